@@ -588,7 +588,7 @@ void GPUDevice::move_textures_to_host(size_t size, const size_t headroom, const
     /* Find suitable memory allocation to move. */
     device_memory *max_mem = nullptr;
     size_t max_size = 0;
-    bool max_is_image = false;
+    int max_priority = -1;
 
     thread_scoped_lock lock(device_mem_map_mutex);
     for (MemMap::value_type &pair : device_mem_map) {
@@ -615,9 +615,11 @@ void GPUDevice::move_textures_to_host(size_t size, const size_t headroom, const
         continue;
       }
 
-      /* Try to move largest allocation, prefer moving images. */
-      if (is_image > max_is_image || (is_image == max_is_image && mem.device_size > max_size)) {
-        max_is_image = is_image;
+      /* Try to move largest allocation, prefer moving images, then memory that is accessed less
+       * often, so that the BVH and geometry stay in device memory as long as possible. */
+      const int priority = is_image ? 2 : (mem.prefer_move_to_host ? 1 : 0);
+      if (priority > max_priority || (priority == max_priority && mem.device_size > max_size)) {
+        max_priority = priority;
         max_size = mem.device_size;
         max_mem = &mem;
       }
@@ -247,6 +247,9 @@ class device_memory {
   /* reference counter for shared_pointer */
   int shared_counter;
   bool move_to_host = false;
+  /* Hint that kernels access this memory less often than other global memory, so that it is
+   * moved to host memory first when device memory runs out. */
+  bool prefer_move_to_host = false;
 
   virtual ~device_memory();
 
@@ -57,6 +57,14 @@ DeviceScene::DeviceScene(Device *device)
       ies_lights(device, "ies", MEM_GLOBAL)
 {
   memset((void *)&data, 0, sizeof(data));
+
+  /* Attributes are read a few times per shading point, while the BVH and geometry are read many
+   * times per ray. When device memory runs out, move the attributes to host memory first. */
+  attributes_float.prefer_move_to_host = true;
+  attributes_float2.prefer_move_to_host = true;
+  attributes_float3.prefer_move_to_host = true;
+  attributes_float4.prefer_move_to_host = true;
+  attributes_uchar4.prefer_move_to_host = true;
 }
 
 CCL_NAMESPACE_END
@@ -8,6 +8,7 @@
 
 #include "util/math_fast.h"
 #include "util/progress.h"
+#include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -545,29 +546,27 @@ bool LightTree::should_split(LightTreeEmitter *emitters,
   const float3 extent = centroid_bbox.size();
   const float max_extent = max4(extent.x, extent.y, extent.z, 0.0f);
 
-  /* Check each dimension to find the minimum splitting cost. */
-  float total_cost = 0.0f;
-  float min_cost = FLT_MAX;
-  for (int dim = 0; dim < 3; dim++) {
-    std::array<LightTreeBucket, LightTreeBucket::num_buckets> buckets;
-    float inv_extent;
-
+  /* Fill in the buckets of each dimension. The dimensions are independent, so for big nodes they
+   * are filled in parallel. This keeps the order in which emitters are added to a bucket, so the
+   * result is the same as filling them one after another. */
+  std::array<std::array<LightTreeBucket, LightTreeBucket::num_buckets>, 3> buckets_by_dim;
+  const auto fill_buckets = [&](const int dim) {
+    std::array<LightTreeBucket, LightTreeBucket::num_buckets> &buckets = buckets_by_dim[dim];
     if (centroid_bbox.size()[dim] == 0.0f) {
       /* If the centroid bounding box is 0 along a given dimension and the node measure is
        * already computed, skip it. */
       if (dim != 0) {
-        continue;
+        return;
       }
 
       /* Degenerate case, everything in the same bucket. */
-      inv_extent = FLT_MAX;
       for (int i = start; i < end; i++) {
         buckets[0].add(emitters[i]);
       }
     }
     else {
       /* Fill in buckets with emitters. */
-      inv_extent = 1 / (centroid_bbox.size()[dim]);
+      const float inv_extent = 1 / (centroid_bbox.size()[dim]);
       for (int i = start; i < end; i++) {
         const LightTreeEmitter *emitter = emitters + i;
 
@@ -580,6 +579,28 @@ bool LightTree::should_split(LightTreeEmitter *emitters,
         buckets[bucket_idx].add(*emitter);
       }
     }
+  };
+  if (num_emitters > MIN_EMITTERS_PER_THREAD) {
+    parallel_for(0, 3, fill_buckets);
+  }
+  else {
+    for (int dim = 0; dim < 3; dim++) {
+      fill_buckets(dim);
+    }
+  }
+
+  /* Check each dimension to find the minimum splitting cost. */
+  float total_cost = 0.0f;
+  float min_cost = FLT_MAX;
+  for (int dim = 0; dim < 3; dim++) {
+    if (centroid_bbox.size()[dim] == 0.0f && dim != 0) {
+      continue;
+    }
+
+    const std::array<LightTreeBucket, LightTreeBucket::num_buckets> &buckets = buckets_by_dim[dim];
+    const float inv_extent = (centroid_bbox.size()[dim] == 0.0f) ?
+                                 FLT_MAX :
+                                 1 / (centroid_bbox.size()[dim]);
 
     /* Precompute the left bucket measure cumulatively. */
     std::array<LightTreeBucket, LightTreeBucket::num_buckets - 1> left_buckets;
@@ -246,6 +246,43 @@ extern void (*MEM_reset_peak_memory)(void);
 /** Get the peak memory usage in bytes, including `mmap` allocations. */
 extern size_t (*MEM_get_peak_memory)(void) ATTR_WARN_UNUSED_RESULT;
 
+/**
+ * Categories used to account memory usage per subsystem. Every allocation is attributed to the
+ * category that is active on the allocating thread (see #MEM_category_set), and the memory is
+ * subtracted from the same category again when it is freed, even if that happens on another
+ * thread.
+ */
+typedef enum eMEMCategory {
+  MEM_CATEGORY_UNKNOWN = 0,
+  /** Evaluated geometry and modifier/geometry nodes evaluation. */
+  MEM_CATEGORY_GEOMETRY,
+  /** Data copied for evaluation by the dependency graph. */
+  MEM_CATEGORY_DEPSGRAPH,
+  /** Image buffers. */
+  MEM_CATEGORY_IMAGE,
+  /** Data prepared on the CPU for uploading to the GPU. */
+  MEM_CATEGORY_GPU,
+  /** Undo steps. */
+  MEM_CATEGORY_UNDO,
+} eMEMCategory;
+#define MEM_CATEGORY_NUM 6
+
+/**
+ * Set the category that is used for allocations on the current thread.
+ * \return The previously active category, to be restored afterwards.
+ */
+eMEMCategory MEM_category_set(eMEMCategory category);
+/** Get the category that is used for allocations on the current thread. */
+eMEMCategory MEM_category_get(void);
+/** Name of the category for printing. */
+const char *MEM_category_name(eMEMCategory category);
+
+/** Memory usage of a single category, see #eMEMCategory. */
+extern size_t (*MEM_get_memory_in_use_by_category)(eMEMCategory category);
+
+/** Print the memory usage of all categories. */
+void MEM_print_memory_categories(void);
+
 /** Overhead for lockfree allocator (use to avoid slop-space). */
 #define MEM_SIZE_OVERHEAD sizeof(size_t)
 #define MEM_SIZE_OPTIMAL(size) ((size)-MEM_SIZE_OVERHEAD)
@@ -590,6 +627,29 @@ template<typename T> inline void MEM_freeN(T *ptr)
 
 /** \} */
 
+/**
+ * Attribute all allocations on the current thread to the given category while the scope exists.
+ * \note Multi-threaded code has to propagate the category to the tasks it spawns,
+ * this is done automatically for `blender::threading::parallel_for`.
+ */
+class MEM_CategoryScope {
+ private:
+  eMEMCategory previous_;
+
+ public:
+  explicit MEM_CategoryScope(const eMEMCategory category) : previous_(MEM_category_set(category))
+  {
+  }
+
+  ~MEM_CategoryScope()
+  {
+    MEM_category_set(previous_);
+  }
+
+  MEM_CategoryScope(const MEM_CategoryScope &other) = delete;
+  MEM_CategoryScope &operator=(const MEM_CategoryScope &other) = delete;
+};
+
 /**
  * Construct a T that will only be destructed after leak detection is run.
  *
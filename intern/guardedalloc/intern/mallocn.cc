@@ -14,6 +14,7 @@
 #include "../../source/blender/blenlib/BLI_strict_flags.h"
 
 #include <cassert>
+#include <cstdio>
 
 #include "mallocn_intern.hh"
 
@@ -71,6 +72,8 @@ size_t (*MEM_get_memory_in_use)(void) = MEM_lockfree_get_memory_in_use;
 uint (*MEM_get_memory_blocks_in_use)(void) = MEM_lockfree_get_memory_blocks_in_use;
 void (*MEM_reset_peak_memory)(void) = MEM_lockfree_reset_peak_memory;
 size_t (*MEM_get_peak_memory)(void) = MEM_lockfree_get_peak_memory;
+size_t (*MEM_get_memory_in_use_by_category)(eMEMCategory category) =
+    MEM_lockfree_get_memory_in_use_by_category;
 
 void (*mem_clearmemlist)(void) = mem_lockfree_clearmemlist;
 
@@ -79,6 +82,36 @@ const char *(*MEM_name_ptr)(void *vmemh) = MEM_lockfree_name_ptr;
 void (*MEM_name_ptr_set)(void *vmemh, const char *str) = MEM_lockfree_name_ptr_set;
 #endif
 
+const char *MEM_category_name(const eMEMCategory category)
+{
+  switch (category) {
+    case MEM_CATEGORY_UNKNOWN:
+      return "Unknown";
+    case MEM_CATEGORY_GEOMETRY:
+      return "Geometry";
+    case MEM_CATEGORY_DEPSGRAPH:
+      return "Depsgraph";
+    case MEM_CATEGORY_IMAGE:
+      return "Image";
+    case MEM_CATEGORY_GPU:
+      return "GPU";
+    case MEM_CATEGORY_UNDO:
+      return "Undo";
+  }
+  return "Unknown";
+}
+
+void MEM_print_memory_categories()
+{
+  printf("\nmemory usage by category:\n");
+  for (int i = 0; i < MEM_CATEGORY_NUM; i++) {
+    const eMEMCategory category = eMEMCategory(i);
+    printf("%12.3f MB  %s\n",
+           double(MEM_get_memory_in_use_by_category(category)) / (1024.0 * 1024.0),
+           MEM_category_name(category));
+  }
+}
+
 void *aligned_malloc(size_t size, size_t alignment)
 {
   /* #posix_memalign requires alignment to be a multiple of `sizeof(void *)`. */
@@ -192,6 +225,7 @@ void MEM_use_lockfree_allocator()
   MEM_get_memory_blocks_in_use = MEM_lockfree_get_memory_blocks_in_use;
   MEM_reset_peak_memory = MEM_lockfree_reset_peak_memory;
   MEM_get_peak_memory = MEM_lockfree_get_peak_memory;
+  MEM_get_memory_in_use_by_category = MEM_lockfree_get_memory_in_use_by_category;
 
   mem_clearmemlist = mem_lockfree_clearmemlist;
 
@@ -228,6 +262,7 @@ void MEM_use_guarded_allocator()
   MEM_get_memory_blocks_in_use = MEM_guarded_get_memory_blocks_in_use;
   MEM_reset_peak_memory = MEM_guarded_reset_peak_memory;
   MEM_get_peak_memory = MEM_guarded_get_peak_memory;
+  MEM_get_memory_in_use_by_category = MEM_guarded_get_memory_in_use_by_category;
 
   mem_clearmemlist = mem_guarded_clearmemlist;
 
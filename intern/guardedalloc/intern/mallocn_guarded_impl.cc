@@ -152,6 +152,10 @@ enum MemHeadFlag {
   MEMHEAD_FLAG_FROM_CPP_NEW = 1 << 1,
 };
 
+/** The high byte of #MemHead::flag stores the #eMEMCategory of the block. */
+#define MEMHEAD_FLAG_CATEGORY_SHIFT 8
+#define MEMHEAD_CATEGORY(memh) eMEMCategory((memh)->flag >> MEMHEAD_FLAG_CATEGORY_SHIFT)
+
 typedef struct MemTail {
   int tag3, pad;
 } MemTail;
@@ -190,6 +194,7 @@ static const char *check_memlist(const MemHead *memh);
 
 static uint totblock = 0;
 static size_t mem_in_use = 0, peak_mem = 0;
+static size_t mem_in_use_by_category[MEM_CATEGORY_NUM] = {0};
 
 static volatile localListBase _membase;
 static volatile localListBase *membase = &_membase;
@@ -502,7 +507,10 @@ static void make_memhead_header(MemHead *memh,
   memh->name = str;
   memh->nextname = nullptr;
   memh->len = len;
-  memh->flag = (allocation_type == AllocationType::NEW_DELETE ? MEMHEAD_FLAG_FROM_CPP_NEW : 0);
+  const eMEMCategory category = MEM_category_get();
+  memh->flag = uint16_t(
+      (allocation_type == AllocationType::NEW_DELETE ? MEMHEAD_FLAG_FROM_CPP_NEW : 0) |
+      (category << MEMHEAD_FLAG_CATEGORY_SHIFT));
   memh->alignment = 0;
   memh->tag2 = MEMTAG2;
 
@@ -519,6 +527,7 @@ static void make_memhead_header(MemHead *memh,
 
   atomic_add_and_fetch_u(&totblock, 1);
   atomic_add_and_fetch_z(&mem_in_use, len);
+  atomic_add_and_fetch_z(&mem_in_use_by_category[category], len);
 
   mem_lock_thread();
   addtail(membase, &memh->next);
@@ -1193,6 +1202,7 @@ static void rem_memblock(MemHead *memh)
 
   atomic_sub_and_fetch_u(&totblock, 1);
   atomic_sub_and_fetch_z(&mem_in_use, memh->len);
+  atomic_sub_and_fetch_z(&mem_in_use_by_category[MEMHEAD_CATEGORY(memh)], memh->len);
 
 #ifdef DEBUG_MEMDUPLINAME
   if (memh->need_free_name) {
@@ -1381,6 +1391,11 @@ size_t MEM_guarded_get_memory_in_use()
   return _mem_in_use;
 }
 
+size_t MEM_guarded_get_memory_in_use_by_category(const eMEMCategory category)
+{
+  return atomic_add_and_fetch_z(&mem_in_use_by_category[category], 0);
+}
+
 uint MEM_guarded_get_memory_blocks_in_use()
 {
   uint _totblock;
@@ -89,8 +89,13 @@ extern bool leak_detector_has_run;
 extern char free_after_leak_detection_message[];
 
 void memory_usage_init(void);
-void memory_usage_block_alloc(size_t size);
-void memory_usage_block_free(size_t size);
+/**
+ * Account for a new memory block.
+ * \return The category the block is attributed to, which has to be passed to
+ * #memory_usage_block_free when the block is freed.
+ */
+eMEMCategory memory_usage_block_alloc(size_t size);
+void memory_usage_block_free(size_t size, eMEMCategory category);
 size_t memory_usage_block_num(void);
 size_t memory_usage_current(void);
 /**
@@ -104,6 +109,7 @@ size_t memory_usage_current(void);
  */
 size_t memory_usage_peak(void);
 void memory_usage_peak_reset(void);
+size_t memory_usage_category_current(eMEMCategory category);
 
 /**
  * Clear the listbase of allocated memory blocks.
@@ -165,6 +171,7 @@ size_t MEM_lockfree_get_memory_in_use(void);
 unsigned int MEM_lockfree_get_memory_blocks_in_use(void);
 void MEM_lockfree_reset_peak_memory(void);
 size_t MEM_lockfree_get_peak_memory(void) ATTR_WARN_UNUSED_RESULT;
+size_t MEM_lockfree_get_memory_in_use_by_category(eMEMCategory category);
 
 void mem_lockfree_clearmemlist(void);
 
@@ -217,6 +224,7 @@ size_t MEM_guarded_get_memory_in_use(void);
 unsigned int MEM_guarded_get_memory_blocks_in_use(void);
 void MEM_guarded_reset_peak_memory(void);
 size_t MEM_guarded_get_peak_memory(void) ATTR_WARN_UNUSED_RESULT;
+size_t MEM_guarded_get_memory_in_use_by_category(eMEMCategory category);
 
 void mem_guarded_clearmemlist(void);
 
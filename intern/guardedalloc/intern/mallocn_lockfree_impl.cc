@@ -56,6 +56,9 @@ static void (*error_callback)(const char *) = nullptr;
 /**
  * Guardedalloc always allocate multiple of 4 bytes. That means that the lower 2 bits of the
  * `len` member of #MemHead/#MemHeadAligned data can be used for the bitflags below.
+ *
+ * The highest byte of `len` stores the #eMEMCategory of the block, allocations are never that
+ * large in practice.
  */
 enum {
   /** This block used aligned allocation, and its 'head' is of #MemHeadAligned type. */
@@ -71,12 +74,19 @@ enum {
   MEMHEAD_FLAG_MASK = (1 << 2) - 1
 };
 
+#define MEMHEAD_CATEGORY_SHIFT 56
+#define MEMHEAD_CATEGORY_MASK (size_t(0xff) << MEMHEAD_CATEGORY_SHIFT)
+
 #define MEMHEAD_FROM_PTR(ptr) (((MemHead *)ptr) - 1)
 #define PTR_FROM_MEMHEAD(memhead) (memhead + 1)
 #define MEMHEAD_ALIGNED_FROM_PTR(ptr) (((MemHeadAligned *)ptr) - 1)
 #define MEMHEAD_IS_ALIGNED(memhead) ((memhead)->len & size_t(MEMHEAD_FLAG_ALIGN))
 #define MEMHEAD_IS_FROM_CPP_NEW(memhead) ((memhead)->len & size_t(MEMHEAD_FLAG_FROM_CPP_NEW))
-#define MEMHEAD_LEN(memhead) ((memhead)->len & ~size_t(MEMHEAD_FLAG_MASK))
+#define MEMHEAD_LEN(memhead) \
+  ((memhead)->len & ~(size_t(MEMHEAD_FLAG_MASK) | MEMHEAD_CATEGORY_MASK))
+#define MEMHEAD_CATEGORY(memhead) \
+  eMEMCategory(((memhead)->len & MEMHEAD_CATEGORY_MASK) >> MEMHEAD_CATEGORY_SHIFT)
+#define MEMHEAD_CATEGORY_BITS(category) (size_t(category) << MEMHEAD_CATEGORY_SHIFT)
 
 #ifdef __GNUC__
 __attribute__((format(printf, 1, 0)))
@@ -164,7 +174,7 @@ void MEM_lockfree_freeN(void *vmemh, AllocationType allocation_type)
         "Attempt to use C-style MEM_freeN on a pointer created with CPP-style MEM_new or new\n");
   }
 
-  memory_usage_block_free(len);
+  memory_usage_block_free(len, MEMHEAD_CATEGORY(memh));
 
   if (UNLIKELY(malloc_debug_memset && len)) {
     memset(memh + 1, 255, len);
@@ -304,8 +314,8 @@ void *MEM_lockfree_callocN(size_t len, const char *str)
   memh = (MemHead *)calloc(1, len + sizeof(MemHead));
 
   if (LIKELY(memh)) {
-    memh->len = len;
-    memory_usage_block_alloc(len);
+    const eMEMCategory category = memory_usage_block_alloc(len);
+    memh->len = len | MEMHEAD_CATEGORY_BITS(category);
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -361,8 +371,8 @@ void *MEM_lockfree_mallocN(size_t len, const char *str)
 #endif /* WITH_MEM_VALGRIND */
     }
 
-    memh->len = len;
-    memory_usage_block_alloc(len);
+    const eMEMCategory category = memory_usage_block_alloc(len);
+    memh->len = len | MEMHEAD_CATEGORY_BITS(category);
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -445,11 +455,12 @@ void *MEM_lockfree_mallocN_aligned(size_t len,
 #endif /* WITH_MEM_VALGRIND */
     }
 
+    const eMEMCategory category = memory_usage_block_alloc(len);
     memh->len = len | size_t(MEMHEAD_FLAG_ALIGN) |
                 size_t(allocation_type == AllocationType::NEW_DELETE ? MEMHEAD_FLAG_FROM_CPP_NEW :
-                                                                       0);
+                                                                       0) |
+                MEMHEAD_CATEGORY_BITS(category);
     memh->alignment = short(alignment);
-    memory_usage_block_alloc(len);
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -577,6 +588,11 @@ size_t MEM_lockfree_get_peak_memory()
   return memory_usage_peak();
 }
 
+size_t MEM_lockfree_get_memory_in_use_by_category(const eMEMCategory category)
+{
+  return memory_usage_category_current(category);
+}
+
 #ifndef NDEBUG
 const char *MEM_lockfree_name_ptr(void *vmemh)
 {
@@ -54,6 +54,16 @@ struct alignas(128) Local {
    * accurate, but it's still good enough for practical purposes.
    */
   std::atomic<int64_t> mem_in_use_during_peak_update = 0;
+  /**
+   * Number of bytes per #eMEMCategory. Can be negative and is atomic for the same reason as
+   * #mem_in_use.
+   */
+  std::atomic<int64_t> mem_in_use_by_category[MEM_CATEGORY_NUM] = {};
+  /**
+   * Category that new allocations on this thread are attributed to. Only accessed by the thread
+   * itself.
+   */
+  eMEMCategory category = MEM_CATEGORY_UNKNOWN;
 
   Local();
   ~Local();
@@ -90,6 +100,10 @@ struct Global {
    * Number of blocks that are not tracked by #Local, for the same reason as above.
    */
   std::atomic<int64_t> blocks_num_outside_locals = 0;
+  /**
+   * Number of bytes per category that are not tracked by #Local, for the same reason as above.
+   */
+  std::atomic<int64_t> mem_in_use_by_category_outside_locals[MEM_CATEGORY_NUM] = {};
   /**
    * Peak memory usage since the last reset.
    */
@@ -152,6 +166,10 @@ Local::~Local()
   /* Don't forget the memory counts stored locally. */
   this->global->blocks_num_outside_locals.fetch_add(this->blocks_num, std::memory_order_relaxed);
   this->global->mem_in_use_outside_locals.fetch_add(this->mem_in_use, std::memory_order_relaxed);
+  for (int i = 0; i < MEM_CATEGORY_NUM; i++) {
+    this->global->mem_in_use_by_category_outside_locals[i].fetch_add(
+        this->mem_in_use_by_category[i], std::memory_order_relaxed);
+  }
 
   if (this->is_main) {
     /* The main thread started shutting down. Use global counters from now on to avoid accessing
@@ -185,31 +203,35 @@ void memory_usage_init()
   get_local_data();
 }
 
-void memory_usage_block_alloc(const size_t size)
+eMEMCategory memory_usage_block_alloc(const size_t size)
 {
   if (LIKELY(use_local_counters.load(std::memory_order_relaxed))) {
     Local &local = get_local_data();
+    const eMEMCategory category = local.category;
     /* Increase local memory counts. This does not cause thread synchronization in the majority of
      * cases, because each thread has these counters on a separate cache line. It may only cause
      * synchronization if another thread is computing the total current memory usage at the same
      * time, which is very rare compared to doing allocations. */
     local.blocks_num.fetch_add(1, std::memory_order_relaxed);
     local.mem_in_use.fetch_add(int64_t(size), std::memory_order_relaxed);
+    local.mem_in_use_by_category[category].fetch_add(int64_t(size), std::memory_order_relaxed);
 
     /* If a certain amount of new memory has been allocated, update the peak. */
     if (local.mem_in_use - local.mem_in_use_during_peak_update > peak_update_threshold) {
       update_global_peak();
     }
+    return category;
   }
-  else {
-    Global &global = get_global();
-    /* Increase global memory counts. */
-    global.blocks_num_outside_locals.fetch_add(1, std::memory_order_relaxed);
-    global.mem_in_use_outside_locals.fetch_add(int64_t(size), std::memory_order_relaxed);
-  }
+  Global &global = get_global();
+  /* Increase global memory counts. */
+  global.blocks_num_outside_locals.fetch_add(1, std::memory_order_relaxed);
+  global.mem_in_use_outside_locals.fetch_add(int64_t(size), std::memory_order_relaxed);
+  global.mem_in_use_by_category_outside_locals[MEM_CATEGORY_UNKNOWN].fetch_add(
+      int64_t(size), std::memory_order_relaxed);
+  return MEM_CATEGORY_UNKNOWN;
 }
 
-void memory_usage_block_free(const size_t size)
+void memory_usage_block_free(const size_t size, const eMEMCategory category)
 {
   if (LIKELY(use_local_counters)) {
     /* Decrease local memory counts. See comment in #memory_usage_block_alloc for details regarding
@@ -217,12 +239,15 @@ void memory_usage_block_free(const size_t size)
     Local &local = get_local_data();
     local.mem_in_use.fetch_sub(int64_t(size), std::memory_order_relaxed);
     local.blocks_num.fetch_sub(1, std::memory_order_relaxed);
+    local.mem_in_use_by_category[category].fetch_sub(int64_t(size), std::memory_order_relaxed);
   }
   else {
     Global &global = get_global();
     /* Decrease global memory counts. */
     global.blocks_num_outside_locals.fetch_sub(1, std::memory_order_relaxed);
     global.mem_in_use_outside_locals.fetch_sub(int64_t(size), std::memory_order_relaxed);
+    global.mem_in_use_by_category_outside_locals[category].fetch_sub(int64_t(size),
+                                                                      std::memory_order_relaxed);
   }
 }
 
@@ -252,6 +277,38 @@ size_t memory_usage_current()
   return size_t(mem_in_use);
 }
 
+size_t memory_usage_category_current(const eMEMCategory category)
+{
+  Global &global = get_global();
+  std::lock_guard lock{global.locals_mutex};
+
+  int64_t mem_in_use = global.mem_in_use_by_category_outside_locals[category];
+  for (const Local *local : global.locals) {
+    mem_in_use += local->mem_in_use_by_category[category];
+  }
+  /* Can be slightly negative when memory allocated before the counters were set up is freed. */
+  return size_t(std::max<int64_t>(mem_in_use, 0));
+}
+
+eMEMCategory MEM_category_set(const eMEMCategory category)
+{
+  if (UNLIKELY(!use_local_counters.load(std::memory_order_relaxed))) {
+    return MEM_CATEGORY_UNKNOWN;
+  }
+  Local &local = get_local_data();
+  const eMEMCategory previous = local.category;
+  local.category = category;
+  return previous;
+}
+
+eMEMCategory MEM_category_get()
+{
+  if (UNLIKELY(!use_local_counters.load(std::memory_order_relaxed))) {
+    return MEM_CATEGORY_UNKNOWN;
+  }
+  return get_local_data().category;
+}
+
 size_t memory_usage_peak()
 {
   update_global_peak();
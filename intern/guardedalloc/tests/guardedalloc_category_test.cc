@@ -0,0 +1,57 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <thread>
+
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+#include "guardedalloc_test_base.h"
+
+namespace {
+
+void DoBasicCategoryChecks()
+{
+  const size_t undo_before = MEM_get_memory_in_use_by_category(MEM_CATEGORY_UNDO);
+  const size_t image_before = MEM_get_memory_in_use_by_category(MEM_CATEGORY_IMAGE);
+
+  void *undo_data;
+  void *image_data;
+  {
+    MEM_CategoryScope scope(MEM_CATEGORY_UNDO);
+    EXPECT_EQ(MEM_category_get(), MEM_CATEGORY_UNDO);
+    undo_data = MEM_mallocN(1024, "test");
+    {
+      MEM_CategoryScope inner_scope(MEM_CATEGORY_IMAGE);
+      image_data = MEM_mallocN_aligned(4096, 64, "test");
+    }
+    EXPECT_EQ(MEM_category_get(), MEM_CATEGORY_UNDO);
+  }
+  EXPECT_EQ(MEM_category_get(), MEM_CATEGORY_UNKNOWN);
+
+  EXPECT_EQ(MEM_get_memory_in_use_by_category(MEM_CATEGORY_UNDO), undo_before + 1024);
+  EXPECT_EQ(MEM_get_memory_in_use_by_category(MEM_CATEGORY_IMAGE), image_before + 4096);
+  EXPECT_EQ(MEM_allocN_len(undo_data), 1024);
+  EXPECT_EQ(MEM_allocN_len(image_data), 4096);
+
+  /* Memory is subtracted from the original category, even when freed on another thread. */
+  std::thread thread([&]() { MEM_freeN(undo_data); });
+  thread.join();
+  MEM_freeN(image_data);
+
+  EXPECT_EQ(MEM_get_memory_in_use_by_category(MEM_CATEGORY_UNDO), undo_before);
+  EXPECT_EQ(MEM_get_memory_in_use_by_category(MEM_CATEGORY_IMAGE), image_before);
+}
+
+}  // namespace
+
+TEST_F(LockFreeAllocatorTest, MEM_category)
+{
+  DoBasicCategoryChecks();
+}
+
+TEST_F(GuardedAllocatorTest, MEM_category)
+{
+  DoBasicCategoryChecks();
+}
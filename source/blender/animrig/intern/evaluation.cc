@@ -151,6 +151,7 @@ static EvaluationResult evaluate_keyframe_data(PointerRNA &animated_id_ptr,
   }
 
   EvaluationResult evaluation_result;
+  AnimsysRNAPathCache path_cache;
   for (FCurve *fcu : channelbag_for_slot->fcurves()) {
     /* Blatant copy of animsys_evaluate_fcurves(). */
 
@@ -159,8 +160,8 @@ static EvaluationResult evaluate_keyframe_data(PointerRNA &animated_id_ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (!BKE_animsys_rna_path_resolve(
-            &animated_id_ptr, fcu->rna_path, fcu->array_index, &anim_rna))
+    if (!BKE_animsys_rna_path_resolve_cached(
+            &animated_id_ptr, fcu->rna_path, fcu->array_index, path_cache, &anim_rna))
     {
       /* Log this at quite a high level, because it can get _very_ noisy when playing back
        * animation. */
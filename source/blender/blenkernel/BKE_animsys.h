@@ -12,6 +12,8 @@
 #include "BLI_span.hh"
 #include "BLI_sys_types.h" /* for bool */
 
+#include "RNA_types.hh"
+
 struct AnimData;
 struct BlendDataReader;
 struct BlendWriter;
@@ -287,6 +289,37 @@ bool BKE_animsys_rna_path_resolve(struct PointerRNA *ptr,
                                   const char *rna_path,
                                   int array_index,
                                   struct PathResolvedRNA *r_result);
+
+/**
+ * The last path resolved by #BKE_animsys_rna_path_resolve_cached. F-Curves animating the
+ * elements of the same array property (e.g. `location[0]` to `location[2]`) are usually stored
+ * next to each other, so remembering a single path already avoids most of the repeated
+ * parsing and lookups when evaluating them in order.
+ *
+ * Only valid for a single loop over F-Curves of the same data-block, since it stores resolved
+ * pointers into that data-block.
+ */
+struct AnimsysRNAPathCache {
+  /** Data of the pointer the path was resolved from. */
+  const void *owner_data = nullptr;
+  /** Points to the path string of the F-Curve that was resolved last, not a copy. */
+  const char *rna_path = nullptr;
+  /** False when the path could not be resolved or the property is not animatable. */
+  bool is_valid = false;
+  PointerRNA ptr = {};
+  PropertyRNA *prop = nullptr;
+  int array_len = 0;
+};
+
+/**
+ * Same as #BKE_animsys_rna_path_resolve, but reuses the result of the previous call when the
+ * path is the same.
+ */
+bool BKE_animsys_rna_path_resolve_cached(struct PointerRNA *ptr,
+                                         const char *rna_path,
+                                         int array_index,
+                                         AnimsysRNAPathCache &cache,
+                                         struct PathResolvedRNA *r_result);
 bool BKE_animsys_read_from_rna_path(struct PathResolvedRNA *anim_rna, float *r_value);
 /**
  * Write the given value to a setting using RNA, and return success.
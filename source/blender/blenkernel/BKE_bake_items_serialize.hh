@@ -23,7 +23,19 @@ namespace blender::bke::bake {
  */
 struct BlobSlice {
   std::string name;
+  /** Range of the stored bytes in the blob. */
   IndexRange range;
+  /**
+   * Set when the stored bytes are compressed with zstd. Each slice is compressed independently,
+   * so that it can still be read without reading the rest of the blob.
+   */
+  std::optional<int64_t> decompressed_size;
+
+  /** Size of the data that is read from the slice. */
+  int64_t data_size() const
+  {
+    return decompressed_size.value_or(range.size());
+  }
 
   std::shared_ptr<io::serialize::DictionaryValue> serialize() const;
   static std::optional<BlobSlice> deserialize(const io::serialize::DictionaryValue &io_slice);
@@ -191,9 +203,11 @@ class DiskBlobWriter : public BlobWriter {
   int64_t current_offset_ = 0;
   /** Used to generate file names for bake data that is stored in independent files. */
   int independent_file_count_ = 0;
+  /** Compress larger slices to reduce the size of the bake on disk. */
+  bool use_compression_ = false;
 
  public:
-  DiskBlobWriter(std::string blob_dir, std::string base_name);
+  DiskBlobWriter(std::string blob_dir, std::string base_name, bool use_compression = false);
 
   BlobSlice write(const void *data, int64_t size) override;
 
@@ -440,6 +440,11 @@ class CurvesGeometry : public ::CurvesGeometry {
 
   /** Call after deforming the position attribute. */
   void tag_positions_changed();
+  /**
+   * Call after deforming the positions of only some curves. Cached evaluated positions are kept
+   * for the other curves, so only the changed curves are evaluated again.
+   */
+  void tag_positions_changed(const IndexMask &changed_curves);
   /**
    * Call after any operation that changes the topology
    * (number of points, evaluated points, or the total count).
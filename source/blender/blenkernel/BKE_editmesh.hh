@@ -13,10 +13,13 @@
  */
 
 #include <array>
+#include <memory>
 
 #include "BLI_array.hh"
 #include "BLI_math_vector_types.hh"
 
+#include "BKE_editmesh_cache.hh"
+
 #include "bmesh.hh"
 
 struct BMLoop;
@@ -62,6 +65,10 @@ struct BMEditMesh {
    * Set #Main.is_memfile_undo_flush_needed when enabling.
    */
   char needs_flush_to_id;
+
+  /** Conversion to a #Mesh for evaluation that can be reused, never null. */
+  std::shared_ptr<blender::bke::EditMeshEvalCache> eval_cache =
+      std::make_shared<blender::bke::EditMeshEvalCache>();
 };
 
 /* editmesh.cc */
@@ -106,6 +113,15 @@ bool BKE_editmesh_eval_orig_map_available(const Mesh &mesh_eval, const Mesh *mes
  */
 void BKE_editmesh_free_data(BMEditMesh *em);
 
+/**
+ * Tag that only vertex positions of the edit mesh changed since the last update, so the next
+ * conversion to a #Mesh for evaluation can reuse the previous one and only update the positions.
+ * The caller must call #BKE_editmesh_eval_cache_clear before making any other change.
+ */
+void BKE_editmesh_eval_cache_tag_positions_changed(BMEditMesh *em);
+/** Free the conversion of the edit mesh for evaluation, after changing more than positions. */
+void BKE_editmesh_eval_cache_clear(BMEditMesh *em);
+
 blender::Array<blender::float3> BKE_editmesh_vert_coords_alloc(Depsgraph *depsgraph,
                                                                BMEditMesh *em,
                                                                Scene *scene,
@@ -13,8 +13,12 @@
 #include "BLI_array.hh"
 #include "BLI_bounds_types.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_mutex.hh"
+
+#include "DNA_customdata_types.h"
 
 struct BMEditMesh;
+struct Mesh;
 
 namespace blender::bke {
 
@@ -42,6 +46,25 @@ struct EditMeshData {
   Array<float3> face_centers;
 };
 
+/**
+ * The last mesh converted from an edit mesh for evaluation, which can be reused while only vertex
+ * positions change, instead of converting all elements and attributes again.
+ */
+struct EditMeshEvalCache {
+  Mutex mutex;
+  /** Copy of the converted mesh, sharing its data. Null when there is nothing to reuse. */
+  Mesh *mesh = nullptr;
+  /** The extra custom data masks used to convert #mesh. */
+  CustomData_MeshMasks cd_mask_extra = {};
+  /**
+   * Only vertex positions of the #BMesh changed since #mesh was converted. Also set while vertices
+   * are being moved, which is the only time #mesh is stored.
+   */
+  bool only_positions_changed = false;
+
+  ~EditMeshEvalCache();
+};
+
 }  // namespace blender::bke
 
 blender::Span<blender::float3> BKE_editmesh_cache_ensure_face_normals(
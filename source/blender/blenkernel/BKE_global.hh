@@ -272,6 +272,7 @@ enum {
 
   G_DEBUG_GHOST = (1 << 24),  /* Debug GHOST module. */
   G_DEBUG_WINTAB = (1 << 25), /* Debug Wintab. */
+  G_DEBUG_MEMORY = (1 << 26), /* Print memory usage by category (`--debug-memory`). */
 };
 
 #define G_DEBUG_ALL \
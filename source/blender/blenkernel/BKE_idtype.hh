@@ -67,6 +67,15 @@ enum {
    * IDs have at least an 'extra user' (#ID_TAG_EXTRAUSER).
    */
   IDTYPE_FLAGS_NEVER_UNUSED = 1 << 6,
+  /**
+   * Indicates that the `blend_write` callback of the given IDType only modifies its own data (or
+   * the temporary copy of the ID it is given), so that several IDs of this type can be written to
+   * a .blend file from different threads at the same time.
+   *
+   * Only set this when the callback (including the callbacks it calls for sub-data, like modifiers
+   * or constraints) is known to never write to data shared with other IDs or to global state.
+   */
+  IDTYPE_FLAGS_BLEND_WRITE_THREADSAFE = 1 << 7,
 };
 
 struct IDCacheKey {
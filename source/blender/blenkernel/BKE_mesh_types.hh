@@ -15,6 +15,7 @@
 #include "BLI_bit_vector.hh"
 #include "BLI_bounds_types.hh"
 #include "BLI_implicit_sharing.hh"
+#include "BLI_implicit_sharing_ptr.hh"
 #include "BLI_kdopbvh.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_mutex.hh"
@@ -75,6 +76,26 @@ enum class MeshNormalDomain : int8_t {
   Corner = 2,
 };
 
+/**
+ * Keeps the BVH tree of the corner triangles of a mesh whose positions change while its topology
+ * stays the same, like a mesh deformed by an armature. It's shared by all copies of a mesh, so
+ * that meshes evaluated from the same original mesh again can refit the tree instead of building
+ * a new one.
+ */
+struct BVHRefitSource {
+  Mutex mutex;
+  /** The corner vertices that the tree was last built for. */
+  WeakImplicitSharingPtr topology;
+  int64_t topology_version = 0;
+  /**
+   * Only stored once a tree has been built more than once for the same topology, so that meshes
+   * that don't deform don't keep a second tree around.
+   */
+  std::unique_ptr<BVHTree, BVHTreeDeleter> tree;
+  /** #BLI_bvhtree_get_area_cost of the tree before it was refit. */
+  float area_cost = 0.0f;
+};
+
 struct LooseGeomCache {
   /**
    * A bitmap set to true for each "loose" element.
@@ -204,6 +225,9 @@ struct MeshRuntime {
   SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_loose_verts_no_hidden;
   SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_loose_edges;
   SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_loose_edges_no_hidden;
+  /** Used to build #bvh_cache_corner_tris after the positions changed. */
+  std::shared_ptr<BVHRefitSource> bvh_corner_tris_refit_source =
+      std::make_shared<BVHRefitSource>();
 
   SharedCache<std::optional<int>> max_material_index;
   SharedCache<VectorSet<int>> used_material_indices;
@@ -294,6 +318,13 @@ struct MeshRuntime {
   /** Stores weak references to material data blocks. */
   std::unique_ptr<bake::BakeMaterialsList> bake_materials;
 
+  /**
+   * Results of modifiers that got an unmodified copy of this evaluated mesh as input. Objects that
+   * use the mesh with identical modifiers can reuse them. Storing them here makes sure that they
+   * are freed together with the evaluated mesh. The actual type is only known by the modifier.
+   */
+  ImplicitSharingPtr<> shared_modifier_results;
+
   MeshRuntime();
   ~MeshRuntime();
 };
@@ -9,6 +9,7 @@
  */
 
 #include "BKE_subsurf.hh"
+#include "BLI_index_mask_fwd.hh"
 #include "BLI_math_matrix_types.hh"
 #include "BLI_utildefines.h"
 
@@ -100,7 +101,11 @@ void multiresModifier_sync_levels_ex(Object *ob_dst,
                                      const MultiresModifierData *mmd_src,
                                      MultiresModifierData *mmd_dst);
 
-void multires_stitch_grids(Object *);
+/**
+ * Average the grid boundaries of the given faces of the sculpt session's #SubdivCCG with the
+ * grids of neighboring faces.
+ */
+void multires_stitch_grids(Object *ob, const blender::IndexMask &face_mask);
 
 void multiresModifier_scale_disp(Depsgraph *depsgraph, Scene *scene, Object *ob);
 void multiresModifier_prepare_join(Depsgraph *depsgraph, Scene *scene, Object *ob, Object *to_ob);
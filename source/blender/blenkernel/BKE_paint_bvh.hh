@@ -118,30 +118,12 @@ class Node : NonCopyable {
 ENUM_OPERATORS(Node::Flags, Node::Flags::TopologyUpdated);
 
 struct MeshNode : public Node {
-  /**
-   * Use a 16 bit integer for the slot index type because there will always be less than
-   * #leaf_limit vertices in a node.
-   */
-  using LocalVertMapIndexT = int16_t;
-  /**
-   * Global vertices are mapped to local indices with a vector set, with a specialized type in
-   * order to use 32 bit integers for slot values. .
-   */
-  using LocalVertMap = VectorSet<int,
-                                 0,
-                                 DefaultProbingStrategy,
-                                 DefaultHash<int>,
-                                 DefaultEquality<int>,
-                                 SimpleVectorSetSlot<int, LocalVertMapIndexT>,
-                                 GuardedAllocator>;
-
   /** Indices into the #Mesh::faces() array. Refers to a subset of Tree::prim_indices_. */
   Span<int> face_indices_;
 
   /**
    * Array of indices into the mesh's vertex array. Contains the indices of all vertices used by
-   * faces that are within this node's bounding box. Also contains a mapping from global vertex
-   * index to indices within only the node.
+   * faces that are within this node's bounding box.
    *
    * Vertices might be used by a multiple faces, and these faces might be in different leaf nodes.
    * Such vertices will appear in the vertex indices array of each of those leaf nodes.
@@ -151,11 +133,13 @@ struct MeshNode : public Node {
    * "unique" vertex indices. These vertices might not be truly unique to this node, but if they
    * appear in another node's vertex indices, they will not be in the first "unique" section.
    *
-   * Used for leaf nodes. Accessed with #verts() and #all_verts().
+   * Both parts of the array are sorted, so that global vertex indices can be mapped to indices
+   * within the node with a binary search. That avoids storing a hash table per node, which would
+   * use a multiple of the memory of the indices themselves on very high resolution meshes.
    *
-   * \todo Find a way to disable the #VectorSet inline buffer.
+   * Used for leaf nodes. Accessed with #verts() and #all_verts().
    */
-  LocalVertMap vert_indices_;
+  Array<int, 0> vert_indices_;
   /** The number of vertices in #vert_indices not shared with (owned by) another node. */
   int unique_verts_num_ = 0;
   /**
@@ -289,6 +273,9 @@ class Tree {
    */
   void tag_positions_changed(const IndexMask &node_mask);
 
+  /** Nodes tagged with #tag_positions_changed since their bounds were last updated. */
+  IndexMask nodes_with_changed_positions(IndexMaskMemory &memory) const;
+
   /** Tag nodes where face or vertex visibility has changed. */
   void tag_visibility_changed(const IndexMask &node_mask);
 
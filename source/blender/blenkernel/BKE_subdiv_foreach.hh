@@ -104,10 +104,9 @@ struct ForeachContext {
    */
   ForeachVertexFromCornerCb vertex_every_corner;
   ForeachVertexFromEdgeCb vertex_every_edge;
-  /* Those callbacks are run once per subdivision vertex, ptex is undefined
-   * as in it will be whatever first ptex face happened to be traversed in
-   * the multi-threaded environment and which shares "emitting" vertex or
-   * edge.
+  /* Those callbacks are run once per subdivision vertex, from multiple threads.
+   * The ptex is the one of the first coarse face which shares "emitting" vertex
+   * or edge.
    */
   ForeachVertexFromCornerCb vertex_corner;
   ForeachVertexFromEdgeCb vertex_edge;
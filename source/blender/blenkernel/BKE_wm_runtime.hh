@@ -40,6 +40,15 @@ struct WindowManagerRuntime {
   /** The current notifier in the `notifier_queue` being handled (clear instead of freeing). */
   const wmNotifier *notifier_current = nullptr;
 
+  /**
+   * Set when data may have changed since the last auto-save, see #WM_file_tag_modified.
+   * Together with #autosave_undo_step this allows skipping auto-saves that would write the same
+   * data again, which is expensive for large files.
+   */
+  bool autosave_is_outdated = true;
+  /** The active undo step when the last auto-save was written (only used for comparison). */
+  const void *autosave_undo_step = nullptr;
+
   WindowManagerRuntime();
   ~WindowManagerRuntime();
 };
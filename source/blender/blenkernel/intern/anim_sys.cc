@@ -347,6 +347,28 @@ static bool is_fcurve_evaluatable(const FCurve *fcu)
   return true;
 }
 
+static bool animsys_rna_path_check_array_index(const PointerRNA *ptr,
+                                               const char *path,
+                                               const int array_index,
+                                               const int array_len,
+                                               PathResolvedRNA *r_result)
+{
+  if (array_len && array_index >= array_len) {
+    if (G.debug & G_DEBUG) {
+      CLOG_WARN(&LOG_ANIM_FCURVE,
+                "Invalid array index. ID = '%s',  '%s[%d]', array length is %d",
+                (ptr->owner_id) ? (ptr->owner_id->name + 2) : "<No ID>",
+                path,
+                array_index,
+                array_len - 1);
+    }
+    return false;
+  }
+
+  r_result->prop_index = array_len ? array_index : -1;
+  return true;
+}
+
 bool BKE_animsys_rna_path_resolve(
     PointerRNA *ptr, /* typically 'fcu->rna_path', 'fcu->array_index' */
     const char *rna_path,
@@ -376,21 +398,41 @@ bool BKE_animsys_rna_path_resolve(
     return false;
   }
 
-  int array_len = RNA_property_array_length(&r_result->ptr, r_result->prop);
-  if (array_len && array_index >= array_len) {
-    if (G.debug & G_DEBUG) {
-      CLOG_WARN(&LOG_ANIM_FCURVE,
-                "Invalid array index. ID = '%s',  '%s[%d]', array length is %d",
-                (ptr->owner_id) ? (ptr->owner_id->name + 2) : "<No ID>",
-                path,
-                array_index,
-                array_len - 1);
+  const int array_len = RNA_property_array_length(&r_result->ptr, r_result->prop);
+  return animsys_rna_path_check_array_index(ptr, path, array_index, array_len, r_result);
+}
+
+bool BKE_animsys_rna_path_resolve_cached(PointerRNA *ptr,
+                                         const char *rna_path,
+                                         const int array_index,
+                                         AnimsysRNAPathCache &cache,
+                                         PathResolvedRNA *r_result)
+{
+  if (rna_path == nullptr) {
+    return false;
+  }
+
+  if (cache.rna_path == nullptr || cache.owner_data != ptr->data ||
+      !STREQ(cache.rna_path, rna_path))
+  {
+    cache.owner_data = ptr->data;
+    cache.rna_path = rna_path;
+    cache.is_valid = BKE_animsys_rna_path_resolve(ptr, rna_path, -1, r_result);
+    if (!cache.is_valid) {
+      return false;
     }
+    cache.ptr = r_result->ptr;
+    cache.prop = r_result->prop;
+    cache.array_len = RNA_property_array_length(&cache.ptr, cache.prop);
+  }
+  else if (!cache.is_valid) {
     return false;
   }
 
-  r_result->prop_index = array_len ? array_index : -1;
-  return true;
+  r_result->ptr = cache.ptr;
+  r_result->prop = cache.prop;
+  return animsys_rna_path_check_array_index(
+      ptr, rna_path, array_index, cache.array_len, r_result);
 }
 
 /* less than 1.0 evaluates to false, use epsilon to avoid float error */
@@ -549,10 +591,15 @@ static bool animsys_construct_orig_pointer_rna(const PointerRNA *ptr, PointerRNA
   return true;
 }
 
+/**
+ * \param orig_cache: Optional cache for the paths resolved on the original data-block, for
+ * callers that write many F-Curves of the same data-block in order.
+ */
 static void animsys_write_orig_anim_rna(PointerRNA *ptr,
                                         const char *rna_path,
                                         int array_index,
-                                        float value)
+                                        float value,
+                                        AnimsysRNAPathCache *orig_cache = nullptr)
 {
   PointerRNA ptr_orig;
   if (!animsys_construct_orig_pointer_rna(ptr, &ptr_orig)) {
@@ -560,7 +607,14 @@ static void animsys_write_orig_anim_rna(PointerRNA *ptr,
   }
   PathResolvedRNA orig_anim_rna;
   /* TODO(sergey): Should be possible to cache resolved path in dependency graph somehow. */
-  if (BKE_animsys_rna_path_resolve(&ptr_orig, rna_path, array_index, &orig_anim_rna)) {
+  const bool resolved = orig_cache ? BKE_animsys_rna_path_resolve_cached(&ptr_orig,
+                                                                         rna_path,
+                                                                         array_index,
+                                                                         *orig_cache,
+                                                                         &orig_anim_rna) :
+                                     BKE_animsys_rna_path_resolve(
+                                         &ptr_orig, rna_path, array_index, &orig_anim_rna);
+  if (resolved) {
     BKE_animsys_write_to_rna_path(&orig_anim_rna, value);
   }
 }
@@ -575,6 +629,9 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      const AnimationEvalContext *anim_eval_context,
                                      bool flush_to_original)
 {
+  AnimsysRNAPathCache path_cache;
+  AnimsysRNAPathCache orig_path_cache;
+
   /* Calculate then execute each curve. */
   for (FCurve *fcu : fcurves) {
 
@@ -583,11 +640,14 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+    if (BKE_animsys_rna_path_resolve_cached(
+            ptr, fcu->rna_path, fcu->array_index, path_cache, &anim_rna))
+    {
       const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
       BKE_animsys_write_to_rna_path(&anim_rna, curval);
       if (flush_to_original) {
-        animsys_write_orig_anim_rna(ptr, fcu->rna_path, fcu->array_index, curval);
+        animsys_write_orig_anim_rna(
+            ptr, fcu->rna_path, fcu->array_index, curval, &orig_path_cache);
       }
     }
   }
@@ -245,17 +245,16 @@ static float dist_bone_deform(const bPoseChannel &pchan, const float3 &co, Mixer
 /* Add bone deformation based on vertex group weight. */
 template<typename MixerT>
 static float pchan_bone_deform(const bPoseChannel &pchan,
+                               const bool use_bbone,
                                const float weight,
                                const float3 &co,
                                MixerT &mixer)
 {
-  const Bone *bone = pchan.bone;
-
   if (!weight) {
     return 0.0f;
   }
 
-  if (bone->segments > 1 && pchan.runtime.bbone_segments == bone->segments) {
+  if (use_bbone) {
     b_bone_deform(pchan, co, weight, mixer);
   }
   else {
@@ -277,6 +276,18 @@ static float pchan_bone_deform(const bPoseChannel &pchan,
 
 namespace blender::bke {
 
+/**
+ * Deform settings of the pose channel of a vertex group. These are looked up once per evaluation
+ * instead of for every weight of every vertex, to avoid reading the bones in the inner loop.
+ */
+struct VertexGroupBone {
+  const bPoseChannel *pchan = nullptr;
+  /** The pose channel has up-to-date B-Bone segments to deform with. */
+  bool use_bbone = false;
+  /** The vertex group weight is multiplied with the envelope weight (#BONE_MULT_VG_ENV). */
+  bool use_envelope_multiply = false;
+};
+
 struct ArmatureDeformParams {
   MutableSpan<float3> vert_coords;
   std::optional<MutableSpan<float3x3>> vert_deform_mats;
@@ -293,7 +304,7 @@ struct ArmatureDeformParams {
   /* Maps vertex group index (def_nr) to pose channels, if vertex groups are used.
    * Vertex groups used for deform can be different from the target object vertex groups list,
    * the def_nr needs to be mapped to the correct pose channel first. */
-  Array<bPoseChannel *> pose_channel_by_vertex_group;
+  Array<VertexGroupBone> bone_by_vertex_group;
 
   float4x4 target_to_armature;
   float4x4 armature_to_target;
@@ -323,19 +334,23 @@ static ArmatureDeformParams get_armature_deform_params(
   deform_params.use_dverts = try_use_dverts && dverts_supported && (deformflag & ARM_DEF_VGROUP);
   if (deform_params.use_dverts) {
     const int defbase_len = BLI_listbase_count(defbase);
-    deform_params.pose_channel_by_vertex_group.reinitialize(defbase_len);
+    deform_params.bone_by_vertex_group.reinitialize(defbase_len);
     /* TODO(sergey): Some considerations here:
      *
      * - Check whether keeping this consistent across frames gives speedup.
      */
     int i;
     LISTBASE_FOREACH_INDEX (bDeformGroup *, dg, defbase, i) {
-      bPoseChannel *pchan = BKE_pose_channel_find_name(ob_arm.pose, dg->name);
+      const bPoseChannel *pchan = BKE_pose_channel_find_name(ob_arm.pose, dg->name);
+      VertexGroupBone &group_bone = deform_params.bone_by_vertex_group[i];
       /* Exclude non-deforming bones. */
-      deform_params.pose_channel_by_vertex_group[i] = (pchan &&
-                                                       !(pchan->bone->flag & BONE_NO_DEFORM)) ?
-                                                          pchan :
-                                                          nullptr;
+      if (pchan == nullptr || (pchan->bone->flag & BONE_NO_DEFORM)) {
+        continue;
+      }
+      const Bone &bone = *pchan->bone;
+      group_bone.pchan = pchan;
+      group_bone.use_bbone = bone.segments > 1 && pchan->runtime.bbone_segments == bone.segments;
+      group_bone.use_envelope_multiply = bone.flag & BONE_MULT_VG_ENV;
     }
   }
 
@@ -397,21 +412,22 @@ static void armature_vert_task_with_mixer(const ArmatureDeformParams &params,
   /* Apply vertex group deformation if enabled. */
   if (params.use_dverts && dvert) {
     /* Range of valid def_nr in MDeformWeight. */
-    const IndexRange def_nr_range = params.pose_channel_by_vertex_group.index_range();
+    const Span<VertexGroupBone> bone_by_vertex_group = params.bone_by_vertex_group;
     const Span<MDeformWeight> dweights(dvert->dw, dvert->totweight);
     for (const auto &dw : dweights) {
-      const bPoseChannel *pchan = def_nr_range.contains(dw.def_nr) ?
-                                      params.pose_channel_by_vertex_group[dw.def_nr] :
-                                      nullptr;
-      if (pchan == nullptr) {
+      if (!bone_by_vertex_group.index_range().contains(dw.def_nr)) {
+        continue;
+      }
+      const VertexGroupBone &group_bone = bone_by_vertex_group[dw.def_nr];
+      if (group_bone.pchan == nullptr) {
         continue;
       }
 
       float weight = dw.weight;
 
       /* Bone option to mix with envelope weight. */
-      const Bone *bone = pchan->bone;
-      if (bone && bone->flag & BONE_MULT_VG_ENV) {
+      if (group_bone.use_envelope_multiply) {
+        const Bone *bone = group_bone.pchan->bone;
         weight *= distfactor_to_bone(co,
                                      float3(bone->arm_head),
                                      float3(bone->arm_tail),
@@ -420,7 +436,7 @@ static void armature_vert_task_with_mixer(const ArmatureDeformParams &params,
                                      bone->dist);
       }
 
-      contrib += pchan_bone_deform(*pchan, weight, co, mixer);
+      contrib += pchan_bone_deform(*group_bone.pchan, group_bone.use_bbone, weight, co, mixer);
       deformed = true;
     }
   }
@@ -490,6 +506,32 @@ static void armature_vert_task_with_dvert(const ArmatureDeformParams &deform_par
   }
 }
 
+/**
+ * Deform all vertices with the same mixer type, so the choice of the mixer doesn't have to be
+ * made again for every vertex.
+ */
+template<typename MixerT>
+static void armature_deform_verts(const ArmatureDeformParams &deform_params,
+                                  const std::optional<Span<MDeformVert>> dverts,
+                                  const Mesh *me_target)
+{
+  const bool use_dverts = (deform_params.use_dverts || deform_params.armature_def_nr >= 0) &&
+                          dverts.has_value();
+  BLI_assert(!me_target || deform_params.vert_coords.size() <= me_target->verts_num);
+  constexpr int grain_size = 32;
+  threading::parallel_for(
+      deform_params.vert_coords.index_range(), grain_size, [&](const IndexRange range) {
+        for (const int i : range) {
+          const MDeformVert *dvert = nullptr;
+          if (use_dverts && (me_target || i < dverts->size())) {
+            dvert = &(*dverts)[i];
+          }
+          MixerT mixer;
+          armature_vert_task_with_mixer(deform_params, i, dvert, mixer);
+        }
+      });
+}
+
 static void armature_deform_coords(const Object &ob_arm,
                                    const Object &ob_target,
                                    const ListBase *defbase,
@@ -512,25 +554,25 @@ static void armature_deform_coords(const Object &ob_arm,
                                                                   dverts.has_value());
 
   const bool use_quaternion = bool(deformflag & ARM_DEF_QUATERNION);
-  constexpr int grain_size = 32;
-  threading::parallel_for(vert_coords.index_range(), grain_size, [&](const IndexRange range) {
-    for (const int i : range) {
-      const MDeformVert *dvert = nullptr;
-      if (deform_params.use_dverts || deform_params.armature_def_nr >= 0) {
-        if (me_target) {
-          BLI_assert(i < me_target->verts_num);
-          if (dverts) {
-            dvert = &(*dverts)[i];
-          }
-        }
-        else if (dverts && i < dverts->size()) {
-          dvert = &(*dverts)[i];
-        }
-      }
-
-      armature_vert_task_with_dvert(deform_params, i, dvert, use_quaternion);
+  const bool full_deform = vert_deform_mats.has_value();
+  if (use_quaternion) {
+    if (full_deform) {
+      armature_deform_verts<bke::BoneDeformDualQuaternionMixer<true>>(
+          deform_params, dverts, me_target);
     }
-  });
+    else {
+      armature_deform_verts<bke::BoneDeformDualQuaternionMixer<false>>(
+          deform_params, dverts, me_target);
+    }
+  }
+  else {
+    if (full_deform) {
+      armature_deform_verts<bke::BoneDeformLinearMixer<true>>(deform_params, dverts, me_target);
+    }
+    else {
+      armature_deform_verts<bke::BoneDeformLinearMixer<false>>(deform_params, dverts, me_target);
+    }
+  }
 }
 
 struct ArmatureEditMeshUserdata {
@@ -15,6 +15,7 @@
 #include "BKE_pointcloud.hh"
 #include "BKE_volume.hh"
 
+#include "BLI_array.hh"
 #include "BLI_endian_defines.h"
 #include "BLI_listbase.h"
 #include "BLI_math_matrix_types.hh"
@@ -30,6 +31,7 @@
 #include <fmt/format.h>
 #include <sstream>
 #include <xxhash.h>
+#include <zstd.h>
 
 #ifdef WITH_OPENVDB
 #  include <openvdb/io/Stream.h>
@@ -49,6 +51,10 @@ std::shared_ptr<DictionaryValue> BlobSlice::serialize() const
   io_slice->append_str("name", this->name);
   io_slice->append_int("start", range.start());
   io_slice->append_int("size", range.size());
+  if (decompressed_size) {
+    io_slice->append_str("compression", "zstd");
+    io_slice->append_int("decompressed_size", *decompressed_size);
+  }
   return io_slice;
 }
 
@@ -60,8 +66,40 @@ std::optional<BlobSlice> BlobSlice::deserialize(const DictionaryValue &io_slice)
   if (!name || !start || !size) {
     return std::nullopt;
   }
+  BlobSlice slice{*name, {*start, *size}};
+  if (const std::optional<StringRefNull> compression = io_slice.lookup_str("compression")) {
+    if (*compression != "zstd") {
+      return std::nullopt;
+    }
+    slice.decompressed_size = io_slice.lookup_int("decompressed_size");
+    if (!slice.decompressed_size) {
+      return std::nullopt;
+    }
+  }
+  return slice;
+}
+
+/**
+ * Slices smaller than this are not compressed, because the gain is small compared to the overhead
+ * of compressing and decompressing them separately.
+ */
+static constexpr int64_t min_compressed_slice_size = 4096;
 
-  return BlobSlice{*name, {*start, *size}};
+/**
+ * Decompress the stored bytes of a slice.
+ * \return True if the decompressed data has exactly the expected size.
+ */
+[[nodiscard]] static bool decompress_slice(const BlobSlice &slice,
+                                           const void *compressed_data,
+                                           void *r_data)
+{
+  BLI_assert(slice.decompressed_size.has_value());
+  const size_t decompressed_size = ZSTD_decompress(
+      r_data, *slice.decompressed_size, compressed_data, slice.range.size());
+  if (ZSTD_isError(decompressed_size)) {
+    return false;
+  }
+  return decompressed_size == size_t(*slice.decompressed_size);
 }
 
 BlobSlice BlobWriter::write_as_stream(const StringRef /*file_extension*/,
@@ -75,7 +113,7 @@ BlobSlice BlobWriter::write_as_stream(const StringRef /*file_extension*/,
 
 bool BlobReader::read_as_stream(const BlobSlice &slice, FunctionRef<bool(std::istream &)> fn) const
 {
-  const int64_t size = slice.range.size();
+  const int64_t size = slice.data_size();
   std::string buffer;
   buffer.resize(size);
   if (!this->read(slice, buffer.data())) {
@@ -92,7 +130,7 @@ DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blo
 
 [[nodiscard]] bool DiskBlobReader::read(const BlobSlice &slice, void *r_data) const
 {
-  if (slice.range.is_empty()) {
+  if (slice.data_size() == 0) {
     return true;
   }
 
@@ -104,15 +142,24 @@ DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blo
     return std::make_unique<fstream>(blob_path, std::ios::in | std::ios::binary);
   });
   blob_file->seekg(slice.range.start());
-  blob_file->read(static_cast<char *>(r_data), slice.range.size());
+  if (!slice.decompressed_size) {
+    blob_file->read(static_cast<char *>(r_data), slice.range.size());
+    return blob_file->gcount() == slice.range.size();
+  }
+  Array<char> compressed_data(slice.range.size(), NoInitialization());
+  blob_file->read(compressed_data.data(), slice.range.size());
   if (blob_file->gcount() != slice.range.size()) {
     return false;
   }
-  return true;
+  return decompress_slice(slice, compressed_data.data(), r_data);
 }
 
-DiskBlobWriter::DiskBlobWriter(std::string blob_dir, std::string base_name)
-    : blob_dir_(std::move(blob_dir)), base_name_(std::move(base_name))
+DiskBlobWriter::DiskBlobWriter(std::string blob_dir,
+                               std::string base_name,
+                               const bool use_compression)
+    : blob_dir_(std::move(blob_dir)),
+      base_name_(std::move(base_name)),
+      use_compression_(use_compression)
 {
   blob_name_ = base_name_ + ".blob";
 }
@@ -127,6 +174,19 @@ BlobSlice DiskBlobWriter::write(const void *data, const int64_t size)
   }
 
   const int64_t old_offset = current_offset_;
+  if (use_compression_ && size >= min_compressed_slice_size) {
+    Array<char> compressed_data(ZSTD_compressBound(size), NoInitialization());
+    /* Use a fast compression level, because baking large simulations shouldn't become much slower
+     * and decompression speed is mostly independent of the level. */
+    const size_t compressed_size = ZSTD_compress(
+        compressed_data.data(), compressed_data.size(), data, size, 1);
+    if (!ZSTD_isError(compressed_size) && int64_t(compressed_size) < size) {
+      blob_stream_.write(compressed_data.data(), compressed_size);
+      current_offset_ += compressed_size;
+      total_written_size_ += compressed_size;
+      return {blob_name_, {old_offset, int64_t(compressed_size)}, size};
+    }
+  }
   blob_stream_.write(static_cast<const char *>(data), size);
   current_offset_ += size;
   total_written_size_ += size;
@@ -165,7 +225,7 @@ void MemoryBlobReader::add(const StringRef name, const Span<std::byte> blob)
 
 bool MemoryBlobReader::read(const BlobSlice &slice, void *r_data) const
 {
-  if (slice.range.is_empty()) {
+  if (slice.data_size() == 0) {
     return true;
   }
   const Span<std::byte> blob_data = blob_by_name_.lookup_default(slice.name, {});
@@ -173,6 +233,9 @@ bool MemoryBlobReader::read(const BlobSlice &slice, void *r_data) const
     return false;
   }
   const void *copy_src = blob_data.slice(slice.range).data();
+  if (slice.decompressed_size) {
+    return decompress_slice(slice, copy_src, r_data);
+  }
   memcpy(r_data, copy_src, slice.range.size());
   return true;
 }
@@ -355,7 +418,7 @@ static std::shared_ptr<DictionaryValue> write_blob_raw_data_with_endian(
   if (!slice) {
     return false;
   }
-  if (slice->range.size() != element_size * elements_num) {
+  if (slice->data_size() != element_size * elements_num) {
     return false;
   }
   if (!blob_reader.read(*slice, r_data)) {
@@ -391,7 +454,7 @@ static std::shared_ptr<DictionaryValue> write_blob_raw_bytes(BlobWriter &blob_wr
   if (!slice) {
     return false;
   }
-  if (slice->range.size() != bytes_num) {
+  if (slice->data_size() != bytes_num) {
     return false;
   }
   return blob_reader.read(*slice, r_data);
@@ -1647,7 +1710,12 @@ static std::unique_ptr<BakeItem> deserialize_bake_item(const DictionaryValue &io
   return {};
 }
 
-static constexpr int bake_file_version = 3;
+/**
+ * Version 4 added compressed blob slices. Version 3 bakes only contain uncompressed slices, which
+ * are still stored the same way, so they can still be read.
+ */
+static constexpr int bake_file_version = 4;
+static constexpr int bake_file_version_min_read = 3;
 
 void serialize_bake(const BakeState &bake_state,
                     BlobWriter &blob_writer,
@@ -1686,7 +1754,9 @@ std::optional<BakeState> deserialize_bake(std::istream &stream,
     return std::nullopt;
   }
   const std::optional<int> version = io_root->lookup_int("version");
-  if (!version.has_value() || *version != bake_file_version) {
+  if (!version.has_value() || *version < bake_file_version_min_read ||
+      *version > bake_file_version)
+  {
     return std::nullopt;
   }
   const io::serialize::DictionaryValue *io_items = io_root->lookup_dict("items");
@@ -22,6 +22,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math_base.hh"
 #include "BLI_rand.h"
+#include "BLI_simd.hh"
 
 #include "BLT_translation.hh"
 
@@ -1366,6 +1367,43 @@ void BKE_brush_randomize_texture_coords(UnifiedPaintSettings *ups, bool mask)
   }
 }
 
+/**
+ * Multiply the factors with a falloff of the normalized inverted distance `1 - distance / radius`
+ * and clear the factors outside of the radius. With SSE2, \a simd_fn evaluates the same falloff as
+ * \a fn for four values at once.
+ */
+template<typename Fn, typename SimdFn>
+static void calc_curve_factors_preset(const blender::Span<float> distances,
+                                      const float brush_radius,
+                                      const blender::MutableSpan<float> factors,
+                                      const Fn &fn,
+                                      [[maybe_unused]] const SimdFn &simd_fn)
+{
+  const float radius_rcp = blender::math::rcp(brush_radius);
+  int64_t i = 0;
+#if BLI_HAVE_SSE2
+  const __m128 radius_v = _mm_set1_ps(brush_radius);
+  const __m128 radius_rcp_v = _mm_set1_ps(radius_rcp);
+  const __m128 one = _mm_set1_ps(1.0f);
+  for (; i + 4 <= distances.size(); i += 4) {
+    const __m128 distance = _mm_loadu_ps(distances.data() + i);
+    const __m128 factor = _mm_sub_ps(one, _mm_mul_ps(distance, radius_rcp_v));
+    const __m128 result = _mm_mul_ps(_mm_loadu_ps(factors.data() + i), simd_fn(factor));
+    /* The mask also clears NaN values of the falloff functions outside of the radius. */
+    const __m128 inside = _mm_cmplt_ps(distance, radius_v);
+    _mm_storeu_ps(factors.data() + i, _mm_and_ps(inside, result));
+  }
+#endif
+  for (; i < distances.size(); i++) {
+    const float distance = distances[i];
+    if (distance >= brush_radius) {
+      factors[i] = 0.0f;
+      continue;
+    }
+    factors[i] *= fn(1.0f - distance * radius_rcp);
+  }
+}
+
 void BKE_brush_calc_curve_factors(const eBrushCurvePreset preset,
                                   const CurveMapping *cumap,
                                   const blender::Span<float> distances,
@@ -1374,9 +1412,18 @@ void BKE_brush_calc_curve_factors(const eBrushCurvePreset preset,
 {
   BLI_assert(factors.size() == distances.size());
 
-  const float radius_rcp = blender::math::rcp(brush_radius);
+#if BLI_HAVE_SSE2
+  using SimdFloat = __m128;
+  const __m128 two = _mm_set1_ps(2.0f);
+  const __m128 three = _mm_set1_ps(3.0f);
+#else
+  /* Placeholder, the SIMD falloff functions are not used without SSE2. */
+  using SimdFloat = float;
+#endif
+
   switch (preset) {
     case BRUSH_CURVE_CUSTOM: {
+      const float radius_rcp = blender::math::rcp(brush_radius);
       for (const int i : distances.index_range()) {
         const float distance = distances[i];
         if (distance >= brush_radius) {
@@ -1388,108 +1435,136 @@ void BKE_brush_calc_curve_factors(const eBrushCurvePreset preset,
       break;
     }
     case BRUSH_CURVE_SHARP: {
-      for (const int i : distances.index_range()) {
-        const float distance = distances[i];
-        if (distance >= brush_radius) {
-          factors[i] = 0.0f;
-          continue;
-        }
-        const float factor = 1.0f - distance * radius_rcp;
-        factors[i] *= factor * factor;
-      }
+      calc_curve_factors_preset(
+          distances,
+          brush_radius,
+          factors,
+          [](const float factor) { return factor * factor; },
+          [&](const SimdFloat factor) {
+#if BLI_HAVE_SSE2
+            return _mm_mul_ps(factor, factor);
+#else
+            return factor;
+#endif
+          });
       break;
     }
     case BRUSH_CURVE_SMOOTH: {
-      for (const int i : distances.index_range()) {
-        const float distance = distances[i];
-        if (distance >= brush_radius) {
-          factors[i] = 0.0f;
-          continue;
-        }
-        const float factor = 1.0f - distance * radius_rcp;
-        factors[i] *= 3.0f * factor * factor - 2.0f * factor * factor * factor;
-      }
+      calc_curve_factors_preset(
+          distances,
+          brush_radius,
+          factors,
+          [](const float factor) {
+            return 3.0f * factor * factor - 2.0f * factor * factor * factor;
+          },
+          [&](const SimdFloat factor) {
+#if BLI_HAVE_SSE2
+            const __m128 factor_sq = _mm_mul_ps(factor, factor);
+            return _mm_sub_ps(_mm_mul_ps(three, factor_sq),
+                              _mm_mul_ps(_mm_mul_ps(two, factor_sq), factor));
+#else
+            return factor;
+#endif
+          });
       break;
     }
     case BRUSH_CURVE_SMOOTHER: {
-      for (const int i : distances.index_range()) {
-        const float distance = distances[i];
-        if (distance >= brush_radius) {
-          factors[i] = 0.0f;
-          continue;
-        }
-        const float factor = 1.0f - distance * radius_rcp;
-        factors[i] *= pow3f(factor) * (factor * (factor * 6.0f - 15.0f) + 10.0f);
-      }
+      calc_curve_factors_preset(
+          distances,
+          brush_radius,
+          factors,
+          [](const float factor) {
+            return pow3f(factor) * (factor * (factor * 6.0f - 15.0f) + 10.0f);
+          },
+          [&](const SimdFloat factor) {
+#if BLI_HAVE_SSE2
+            const __m128 factor_cube = _mm_mul_ps(_mm_mul_ps(factor, factor), factor);
+            const __m128 inner = _mm_sub_ps(_mm_mul_ps(factor, _mm_set1_ps(6.0f)),
+                                            _mm_set1_ps(15.0f));
+            return _mm_mul_ps(factor_cube,
+                              _mm_add_ps(_mm_mul_ps(factor, inner), _mm_set1_ps(10.0f)));
+#else
+            return factor;
+#endif
+          });
       break;
     }
     case BRUSH_CURVE_ROOT: {
-      for (const int i : distances.index_range()) {
-        const float distance = distances[i];
-        if (distance >= brush_radius) {
-          factors[i] = 0.0f;
-          continue;
-        }
-        const float factor = 1.0f - distance * radius_rcp;
-        factors[i] *= sqrtf(factor);
-      }
+      calc_curve_factors_preset(
+          distances,
+          brush_radius,
+          factors,
+          [](const float factor) { return sqrtf(factor); },
+          [&](const SimdFloat factor) {
+#if BLI_HAVE_SSE2
+            return _mm_sqrt_ps(factor);
+#else
+            return factor;
+#endif
+          });
       break;
     }
     case BRUSH_CURVE_LIN: {
-      for (const int i : distances.index_range()) {
-        const float distance = distances[i];
-        if (distance >= brush_radius) {
-          factors[i] = 0.0f;
-          continue;
-        }
-        const float factor = 1.0f - distance * radius_rcp;
-        factors[i] *= factor;
-      }
+      calc_curve_factors_preset(
+          distances,
+          brush_radius,
+          factors,
+          [](const float factor) { return factor; },
+          [&](const SimdFloat factor) { return factor; });
       break;
     }
     case BRUSH_CURVE_CONSTANT: {
       for (const int i : distances.index_range()) {
-        const float distance = distances[i];
-        if (distance >= brush_radius) {
+        if (distances[i] >= brush_radius) {
           factors[i] = 0.0f;
         }
       }
       break;
     }
     case BRUSH_CURVE_SPHERE: {
-      for (const int i : distances.index_range()) {
-        const float distance = distances[i];
-        if (distance >= brush_radius) {
-          factors[i] = 0.0f;
-          continue;
-        }
-        const float factor = 1.0f - distance * radius_rcp;
-        factors[i] *= sqrtf(2 * factor - factor * factor);
-      }
+      calc_curve_factors_preset(
+          distances,
+          brush_radius,
+          factors,
+          [](const float factor) { return sqrtf(2 * factor - factor * factor); },
+          [&](const SimdFloat factor) {
+#if BLI_HAVE_SSE2
+            return _mm_sqrt_ps(_mm_sub_ps(_mm_mul_ps(two, factor), _mm_mul_ps(factor, factor)));
+#else
+            return factor;
+#endif
+          });
       break;
     }
     case BRUSH_CURVE_POW4: {
-      for (const int i : distances.index_range()) {
-        const float distance = distances[i];
-        if (distance >= brush_radius) {
-          factors[i] = 0.0f;
-          continue;
-        }
-        const float factor = 1.0f - distance * radius_rcp;
-        factors[i] *= factor * factor * factor * factor;
-      }
+      calc_curve_factors_preset(
+          distances,
+          brush_radius,
+          factors,
+          [](const float factor) { return factor * factor * factor * factor; },
+          [&](const SimdFloat factor) {
+#if BLI_HAVE_SSE2
+            const __m128 factor_sq = _mm_mul_ps(factor, factor);
+            return _mm_mul_ps(factor_sq, factor_sq);
+#else
+            return factor;
+#endif
+          });
       break;
     }
     case BRUSH_CURVE_INVSQUARE: {
-      for (const int i : distances.index_range()) {
-        const float distance = distances[i];
-        if (distance >= brush_radius) {
-          factors[i] = 0.0f;
-          continue;
-        }
-        const float factor = 1.0f - distance * radius_rcp;
-        factors[i] *= factor * (2.0f - factor);
-      }
+      calc_curve_factors_preset(
+          distances,
+          brush_radius,
+          factors,
+          [](const float factor) { return factor * (2.0f - factor); },
+          [&](const SimdFloat factor) {
+#if BLI_HAVE_SSE2
+            return _mm_mul_ps(factor, _mm_sub_ps(two, factor));
+#else
+            return factor;
+#endif
+          });
       break;
     }
   }
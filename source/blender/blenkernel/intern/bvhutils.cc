@@ -10,6 +10,7 @@
 #include "DNA_pointcloud_types.h"
 
 #include "BLI_math_geom.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_bvhutils.hh"
@@ -426,12 +427,21 @@ static BVHTreeFromMesh create_tris_tree_data(std::unique_ptr<BVHTree, BVHTreeDel
   return data;
 }
 
+/**
+ * The trees are mostly used for ray-casts and nearest queries, which visit fewer nodes in a
+ * shallower tree with four children per branch.
+ */
 static std::unique_ptr<BVHTree, BVHTreeDeleter> bvhtree_new_common(int elems_num)
 {
   if (elems_num == 0) {
     return nullptr;
   }
-  return std::unique_ptr<BVHTree, BVHTreeDeleter>(BLI_bvhtree_new(elems_num, 0.0f, 2, 6));
+  return std::unique_ptr<BVHTree, BVHTreeDeleter>(BLI_bvhtree_new(elems_num, 0.0f, 4, 6));
+}
+
+static void bvhtree_balance_common(BVHTree &tree)
+{
+  BLI_bvhtree_balance_ex(&tree, BVH_BALANCE_USE_SAH);
 }
 
 static std::unique_ptr<BVHTree, BVHTreeDeleter> create_tree_from_verts(
@@ -443,7 +453,7 @@ static std::unique_ptr<BVHTree, BVHTreeDeleter> create_tree_from_verts(
   }
   verts_mask.foreach_index(
       [&](const int i) { BLI_bvhtree_insert(tree.get(), i, positions[i], 1); });
-  BLI_bvhtree_balance(tree.get());
+  bvhtree_balance_common(*tree);
   return tree;
 }
 
@@ -468,7 +478,7 @@ static std::unique_ptr<BVHTree, BVHTreeDeleter> create_tree_from_edges(
     copy_v3_v3(co[1], positions[edge[1]]);
     BLI_bvhtree_insert(tree.get(), edge_i, co[0], 2);
   });
-  BLI_bvhtree_balance(tree.get());
+  bvhtree_balance_common(*tree);
   return tree;
 }
 
@@ -497,7 +507,7 @@ static std::unique_ptr<BVHTree, BVHTreeDeleter> create_tree_from_legacy_faces(
     }
     BLI_bvhtree_insert(tree.get(), i, co[0], faces[i].v4 ? 4 : 3);
   }
-  BLI_bvhtree_balance(tree.get());
+  bvhtree_balance_common(*tree);
   return tree;
 }
 
@@ -516,7 +526,69 @@ static std::unique_ptr<BVHTree, BVHTreeDeleter> create_tree_from_tris(const Span
     copy_v3_v3(co[2], positions[corner_verts[corner_tris[tri][2]]]);
     BLI_bvhtree_insert(tree.get(), tri, co[0], 3);
   }
-  BLI_bvhtree_balance(tree.get());
+  bvhtree_balance_common(*tree);
+  return tree;
+}
+
+/**
+ * A refit tree is used as long as it's not much slower to query than the tree was originally.
+ */
+static constexpr float max_refit_area_cost_factor = 1.5f;
+
+/**
+ * Refit a copy of the tree that was built for another mesh with the same topology, or build a new
+ * tree if there is none or if the refit tree would make queries much slower. For deformed meshes,
+ * updating the bounds of the existing nodes is much cheaper than balancing a new tree.
+ */
+static std::unique_ptr<BVHTree, BVHTreeDeleter> refit_or_create_tree_from_tris(
+    BVHRefitSource &source,
+    const ImplicitSharingInfo *topology_sharing_info,
+    const Span<float3> positions,
+    const Span<int> corner_verts,
+    const Span<int3> corner_tris)
+{
+  if (!topology_sharing_info) {
+    return create_tree_from_tris(positions, corner_verts, corner_tris);
+  }
+  std::unique_ptr<BVHTree, BVHTreeDeleter> tree;
+  /* Isolate because the tree is built with multiple threads while the mutex is locked. */
+  threading::isolate_task([&]() {
+    std::scoped_lock lock(source.mutex);
+    const bool same_topology = source.topology == topology_sharing_info &&
+                               source.topology_version == topology_sharing_info->version();
+    if (same_topology && source.tree &&
+        BLI_bvhtree_get_len(source.tree.get()) == corner_tris.size())
+    {
+      tree.reset(BLI_bvhtree_copy(source.tree.get()));
+      threading::parallel_for(corner_tris.index_range(), 1024, [&](const IndexRange range) {
+        for (const int tri : range) {
+          float co[3][3];
+          copy_v3_v3(co[0], positions[corner_verts[corner_tris[tri][0]]]);
+          copy_v3_v3(co[1], positions[corner_verts[corner_tris[tri][1]]]);
+          copy_v3_v3(co[2], positions[corner_verts[corner_tris[tri][2]]]);
+          BLI_bvhtree_update_node(tree.get(), tri, co[0], nullptr, 3);
+        }
+      });
+      BLI_bvhtree_update_tree(tree.get());
+      if (BLI_bvhtree_get_area_cost(tree.get()) <= source.area_cost * max_refit_area_cost_factor)
+      {
+        return;
+      }
+    }
+
+    tree = create_tree_from_tris(positions, corner_verts, corner_tris);
+    if (same_topology && tree) {
+      /* The positions changed since the last tree was built, so the mesh is likely deforming. */
+      source.tree.reset(BLI_bvhtree_copy(tree.get()));
+      source.area_cost = BLI_bvhtree_get_area_cost(tree.get());
+    }
+    else {
+      source.tree.reset();
+      topology_sharing_info->add_weak_user();
+      source.topology = WeakImplicitSharingPtr(topology_sharing_info);
+      source.topology_version = topology_sharing_info->version();
+    }
+  });
   return tree;
 }
 
@@ -549,7 +621,7 @@ static std::unique_ptr<BVHTree, BVHTreeDeleter> create_tree_from_tris(
       BLI_bvhtree_insert(tree.get(), tri, co[0], 3);
     }
   });
-  BLI_bvhtree_balance(tree.get());
+  bvhtree_balance_common(*tree);
   return tree;
 }
 
@@ -773,7 +845,12 @@ blender::bke::BVHTreeFromMesh Mesh::bvh_corner_tris() const
   const Span<int> corner_verts = this->corner_verts();
   const Span<int3> corner_tris = this->corner_tris();
   this->runtime->bvh_cache_corner_tris.ensure([&](std::unique_ptr<BVHTree, BVHTreeDeleter> &data) {
-    data = create_tree_from_tris(positions, corner_verts, corner_tris);
+    const GAttributeReader corner_verts_attr = this->attributes().lookup(".corner_vert");
+    data = refit_or_create_tree_from_tris(*this->runtime->bvh_corner_tris_refit_source,
+                                          corner_verts_attr.sharing_info,
+                                          positions,
+                                          corner_verts,
+                                          corner_tris);
   });
   return create_tris_tree_data(
       this->runtime->bvh_cache_corner_tris.data().get(), positions, corner_verts, corner_tris);
@@ -263,8 +263,10 @@ int BKE_crazyspace_get_first_deform_matrices_editbmesh(
         cd_mask_extra = datamasks->mask;
         BLI_linklist_free((LinkNode *)datamasks, nullptr);
 
-        mesh = BKE_mesh_wrapper_from_editmesh(
-            std::make_shared<BMEditMesh>(*em), &cd_mask_extra, me_input);
+        std::shared_ptr<BMEditMesh> em_copy = std::make_shared<BMEditMesh>(*em);
+        /* Don't store the conversion of the temporary copy in the cache of the edit mesh. */
+        em_copy->eval_cache = std::make_shared<blender::bke::EditMeshEvalCache>();
+        mesh = BKE_mesh_wrapper_from_editmesh(std::move(em_copy), &cd_mask_extra, me_input);
         deformcos.reinitialize(verts_num);
         BKE_mesh_wrapper_vert_coords_copy(mesh, deformcos);
         deformmats.reinitialize(verts_num);
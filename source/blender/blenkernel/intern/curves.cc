@@ -104,6 +104,10 @@ static void curves_foreach_id(ID *id, LibraryForeachIDData *data)
   BKE_LIB_FOREACHID_PROCESS_IDSUPER(data, curves->surface, IDWALK_CB_NOP);
 }
 
+/**
+ * Thread-safe (#IDTYPE_FLAGS_BLEND_WRITE_THREADSAFE): only the temporary copy of the curves and
+ * local buffers are modified, attribute arrays and other IDs are only read.
+ */
 static void curves_blend_write(BlendWriter *writer, ID *id, const void *id_address)
 {
   Curves *curves = (Curves *)id;
@@ -149,7 +153,7 @@ IDTypeInfo IDType_ID_CV = {
     /*name*/ "Curves",
     /*name_plural*/ N_("hair_curves"),
     /*translation_context*/ BLT_I18NCONTEXT_ID_CURVES,
-    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE,
+    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE | IDTYPE_FLAGS_BLEND_WRITE_THREADSAFE,
     /*asset_type_info*/ nullptr,
 
     /*init_data*/ curves_init_data,
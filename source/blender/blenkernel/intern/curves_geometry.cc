@@ -794,6 +794,75 @@ void CurvesGeometry::ensure_nurbs_basis_cache() const
   });
 }
 
+/** Expects the evaluated offsets and the NURBS basis cache to be calculated already. */
+static void evaluate_positions(const CurvesGeometry &curves,
+                               const IndexMask &curve_selection,
+                               MutableSpan<float3> evaluated_positions)
+{
+  const CurvesGeometryRuntime &runtime = *curves.runtime;
+  const OffsetIndices<int> points_by_curve = curves.points_by_curve();
+  const OffsetIndices<int> evaluated_points_by_curve = curves.evaluated_points_by_curve();
+  const Span<float3> positions = curves.positions();
+
+  auto evaluate_catmull = [&](const IndexMask &selection) {
+    const VArray<bool> cyclic = curves.cyclic();
+    const VArray<int> resolution = curves.resolution();
+    selection.foreach_index(GrainSize(128), [&](const int curve_index) {
+      const IndexRange points = points_by_curve[curve_index];
+      const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+      curves::catmull_rom::interpolate_to_evaluated(positions.slice(points),
+                                                    cyclic[curve_index],
+                                                    resolution[curve_index],
+                                                    evaluated_positions.slice(evaluated_points));
+    });
+  };
+  auto evaluate_poly = [&](const IndexMask &selection) {
+    array_utils::copy_group_to_group(
+        points_by_curve, evaluated_points_by_curve, selection, positions, evaluated_positions);
+  };
+  auto evaluate_bezier = [&](const IndexMask &selection) {
+    const Span<float3> handle_positions_left = curves.handle_positions_left();
+    const Span<float3> handle_positions_right = curves.handle_positions_right();
+    if (handle_positions_left.is_empty() || handle_positions_right.is_empty()) {
+      curves::fill_points(evaluated_points_by_curve, selection, float3(0), evaluated_positions);
+      return;
+    }
+    const Span<int> all_bezier_offsets =
+        runtime.evaluated_offsets_cache.data().all_bezier_offsets;
+    selection.foreach_index(GrainSize(128), [&](const int curve_index) {
+      const IndexRange points = points_by_curve[curve_index];
+      const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+      const IndexRange offsets = curves::per_curve_point_offsets_range(points, curve_index);
+      curves::bezier::calculate_evaluated_positions(positions.slice(points),
+                                                    handle_positions_left.slice(points),
+                                                    handle_positions_right.slice(points),
+                                                    all_bezier_offsets.slice(offsets),
+                                                    evaluated_positions.slice(evaluated_points));
+    });
+  };
+  auto evaluate_nurbs = [&](const IndexMask &selection) {
+    const VArray<int8_t> nurbs_orders = curves.nurbs_orders();
+    const Span<float> nurbs_weights = curves.nurbs_weights();
+    const Span<curves::nurbs::BasisCache> nurbs_basis_cache = runtime.nurbs_basis_cache.data();
+    selection.foreach_index(GrainSize(128), [&](const int curve_index) {
+      const IndexRange points = points_by_curve[curve_index];
+      const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+      curves::nurbs::interpolate_to_evaluated(nurbs_basis_cache[curve_index],
+                                              nurbs_orders[curve_index],
+                                              nurbs_weights.slice_safe(points),
+                                              positions.slice(points),
+                                              evaluated_positions.slice(evaluated_points));
+    });
+  };
+  curves::foreach_curve_by_type(curves.curve_types(),
+                                curves.curve_type_counts(),
+                                curve_selection,
+                                evaluate_catmull,
+                                evaluate_poly,
+                                evaluate_bezier,
+                                evaluate_nurbs);
+}
+
 Span<float3> CurvesGeometry::evaluated_positions() const
 {
   const CurvesGeometryRuntime &runtime = *this->runtime;
@@ -805,70 +874,7 @@ Span<float3> CurvesGeometry::evaluated_positions() const
   this->ensure_nurbs_basis_cache();
   runtime.evaluated_position_cache.ensure([&](Vector<float3> &r_data) {
     r_data.resize(this->evaluated_points_num());
-    MutableSpan<float3> evaluated_positions = r_data;
-
-    const OffsetIndices<int> points_by_curve = this->points_by_curve();
-    const OffsetIndices<int> evaluated_points_by_curve = this->evaluated_points_by_curve();
-    const Span<float3> positions = this->positions();
-
-    auto evaluate_catmull = [&](const IndexMask &selection) {
-      const VArray<bool> cyclic = this->cyclic();
-      const VArray<int> resolution = this->resolution();
-      selection.foreach_index(GrainSize(128), [&](const int curve_index) {
-        const IndexRange points = points_by_curve[curve_index];
-        const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-        curves::catmull_rom::interpolate_to_evaluated(positions.slice(points),
-                                                      cyclic[curve_index],
-                                                      resolution[curve_index],
-                                                      evaluated_positions.slice(evaluated_points));
-      });
-    };
-    auto evaluate_poly = [&](const IndexMask &selection) {
-      array_utils::copy_group_to_group(
-          points_by_curve, evaluated_points_by_curve, selection, positions, evaluated_positions);
-    };
-    auto evaluate_bezier = [&](const IndexMask &selection) {
-      const Span<float3> handle_positions_left = this->handle_positions_left();
-      const Span<float3> handle_positions_right = this->handle_positions_right();
-      if (handle_positions_left.is_empty() || handle_positions_right.is_empty()) {
-        curves::fill_points(evaluated_points_by_curve, selection, float3(0), evaluated_positions);
-        return;
-      }
-      const Span<int> all_bezier_offsets =
-          runtime.evaluated_offsets_cache.data().all_bezier_offsets;
-      selection.foreach_index(GrainSize(128), [&](const int curve_index) {
-        const IndexRange points = points_by_curve[curve_index];
-        const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-        const IndexRange offsets = curves::per_curve_point_offsets_range(points, curve_index);
-        curves::bezier::calculate_evaluated_positions(positions.slice(points),
-                                                      handle_positions_left.slice(points),
-                                                      handle_positions_right.slice(points),
-                                                      all_bezier_offsets.slice(offsets),
-                                                      evaluated_positions.slice(evaluated_points));
-      });
-    };
-    auto evaluate_nurbs = [&](const IndexMask &selection) {
-      this->ensure_nurbs_basis_cache();
-      const VArray<int8_t> nurbs_orders = this->nurbs_orders();
-      const Span<float> nurbs_weights = this->nurbs_weights();
-      const Span<curves::nurbs::BasisCache> nurbs_basis_cache = runtime.nurbs_basis_cache.data();
-      selection.foreach_index(GrainSize(128), [&](const int curve_index) {
-        const IndexRange points = points_by_curve[curve_index];
-        const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-        curves::nurbs::interpolate_to_evaluated(nurbs_basis_cache[curve_index],
-                                                nurbs_orders[curve_index],
-                                                nurbs_weights.slice_safe(points),
-                                                positions.slice(points),
-                                                evaluated_positions.slice(evaluated_points));
-      });
-    };
-    curves::foreach_curve_by_type(this->curve_types(),
-                                  this->curve_type_counts(),
-                                  this->curves_range(),
-                                  evaluate_catmull,
-                                  evaluate_poly,
-                                  evaluate_bezier,
-                                  evaluate_nurbs);
+    evaluate_positions(*this, this->curves_range(), r_data);
   });
   return runtime.evaluated_position_cache.data();
 }
@@ -1205,6 +1211,31 @@ void CurvesGeometry::tag_positions_changed()
   this->runtime->bounds_cache.tag_dirty();
   this->runtime->bounds_with_radius_cache.tag_dirty();
 }
+void CurvesGeometry::tag_positions_changed(const IndexMask &changed_curves)
+{
+  if (changed_curves.is_empty()) {
+    return;
+  }
+  /* Like #Drawing::tag_positions_changed, recompute everything lazily when most curves changed. */
+  const CurvesGeometryRuntime &runtime = *this->runtime;
+  if (changed_curves.size() > this->curves_num() / 2 ||
+      !runtime.evaluated_position_cache.is_cached() || this->is_single_type(CURVE_TYPE_POLY))
+  {
+    this->tag_positions_changed();
+    return;
+  }
+  /* The evaluated offsets and NURBS basis only depend on topology, so they are still valid. Keep
+   * the evaluated positions of unchanged curves and only evaluate the changed ones again. */
+  this->ensure_nurbs_basis_cache();
+  runtime.evaluated_position_cache.update([&](Vector<float3> &r_data) {
+    evaluate_positions(*this, changed_curves, r_data);
+  });
+  runtime.evaluated_tangent_cache.tag_dirty();
+  runtime.evaluated_normal_cache.tag_dirty();
+  runtime.evaluated_length_cache.tag_dirty();
+  runtime.bounds_cache.tag_dirty();
+  runtime.bounds_with_radius_cache.tag_dirty();
+}
 void CurvesGeometry::tag_topology_changed()
 {
   this->runtime->custom_knot_offsets_cache.tag_dirty();
@@ -1236,23 +1267,10 @@ static void translate_positions(MutableSpan<float3> positions, const float3 &tra
   });
 }
 
-static void transform_positions(MutableSpan<float3> positions, const float4x4 &matrix)
-{
-  threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
-    for (float3 &position : positions.slice(range)) {
-      position = math::transform_point(matrix, position);
-    }
-  });
-}
-
 static void transform_normals(MutableSpan<float3> normals, const float4x4 &matrix)
 {
   const float3x3 normal_transform = math::transpose(math::invert(float3x3(matrix)));
-  threading::parallel_for(normals.index_range(), 1024, [&](const IndexRange range) {
-    for (float3 &normal : normals.slice(range)) {
-      normal = normal_transform * normal;
-    }
-  });
+  math::transform_normals(normal_transform, normals);
 }
 
 void CurvesGeometry::calculate_bezier_auto_handles()
@@ -1316,12 +1334,12 @@ void CurvesGeometry::translate(const float3 &translation)
 
 void CurvesGeometry::transform(const float4x4 &matrix)
 {
-  transform_positions(this->positions_for_write(), matrix);
+  math::transform_points(matrix, this->positions_for_write());
   if (!this->handle_positions_left().is_empty()) {
-    transform_positions(this->handle_positions_left_for_write(), matrix);
+    math::transform_points(matrix, this->handle_positions_left_for_write());
   }
   if (!this->handle_positions_right().is_empty()) {
-    transform_positions(this->handle_positions_right_for_write(), matrix);
+    math::transform_points(matrix, this->handle_positions_right_for_write());
   }
   MutableAttributeAccessor attributes = this->attributes_for_write();
   if (SpanAttributeWriter normals = attributes.lookup_for_write_span<float3>("custom_normal")) {
@@ -8,6 +8,8 @@
 
 #include "BKE_curves.hh"
 
+#include "BLI_index_mask.hh"
+
 #include "testing/testing.h"
 
 namespace blender::bke::tests {
@@ -478,6 +480,90 @@ TEST(curves_geometry, BezierGenericEvaluation)
   }
 }
 
+/** Curves of different types with the given number of points, with handles for Bezier curves. */
+static CurvesGeometry create_mixed_type_curves(const int points_size, const int curves_size)
+{
+  CurvesGeometry curves = create_basic_curves(points_size, curves_size);
+  MutableSpan<int8_t> types = curves.curve_types_for_write();
+  const Array<CurveType> type_cycle = {
+      CURVE_TYPE_CATMULL_ROM, CURVE_TYPE_BEZIER, CURVE_TYPE_NURBS, CURVE_TYPE_POLY};
+  for (const int i : curves.curves_range()) {
+    types[i] = type_cycle[i % type_cycle.size()];
+  }
+  curves.update_curve_types();
+  curves.resolution_for_write().fill(4);
+
+  const Span<float3> positions = curves.positions();
+  MutableSpan<float3> handles_left = curves.handle_positions_left_for_write();
+  MutableSpan<float3> handles_right = curves.handle_positions_right_for_write();
+  for (const int i : curves.points_range()) {
+    handles_left[i] = positions[i] + float3(-0.25f, 0.5f, 0.0f);
+    handles_right[i] = positions[i] + float3(0.25f, -0.5f, 0.0f);
+  }
+  return curves;
+}
+
+static void translate_curve_points(CurvesGeometry &curves,
+                                   const IndexMask &curve_mask,
+                                   const float3 &translation)
+{
+  const OffsetIndices points_by_curve = curves.points_by_curve();
+  MutableSpan<float3> positions = curves.positions_for_write();
+  MutableSpan<float3> handles_left = curves.handle_positions_left_for_write();
+  MutableSpan<float3> handles_right = curves.handle_positions_right_for_write();
+  curve_mask.foreach_index([&](const int curve) {
+    for (const int point : points_by_curve[curve]) {
+      positions[point] += translation;
+      handles_left[point] += translation;
+      handles_right[point] += translation;
+    }
+  });
+}
+
+TEST(curves_geometry, TagPositionsChangedSubset)
+{
+  CurvesGeometry curves = create_mixed_type_curves(80, 10);
+  const Array<float3> old_evaluated_positions(curves.evaluated_positions());
+
+  /* The copy shares the evaluated positions with the original curves. */
+  const CurvesGeometry copy = curves;
+
+  /* Move one curve of every type, so that the subset is small enough to be updated separately. */
+  IndexMaskMemory memory;
+  const IndexMask changed_curves = IndexMask::from_indices<int>({0, 1, 2, 3}, memory);
+  translate_curve_points(curves, changed_curves, float3(1.0f, 2.0f, -3.0f));
+  curves.tag_positions_changed(changed_curves);
+
+  /* Compare against evaluating all curves from scratch. */
+  CurvesGeometry expected = curves;
+  expected.tag_positions_changed();
+  const Span<float3> evaluated_positions = curves.evaluated_positions();
+  const Span<float3> expected_positions = expected.evaluated_positions();
+  ASSERT_EQ(evaluated_positions.size(), expected_positions.size());
+  for (const int i : evaluated_positions.index_range()) {
+    EXPECT_V3_NEAR(evaluated_positions[i], expected_positions[i], 1e-5f);
+  }
+
+  /* The evaluated positions of the copy are unchanged. */
+  const Span<float3> copy_positions = copy.evaluated_positions();
+  ASSERT_EQ(copy_positions.size(), old_evaluated_positions.size());
+  for (const int i : copy_positions.index_range()) {
+    EXPECT_EQ(copy_positions[i], old_evaluated_positions[i]);
+  }
+
+  /* Changing the curves again while the cache is not shared gives the same result. */
+  const IndexMask changed_again = IndexMask::from_indices<int>({5, 6}, memory);
+  translate_curve_points(curves, changed_again, float3(0.0f, -1.0f, 0.5f));
+  curves.tag_positions_changed(changed_again);
+  CurvesGeometry expected_again = curves;
+  expected_again.tag_positions_changed();
+  const Span<float3> evaluated_again = curves.evaluated_positions();
+  const Span<float3> expected_again_positions = expected_again.evaluated_positions();
+  for (const int i : evaluated_again.index_range()) {
+    EXPECT_V3_NEAR(evaluated_again[i], expected_again_positions[i], 1e-5f);
+  }
+}
+
 TEST(knot_vector, KnotVectorUniform)
 {
   constexpr int8_t order = 5;
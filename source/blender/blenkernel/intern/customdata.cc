@@ -5351,6 +5351,27 @@ static void blend_read_layer_data(BlendDataReader *reader, CustomDataLayer &laye
   }
 }
 
+/**
+ * Use the layer data directly from the memory-mapped blend-file if possible, which avoids copying
+ * large arrays on load. Only possible for types that don't reference other data.
+ */
+static const ImplicitSharingInfo *blend_read_layer_data_mapped(BlendDataReader *reader,
+                                                               CustomDataLayer &layer,
+                                                               const int count)
+{
+  if (ELEM(layer.type, CD_MDEFORMVERT, CD_MDISPS, CD_GRID_PAINT_MASK)) {
+    return nullptr;
+  }
+  const LayerTypeInfo *type_info = layerType_getInfo(eCustomDataType(layer.type));
+  if (type_info == nullptr || type_info->size == 0 || type_info->copy || type_info->free) {
+    return nullptr;
+  }
+  return BLO_read_shared_mapped(reader,
+                                const_cast<const void **>(&layer.data),
+                                size_t(count) * size_t(type_info->size),
+                                size_t(type_info->alignment));
+}
+
 void CustomData_blend_read(BlendDataReader *reader, CustomData *data, const int count)
 {
   BLO_read_struct_array(reader, CustomDataLayer, data->totlayer, &data->layers);
@@ -5376,6 +5397,11 @@ void CustomData_blend_read(BlendDataReader *reader, CustomData *data, const int
     if (CustomData_verify_versions(data, i)) {
       layer->sharing_info = BLO_read_shared(
           reader, &layer->data, [&]() -> const ImplicitSharingInfo * {
+            if (const ImplicitSharingInfo *sharing_info = blend_read_layer_data_mapped(
+                    reader, *layer, count))
+            {
+              return sharing_info;
+            }
             blend_read_layer_data(reader, *layer, count);
             if (layer->data == nullptr) {
               return nullptr;
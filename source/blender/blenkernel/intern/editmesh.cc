@@ -17,6 +17,8 @@
 
 #include "BKE_customdata.hh"
 #include "BKE_editmesh.hh"
+#include "BKE_editmesh_cache.hh"
+#include "BKE_lib_id.hh"
 #include "BKE_mesh.hh"
 #include "BKE_mesh_iterators.hh"
 #include "BKE_mesh_runtime.hh"
@@ -42,6 +44,7 @@ BMEditMesh *BKE_editmesh_copy(BMEditMesh *em)
   *em_copy = *em;
 
   em_copy->bm = BM_mesh_copy(em->bm);
+  em_copy->eval_cache = std::make_shared<blender::bke::EditMeshEvalCache>();
 
   /* The tessellation is NOT calculated on the copy here,
    * because currently all the callers of this function use
@@ -132,12 +135,47 @@ void BKE_editmesh_looptris_and_normals_calc_with_partial(BMEditMesh *em, BMParti
 void BKE_editmesh_free_data(BMEditMesh *em)
 {
   em->looptris = {};
+  BKE_editmesh_eval_cache_clear(em);
 
   if (em->bm) {
     BM_mesh_free(em->bm);
   }
 }
 
+void BKE_editmesh_eval_cache_tag_positions_changed(BMEditMesh *em)
+{
+  if (!em->eval_cache) {
+    return;
+  }
+  std::scoped_lock lock(em->eval_cache->mutex);
+  em->eval_cache->only_positions_changed = true;
+}
+
+void BKE_editmesh_eval_cache_clear(BMEditMesh *em)
+{
+  if (!em->eval_cache) {
+    return;
+  }
+  blender::bke::EditMeshEvalCache &cache = *em->eval_cache;
+  std::scoped_lock lock(cache.mutex);
+  if (cache.mesh) {
+    BKE_id_free(nullptr, cache.mesh);
+    cache.mesh = nullptr;
+  }
+  cache.only_positions_changed = false;
+}
+
+namespace blender::bke {
+
+EditMeshEvalCache::~EditMeshEvalCache()
+{
+  if (this->mesh) {
+    BKE_id_free(nullptr, this->mesh);
+  }
+}
+
+}  // namespace blender::bke
+
 struct CageUserData {
   int totvert;
   blender::MutableSpan<float3> positions_cage;
@@ -1802,6 +1802,16 @@ void id_sort_by_name(ListBase *lb, ID *id, ID *id_sorting_hint)
     }
   }
 
+  /* Fast path for the typical bulk creation case: IDs created in sequence with the same base name
+   * get increasing numeric suffixes, so they usually belong at the very end of the list. When the
+   * last item is from the same library and sorts lower, it is the greatest item of that library
+   * 'range', and appending is correct without walking the list at all. */
+  ID *id_last = static_cast<ID *>(lb->last);
+  if (id_last->lib == id->lib && BLI_strcasecmp(id_last->name, id->name) < 0) {
+    BLI_addtail(lb, id);
+    return;
+  }
+
   void *item_array[ID_SORT_STEP_SIZE];
   int item_array_index;
 
@@ -47,27 +47,41 @@ static void reserve_hash_maps(const Mesh &mesh,
       edge_maps, [&](EdgeMap &edge_map) { edge_map.reserve(totedge_guess / edge_maps.size()); });
 }
 
+/**
+ * \param r_edge_indices: Optional, receives the index of every existing edge in its hash map.
+ */
 static void add_existing_edges_to_hash_maps(const Mesh &mesh,
                                             const uint32_t parallel_mask,
-                                            MutableSpan<EdgeMap> edge_maps)
+                                            MutableSpan<EdgeMap> edge_maps,
+                                            MutableSpan<int> r_edge_indices)
 {
   /* Assume existing edges are valid. */
   const Span<int2> edges = mesh.edges();
   threading::parallel_for_each(edge_maps, [&](EdgeMap &edge_map) {
     const int task_index = &edge_map - edge_maps.data();
-    for (const int2 edge : edges) {
-      const OrderedEdge ordered_edge(edge);
+    for (const int edge_i : edges.index_range()) {
+      const OrderedEdge ordered_edge(edges[edge_i]);
       /* Only add the edge when it belongs into this map. */
       if (task_index == (parallel_mask & edge_hash_2(ordered_edge))) {
-        edge_map.add(ordered_edge);
+        const int index = edge_map.index_of_or_add(ordered_edge);
+        if (!r_edge_indices.is_empty()) {
+          r_edge_indices[edge_i] = index;
+        }
       }
     }
   });
 }
 
+/**
+ * Add the edges of all faces to the hash maps. The index of every edge within its hash map is
+ * written to #corner_edges directly, which avoids looking up all edges again later. Every corner
+ * is only written by the task of the map its edge belongs to, so no synchronization is necessary.
+ * The offsets of the maps in the final edge array are added by #offset_corner_edges afterwards.
+ */
 static void add_face_edges_to_hash_maps(const Mesh &mesh,
                                         const uint32_t parallel_mask,
-                                        MutableSpan<EdgeMap> edge_maps)
+                                        MutableSpan<EdgeMap> edge_maps,
+                                        MutableSpan<int> corner_edges)
 {
   const OffsetIndices<int> faces = mesh.faces();
   const Span<int> corner_verts = mesh.corner_verts();
@@ -77,67 +91,83 @@ static void add_face_edges_to_hash_maps(const Mesh &mesh,
       const IndexRange face = faces[face_i];
       for (const int corner : face) {
         const int vert = corner_verts[corner];
-        const int vert_prev = corner_verts[bke::mesh::face_corner_prev(face, corner)];
+        const int corner_prev = bke::mesh::face_corner_prev(face, corner);
+        const int vert_prev = corner_verts[corner_prev];
         /* Can only be the same when the mesh data is invalid. */
         if (LIKELY(vert_prev != vert)) {
           const OrderedEdge ordered_edge(vert_prev, vert);
           /* Only add the edge when it belongs into this map. */
           if (task_index == (parallel_mask & edge_hash_2(ordered_edge))) {
-            edge_map.add(ordered_edge);
+            corner_edges[corner_prev] = edge_map.index_of_or_add(ordered_edge);
           }
         }
+        else if (task_index == 0) {
+          /* This is an invalid edge; normally this does not happen in Blender,
+           * but it can be part of an imported mesh with invalid geometry. See
+           * #76514. */
+          corner_edges[corner_prev] = 0;
+        }
       }
     }
   });
 }
 
-static void serialize_and_initialize_deduplicated_edges(MutableSpan<EdgeMap> edge_maps,
-                                                        const OffsetIndices<int> edge_offsets,
-                                                        MutableSpan<int2> new_edges)
+/**
+ * Copy the edges of every map to their final location and free the maps, so that the memory
+ * used by the hash tables is not kept alive together with the final edge array.
+ */
+static void serialize_and_free_deduplicated_edges(MutableSpan<EdgeMap> edge_maps,
+                                                  const OffsetIndices<int> edge_offsets,
+                                                  MutableSpan<int2> new_edges)
 {
   threading::parallel_for_each(edge_maps, [&](EdgeMap &edge_map) {
     const int task_index = &edge_map - edge_maps.data();
-    if (edge_offsets[task_index].is_empty()) {
-      return;
+    if (!edge_offsets[task_index].is_empty()) {
+      MutableSpan<int2> result_edges = new_edges.slice(edge_offsets[task_index]);
+      result_edges.copy_from(edge_map.as_span().cast<int2>());
     }
-
-    MutableSpan<int2> result_edges = new_edges.slice(edge_offsets[task_index]);
-    result_edges.copy_from(edge_map.as_span().cast<int2>());
+    edge_map.clear();
   });
 }
 
-static void update_edge_indices_in_face_loops(const OffsetIndices<int> faces,
-                                              const Span<int> corner_verts,
-                                              const Span<EdgeMap> edge_maps,
-                                              const uint32_t parallel_mask,
-                                              const OffsetIndices<int> edge_offsets,
-                                              MutableSpan<int> corner_edges)
+/** Turn the indices within the hash maps into indices in the final edge array. */
+static void offset_corner_edges(const OffsetIndices<int> faces,
+                                const Span<int> corner_verts,
+                                const uint32_t parallel_mask,
+                                const OffsetIndices<int> edge_offsets,
+                                MutableSpan<int> corner_edges)
 {
-  threading::parallel_for(faces.index_range(), 100, [&](IndexRange range) {
+  threading::parallel_for(faces.index_range(), 1024, [&](IndexRange range) {
     for (const int face_index : range) {
       const IndexRange face = faces[face_index];
       for (const int corner : face) {
         const int vert = corner_verts[corner];
-        const int vert_prev = corner_verts[bke::mesh::face_corner_next(face, corner)];
-        if (UNLIKELY(vert == vert_prev)) {
-          /* This is an invalid edge; normally this does not happen in Blender,
-           * but it can be part of an imported mesh with invalid geometry. See
-           * #76514. */
-          corner_edges[corner] = 0;
+        const int vert_next = corner_verts[bke::mesh::face_corner_next(face, corner)];
+        if (UNLIKELY(vert == vert_next)) {
           continue;
         }
-
-        const OrderedEdge ordered_edge(vert_prev, vert);
+        const OrderedEdge ordered_edge(vert, vert_next);
         const int task_index = parallel_mask & edge_hash_2(ordered_edge);
-        const EdgeMap &edge_map = edge_maps[task_index];
-        const int edge_i = edge_map.index_of(ordered_edge);
-        const int edge_index = edge_offsets[task_index][edge_i];
-        corner_edges[corner] = edge_index;
+        corner_edges[corner] += edge_offsets[task_index].start();
       }
     }
   });
 }
 
+static void offset_known_edges(const Span<int2> known_edges,
+                               const uint32_t parallel_mask,
+                               const OffsetIndices<int> edge_offsets,
+                               MutableSpan<int> edge_indices)
+{
+  threading::parallel_for(known_edges.index_range(), 2048, [&](const IndexRange range) {
+    for (const int edge_i : range) {
+      const OrderedEdge ordered_edge(known_edges[edge_i]);
+      const int task_index = parallel_mask & edge_hash_2(ordered_edge);
+      edge_indices[edge_i] += edge_offsets[task_index].start();
+    }
+  });
+}
+
 static int get_parallel_maps_count(const Mesh &mesh)
 {
   /* Don't use parallelization when the mesh is small. */
@@ -150,46 +180,37 @@ static int get_parallel_maps_count(const Mesh &mesh)
   return power_of_2_min_i(std::min(8, system_thread_count));
 }
 
-static void clear_hash_tables(MutableSpan<EdgeMap> edge_maps)
-{
-  threading::parallel_for_each(edge_maps, [](EdgeMap &edge_map) { edge_map.clear(); });
-}
-
-static void deselect_known_edges(const OffsetIndices<int> edge_offsets,
-                                 const Span<EdgeMap> edge_maps,
-                                 const uint32_t parallel_mask,
-                                 const Span<int2> known_edges,
-                                 MutableSpan<bool> selection)
-{
-  threading::parallel_for(known_edges.index_range(), 2048, [&](const IndexRange range) {
-    for (const int2 original_edge : known_edges.slice(range)) {
-      const OrderedEdge ordered_edge(original_edge);
-      const int task_index = parallel_mask & edge_hash_2(ordered_edge);
-      const EdgeMap &edge_map = edge_maps[task_index];
-      const int edge_i = edge_map.index_of(ordered_edge);
-      const int edge_index = edge_offsets[task_index][edge_i];
-      selection[edge_index] = false;
-    }
-  });
-}
-
 }  // namespace calc_edges
 
 void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new_edges)
 {
   /* Parallelization is achieved by having multiple hash tables for different subsets of edges.
-   * Each edge is assigned to one of the hash maps based on the lower bits of a hash value. */
+   * Each edge is assigned to one of the hash maps based on the lower bits of a hash value. The
+   * index of the edge within its map is stored directly in the final arrays, and only has to be
+   * offset by the start of the map in the final edge array once the sizes of all maps are known.
+   */
   const int parallel_maps = calc_edges::get_parallel_maps_count(mesh);
   BLI_assert(is_power_of_2_i(parallel_maps));
   const uint32_t parallel_mask = uint32_t(parallel_maps) - 1;
   Array<calc_edges::EdgeMap> edge_maps(parallel_maps);
   calc_edges::reserve_hash_maps(mesh, keep_existing_edges, edge_maps);
 
+  MutableAttributeAccessor attributes = mesh.attributes_for_write();
+  attributes.add<int>(".corner_edge", AttrDomain::Corner, AttributeInitConstruct());
+  MutableSpan<int> corner_edges = mesh.corner_edges_for_write();
+
+  /* Indices of the original edges in the new edge array, used to only select new edges. */
+  Array<int> known_edge_indices;
+  if (keep_existing_edges && select_new_edges) {
+    known_edge_indices.reinitialize(mesh.edges_num);
+  }
+
   /* Add all edges. */
   if (keep_existing_edges) {
-    calc_edges::add_existing_edges_to_hash_maps(mesh, parallel_mask, edge_maps);
+    calc_edges::add_existing_edges_to_hash_maps(
+        mesh, parallel_mask, edge_maps, known_edge_indices);
   }
-  calc_edges::add_face_edges_to_hash_maps(mesh, parallel_mask, edge_maps);
+  calc_edges::add_face_edges_to_hash_maps(mesh, parallel_mask, edge_maps, corner_edges);
 
   Array<int> edge_sizes(edge_maps.size() + 1);
   for (const int i : edge_maps.index_range()) {
@@ -198,22 +219,16 @@ void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new
   const OffsetIndices<int> edge_offsets = offset_indices::accumulate_counts_to_offsets(edge_sizes);
 
   /* Create new edges. */
-  MutableAttributeAccessor attributes = mesh.attributes_for_write();
-  attributes.add<int>(".corner_edge", AttrDomain::Corner, AttributeInitConstruct());
-  MutableSpan<int2> new_edges(MEM_calloc_arrayN<int2>(edge_offsets.total_size(), __func__),
+  MutableSpan<int2> new_edges(MEM_malloc_arrayN<int2>(edge_offsets.total_size(), __func__),
                               edge_offsets.total_size());
-  calc_edges::serialize_and_initialize_deduplicated_edges(edge_maps, edge_offsets, new_edges);
-  calc_edges::update_edge_indices_in_face_loops(mesh.faces(),
-                                                mesh.corner_verts(),
-                                                edge_maps,
-                                                parallel_mask,
-                                                edge_offsets,
-                                                mesh.corner_edges_for_write());
-
-  Array<int2> original_edges;
-  if (keep_existing_edges && select_new_edges) {
-    original_edges.reinitialize(mesh.edges_num);
-    array_utils::copy(mesh.edges(), original_edges.as_mutable_span());
+  calc_edges::serialize_and_free_deduplicated_edges(edge_maps, edge_offsets, new_edges);
+  if (parallel_maps > 1) {
+    calc_edges::offset_corner_edges(
+        mesh.faces(), mesh.corner_verts(), parallel_mask, edge_offsets, corner_edges);
+    if (!known_edge_indices.is_empty()) {
+      calc_edges::offset_known_edges(
+          mesh.edges(), parallel_mask, edge_offsets, known_edge_indices);
+    }
   }
 
   /* Free old CustomData and assign new one. */
@@ -228,9 +243,13 @@ void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new
         ".select_edge", AttrDomain::Edge);
     if (select_edge) {
       select_edge.span.fill(true);
-      if (!original_edges.is_empty()) {
-        calc_edges::deselect_known_edges(
-            edge_offsets, edge_maps, parallel_mask, original_edges, select_edge.span);
+      if (!known_edge_indices.is_empty()) {
+        threading::parallel_for(
+            known_edge_indices.index_range(), 4096, [&](const IndexRange range) {
+              for (const int i : range) {
+                select_edge.span[known_edge_indices[i]] = false;
+              }
+            });
       }
       select_edge.finish();
     }
@@ -240,9 +259,6 @@ void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new
     /* All edges are rebuilt from the faces, so there are no loose edges. */
     mesh.tag_loose_edges_none();
   }
-
-  /* Explicitly clear edge maps, because that way it can be parallelized. */
-  calc_edges::clear_hash_tables(edge_maps);
 }
 
 }  // namespace blender::bke
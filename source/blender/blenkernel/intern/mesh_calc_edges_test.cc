@@ -0,0 +1,157 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "testing/testing.h"
+
+#include "BLI_ordered_edge.hh"
+#include "BLI_set.hh"
+#include "BLI_task.hh"
+#include "BLI_timeit.hh"
+#include "BLI_vector.hh"
+
+#include "BKE_attribute.hh"
+#include "BKE_idtype.hh"
+#include "BKE_lib_id.hh"
+#include "BKE_mesh.hh"
+
+#include "CLG_log.h"
+
+namespace blender::bke::tests {
+
+class MeshCalcEdgesTest : public testing::Test {
+ public:
+  static void SetUpTestSuite()
+  {
+    CLG_init();
+    BKE_idtype_init();
+  }
+
+  static void TearDownTestSuite()
+  {
+    CLG_exit();
+  }
+};
+
+/** Create a grid of quads without any edges. */
+static Mesh *create_quad_grid_without_edges(const int size_x, const int size_y)
+{
+  const int verts_x = size_x + 1;
+  const int faces_num = size_x * size_y;
+  Mesh *mesh = BKE_mesh_new_nomain(verts_x * (size_y + 1), 0, faces_num, faces_num * 4);
+  MutableSpan<int> face_offsets = mesh->face_offsets_for_write();
+  MutableSpan<int> corner_verts = mesh->corner_verts_for_write();
+  threading::parallel_for(IndexRange(size_y), 64, [&](const IndexRange range) {
+    for (const int y : range) {
+      for (const int x : IndexRange(size_x)) {
+        const int face = y * size_x + x;
+        const int vert = y * verts_x + x;
+        face_offsets[face] = face * 4;
+        corner_verts[face * 4 + 0] = vert;
+        corner_verts[face * 4 + 1] = vert + 1;
+        corner_verts[face * 4 + 2] = vert + verts_x + 1;
+        corner_verts[face * 4 + 3] = vert + verts_x;
+      }
+    }
+  });
+  face_offsets.last() = faces_num * 4;
+  return mesh;
+}
+
+static void expect_valid_corner_edges(const Mesh &mesh)
+{
+  const OffsetIndices<int> faces = mesh.faces();
+  const Span<int> corner_verts = mesh.corner_verts();
+  const Span<int> corner_edges = mesh.corner_edges();
+  const Span<int2> edges = mesh.edges();
+  for (const int face : faces.index_range()) {
+    for (const int corner : faces[face]) {
+      const int vert_next = corner_verts[mesh::face_corner_next(faces[face], corner)];
+      EXPECT_EQ(OrderedEdge(edges[corner_edges[corner]]),
+                OrderedEdge(corner_verts[corner], vert_next));
+    }
+  }
+}
+
+TEST_F(MeshCalcEdgesTest, QuadGrid)
+{
+  /* Large enough to use multiple hash maps. */
+  const int size_x = 100;
+  const int size_y = 50;
+  Mesh *mesh = create_quad_grid_without_edges(size_x, size_y);
+  mesh_calc_edges(*mesh, false, false);
+
+  EXPECT_EQ(mesh->edges_num, size_x * (size_y + 1) + size_y * (size_x + 1));
+  Set<OrderedEdge> unique_edges;
+  for (const int2 edge : mesh->edges()) {
+    unique_edges.add(edge);
+  }
+  EXPECT_EQ(unique_edges.size(), mesh->edges_num);
+  expect_valid_corner_edges(*mesh);
+
+  BKE_id_free(nullptr, mesh);
+}
+
+TEST_F(MeshCalcEdgesTest, KeepExistingEdgesSelectNew)
+{
+  const int size_x = 100;
+  const int size_y = 50;
+  Mesh *full_mesh = create_quad_grid_without_edges(size_x, size_y);
+  mesh_calc_edges(*full_mesh, false, false);
+  const int full_edges_num = full_mesh->edges_num;
+
+  /* Only keep every third edge, in reversed order and direction, so that some edges are new. */
+  Vector<int2> existing_edges;
+  for (int i = full_edges_num - 1; i >= 0; i -= 3) {
+    const int2 edge = full_mesh->edges()[i];
+    existing_edges.append(int2(edge[1], edge[0]));
+  }
+  Mesh *mesh = BKE_mesh_new_nomain(full_mesh->verts_num,
+                                   int(existing_edges.size()),
+                                   full_mesh->faces_num,
+                                   full_mesh->corners_num);
+  mesh->face_offsets_for_write().copy_from(full_mesh->face_offsets());
+  mesh->corner_verts_for_write().copy_from(full_mesh->corner_verts());
+  mesh->edges_for_write().copy_from(existing_edges);
+  BKE_id_free(nullptr, full_mesh);
+
+  mesh_calc_edges(*mesh, true, true);
+  EXPECT_EQ(mesh->edges_num, full_edges_num);
+  expect_valid_corner_edges(*mesh);
+
+  Set<OrderedEdge> existing_edge_set;
+  for (const int2 edge : existing_edges) {
+    existing_edge_set.add(edge);
+  }
+  const VArray<bool> select_edge = *mesh->attributes().lookup<bool>(".select_edge",
+                                                                    AttrDomain::Edge);
+  ASSERT_TRUE(bool(select_edge));
+  int selected_num = 0;
+  for (const int edge : select_edge.index_range()) {
+    /* Only the edges that were added are selected. */
+    EXPECT_EQ(select_edge[edge], !existing_edge_set.contains(mesh->edges()[edge]));
+    selected_num += select_edge[edge];
+  }
+  EXPECT_EQ(selected_num, full_edges_num - existing_edges.size());
+
+  BKE_id_free(nullptr, mesh);
+}
+
+/**
+ * Set this to 1 to activate the benchmark. It is disabled by default, because it allocates a few
+ * gigabytes of memory.
+ */
+#if 0
+TEST_F(MeshCalcEdgesTest, Benchmark50MCorners)
+{
+  /* 3536 * 3536 * 4 corners are slightly more than 50 million. */
+  Mesh *mesh = create_quad_grid_without_edges(3536, 3536);
+  for ([[maybe_unused]] const int i : IndexRange(5)) {
+    SCOPED_TIMER("mesh_calc_edges");
+    mesh_calc_edges(*mesh, false, false);
+  }
+  BKE_id_free(nullptr, mesh);
+}
+#endif
+
+}  // namespace blender::bke::tests
@@ -187,6 +187,36 @@ void normals_calc_faces(const Span<float3> positions,
   });
 }
 
+/**
+ * Calculate the angle at every face corner, which is the weight of the face normal in the normal
+ * of the corner's vertex. Iterating over faces reads the position of every corner once and
+ * normalizes every edge direction once. Iterating over the faces of every vertex instead gathers
+ * the positions of both neighbors of every corner and normalizes every edge twice.
+ */
+static void calc_corner_angles(const Span<float3> positions,
+                               const OffsetIndices<int> faces,
+                               const Span<int> corner_verts,
+                               MutableSpan<float> corner_angles)
+{
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int face_i : range) {
+      const IndexRange face = faces[face_i];
+      const Span<int> face_verts = corner_verts.slice(face);
+      float3 position_curr = positions[face_verts.first()];
+      float3 edge_prev = math::normalize(position_curr - positions[face_verts.last()]);
+      for (const int i : face_verts.index_range()) {
+        const int i_next = (i == face_verts.size() - 1) ? 0 : i + 1;
+        const float3 position_next = positions[face_verts[i_next]];
+        const float3 edge_next = math::normalize(position_next - position_curr);
+        /* The direction to the previous vertex is the negated previous edge direction. */
+        corner_angles[face[i]] = math::safe_acos_approx(math::dot(-edge_prev, edge_next));
+        edge_prev = edge_next;
+        position_curr = position_next;
+      }
+    }
+  });
+}
+
 void normals_calc_verts(const Span<float3> vert_positions,
                         const OffsetIndices<int> faces,
                         const Span<int> corner_verts,
@@ -195,6 +225,9 @@ void normals_calc_verts(const Span<float3> vert_positions,
                         MutableSpan<float3> vert_normals)
 {
   const Span<float3> positions = vert_positions;
+  Array<float> corner_angles(corner_verts.size(), NoInitialization());
+  calc_corner_angles(positions, faces, corner_verts, corner_angles);
+
   threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
     for (const int vert : range) {
       const Span<int> vert_faces = vert_to_face_map[vert];
@@ -205,12 +238,8 @@ void normals_calc_verts(const Span<float3> vert_positions,
 
       float3 vert_normal(0);
       for (const int face : vert_faces) {
-        const int2 adjacent_verts = face_find_adjacent_verts(faces[face], corner_verts, vert);
-        const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
-        const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
-        const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
-
-        vert_normal += face_normals[face] * factor;
+        const int corner = face_find_corner_from_vert(faces[face], corner_verts, vert);
+        vert_normal += face_normals[face] * corner_angles[corner];
       }
 
       vert_normals[vert] = math::normalize(vert_normal);
@@ -24,6 +24,7 @@
 #include "BLI_memarena.h"
 #include "BLI_polyfill_2d.h"
 #include "BLI_rand.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_modifier_enums.h"
@@ -75,6 +76,49 @@ static bool mesh_remap_bvhtree_query_nearest(blender::bke::BVHTreeFromMesh *tree
   return false;
 }
 
+/**
+ * Find the nearest tree element for every position in parallel. The search for every position
+ * starts from scratch, so that the result does not depend on how the positions are split into
+ * tasks.
+ *
+ * \param r_indices: The index of the nearest element, or -1 if none was found within the
+ * maximum distance.
+ * \param r_tree_positions: Optional, the positions converted to tree coordinates.
+ */
+static void mesh_remap_bvhtree_query_nearest_parallel(
+    blender::bke::BVHTreeFromMesh *treedata,
+    const Span<float3> positions,
+    const SpaceTransform *space_transform,
+    const float max_dist_sq,
+    blender::MutableSpan<int> r_indices,
+    blender::MutableSpan<float> r_hit_dists,
+    blender::MutableSpan<float3> r_tree_positions)
+{
+  blender::threading::parallel_for(
+      positions.index_range(), 1024, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          float3 co = positions[i];
+          /* Convert the vertex to tree coordinates, if needed. */
+          if (space_transform) {
+            BLI_space_transform_apply(space_transform, co);
+          }
+          if (!r_tree_positions.is_empty()) {
+            r_tree_positions[i] = co;
+          }
+          BVHTreeNearest nearest = {0};
+          nearest.index = -1;
+          if (mesh_remap_bvhtree_query_nearest(
+                  treedata, &nearest, co, max_dist_sq, &r_hit_dists[i]))
+          {
+            r_indices[i] = nearest.index;
+          }
+          else {
+            r_indices[i] = -1;
+          }
+        }
+      });
+}
+
 static bool mesh_remap_bvhtree_query_raycast(blender::bke::BVHTreeFromMesh *treedata,
                                              BVHTreeRayHit *rayhit,
                                              const float co[3],
@@ -463,19 +507,22 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
 
     if (mode == MREMAP_MODE_VERT_NEAREST) {
       treedata = me_src->bvh_verts();
-      nearest.index = -1;
-
-      for (i = 0; i < vert_positions_dst.size(); i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+      /* The tree queries are done in parallel, the map items are defined afterwards because the
+       * map's memory arena is not thread-safe. */
+      blender::Array<int> nearest_indices(vert_positions_dst.size());
+      blender::Array<float> hit_dists(vert_positions_dst.size());
+      mesh_remap_bvhtree_query_nearest_parallel(&treedata,
+                                                vert_positions_dst,
+                                                space_transform,
+                                                max_dist_sq,
+                                                nearest_indices,
+                                                hit_dists,
+                                                {});
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &nearest.index, &full_weight);
+      for (i = 0; i < vert_positions_dst.size(); i++) {
+        if (nearest_indices[i] != -1) {
+          mesh_remap_item_define(r_map, i, hit_dists[i], 0, 1, &nearest_indices[i], &full_weight);
         }
         else {
           /* No source for this dest vertex! */
@@ -488,19 +535,24 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
       const blender::Span<blender::float3> positions_src = me_src->vert_positions();
 
       treedata = me_src->bvh_edges();
-      nearest.index = -1;
 
-      for (i = 0; i < vert_positions_dst.size(); i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
+      blender::Array<int> nearest_indices(vert_positions_dst.size());
+      blender::Array<float> hit_dists(vert_positions_dst.size());
+      blender::Array<blender::float3> tree_positions(vert_positions_dst.size());
+      mesh_remap_bvhtree_query_nearest_parallel(&treedata,
+                                                vert_positions_dst,
+                                                space_transform,
+                                                max_dist_sq,
+                                                nearest_indices,
+                                                hit_dists,
+                                                tree_positions);
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+      for (i = 0; i < vert_positions_dst.size(); i++) {
+        copy_v3_v3(tmp_co, tree_positions[i]);
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          const blender::int2 &edge = edges_src[nearest.index];
+        if (nearest_indices[i] != -1) {
+          hit_dist = hit_dists[i];
+          const blender::int2 &edge = edges_src[nearest_indices[i]];
           const float *v1cos = positions_src[edge[0]];
           const float *v2cos = positions_src[edge[1]];
 
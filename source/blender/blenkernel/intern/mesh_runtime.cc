@@ -315,6 +315,7 @@ void BKE_mesh_runtime_clear_geometry(Mesh *mesh)
   /* Tagging shared caches dirty will free the allocated data if there is only one user. */
   free_bvh_caches(*mesh->runtime);
   mesh->runtime->subdiv_ccg.reset();
+  mesh->runtime->shared_modifier_results.reset();
   mesh->runtime->bounds_cache.tag_dirty();
   mesh->runtime->vert_to_face_offset_cache.tag_dirty();
   mesh->runtime->vert_to_face_map_cache.tag_dirty();
@@ -422,6 +423,8 @@ void Mesh::tag_positions_changed_uniformly()
 void Mesh::tag_topology_changed()
 {
   BKE_mesh_runtime_clear_geometry(this);
+  /* Don't replace the tree that other meshes with the old topology can still refit. */
+  this->runtime->bvh_corner_tris_refit_source = std::make_shared<blender::bke::BVHRefitSource>();
 }
 
 void Mesh::tag_visibility_changed()
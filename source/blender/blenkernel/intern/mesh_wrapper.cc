@@ -25,6 +25,7 @@
 #include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
+#include "BKE_customdata.hh"
 #include "BKE_editmesh.hh"
 #include "BKE_editmesh_cache.hh"
 #include "BKE_lib_id.hh"
@@ -76,6 +77,111 @@ Mesh *BKE_mesh_wrapper_from_editmesh(std::shared_ptr<BMEditMesh> em,
   return mesh;
 }
 
+static bool customdata_masks_equal(const CustomData_MeshMasks &a, const CustomData_MeshMasks &b)
+{
+  return a.vmask == b.vmask && a.emask == b.emask && a.fmask == b.fmask && a.pmask == b.pmask &&
+         a.lmask == b.lmask;
+}
+
+/**
+ * Fill the empty \a mesh with the data of the previous conversion of the edit mesh when only
+ * vertex positions changed since, which avoids converting all elements and attributes again.
+ * The data is shared, only the positions are copied from the #BMesh.
+ */
+static bool mesh_wrapper_mdata_from_eval_cache(BMEditMesh &em, Mesh &mesh)
+{
+  using namespace blender;
+  if (!em.eval_cache) {
+    return false;
+  }
+  bke::EditMeshEvalCache &cache = *em.eval_cache;
+  std::scoped_lock lock(cache.mutex);
+  if (!cache.only_positions_changed || cache.mesh == nullptr) {
+    return false;
+  }
+  const Mesh &src = *cache.mesh;
+  const BMesh &bm = *em.bm;
+  if (src.verts_num != bm.totvert || src.edges_num != bm.totedge ||
+      src.faces_num != bm.totface || src.corners_num != bm.totloop)
+  {
+    return false;
+  }
+  if (!customdata_masks_equal(cache.cd_mask_extra, mesh.runtime->cd_mask_extra)) {
+    return false;
+  }
+
+  BKE_mesh_runtime_clear_geometry(&mesh);
+  mesh.verts_num = src.verts_num;
+  mesh.edges_num = src.edges_num;
+  mesh.faces_num = src.faces_num;
+  mesh.corners_num = src.corners_num;
+  CustomData_init_from(&src.vert_data, &mesh.vert_data, CD_MASK_ALL, mesh.verts_num);
+  CustomData_init_from(&src.edge_data, &mesh.edge_data, CD_MASK_ALL, mesh.edges_num);
+  CustomData_init_from(&src.face_data, &mesh.face_data, CD_MASK_ALL, mesh.faces_num);
+  CustomData_init_from(&src.corner_data, &mesh.corner_data, CD_MASK_ALL, mesh.corners_num);
+  implicit_sharing::copy_shared_pointer(src.face_offset_indices,
+                                        src.runtime->face_offsets_sharing_info,
+                                        &mesh.face_offset_indices,
+                                        &mesh.runtime->face_offsets_sharing_info);
+  mesh.act_face = src.act_face;
+  mesh.runtime->deformed_only = true;
+
+  /* Caches that only depend on the topology stay valid. */
+  mesh.runtime->loose_verts_cache = src.runtime->loose_verts_cache;
+  mesh.runtime->verts_no_face_cache = src.runtime->verts_no_face_cache;
+  mesh.runtime->loose_edges_cache = src.runtime->loose_edges_cache;
+  mesh.runtime->vert_to_face_offset_cache = src.runtime->vert_to_face_offset_cache;
+  mesh.runtime->vert_to_face_map_cache = src.runtime->vert_to_face_map_cache;
+  mesh.runtime->vert_to_corner_map_cache = src.runtime->vert_to_corner_map_cache;
+  mesh.runtime->corner_to_face_map_cache = src.runtime->corner_to_face_map_cache;
+  mesh.runtime->max_material_index = src.runtime->max_material_index;
+
+  MutableSpan<float3> positions = mesh.vert_positions_for_write();
+  BMIter iter;
+  BMVert *vert;
+  int i;
+  BM_ITER_MESH_INDEX (vert, &iter, em.bm, BM_VERTS_OF_MESH, i) {
+    positions[i] = vert->co;
+  }
+  mesh.tag_positions_changed();
+  return true;
+}
+
+/**
+ * Keep a copy of the mesh converted from the edit mesh, to reuse it later. This is only done while
+ * vertices are being moved (see #BKE_editmesh_eval_cache_tag_positions_changed), so that the copy
+ * isn't kept alive outside of that.
+ */
+static void mesh_wrapper_eval_cache_store(BMEditMesh &em, const Mesh &mesh)
+{
+  if (!em.eval_cache) {
+    return;
+  }
+  blender::bke::EditMeshEvalCache &cache = *em.eval_cache;
+  {
+    std::scoped_lock lock(cache.mutex);
+    if (!cache.only_positions_changed) {
+      return;
+    }
+  }
+  Mesh *mesh_copy = BKE_mesh_copy_for_eval(mesh);
+  /* The cache is owned by the edit mesh, it must not reference it. */
+  mesh_copy->runtime->edit_mesh.reset();
+  mesh_copy->runtime->edit_data.reset();
+
+  std::scoped_lock lock(cache.mutex);
+  if (!cache.only_positions_changed) {
+    /* Cleared in the meantime. */
+    BKE_id_free(nullptr, mesh_copy);
+    return;
+  }
+  if (cache.mesh) {
+    BKE_id_free(nullptr, cache.mesh);
+  }
+  cache.mesh = mesh_copy;
+  cache.cd_mask_extra = mesh.runtime->cd_mask_extra;
+}
+
 void BKE_mesh_wrapper_ensure_mdata(Mesh *mesh)
 {
   if (mesh->runtime->wrapper_type == ME_WRAPPER_TYPE_MDATA) {
@@ -100,17 +206,21 @@ void BKE_mesh_wrapper_ensure_mdata(Mesh *mesh)
       BLI_assert(mesh->runtime->edit_data != nullptr);
 
       BMEditMesh *em = mesh->runtime->edit_mesh.get();
-      BM_mesh_bm_to_me_for_eval(*em->bm, *mesh, &mesh->runtime->cd_mask_extra);
-
-      /* Adding original index layers here assumes that all BMesh Mesh wrappers are created from
-       * original edit mode meshes (the only case where adding original indices makes sense).
-       * If that assumption is broken, the layers might be incorrect because they might not
-       * actually be "original".
-       *
-       * There is also a performance aspect, where this also assumes that original indices are
-       * always needed when converting a BMesh to a mesh with the mesh wrapper system. That might
-       * be wrong, but it's not harmful. */
-      BKE_mesh_ensure_default_orig_index_customdata_no_check(mesh);
+      if (!mesh_wrapper_mdata_from_eval_cache(*em, *mesh)) {
+        BM_mesh_bm_to_me_for_eval(*em->bm, *mesh, &mesh->runtime->cd_mask_extra);
+
+        /* Adding original index layers here assumes that all BMesh Mesh wrappers are created from
+         * original edit mode meshes (the only case where adding original indices makes sense).
+         * If that assumption is broken, the layers might be incorrect because they might not
+         * actually be "original".
+         *
+         * There is also a performance aspect, where this also assumes that original indices are
+         * always needed when converting a BMesh to a mesh with the mesh wrapper system. That might
+         * be wrong, but it's not harmful. */
+        BKE_mesh_ensure_default_orig_index_customdata_no_check(mesh);
+
+        mesh_wrapper_eval_cache_store(*em, *mesh);
+      }
 
       blender::bke::EditMeshData &edit_data = *mesh->runtime->edit_data;
       if (!edit_data.vert_positions.is_empty()) {
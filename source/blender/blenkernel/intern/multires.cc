@@ -971,7 +971,7 @@ static void multiresModifier_disp_run(DerivedMesh *dm,
   }
 }
 
-void multires_stitch_grids(Object *ob)
+void multires_stitch_grids(Object *ob, const blender::IndexMask &face_mask)
 {
   using namespace blender;
   if (ob == nullptr) {
@@ -987,7 +987,7 @@ void multires_stitch_grids(Object *ob)
   }
   BLI_assert(bke::object::pbvh_get(*ob) &&
              bke::object::pbvh_get(*ob)->type() == blender::bke::pbvh::Type::Grids);
-  BKE_subdiv_ccg_average_stitch_faces(*subdiv_ccg, IndexMask(subdiv_ccg->faces.size()));
+  BKE_subdiv_ccg_average_stitch_faces(*subdiv_ccg, face_mask);
 }
 
 DerivedMesh *multires_make_derived_from_derived(DerivedMesh *dm,
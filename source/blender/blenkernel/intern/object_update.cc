@@ -129,6 +129,8 @@ void BKE_object_handle_data_update(Depsgraph *depsgraph, Scene *scene, Object *o
 {
   DEG_debug_print_eval(depsgraph, __func__, ob->id.name, ob);
 
+  MEM_CategoryScope mem_category_scope(MEM_CATEGORY_GEOMETRY);
+
   /* includes all keys and modifiers */
   switch (ob->type) {
     case OB_MESH: {
@@ -33,6 +33,7 @@
 #include "DNA_scene_types.h"
 #include "DNA_texture_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_kdopbvh.hh"
 #include "BLI_kdtree.h"
 #include "BLI_linklist.h"
@@ -2655,19 +2656,32 @@ void psys_find_parents(ParticleSimulationData *sim, const bool use_render_params
 
   BLI_kdtree_3d_balance(tree);
 
-  for (; p < totchild; p++, cpa++) {
+  /* Look up all parents at once, which is much faster than separate queries for many children. */
+  const int first_child = p;
+  blender::Array<float3> child_orcos(std::max(totchild - first_child, 0));
+  for (; p < totchild; p++) {
+    ChildParticle *child = &sim->psys->child[p];
     psys_particle_on_emitter(sim->psmd,
                              from,
-                             cpa->num,
+                             child->num,
                              DMCACHE_ISCHILD,
-                             cpa->fuv,
-                             cpa->foffset,
+                             child->fuv,
+                             child->foffset,
                              co,
                              nullptr,
                              nullptr,
                              nullptr,
-                             orco);
-    cpa->parent = BLI_kdtree_3d_find_nearest(tree, orco, nullptr);
+                             child_orcos[p - first_child]);
+  }
+  blender::Array<int> parents(child_orcos.size());
+  BLI_kdtree_3d_find_nearest_batch(tree,
+                                   reinterpret_cast<const float(*)[3]>(child_orcos.data()),
+                                   uint(child_orcos.size()),
+                                   nullptr,
+                                   parents.data(),
+                                   nullptr);
+  for (const int i : parents.index_range()) {
+    sim->psys->child[first_child + i].parent = parents[i];
   }
 
   BLI_kdtree_3d_free(tree);
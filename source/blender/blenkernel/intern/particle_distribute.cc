@@ -17,6 +17,7 @@
 #include "BLI_rand.h"
 #include "BLI_sort.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_mesh_types.h"
@@ -1067,44 +1068,56 @@ static int psys_thread_context_init_distribute(ParticleThreadContext *ctx,
 
   /* Calculate weights from face areas */
   if ((part->flag & PART_EDISTR || children) && from != PART_FROM_VERT) {
-    float totarea = 0.0f, co1[3], co2[3], co3[3], co4[3];
+    float totarea = 0.0f;
     const float(*orcodata)[3];
 
     orcodata = static_cast<const float(*)[3]>(CustomData_get_layer(&mesh->vert_data, CD_ORCO));
 
-    MFace *mfaces = (MFace *)CustomData_get_layer_for_write(
-        &mesh->fdata_legacy, CD_MFACE, mesh->totface_legacy);
-    for (i = 0; i < totelem; i++) {
-      MFace *mf = &mfaces[i];
-
-      if (orcodata) {
-        /* Transform orcos from normalized 0..1 to object space. */
-        copy_v3_v3(co1, orcodata[mf->v1]);
-        copy_v3_v3(co2, orcodata[mf->v2]);
-        copy_v3_v3(co3, orcodata[mf->v3]);
-        BKE_mesh_orco_verts_transform(static_cast<Mesh *>(ob->data), &co1, 1, true);
-        BKE_mesh_orco_verts_transform(static_cast<Mesh *>(ob->data), &co2, 1, true);
-        BKE_mesh_orco_verts_transform(static_cast<Mesh *>(ob->data), &co3, 1, true);
-        if (mf->v4) {
-          copy_v3_v3(co4, orcodata[mf->v4]);
-          BKE_mesh_orco_verts_transform(static_cast<Mesh *>(ob->data), &co4, 1, true);
-        }
-      }
-      else {
-        blender::MutableSpan<blender::float3> positions = mesh->vert_positions_for_write();
-        copy_v3_v3(co1, positions[mf->v1]);
-        copy_v3_v3(co2, positions[mf->v2]);
-        copy_v3_v3(co3, positions[mf->v3]);
-        if (mf->v4) {
-          copy_v3_v3(co4, positions[mf->v4]);
-        }
-      }
+    const MFace *mfaces = static_cast<const MFace *>(
+        CustomData_get_layer(&mesh->fdata_legacy, CD_MFACE));
+    const blender::Span<blender::float3> positions = mesh->vert_positions();
+    /* Same as #BKE_mesh_orco_verts_transform, but with the texture space only looked up once,
+     * since it may have to be computed first. */
+    float texspace_location[3] = {0.0f, 0.0f, 0.0f}, texspace_size[3] = {1.0f, 1.0f, 1.0f};
+    if (orcodata) {
+      Mesh *orco_mesh = static_cast<Mesh *>(ob->data);
+      BKE_mesh_texspace_get(orco_mesh->texcomesh ? orco_mesh->texcomesh : orco_mesh,
+                            texspace_location,
+                            texspace_size);
+    }
+    blender::threading::parallel_for(
+        blender::IndexRange(totelem), 4096, [&](const blender::IndexRange range) {
+          float co1[3], co2[3], co3[3], co4[3];
+          for (const int64_t face : range) {
+            const MFace *mf = &mfaces[face];
+
+            if (orcodata) {
+              /* Transform orcos from normalized 0..1 to object space. */
+              madd_v3_v3v3v3(co1, texspace_location, orcodata[mf->v1], texspace_size);
+              madd_v3_v3v3v3(co2, texspace_location, orcodata[mf->v2], texspace_size);
+              madd_v3_v3v3v3(co3, texspace_location, orcodata[mf->v3], texspace_size);
+              if (mf->v4) {
+                madd_v3_v3v3v3(co4, texspace_location, orcodata[mf->v4], texspace_size);
+              }
+            }
+            else {
+              copy_v3_v3(co1, positions[mf->v1]);
+              copy_v3_v3(co2, positions[mf->v2]);
+              copy_v3_v3(co3, positions[mf->v3]);
+              if (mf->v4) {
+                copy_v3_v3(co4, positions[mf->v4]);
+              }
+            }
 
-      cur = mf->v4 ? area_quad_v3(co1, co2, co3, co4) : area_tri_v3(co1, co2, co3);
+            element_weight[face] = mf->v4 ? area_quad_v3(co1, co2, co3, co4) :
+                                            area_tri_v3(co1, co2, co3);
+          }
+        });
 
+    /* Sum in order, so the total doesn't depend on how the work was split. */
+    for (i = 0; i < totelem; i++) {
+      cur = element_weight[i];
       maxweight = std::max(cur, maxweight);
-
-      element_weight[i] = cur;
       totarea += cur;
     }
 
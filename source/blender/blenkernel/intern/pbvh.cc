@@ -124,9 +124,9 @@ BLI_NOINLINE static void build_mesh_leaf_nodes(const int verts_num,
       }
     }
     node.unique_verts_num_ = owned_verts.size();
-    node.vert_indices_.reserve(owned_verts.size() + shared_verts.size());
-    node.vert_indices_.add_multiple(owned_verts);
-    node.vert_indices_.add_multiple(shared_verts);
+    node.vert_indices_.reinitialize(owned_verts.size() + shared_verts.size());
+    node.vert_indices_.as_mutable_span().take_front(owned_verts.size()).copy_from(owned_verts);
+    node.vert_indices_.as_mutable_span().drop_front(owned_verts.size()).copy_from(shared_verts);
   }
 }
 
@@ -261,19 +261,17 @@ Tree Tree::from_spatially_organized_mesh(const Mesh &mesh)
 
           pbvh_node.corners_num_ = spatial_groups[node_idx].corners_count;
 
-          pbvh_node.unique_verts_num_ = spatial_groups[node_idx].unique_verts.size();
-
-          pbvh_node.vert_indices_.reserve(spatial_groups[node_idx].unique_verts.size() +
-                                          spatial_groups[node_idx].shared_verts.size());
-
-          for (const int i : spatial_groups[node_idx].unique_verts.index_range()) {
-            const int vert_idx = spatial_groups[node_idx].unique_verts.start() + i;
-            pbvh_node.vert_indices_.add(vert_idx);
-          }
-
-          for (const int vert_idx : spatial_groups[node_idx].shared_verts) {
-            pbvh_node.vert_indices_.add(vert_idx);
-          }
+          const IndexRange unique_verts = spatial_groups[node_idx].unique_verts;
+          const Span<int> shared_verts = spatial_groups[node_idx].shared_verts;
+          pbvh_node.unique_verts_num_ = unique_verts.size();
+
+          pbvh_node.vert_indices_.reinitialize(unique_verts.size() + shared_verts.size());
+          MutableSpan<int> node_verts = pbvh_node.vert_indices_;
+          array_utils::fill_index_range<int>(node_verts.take_front(unique_verts.size()),
+                                             unique_verts.start());
+          MutableSpan<int> node_shared_verts = node_verts.drop_front(unique_verts.size());
+          node_shared_verts.copy_from(shared_verts);
+          std::sort(node_shared_verts.begin(), node_shared_verts.end());
         }
         else {
           pbvh_node.unique_verts_num_ = 0;
@@ -320,7 +318,6 @@ Tree Tree::from_mesh(const Mesh &mesh)
   }
 
   constexpr int leaf_limit = 2500;
-  static_assert(leaf_limit < std::numeric_limits<MeshNode::LocalVertMapIndexT>::max());
 
   Array<float3> face_centers(faces.size());
   const Bounds<float3> bounds = threading::parallel_reduce(
@@ -632,6 +629,11 @@ Tree::~Tree()
   pixels_free(this);
 }
 
+IndexMask Tree::nodes_with_changed_positions(IndexMaskMemory &memory) const
+{
+  return IndexMask::from_bits(bounds_dirty_, memory);
+}
+
 void Tree::tag_positions_changed(const IndexMask &node_mask)
 {
   bounds_dirty_.resize(std::max(bounds_dirty_.size(), node_mask.min_array_size()), false);
@@ -1857,6 +1859,24 @@ static void calc_mesh_intersect_data(const Span<int> corner_verts,
   }
 }
 
+/**
+ * Find the index of a vertex in #MeshNode::all_verts(). Both the unique and the shared part of the
+ * array are sorted, see #MeshNode::vert_indices_.
+ */
+static int node_vert_index(const MeshNode &node, const int vert)
+{
+  const Span<int> verts = node.all_verts();
+  const Span<int> unique_verts = verts.take_front(node.unique_verts_num_);
+  const int *unique_vert = std::lower_bound(unique_verts.begin(), unique_verts.end(), vert);
+  if (unique_vert != unique_verts.end() && *unique_vert == vert) {
+    return unique_vert - verts.begin();
+  }
+  const Span<int> shared_verts = verts.drop_front(node.unique_verts_num_);
+  const int *shared_vert = std::lower_bound(shared_verts.begin(), shared_verts.end(), vert);
+  BLI_assert(shared_vert != shared_verts.end() && *shared_vert == vert);
+  return shared_vert - verts.begin();
+}
+
 bool node_raycast_mesh(const MeshNode &node,
                        const Span<float3> node_positions,
                        const Span<float3> vert_positions,
@@ -1905,7 +1925,6 @@ bool node_raycast_mesh(const MeshNode &node,
     }
   }
   else {
-    const MeshNode::LocalVertMap &vert_map = node.vert_indices_;
     for (const int i : face_indices.index_range()) {
       const int face_i = face_indices[i];
       if (!hide_poly.is_empty() && hide_poly[face_i]) {
@@ -1915,9 +1934,9 @@ bool node_raycast_mesh(const MeshNode &node,
       for (const int tri_i : bke::mesh::face_triangles_range(faces, face_i)) {
         const int3 &tri = corner_tris[tri_i];
         const std::array<const float *, 3> co{
-            {node_positions[vert_map.index_of(corner_verts[tri[0]])],
-             node_positions[vert_map.index_of(corner_verts[tri[1]])],
-             node_positions[vert_map.index_of(corner_verts[tri[2]])]}};
+            {node_positions[node_vert_index(node, corner_verts[tri[0]])],
+             node_positions[node_vert_index(node, corner_verts[tri[1]])],
+             node_positions[node_vert_index(node, corner_verts[tri[2]])]}};
         if (ray_face_intersection_tri(ray_start, isect_precalc, co[0], co[1], co[2], depth)) {
           hit = true;
           calc_mesh_intersect_data(corner_verts,
@@ -2225,7 +2244,6 @@ static bool pbvh_faces_node_nearest_to_ray(const MeshNode &node,
     }
   }
   else {
-    const MeshNode::LocalVertMap &vert_map = node.vert_indices_;
     for (const int i : face_indices.index_range()) {
       const int face_i = face_indices[i];
       if (!hide_poly.is_empty() && hide_poly[face_i]) {
@@ -2234,11 +2252,14 @@ static bool pbvh_faces_node_nearest_to_ray(const MeshNode &node,
 
       for (const int tri_i : bke::mesh::face_triangles_range(faces, face_i)) {
         const int3 &corner_tri = corner_tris[tri_i];
+        const int3 tri_verts(node_vert_index(node, corner_verts[corner_tri[0]]),
+                             node_vert_index(node, corner_verts[corner_tri[1]]),
+                             node_vert_index(node, corner_verts[corner_tri[2]]));
         hit |= ray_face_nearest_tri(ray_start,
                                     ray_normal,
-                                    node_positions[vert_map.index_of(corner_verts[corner_tri[0]])],
-                                    node_positions[vert_map.index_of(corner_verts[corner_tri[1]])],
-                                    node_positions[vert_map.index_of(corner_verts[corner_tri[2]])],
+                                    node_positions[tri_verts[0]],
+                                    node_positions[tri_verts[1]],
+                                    node_positions[tri_verts[2]],
                                     r_depth,
                                     dist_sq);
       }
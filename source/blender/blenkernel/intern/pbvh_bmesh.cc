@@ -14,6 +14,7 @@
 #include "BLI_math_vector.hh"
 #include "BLI_memarena.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
 
@@ -934,44 +935,63 @@ static void short_edge_queue_edge_add(const EdgeQueueContext *eq_ctx, BMEdge *e)
   }
 }
 
+/** Add the edges of a face in range of the brush to the queue. */
 static void long_edge_queue_face_add(const EdgeQueueContext *eq_ctx, BMFace *f)
 {
-  if (eq_ctx->queue->use_front_face) {
-    if (dot_v3v3(f->no, *eq_ctx->queue->view_normal) < 0.0f) {
-      return;
+  /* Check each edge of the face. */
+  const BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
+  const BMLoop *l_iter = l_first;
+  do {
+    const float len_sq = BM_edge_calc_length_squared(l_iter->e);
+    if (len_sq > eq_ctx->queue->limit_len_squared) {
+      long_edge_queue_edge_add_recursive(
+          eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->queue->limit_len);
     }
-  }
-
-  if (eq_ctx->queue->edge_queue_tri_in_range(eq_ctx->queue, f)) {
-    /* Check each edge of the face. */
-    const BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
-    const BMLoop *l_iter = l_first;
-    do {
-      const float len_sq = BM_edge_calc_length_squared(l_iter->e);
-      if (len_sq > eq_ctx->queue->limit_len_squared) {
-        long_edge_queue_edge_add_recursive(
-            eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->queue->limit_len);
-      }
-    } while ((l_iter = l_iter->next) != l_first);
-  }
+  } while ((l_iter = l_iter->next) != l_first);
 }
 
+/** Add the edges of a face in range of the brush to the queue. */
 static void short_edge_queue_face_add(const EdgeQueueContext *eq_ctx, BMFace *f)
 {
-  if (eq_ctx->queue->use_front_face) {
-    if (dot_v3v3(f->no, *eq_ctx->queue->view_normal) < 0.0f) {
-      return;
-    }
-  }
+  /* Check each edge of the face. */
+  const BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
+  const BMLoop *l_iter = l_first;
+  do {
+    short_edge_queue_edge_add(eq_ctx, l_iter->e);
+  } while ((l_iter = l_iter->next) != l_first);
+}
 
-  if (eq_ctx->queue->edge_queue_tri_in_range(eq_ctx->queue, f)) {
-    /* Check each edge of the face. */
-    const BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
-    const BMLoop *l_iter = l_first;
-    do {
-      short_edge_queue_edge_add(eq_ctx, l_iter->e);
-    } while ((l_iter = l_iter->next) != l_first);
-  }
+/**
+ * Find the faces in range of the brush in the leaf nodes marked for topology update. Testing the
+ * faces only reads the mesh, so it is done for all nodes in parallel. Adding their edges to the
+ * queue tags the edges, so that is done afterwards on a single thread, in the order of the nodes
+ * to keep the result deterministic.
+ */
+static Array<Vector<BMFace *>> edge_queue_faces_in_range(const EdgeQueue &queue,
+                                                         const Span<BMeshNode> nodes)
+{
+  Array<Vector<BMFace *>> node_faces(nodes.size());
+  threading::parallel_for(nodes.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      const BMeshNode &node = nodes[i];
+      if (!(node.flag_ & Node::Leaf) || !(node.flag_ & Node::UpdateTopology) ||
+          (node.flag_ & Node::FullyHidden))
+      {
+        continue;
+      }
+      for (BMFace *f : node.bm_faces_) {
+        if (queue.use_front_face) {
+          if (dot_v3v3(f->no, *queue.view_normal) < 0.0f) {
+            continue;
+          }
+        }
+        if (queue.edge_queue_tri_in_range(&queue, f)) {
+          node_faces[i].append(f);
+        }
+      }
+    }
+  });
+  return node_faces;
 }
 
 /**
@@ -1019,14 +1039,9 @@ static void long_edge_queue_create(const EdgeQueueContext *eq_ctx,
   pbvh_bmesh_edge_tag_verify(pbvh);
 #endif
 
-  for (BMeshNode &node : nodes) {
-    /* Check leaf nodes marked for topology update. */
-    if ((node.flag_ & Node::Leaf) && (node.flag_ & Node::UpdateTopology) &&
-        !(node.flag_ & Node::FullyHidden))
-    {
-      for (BMFace *f : node.bm_faces_) {
-        long_edge_queue_face_add(eq_ctx, f);
-      }
+  for (const Span<BMFace *> faces : edge_queue_faces_in_range(*eq_ctx->queue, nodes)) {
+    for (BMFace *f : faces) {
+      long_edge_queue_face_add(eq_ctx, f);
     }
   }
 }
@@ -1072,14 +1087,9 @@ static void short_edge_queue_create(const EdgeQueueContext *eq_ctx,
     eq_ctx->queue->edge_queue_tri_in_range = edge_queue_tri_in_sphere;
   }
 
-  for (BMeshNode &node : nodes) {
-    /* Check leaf nodes marked for topology update */
-    if ((node.flag_ & Node::Leaf) && (node.flag_ & Node::UpdateTopology) &&
-        !(node.flag_ & Node::FullyHidden))
-    {
-      for (BMFace *f : node.bm_faces_) {
-        short_edge_queue_face_add(eq_ctx, f);
-      }
+  for (const Span<BMFace *> faces : edge_queue_faces_in_range(*eq_ctx->queue, nodes)) {
+    for (BMFace *f : faces) {
+      short_edge_queue_face_add(eq_ctx, f);
     }
   }
 }
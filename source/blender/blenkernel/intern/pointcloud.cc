@@ -112,6 +112,10 @@ static void pointcloud_foreach_id(ID *id, LibraryForeachIDData *data)
   }
 }
 
+/**
+ * Thread-safe (#IDTYPE_FLAGS_BLEND_WRITE_THREADSAFE): only the temporary copy of the point cloud
+ * and local buffers are modified, attribute arrays and other IDs are only read.
+ */
 static void pointcloud_blend_write(BlendWriter *writer, ID *id, const void *id_address)
 {
   using namespace blender;
@@ -164,7 +168,7 @@ IDTypeInfo IDType_ID_PT = {
     /*name*/ "PointCloud",
     /*name_plural*/ N_("pointclouds"),
     /*translation_context*/ BLT_I18NCONTEXT_ID_POINTCLOUD,
-    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE,
+    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE | IDTYPE_FLAGS_BLEND_WRITE_THREADSAFE,
     /*asset_type_info*/ nullptr,
 
     /*init_data*/ pointcloud_init_data,
@@ -22,6 +22,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_mutex.hh"
+#include "BLI_rand.h"
 
 #ifdef WITH_BULLET
 #  include "RBI_api.h"
@@ -1947,6 +1948,15 @@ static void rigidbody_update_external_forces(Depsgraph *depsgraph,
                                              Scene *scene,
                                              RigidBodyWorld *rbw)
 {
+  EffectorWeights *effector_weights = rbw->effector_weights;
+  /* The effectors are the same for all bodies: only objects with a force field are effectors,
+   * and those are skipped below, so none of the bodies has to be excluded from its own list.
+   * Create them once instead of for every body, which also avoids updating particle trees and
+   * guide curves once per body. */
+  ListBase *effectors = BKE_effectors_create(depsgraph, nullptr, nullptr, effector_weights, false);
+  const float ctime = DEG_get_ctime(depsgraph);
+  const uint rng_frame = uint(ctime >= 0 ? ctime : -ctime);
+
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
     /* only update if rigid body exists */
     RigidBodyOb *rbo = ob->rigidbody_object;
@@ -1959,13 +1969,14 @@ static void rigidbody_update_external_forces(Depsgraph *depsgraph,
     if (rbo->type == RBO_TYPE_ACTIVE &&
         ((ob->pd == nullptr) || (ob->pd->forcefield == PFIELD_NULL)))
     {
-      EffectorWeights *effector_weights = rbw->effector_weights;
       EffectedPoint epoint;
-      ListBase *effectors;
 
-      /* get effectors present in the group specified by effector_weights */
-      effectors = BKE_effectors_create(depsgraph, ob, nullptr, effector_weights, false);
       if (effectors) {
+        /* Restart the noise of every effector, as if it was created for this body. */
+        LISTBASE_FOREACH (EffectorCache *, eff, effectors) {
+          BLI_rng_seed(eff->rng, eff->pd->seed + rng_frame);
+        }
+
         float eff_force[3] = {0.0f, 0.0f, 0.0f};
         float eff_loc[3], eff_vel[3];
 
@@ -2003,13 +2014,12 @@ static void rigidbody_update_external_forces(Depsgraph *depsgraph,
       else if (G.f & G_DEBUG) {
         printf("\tno forces to apply to '%s'\n", ob->id.name + 2);
       }
-
-      /* cleanup */
-      BKE_effectors_free(effectors);
     }
     /* NOTE: passive objects don't need to be updated since they don't move */
   }
   FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
+
+  BKE_effectors_free(effectors);
 }
 
 static void rigidbody_free_substep_data(ListBase *substep_targets)
@@ -15,7 +15,6 @@
 #include "BLI_math_bits.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
-#include "BLI_set.hh"
 #include "BLI_task.hh"
 #include "BLI_vector_set.hh"
 
@@ -803,60 +802,65 @@ static void subdiv_ccg_average_corners(SubdivCCG &subdiv_ccg,
 
 void BKE_subdiv_ccg_average_grids(SubdivCCG &subdiv_ccg)
 {
-#ifdef WITH_OPENSUBDIV
-  using namespace blender;
-  const CCGKey key = BKE_subdiv_ccg_key_top_level(subdiv_ccg);
   /* Average inner boundaries of grids (within one face), across faces
-   * from different face-corners. */
+   * from different face-corners. Stitching all faces also averages all boundaries and corners. */
   BKE_subdiv_ccg_average_stitch_faces(subdiv_ccg, subdiv_ccg.faces.index_range());
-  subdiv_ccg_average_boundaries(subdiv_ccg, key, subdiv_ccg.adjacent_edges.index_range());
-  subdiv_ccg_average_corners(subdiv_ccg, key, subdiv_ccg.adjacent_verts.index_range());
-#else
-  UNUSED_VARS(subdiv_ccg);
-#endif
 }
 
 #ifdef WITH_OPENSUBDIV
 
-static void subdiv_ccg_affected_face_adjacency(SubdivCCG &subdiv_ccg,
+/**
+ * Find the coarse vertices and edges adjacent to the given faces, which are the only ones whose
+ * grid boundaries and corners have to be averaged after the faces changed.
+ */
+static void subdiv_ccg_affected_face_adjacency(const SubdivCCG &subdiv_ccg,
                                                const IndexMask &face_mask,
-                                               blender::Set<int> &adjacent_verts,
-                                               blender::Set<int> &adjacent_edges)
+                                               IndexMaskMemory &memory,
+                                               IndexMask &r_adjacent_verts,
+                                               IndexMask &r_adjacent_edges)
 {
+  using namespace blender;
+  if (face_mask.size() == subdiv_ccg.faces.size()) {
+    r_adjacent_verts = subdiv_ccg.adjacent_verts.index_range();
+    r_adjacent_edges = subdiv_ccg.adjacent_edges.index_range();
+    return;
+  }
+
   Subdiv *subdiv = subdiv_ccg.subdiv;
-  const blender::opensubdiv::TopologyRefinerImpl *topology_refiner = subdiv->topology_refiner;
+  const opensubdiv::TopologyRefinerImpl *topology_refiner = subdiv->topology_refiner;
 
-  face_mask.foreach_index([&](const int face_index) {
+  /* Writing the same value from multiple threads is fine, faces often share vertices and edges. */
+  Array<bool> vert_affected(subdiv_ccg.adjacent_verts.size(), false);
+  Array<bool> edge_affected(subdiv_ccg.adjacent_edges.size(), false);
+  face_mask.foreach_index(GrainSize(1024), [&](const int face_index) {
     const OpenSubdiv::Far::ConstIndexArray face_vertices =
         topology_refiner->base_level().GetFaceVertices(face_index);
-    adjacent_verts.add_multiple({face_vertices.begin(), face_vertices.size()});
-
+    for (const int vert : face_vertices) {
+      vert_affected[vert] = true;
+    }
     const OpenSubdiv::Far::ConstIndexArray face_edges =
         topology_refiner->base_level().GetFaceEdges(face_index);
-    adjacent_edges.add_multiple({face_edges.begin(), face_edges.size()});
+    for (const int edge : face_edges) {
+      edge_affected[edge] = true;
+    }
   });
+
+  r_adjacent_verts = IndexMask::from_bools(vert_affected, memory);
+  r_adjacent_edges = IndexMask::from_bools(edge_affected, memory);
 }
 
 void subdiv_ccg_average_faces_boundaries_and_corners(SubdivCCG &subdiv_ccg,
                                                      const CCGKey &key,
                                                      const IndexMask &face_mask)
 {
-  blender::Set<int> adjacent_vert_set;
-  blender::Set<int> adjacent_edge_set;
-  subdiv_ccg_affected_face_adjacency(subdiv_ccg, face_mask, adjacent_vert_set, adjacent_edge_set);
-
-  Vector<int> adjacent_verts(adjacent_vert_set.begin(), adjacent_vert_set.end());
-  Vector<int> adjacent_edges(adjacent_edge_set.begin(), adjacent_edge_set.end());
-
-  std::sort(adjacent_verts.begin(), adjacent_verts.end());
-  std::sort(adjacent_edges.begin(), adjacent_edges.end());
-
   IndexMaskMemory memory;
-  subdiv_ccg_average_boundaries(
-      subdiv_ccg, key, IndexMask::from_indices(adjacent_edges.as_span(), memory));
+  IndexMask adjacent_verts;
+  IndexMask adjacent_edges;
+  subdiv_ccg_affected_face_adjacency(
+      subdiv_ccg, face_mask, memory, adjacent_verts, adjacent_edges);
 
-  subdiv_ccg_average_corners(
-      subdiv_ccg, key, IndexMask::from_indices(adjacent_verts.as_span(), memory));
+  subdiv_ccg_average_boundaries(subdiv_ccg, key, adjacent_edges);
+  subdiv_ccg_average_corners(subdiv_ccg, key, adjacent_verts);
 }
 
 #endif
@@ -869,10 +873,7 @@ void BKE_subdiv_ccg_average_stitch_faces(SubdivCCG &subdiv_ccg, const IndexMask
   face_mask.foreach_index(GrainSize(512), [&](const int face_index) {
     subdiv_ccg_average_inner_face_grids(subdiv_ccg, key, subdiv_ccg.faces[face_index]);
   });
-  /* TODO(sergey): Only average elements which are adjacent to modified
-   * faces. */
-  subdiv_ccg_average_boundaries(subdiv_ccg, key, subdiv_ccg.adjacent_edges.index_range());
-  subdiv_ccg_average_corners(subdiv_ccg, key, subdiv_ccg.adjacent_verts.index_range());
+  subdiv_ccg_average_faces_boundaries_and_corners(subdiv_ccg, key, face_mask);
 #else
   UNUSED_VARS(subdiv_ccg, face_mask);
 #endif
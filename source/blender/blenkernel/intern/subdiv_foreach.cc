@@ -107,6 +107,12 @@ struct ForeachTaskContext {
    *   were already evaluated.
    */
   BLI_bitmap *coarse_edges_used_map;
+  /* Indexed by coarse corner, indicates whether the face of the corner is responsible for the
+   * subdivided vertex of the corner's vertex and for the subdivided vertices along the corner's
+   * edge. Every shared vertex is owned by the first face using it, so that the result doesn't
+   * depend on the order in which faces are processed by threads. */
+  BLI_bitmap *coarse_corner_vert_owner_map;
+  BLI_bitmap *coarse_corner_edge_owner_map;
 };
 
 /** \} */
@@ -264,6 +270,8 @@ static void subdiv_foreach_ctx_free(ForeachTaskContext *ctx)
 {
   MEM_freeN(ctx->coarse_vertices_used_map);
   MEM_freeN(ctx->coarse_edges_used_map);
+  MEM_SAFE_FREE(ctx->coarse_corner_vert_owner_map);
+  MEM_SAFE_FREE(ctx->coarse_corner_edge_owner_map);
   MEM_freeN(ctx->subdiv_vertex_offset);
   MEM_freeN(ctx->subdiv_edge_offset);
   MEM_freeN(ctx->subdiv_face_offset);
@@ -288,8 +296,7 @@ static void subdiv_foreach_corner_vertices_regular_do(ForeachTaskContext *ctx,
   const int ptex_face_index = ctx->face_ptex_offset[coarse_face_index];
   for (int corner = 0; corner < coarse_face.size(); corner++) {
     const int coarse_vert = ctx->coarse_corner_verts[coarse_face[corner]];
-    if (check_usage && BLI_BITMAP_TEST_AND_SET_ATOMIC(ctx->coarse_vertices_used_map, coarse_vert))
-    {
+    if (check_usage && !BLI_BITMAP_TEST(ctx->coarse_corner_vert_owner_map, coarse_face[corner])) {
       continue;
     }
     const int coarse_vertex_index = coarse_vert;
@@ -326,8 +333,7 @@ static void subdiv_foreach_corner_vertices_special_do(ForeachTaskContext *ctx,
   int ptex_face_index = ctx->face_ptex_offset[coarse_face_index];
   for (int corner = 0; corner < coarse_face.size(); corner++, ptex_face_index++) {
     const int coarse_vert = ctx->coarse_corner_verts[coarse_face[corner]];
-    if (check_usage && BLI_BITMAP_TEST_AND_SET_ATOMIC(ctx->coarse_vertices_used_map, coarse_vert))
-    {
+    if (check_usage && !BLI_BITMAP_TEST(ctx->coarse_corner_vert_owner_map, coarse_face[corner])) {
       continue;
     }
     const int coarse_vertex_index = coarse_vert;
@@ -413,9 +419,7 @@ static void subdiv_foreach_edge_vertices_regular_do(ForeachTaskContext *ctx,
   for (int corner = 0; corner < coarse_face.size(); corner++) {
     const int coarse_vert = ctx->coarse_corner_verts[coarse_face[corner]];
     const int coarse_edge_index = ctx->coarse_corner_edges[coarse_face[corner]];
-    if (check_usage &&
-        BLI_BITMAP_TEST_AND_SET_ATOMIC(ctx->coarse_edges_used_map, coarse_edge_index))
-    {
+    if (check_usage && !BLI_BITMAP_TEST(ctx->coarse_corner_edge_owner_map, coarse_face[corner])) {
       continue;
     }
     const int2 &coarse_edge = ctx->coarse_edges[coarse_edge_index];
@@ -478,9 +482,7 @@ static void subdiv_foreach_edge_vertices_special_do(ForeachTaskContext *ctx,
   for (int corner = 0; corner < coarse_face.size(); corner++, ptex_face_index++) {
     const int coarse_vert = ctx->coarse_corner_verts[coarse_face[corner]];
     const int coarse_edge_index = ctx->coarse_corner_edges[coarse_face[corner]];
-    if (check_usage &&
-        BLI_BITMAP_TEST_AND_SET_ATOMIC(ctx->coarse_edges_used_map, coarse_edge_index))
-    {
+    if (check_usage && !BLI_BITMAP_TEST(ctx->coarse_corner_edge_owner_map, coarse_face[corner])) {
       continue;
     }
     const int2 &coarse_edge = ctx->coarse_edges[coarse_edge_index];
@@ -1712,15 +1714,32 @@ static void subdiv_foreach_vertices_of_loose_edges_task(void *__restrict userdat
 /** \name Subdivision process entry points
  * \{ */
 
-static void subdiv_foreach_single_geometry_vertices(ForeachTaskContext *ctx, void *tls)
+/**
+ * Decide which face evaluates each of the subdivided vertices that are shared between faces, in
+ * the same order as a single threaded traversal would. This is cheap compared to the evaluation
+ * itself, which can then happen in parallel, see #subdiv_foreach_single_geometry_vertices_task.
+ */
+static void subdiv_foreach_find_single_geometry_owners(ForeachTaskContext *ctx)
 {
   if (ctx->foreach_context->vertex_corner == nullptr) {
     return;
   }
-  const Mesh *coarse_mesh = ctx->coarse_mesh;
-  for (int face_index = 0; face_index < coarse_mesh->faces_num; face_index++) {
-    subdiv_foreach_corner_vertices(ctx, tls, face_index);
-    subdiv_foreach_edge_vertices(ctx, tls, face_index);
+  const int corners_num = ctx->coarse_corner_verts.size();
+  ctx->coarse_corner_vert_owner_map = BLI_BITMAP_NEW(corners_num, "corner vertex owner map");
+  ctx->coarse_corner_edge_owner_map = BLI_BITMAP_NEW(corners_num, "corner edge owner map");
+  for (const int face_index : ctx->coarse_faces.index_range()) {
+    for (const int corner : ctx->coarse_faces[face_index]) {
+      const int vert = ctx->coarse_corner_verts[corner];
+      if (!BLI_BITMAP_TEST(ctx->coarse_vertices_used_map, vert)) {
+        BLI_BITMAP_ENABLE(ctx->coarse_vertices_used_map, vert);
+        BLI_BITMAP_ENABLE(ctx->coarse_corner_vert_owner_map, corner);
+      }
+      const int edge = ctx->coarse_corner_edges[corner];
+      if (!BLI_BITMAP_TEST(ctx->coarse_edges_used_map, edge)) {
+        BLI_BITMAP_ENABLE(ctx->coarse_edges_used_map, edge);
+        BLI_BITMAP_ENABLE(ctx->coarse_corner_edge_owner_map, corner);
+      }
+    }
   }
 }
 
@@ -1744,9 +1763,10 @@ static void subdiv_foreach_single_thread_tasks(ForeachTaskContext *ctx)
    * and boundary edges. */
   subdiv_foreach_every_corner_vertices(ctx, tls);
   subdiv_foreach_every_edge_vertices(ctx, tls);
-  /* Run callbacks which are supposed to be run once per shared geometry. */
-  subdiv_foreach_single_geometry_vertices(ctx, tls);
   subdiv_foreach_tls_free(ctx, tls);
+  /* Callbacks which are supposed to be run once per shared geometry are run from threads
+   * afterwards, but the owner of every shared vertex has to be known first. */
+  subdiv_foreach_find_single_geometry_owners(ctx);
 
   const ForeachContext *foreach_context = ctx->foreach_context;
   const bool is_loose_geometry_tagged = (foreach_context->vertex_every_edge != nullptr &&
@@ -1758,6 +1778,15 @@ static void subdiv_foreach_single_thread_tasks(ForeachTaskContext *ctx)
   }
 }
 
+static void subdiv_foreach_single_geometry_vertices_task(void *__restrict userdata,
+                                                        const int face_index,
+                                                        const TaskParallelTLS *__restrict tls)
+{
+  ForeachTaskContext *ctx = static_cast<ForeachTaskContext *>(userdata);
+  subdiv_foreach_corner_vertices(ctx, tls->userdata_chunk, face_index);
+  subdiv_foreach_edge_vertices(ctx, tls->userdata_chunk, face_index);
+}
+
 static void subdiv_foreach_task(void *__restrict userdata,
                                 const int face_index,
                                 const TaskParallelTLS *__restrict tls)
@@ -1835,6 +1864,13 @@ bool foreach_subdiv_geometry(Subdiv *subdiv,
    * currently are relying on the fact that face/grid callbacks will tag non-
    * loose geometry. */
 
+  if (context->vertex_corner != nullptr) {
+    BLI_task_parallel_range(0,
+                            coarse_mesh->faces_num,
+                            &ctx,
+                            subdiv_foreach_single_geometry_vertices_task,
+                            &parallel_range_settings);
+  }
   BLI_task_parallel_range(
       0, coarse_mesh->faces_num, &ctx, subdiv_foreach_task, &parallel_range_settings);
   if (context->vertex_loose != nullptr) {
@@ -162,6 +162,7 @@ static void undosys_id_ref_resolve(void *user_data, UndoRefID *id_ref)
 static bool undosys_step_encode(bContext *C, Main *bmain, UndoStack *ustack, UndoStep *us)
 {
   CLOG_DEBUG(&LOG, "addr=%p, name='%s', type='%s'", us, us->name, us->type->name);
+  MEM_CategoryScope mem_category_scope(MEM_CATEGORY_UNDO);
   UNDO_NESTED_CHECK_BEGIN;
   bool ok = us->type->step_encode(C, bmain, us);
   UNDO_NESTED_CHECK_END;
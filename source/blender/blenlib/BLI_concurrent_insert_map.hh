@@ -0,0 +1,334 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * A #blender::ConcurrentInsertMap is an open addressing hash table that supports adding and
+ * looking up keys from many threads at the same time, without any locks. It is meant for
+ * parallel builders that would otherwise fill one #Map per thread and merge them afterwards.
+ *
+ * The map has a few important restrictions compared to #Map:
+ * - The maximum number of keys has to be known when the map is constructed, the map never grows.
+ *   Adding a new key to a full map fails, so callers have to handle that case.
+ * - Keys can't be removed.
+ * - The order of the keys depends on thread scheduling. Code that depends on a deterministic
+ *   order (e.g. to compute indices of new elements) has to sort the result afterwards.
+ * - Values are not protected after they have been added. Threads that want to modify the same
+ *   value concurrently have to use atomics or their own synchronization.
+ *
+ * Every slot has an atomic state. A thread that finds an empty slot claims it with a
+ * compare-and-swap, constructs the key and value and publishes the slot afterwards. Other threads
+ * that probe the same slot in the meantime wait until the slot is published, so that the value
+ * of a key is only ever created once.
+ *
+ * The probing strategies from `BLI_probing_strategies.hh` are used the same way as in #Map.
+ */
+
+#include <atomic>
+
+#include "BLI_array.hh"
+#include "BLI_hash.hh"
+#include "BLI_hash_tables.hh"
+#include "BLI_memory_utils.hh"
+#include "BLI_probing_strategies.hh"
+
+namespace blender {
+
+/**
+ * Same layout as #SimpleMapSlot, but the state can be accessed atomically. There is no removed
+ * state, because #ConcurrentInsertMap does not support removing keys.
+ */
+template<typename Key, typename Value> class ConcurrentMapSlot {
+ private:
+  enum State : uint8_t {
+    Empty = 0,
+    Writing = 1,
+    Occupied = 2,
+  };
+
+  std::atomic<uint8_t> state_;
+  TypedBuffer<Key> key_buffer_;
+  TypedBuffer<Value> value_buffer_;
+
+ public:
+  ConcurrentMapSlot() : state_(Empty) {}
+
+  ~ConcurrentMapSlot()
+  {
+    if (this->is_occupied()) {
+      key_buffer_.ref().~Key();
+      value_buffer_.ref().~Value();
+    }
+  }
+
+  ConcurrentMapSlot(const ConcurrentMapSlot &other) = delete;
+  ConcurrentMapSlot &operator=(const ConcurrentMapSlot &other) = delete;
+
+  Key *key()
+  {
+    return key_buffer_;
+  }
+
+  const Key *key() const
+  {
+    return key_buffer_;
+  }
+
+  Value *value()
+  {
+    return value_buffer_;
+  }
+
+  const Value *value() const
+  {
+    return value_buffer_;
+  }
+
+  bool is_empty() const
+  {
+    return state_.load(std::memory_order_acquire) == Empty;
+  }
+
+  bool is_occupied() const
+  {
+    return state_.load(std::memory_order_acquire) == Occupied;
+  }
+
+  /**
+   * Wait until another thread that is currently writing into this slot published it.
+   * \return False if the slot is empty.
+   */
+  bool wait_for_occupied() const
+  {
+    while (true) {
+      const uint8_t state = state_.load(std::memory_order_acquire);
+      if (state == Occupied) {
+        return true;
+      }
+      if (state == Empty) {
+        return false;
+      }
+    }
+  }
+
+  /**
+   * Try to get exclusive write access to an empty slot. On success, the caller has to construct
+   * the key and value and call #publish afterwards.
+   */
+  bool try_claim()
+  {
+    uint8_t expected = Empty;
+    return state_.compare_exchange_strong(expected, Writing, std::memory_order_acq_rel);
+  }
+
+  void publish()
+  {
+    BLI_assert(state_.load(std::memory_order_relaxed) == Writing);
+    state_.store(Occupied, std::memory_order_release);
+  }
+
+  template<typename ForwardKey, typename IsEqual>
+  bool contains(const ForwardKey &key, const IsEqual &is_equal) const
+  {
+    return is_equal(key, *key_buffer_);
+  }
+};
+
+template<typename Key,
+         typename Value,
+         typename ProbingStrategy = DefaultProbingStrategy,
+         typename Hash = DefaultHash<Key>,
+         typename IsEqual = DefaultEquality<Key>,
+         typename Allocator = GuardedAllocator>
+class ConcurrentInsertMap {
+ public:
+  using size_type = int64_t;
+
+ private:
+  using Slot = ConcurrentMapSlot<Key, Value>;
+
+  /** The same maximum load factor as #Map uses by default. */
+  static constexpr LoadFactor max_load_factor_ = LoadFactor(1, 2);
+
+  Array<Slot, 0, Allocator> slots_;
+  uint64_t slot_mask_;
+  int64_t usable_slots_;
+  /**
+   * Number of slots that are occupied, being written or about to be claimed. Slots are only
+   * claimed after they have been reserved here, so this never exceeds #usable_slots_. That keeps
+   * some slots empty, which is necessary for probing to terminate.
+   */
+  std::atomic<int64_t> reserved_slots_ = 0;
+
+  BLI_NO_UNIQUE_ADDRESS Hash hash_;
+  BLI_NO_UNIQUE_ADDRESS IsEqual is_equal_;
+
+#define CONCURRENT_MAP_SLOT_PROBING_BEGIN(HASH, R_SLOT) \
+  SLOT_PROBING_BEGIN (ProbingStrategy, HASH, slot_mask_, SLOT_INDEX) \
+    auto &R_SLOT = slots_[SLOT_INDEX];
+#define CONCURRENT_MAP_SLOT_PROBING_END() SLOT_PROBING_END()
+
+ public:
+  /**
+   * Create a map that can hold up to \a max_size keys. Adding more keys than that fails.
+   */
+  explicit ConcurrentInsertMap(const int64_t max_size, Allocator allocator = {})
+      : slots_(allocator)
+  {
+    BLI_assert(max_size >= 0);
+    int64_t total_slots;
+    max_load_factor_.compute_total_and_usable_slots(1, max_size, &total_slots, &usable_slots_);
+    slots_.reinitialize(total_slots);
+    slot_mask_ = uint64_t(total_slots) - 1;
+  }
+
+  ConcurrentInsertMap(const ConcurrentInsertMap &other) = delete;
+  ConcurrentInsertMap &operator=(const ConcurrentInsertMap &other) = delete;
+
+  /**
+   * Add a key-value-pair if the key does not exist yet. The value is only created when the key
+   * is new, by the thread that actually inserts it.
+   * \return A pointer to the value and true if it was added by this call. The pointer is null if
+   * the key is new but the map is full. While other threads are adding keys, this can already
+   * happen when the map is almost full.
+   */
+  template<typename CreateValueF>
+  std::pair<Value *, bool> lookup_or_add_cb(const Key &key, const CreateValueF &create_value)
+  {
+    return this->lookup_or_add_cb_as(key, create_value);
+  }
+  template<typename CreateValueF>
+  std::pair<Value *, bool> lookup_or_add_cb(Key &&key, const CreateValueF &create_value)
+  {
+    return this->lookup_or_add_cb_as(std::move(key), create_value);
+  }
+  template<typename ForwardKey, typename CreateValueF>
+  std::pair<Value *, bool> lookup_or_add_cb_as(ForwardKey &&key, const CreateValueF &create_value)
+  {
+    const uint64_t hash = hash_(key);
+    CONCURRENT_MAP_SLOT_PROBING_BEGIN (hash, slot) {
+      if (slot.is_empty()) {
+        if (!this->try_reserve_slot()) {
+          return {nullptr, false};
+        }
+        if (slot.try_claim()) {
+          new (slot.key()) Key(std::forward<ForwardKey>(key));
+          new (slot.value()) Value(create_value());
+          slot.publish();
+          return {slot.value(), true};
+        }
+        /* Another thread claimed the slot first. */
+        reserved_slots_.fetch_sub(1, std::memory_order_relaxed);
+      }
+      if (slot.wait_for_occupied() && slot.contains(key, is_equal_)) {
+        return {slot.value(), false};
+      }
+    }
+    CONCURRENT_MAP_SLOT_PROBING_END();
+  }
+
+  /**
+   * Add a key-value-pair if the key does not exist yet.
+   * \return True if the key was added by this call, false if it existed already or the map is
+   * full.
+   */
+  bool add(const Key &key, const Value &value)
+  {
+    return this->lookup_or_add_cb(key, [&]() { return value; }).second;
+  }
+
+  /**
+   * Get the value for the key, or add a default constructed value if the key is new.
+   * \return Null if the key is new but the map is full.
+   */
+  Value *lookup_or_add_default(const Key &key)
+  {
+    return this->lookup_or_add_cb(key, []() { return Value(); }).first;
+  }
+
+  /**
+   * Get a pointer to the value that corresponds to the key, if it exists. This is safe to call
+   * while other threads add keys, but keys that are added at the same time may not be found.
+   */
+  const Value *lookup_ptr(const Key &key) const
+  {
+    const uint64_t hash = hash_(key);
+    CONCURRENT_MAP_SLOT_PROBING_BEGIN (hash, slot) {
+      if (!slot.wait_for_occupied()) {
+        return nullptr;
+      }
+      if (slot.contains(key, is_equal_)) {
+        return slot.value();
+      }
+    }
+    CONCURRENT_MAP_SLOT_PROBING_END();
+  }
+  Value *lookup_ptr(const Key &key)
+  {
+    return const_cast<Value *>(const_cast<const ConcurrentInsertMap *>(this)->lookup_ptr(key));
+  }
+
+  bool contains(const Key &key) const
+  {
+    return this->lookup_ptr(key) != nullptr;
+  }
+
+  /**
+   * Call the function for every key-value-pair. This must not be called while other threads are
+   * still adding keys. The order is not deterministic.
+   */
+  template<typename FuncT> void foreach_item(const FuncT &fn) const
+  {
+    for (const Slot &slot : slots_) {
+      if (slot.is_occupied()) {
+        fn(*slot.key(), *slot.value());
+      }
+    }
+  }
+
+  /**
+   * Number of keys in the map. Keys that are currently being added by other threads may already
+   * be included.
+   */
+  int64_t size() const
+  {
+    return reserved_slots_.load(std::memory_order_relaxed);
+  }
+
+  bool is_empty() const
+  {
+    return this->size() == 0;
+  }
+
+  /**
+   * Maximum number of keys that can be added to the map.
+   */
+  int64_t capacity() const
+  {
+    return usable_slots_;
+  }
+
+  int64_t size_in_bytes() const
+  {
+    return int64_t(sizeof(Slot) * slots_.size());
+  }
+
+ private:
+  bool try_reserve_slot()
+  {
+    if (reserved_slots_.fetch_add(1, std::memory_order_relaxed) < usable_slots_) {
+      return true;
+    }
+    reserved_slots_.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+};
+
+#undef CONCURRENT_MAP_SLOT_PROBING_BEGIN
+#undef CONCURRENT_MAP_SLOT_PROBING_END
+
+}  // namespace blender
@@ -50,6 +50,11 @@ typedef struct FileReader {
 FileReader *BLI_filereader_new_file(int filedes) ATTR_WARN_UNUSED_RESULT;
 /** Create #FileReader from raw file descriptor using memory-mapped IO. */
 FileReader *BLI_filereader_new_mmap(int filedes) ATTR_WARN_UNUSED_RESULT;
+/**
+ * Get the memory of a #FileReader created by #BLI_filereader_new_mmap, or NULL for other readers.
+ * It remains valid until the reader is closed.
+ */
+void *BLI_filereader_mmap_memory(FileReader *reader) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
 /** Create #FileReader from a region of memory. */
 FileReader *BLI_filereader_new_memory(const void *data, size_t len) ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL();
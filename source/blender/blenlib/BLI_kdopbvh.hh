@@ -86,6 +86,12 @@ enum {
   /* calculate IsectRayPrecalc data */
   BVH_RAYCAST_WATERTIGHT = (1 << 0),
 };
+enum {
+  /* Choose the split axis of every branch with the surface area heuristic instead of using the
+   * largest extent. Building is a bit slower, but ray-casts and nearest queries visit fewer nodes.
+   * Only used for trees whose bounding volumes contain the X, Y and Z axes. */
+  BVH_BALANCE_USE_SAH = (1 << 0),
+};
 #define BVH_RAYCAST_DEFAULT (BVH_RAYCAST_WATERTIGHT)
 #define BVH_RAYCAST_DIST_MAX (FLT_MAX / 2.0f)
 
@@ -145,6 +151,10 @@ BVHTree *BLI_bvhtree_new(int maxsize, float epsilon, char tree_type, char axis);
  */
 void BLI_bvhtree_insert(BVHTree *tree, int index, const float co[3], int numpoints);
 void BLI_bvhtree_balance(BVHTree *tree);
+/**
+ * \param flag: See `BVH_BALANCE_*` flags.
+ */
+void BLI_bvhtree_balance_ex(BVHTree *tree, int flag);
 
 /**
  * Update: first update points/nodes, then call update_tree to refit the bounding volumes.
@@ -160,6 +170,21 @@ bool BLI_bvhtree_update_node(
  */
 void BLI_bvhtree_update_tree(BVHTree *tree);
 
+/**
+ * Create an independent copy of a balanced tree, typically to update it with
+ * #BLI_bvhtree_update_node while the original is still in use.
+ */
+BVHTree *BLI_bvhtree_copy(const BVHTree *tree);
+
+/**
+ * Sum of the surface areas of all branches, relative to the surface area of the root. This is
+ * the expected number of branches that a random ray passing through the tree has to visit, and
+ * can be compared before and after #BLI_bvhtree_update_tree to detect when the tree should be
+ * built again. Only supported for trees whose bounding volumes contain the X, Y and Z axes,
+ * zero is returned otherwise.
+ */
+float BLI_bvhtree_get_area_cost(const BVHTree *tree);
+
 /**
  * Use to check the total number of threads #BLI_bvhtree_overlap will use.
  *
@@ -45,6 +45,13 @@ int BLI_kdtree_nd_(find_nearest_n)(const KDTree *tree,
                                    KDTreeNearest *r_nearest,
                                    uint nearest_len_capacity) ATTR_NONNULL(1, 2, 3);
 
+void BLI_kdtree_nd_(find_nearest_batch)(const KDTree *tree,
+                                        const float (*co)[KD_DIMS],
+                                        uint co_len,
+                                        const int *skip_indices,
+                                        int *r_indices,
+                                        float *r_dist_sq) ATTR_NONNULL(1, 2, 5);
+
 int BLI_kdtree_nd_(range_search)(const KDTree *tree,
                                  const float co[KD_DIMS],
                                  KDTreeNearest **r_nearest,
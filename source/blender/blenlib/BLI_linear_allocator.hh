@@ -21,6 +21,44 @@ namespace blender {
  */
 // #define BLI_DEBUG_LINEAR_ALLOCATOR_SIZE
 
+namespace linear_allocator_arena {
+
+/** Size and alignment of the buffers that are recycled by #LinearAllocatorArenaScope. */
+constexpr int64_t chunk_size = 8192;
+constexpr int64_t chunk_alignment = 64;
+
+/**
+ * Get a chunk from the arena that is active on the current thread.
+ * \return Null if there is no active arena.
+ */
+void *try_allocate_chunk();
+
+/**
+ * Give a chunk back to the arena that is active on the current thread, or free it if there is
+ * none. This does not have to be the same thread that allocated the chunk.
+ */
+void free_chunk(void *chunk);
+
+}  // namespace linear_allocator_arena
+
+/**
+ * While a #LinearAllocatorArenaScope exists, all #LinearAllocator instances on the same thread
+ * (including the ones in #ResourceScope and #IndexMaskMemory) get their buffers from a
+ * thread-local free-list of fixed size chunks once they have outgrown their inline buffer and
+ * first small allocations, and give them back when they are destructed. This
+ * avoids hitting the global allocator for every short-lived allocator, which causes contention
+ * when many threads evaluate at the same time.
+ *
+ * The arena only owns the chunks that are not in use. Allocators may outlive the scope, their
+ * chunks are freed normally then. All cached chunks are freed in bulk when the outermost scope on
+ * the thread ends. Scopes can be nested.
+ */
+class LinearAllocatorArenaScope : NonCopyable, NonMovable {
+ public:
+  LinearAllocatorArenaScope();
+  ~LinearAllocatorArenaScope();
+};
+
 /**
  * A linear allocator is the simplest form of an allocator. It never reuses any memory, and
  * therefore does not need a deallocation method. It simply hands out consecutive buffers of
@@ -30,6 +68,8 @@ template<typename Allocator = GuardedAllocator> class LinearAllocator : NonCopya
  private:
   BLI_NO_UNIQUE_ADDRESS Allocator allocator_;
   Vector<void *, 2> owned_buffers_;
+  /** Buffers that have been taken from a #LinearAllocatorArenaScope. */
+  Vector<void *> owned_chunks_;
 
   uintptr_t current_begin_;
   uintptr_t current_end_;
@@ -55,6 +95,9 @@ template<typename Allocator = GuardedAllocator> class LinearAllocator : NonCopya
     for (void *ptr : owned_buffers_) {
       allocator_.deallocate(ptr);
     }
+    for (void *ptr : owned_chunks_) {
+      linear_allocator_arena::free_chunk(ptr);
+    }
   }
 
   /**
@@ -269,11 +312,13 @@ template<typename Allocator = GuardedAllocator> class LinearAllocator : NonCopya
   void transfer_ownership_from(LinearAllocator<> &other)
   {
     owned_buffers_.extend(other.owned_buffers_);
+    owned_chunks_.extend(other.owned_chunks_);
 #ifdef BLI_DEBUG_LINEAR_ALLOCATOR_SIZE
     user_requested_size_ += other.user_requested_size_;
     owned_allocation_size_ += other.owned_allocation_size_;
 #endif
     other.owned_buffers_.clear();
+    other.owned_chunks_.clear();
     std::destroy_at(&other);
     new (&other) LinearAllocator<>();
   }
@@ -287,11 +332,32 @@ template<typename Allocator = GuardedAllocator> class LinearAllocator : NonCopya
     int64_t size_in_bytes = min_allocation_size;
     if (size_in_bytes <= large_buffer_threshold) {
       /* Gradually grow buffer size with each allocation, up to a maximum. */
-      const int grow_size = 1 << std::min<int>(owned_buffers_.size() + 6, 20);
+      const int buffers_num = owned_buffers_.size() + owned_chunks_.size();
+      const int grow_size = 1 << std::min<int>(buffers_num + 6, 20);
       size_in_bytes = std::min(large_buffer_threshold,
                                std::max<int64_t>(size_in_bytes, grow_size));
     }
 
+    if constexpr (std::is_same_v<Allocator, GuardedAllocator>) {
+      /* Only take chunks from the arena once the allocator has grown to the largest buffer size.
+       * Allocators that need little memory keep using their inline buffer and small allocations
+       * instead of occupying a whole chunk. */
+      if (size_in_bytes >= large_buffer_threshold &&
+          min_allocation_size <= linear_allocator_arena::chunk_size &&
+          min_alignment <= linear_allocator_arena::chunk_alignment)
+      {
+        if (void *chunk = linear_allocator_arena::try_allocate_chunk()) {
+          owned_chunks_.append(chunk);
+#ifdef BLI_DEBUG_LINEAR_ALLOCATOR_SIZE
+          owned_allocation_size_ += linear_allocator_arena::chunk_size;
+#endif
+          current_begin_ = uintptr_t(chunk);
+          current_end_ = current_begin_ + linear_allocator_arena::chunk_size;
+          return;
+        }
+      }
+    }
+
     void *buffer = this->allocated_owned(size_in_bytes, min_alignment);
     current_begin_ = uintptr_t(buffer);
     current_end_ = current_begin_ + size_in_bytes;
@@ -416,6 +416,20 @@ template<typename T>
 template<typename MatT, typename VectorT>
 [[nodiscard]] VectorT project_point(const MatT &mat, const VectorT &point);
 
+/**
+ * Transform all points in place using a 4x4 matrix (location & rotation & scale).
+ * Vectorized and multi-threaded, meant for large arrays like mesh or curve positions.
+ */
+void transform_points(const float4x4 &transform, MutableSpan<float3> points);
+void transform_points(Span<float3> src, const float4x4 &transform, MutableSpan<float3> dst);
+
+/**
+ * Transform all directions in place using a 3x3 matrix. To transform normals, the matrix is
+ * expected to already be the inverse transposed of the geometry transform.
+ */
+void transform_normals(const float3x3 &transform, MutableSpan<float3> normals);
+void transform_normals(Span<float3> src, const float3x3 &transform, MutableSpan<float3> dst);
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -801,4 +801,13 @@ template<typename T, int Size>
                                                            const VecBase<T, Size> &v3,
                                                            const VecBase<T, Size> &v4);
 
+/**
+ * Batch operations on arrays of vectors, vectorized and multi-threaded. They give the same
+ * results as calling the functions for single vectors on every element. The destination may be
+ * the same array as one of the sources.
+ */
+void normalize_array(Span<float3> src, MutableSpan<float3> dst);
+void dot_array(Span<float3> a, Span<float3> b, MutableSpan<float> dst);
+void cross_array(Span<float3> a, Span<float3> b, MutableSpan<float3> dst);
+
 }  // namespace blender::math
@@ -109,6 +109,11 @@ enum {
    * order of allocation when no chunks have been freed.
    */
   BLI_MEMPOOL_ALLOW_ITER = (1 << 0),
+  /**
+   * Allow allocating and freeing elements from multiple threads at the same time through
+   * #BLI_mempool_thread_cache.
+   */
+  BLI_MEMPOOL_THREAD_CACHE = (1 << 1),
 };
 
 /**
@@ -119,3 +124,35 @@ void BLI_mempool_iternew(BLI_mempool *pool, BLI_mempool_iter *iter) ATTR_NONNULL
  * Step over the iterator, returning the mempool item or NULL.
  */
 void *BLI_mempool_iterstep(BLI_mempool_iter *iter) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
+
+/**
+ * Thread local cache of free elements, for pools created with #BLI_MEMPOOL_THREAD_CACHE.
+ *
+ * Every thread allocates from and frees into its own cache. The cache only accesses the pool
+ * when it runs out of elements or holds too many free elements, and then moves up to a chunk of
+ * elements at once, so threads rarely wait for each other.
+ *
+ * \note Elements in a cache are counted by #BLI_mempool_len until the cache is flushed.
+ * \note Other operations on the pool, including #BLI_mempool_alloc and #BLI_mempool_free, must
+ * not run while caches are in use on multiple threads.
+ */
+struct BLI_mempool_thread_cache {
+  BLI_mempool *pool;
+  /** Free elements owned by this cache. */
+  struct BLI_freenode *free;
+  unsigned int free_num;
+};
+
+void BLI_mempool_thread_cache_init(BLI_mempool *pool, BLI_mempool_thread_cache *cache)
+    ATTR_NONNULL();
+void *BLI_mempool_thread_cache_alloc(BLI_mempool_thread_cache *cache) ATTR_MALLOC
+    ATTR_WARN_UNUSED_RESULT ATTR_RETURNS_NONNULL ATTR_NONNULL(1);
+/**
+ * Free an element into the cache. The element may have been allocated by any cache of the pool.
+ */
+void BLI_mempool_thread_cache_free(BLI_mempool_thread_cache *cache, void *addr) ATTR_NONNULL(1, 2);
+/**
+ * Give all cached free elements back to the pool. Has to be called before the cache goes out of
+ * scope.
+ */
+void BLI_mempool_thread_cache_flush(BLI_mempool_thread_cache *cache) ATTR_NONNULL(1);
@@ -18,6 +18,7 @@ struct BLI_mmap_file;
 typedef struct BLI_mmap_file BLI_mmap_file;
 
 /* Prepares an opened file for memory-mapped IO.
+ * The mapping is copy-on-write: the mapped memory can be written to, which never affects the file.
  * May return NULL if the operation fails.
  * Note that this seeks to the end of the file to determine its length. */
 BLI_mmap_file *BLI_mmap_open(int fd) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT;
@@ -307,6 +307,19 @@ int BLI_task_parallel_thread_id(const TaskParallelTLS *tls);
  * TaskNode *node_3 = BLI_task_graph_node_create(task_graph, node_exec, task_data, NULL);
  * TaskNode *node_4 = BLI_task_graph_node_create(task_graph, node_exec, task_data, NULL);
  * \endcode
+ *
+ * Priority
+ * --------
+ *
+ * Nodes are created with #TASK_PRIORITY_LOW by default. When all threads are busy, nodes created
+ * with #TASK_PRIORITY_HIGH (see #BLI_task_graph_node_create_ex) are picked before other pending
+ * work. This is meant for latency sensitive work (like viewport updates) that competes with
+ * background work for the same threads.
+ *
+ * \code{.c}
+ * TaskNode *node = BLI_task_graph_node_create_ex(
+ *     task_graph, node_exec, task_data, NULL, TASK_PRIORITY_HIGH);
+ * \endcode
  * \{ */
 
 struct TaskGraph;
@@ -322,6 +335,11 @@ struct TaskNode *BLI_task_graph_node_create(struct TaskGraph *task_graph,
                                             TaskGraphNodeRunFunction run,
                                             void *user_data,
                                             TaskGraphNodeFreeFunction free_func);
+struct TaskNode *BLI_task_graph_node_create_ex(struct TaskGraph *task_graph,
+                                               TaskGraphNodeRunFunction run,
+                                               void *user_data,
+                                               TaskGraphNodeFreeFunction free_func,
+                                               eTaskPriority priority);
 bool BLI_task_graph_node_push_work(struct TaskNode *task_node);
 void BLI_task_graph_edge_create(struct TaskNode *from_node, struct TaskNode *to_node);
 
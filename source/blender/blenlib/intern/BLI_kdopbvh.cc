@@ -56,6 +56,11 @@
 #  define KDOPBVH_THREAD_LEAF_THRESHOLD 1024
 #endif
 
+/* Number of bins per axis used to estimate the cost of a split with the surface area heuristic. */
+#define KDOPBVH_SAH_BINS_NUM 32
+/* Branches with fewer leafs are split along their largest axis, where binning doesn't pay off. */
+#define KDOPBVH_SAH_LEAF_THRESHOLD 16
+
 /* -------------------------------------------------------------------- */
 /** \name Struct Definitions
  * \{ */
@@ -670,6 +675,92 @@ static void split_leafs(BVHNode **leafs_array,
   }
 }
 
+/**
+ * Half of the surface area of the axis aligned box given by the first three slabs of \a bv.
+ */
+static float bv_half_area(const float *bv)
+{
+  const float dx = bv[1] - bv[0];
+  const float dy = bv[3] - bv[2];
+  const float dz = bv[5] - bv[4];
+  return dx * dy + dy * dz + dz * dx;
+}
+
+/**
+ * Choose the axis to split a branch along with the surface area heuristic. The number of leafs
+ * that go into every child is fixed by the implicit tree layout, so only the axis can be chosen.
+ * Instead of partitioning the leafs along every axis, the leafs are sorted into bins and the
+ * bounds of a child are estimated by the bins its leafs fall into.
+ *
+ * Uses the same sort key as #split_leafs (the maximum of the slab) and returns the axis in the
+ * same form as #get_largest_axis.
+ */
+static char get_sah_split_axis(const BVHNode *parent,
+                               BVHNode *const *leafs_array,
+                               const int nth[],
+                               const int partitions)
+{
+  const char largest_axis = get_largest_axis(parent->bv);
+  /* Test the largest axis first, so that it's kept when the costs are equal. */
+  const int axes[3] = {largest_axis / 2, (largest_axis / 2 + 1) % 3, (largest_axis / 2 + 2) % 3};
+
+  char best_axis = largest_axis;
+  float best_cost = FLT_MAX;
+  for (const int axis : axes) {
+    const float axis_min = parent->bv[2 * axis];
+    const float axis_extent = parent->bv[2 * axis + 1] - axis_min;
+    if (!(axis_extent > 0.0f)) {
+      continue;
+    }
+    const float bin_scale = float(KDOPBVH_SAH_BINS_NUM) / axis_extent;
+
+    int bin_leafs_num[KDOPBVH_SAH_BINS_NUM] = {0};
+    float bin_bv[KDOPBVH_SAH_BINS_NUM][6];
+    for (float *bv : bin_bv) {
+      bv[0] = bv[2] = bv[4] = FLT_MAX;
+      bv[1] = bv[3] = bv[5] = -FLT_MAX;
+    }
+    for (int i = nth[0]; i < nth[partitions]; i++) {
+      const float *leaf_bv = leafs_array[i]->bv;
+      const int bin = std::clamp(
+          int((leaf_bv[2 * axis + 1] - axis_min) * bin_scale), 0, KDOPBVH_SAH_BINS_NUM - 1);
+      bin_leafs_num[bin]++;
+      for (int j = 0; j < 6; j += 2) {
+        bin_bv[bin][j] = std::min(bin_bv[bin][j], leaf_bv[j]);
+        bin_bv[bin][j + 1] = std::max(bin_bv[bin][j + 1], leaf_bv[j + 1]);
+      }
+    }
+
+    float cost = 0.0f;
+    for (int k = 0; k < partitions; k++) {
+      const int child_begin = nth[k] - nth[0];
+      const int child_end = nth[k + 1] - nth[0];
+      if (child_begin >= child_end) {
+        break;
+      }
+      float child_bv[6] = {FLT_MAX, -FLT_MAX, FLT_MAX, -FLT_MAX, FLT_MAX, -FLT_MAX};
+      int bin_begin = 0;
+      for (int bin = 0; bin < KDOPBVH_SAH_BINS_NUM && bin_begin < child_end; bin++) {
+        const int bin_end = bin_begin + bin_leafs_num[bin];
+        if (bin_end > child_begin) {
+          for (int j = 0; j < 6; j += 2) {
+            child_bv[j] = std::min(child_bv[j], bin_bv[bin][j]);
+            child_bv[j + 1] = std::max(child_bv[j + 1], bin_bv[bin][j + 1]);
+          }
+        }
+        bin_begin = bin_end;
+      }
+      cost += bv_half_area(child_bv) * float(child_end - child_begin);
+    }
+
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_axis = char(2 * axis + 1);
+    }
+  }
+  return best_axis;
+}
+
 struct BVHDivNodesData {
   const BVHTree *tree;
   BVHNode *branches_array;
@@ -677,6 +768,7 @@ struct BVHDivNodesData {
 
   int tree_type;
   int tree_offset;
+  bool use_sah;
 
   const BVHBuildHelper *data;
 
@@ -703,15 +795,7 @@ static void non_recursive_bvh_div_nodes_task_cb(void *__restrict userdata,
   /* This calculates the bounding box of this branch
    * and chooses the largest axis as the axis to divide leafs */
   refit_kdop_hull(data->tree, parent, parent_leafs_begin, parent_leafs_end);
-  split_axis = get_largest_axis(parent->bv);
 
-  /* Save split axis (this can be used on ray-tracing to speedup the query time) */
-  parent->main_axis = split_axis / 2;
-
-  /* Split the children along the split_axis, NOTE: its not needed to sort the whole leafs array
-   * Only to assure that the elements are partitioned on a way that each child takes the elements
-   * it would take in case the whole array was sorted.
-   * Split_leafs takes care of that "sort" problem. */
   nth_positions[0] = parent_leafs_begin;
   nth_positions[data->tree_type] = parent_leafs_end;
   for (k = 1; k < data->tree_type; k++) {
@@ -721,6 +805,21 @@ static void non_recursive_bvh_div_nodes_task_cb(void *__restrict userdata,
     nth_positions[k] = implicit_leafs_index(data->data, data->depth + 1, child_level_index);
   }
 
+  if (data->use_sah && parent_leafs_end - parent_leafs_begin >= KDOPBVH_SAH_LEAF_THRESHOLD) {
+    split_axis = get_sah_split_axis(parent, data->leafs_array, nth_positions, data->tree_type);
+  }
+  else {
+    split_axis = get_largest_axis(parent->bv);
+  }
+
+  /* Save split axis (this can be used on ray-tracing to speedup the query time) */
+  parent->main_axis = split_axis / 2;
+
+  /* Split the children along the split_axis, NOTE: its not needed to sort the whole leafs array
+   * Only to assure that the elements are partitioned on a way that each child takes the elements
+   * it would take in case the whole array was sorted.
+   * Split_leafs takes care of that "sort" problem. */
+
   split_leafs(data->leafs_array, nth_positions, data->tree_type, split_axis);
 
   /* Setup `children` and `node_num` counters
@@ -772,7 +871,8 @@ static void non_recursive_bvh_div_nodes_task_cb(void *__restrict userdata,
 static void non_recursive_bvh_div_nodes(const BVHTree *tree,
                                         BVHNode *branches_array,
                                         BVHNode **leafs_array,
-                                        int leafs_num)
+                                        int leafs_num,
+                                        const bool use_sah)
 {
   int i;
 
@@ -810,6 +910,7 @@ static void non_recursive_bvh_div_nodes(const BVHTree *tree,
   cb_data.leafs_array = leafs_array;
   cb_data.tree_type = tree_type;
   cb_data.tree_offset = tree_offset;
+  cb_data.use_sah = use_sah;
   cb_data.data = &data;
   cb_data.first_of_next_level = 0;
   cb_data.depth = 0;
@@ -931,6 +1032,11 @@ void BLI_bvhtree_free(BVHTree *tree)
 }
 
 void BLI_bvhtree_balance(BVHTree *tree)
+{
+  BLI_bvhtree_balance_ex(tree, 0);
+}
+
+void BLI_bvhtree_balance_ex(BVHTree *tree, const int flag)
 {
   BVHNode **leafs_array = tree->nodes;
 
@@ -938,9 +1044,12 @@ void BLI_bvhtree_balance(BVHTree *tree)
    * (some big bug goes here if its being called more than once per tree) */
   BLI_assert(tree->branch_num == 0);
 
+  /* The heuristic only looks at the X, Y and Z slabs. */
+  const bool use_sah = (flag & BVH_BALANCE_USE_SAH) && tree->start_axis == 0;
+
   /* Build the implicit tree */
   non_recursive_bvh_div_nodes(
-      tree, tree->nodearray + (tree->leaf_num - 1), leafs_array, tree->leaf_num);
+      tree, tree->nodearray + (tree->leaf_num - 1), leafs_array, tree->leaf_num, use_sah);
 
   /* current code expects the branches to be linked to the nodes array
    * we perform that linkage here */
@@ -1027,6 +1136,53 @@ void BLI_bvhtree_update_tree(BVHTree *tree)
     node_join(tree, *index);
   }
 }
+
+BVHTree *BLI_bvhtree_copy(const BVHTree *tree)
+{
+  const int numnodes = int(MEM_allocN_len(tree->nodearray) / sizeof(BVHNode));
+
+  BVHTree *copy = static_cast<BVHTree *>(MEM_dupallocN(tree));
+  copy->nodes = static_cast<BVHNode **>(MEM_dupallocN(tree->nodes));
+  copy->nodearray = static_cast<BVHNode *>(MEM_dupallocN(tree->nodearray));
+  copy->nodechild = static_cast<BVHNode **>(MEM_dupallocN(tree->nodechild));
+  copy->nodebv = static_cast<float *>(MEM_dupallocN(tree->nodebv));
+
+  /* All nodes are stored in the node array, so pointers can be remapped with their offset. */
+  const auto remap = [&](BVHNode *node) -> BVHNode * {
+    return node ? copy->nodearray + (node - tree->nodearray) : nullptr;
+  };
+  for (int i = 0; i < numnodes; i++) {
+    copy->nodes[i] = remap(tree->nodes[i]);
+    BVHNode &node = copy->nodearray[i];
+    node.bv = &copy->nodebv[i * tree->axis];
+    node.children = &copy->nodechild[i * tree->tree_type];
+    node.parent = remap(node.parent);
+#ifdef USE_SKIP_LINKS
+    node.skip[0] = remap(node.skip[0]);
+    node.skip[1] = remap(node.skip[1]);
+#endif
+  }
+  for (int i = 0; i < numnodes * tree->tree_type; i++) {
+    copy->nodechild[i] = remap(tree->nodechild[i]);
+  }
+  return copy;
+}
+
+float BLI_bvhtree_get_area_cost(const BVHTree *tree)
+{
+  if (tree->start_axis != 0 || tree->branch_num == 0) {
+    return 0.0f;
+  }
+  const float root_area = bv_half_area(tree->nodes[tree->leaf_num]->bv);
+  if (!(root_area > 0.0f)) {
+    return 0.0f;
+  }
+  float area_sum = 0.0f;
+  for (int i = 0; i < tree->branch_num; i++) {
+    area_sum += bv_half_area(tree->nodes[tree->leaf_num + i]->bv);
+  }
+  return area_sum / root_area;
+}
 int BLI_bvhtree_get_len(const BVHTree *tree)
 {
   return tree->leaf_num;
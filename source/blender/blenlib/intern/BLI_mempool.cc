@@ -12,6 +12,8 @@
  * - Freeing chunks.
  * - Iterating over allocated chunks
  *   (optionally when using the #BLI_MEMPOOL_ALLOW_ITER flag).
+ * - Allocating and freeing from multiple threads with thread local caches
+ *   (optionally when using the #BLI_MEMPOOL_THREAD_CACHE flag).
  */
 
 #include <algorithm>
@@ -27,9 +29,7 @@
 #include "BLI_mempool.h"         /* own include */
 #include "BLI_mempool_private.h" /* own include */
 
-#ifdef WITH_ASAN
-#  include "BLI_threads.h"
-#endif
+#include "BLI_threads.h"
 
 #include "MEM_guardedalloc.h"
 
@@ -102,6 +102,8 @@ struct BLI_mempool {
   /** Serialize access to memory-pools when debugging with ASAN. */
   ThreadMutex mutex;
 #endif
+  /** Protects the pool when thread caches access it, see #BLI_MEMPOOL_THREAD_CACHE. */
+  SpinLock spin;
   /** Single linked list of allocated chunks. */
   BLI_mempool_chunk *chunks;
   /** Keep a pointer to the last, so we can append new chunks there
@@ -325,6 +327,9 @@ BLI_mempool *BLI_mempool_create(uint esize, uint elem_num, uint pchunk, uint fla
 #ifdef WITH_ASAN
   BLI_mutex_init(&pool->mutex);
 #endif
+  if (flag & BLI_MEMPOOL_THREAD_CACHE) {
+    BLI_spin_init(&pool->spin);
+  }
 
   /* set the elem size */
   esize = std::max(esize, uint(MEMPOOL_ELEM_SIZE_MIN));
@@ -518,6 +523,169 @@ void BLI_mempool_free(BLI_mempool *pool, void *addr)
   }
 }
 
+/** Read the link of a free element, which is poisoned when using ASAN. */
+static BLI_freenode *mempool_freenode_next(const BLI_mempool *pool, BLI_freenode *node)
+{
+  BLI_asan_unpoison(node, pool->esize - POISON_REDZONE_SIZE);
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MAKE_MEM_DEFINED(node, pool->esize - POISON_REDZONE_SIZE);
+#endif
+  BLI_freenode *next = node->next;
+  BLI_asan_poison(node, pool->esize);
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MAKE_MEM_UNDEFINED(node, pool->esize);
+#endif
+  return next;
+}
+
+static void mempool_freenode_set_next(const BLI_mempool *pool,
+                                      BLI_freenode *node,
+                                      BLI_freenode *next)
+{
+  BLI_asan_unpoison(node, pool->esize - POISON_REDZONE_SIZE);
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MAKE_MEM_DEFINED(node, pool->esize - POISON_REDZONE_SIZE);
+#endif
+  node->next = next;
+  BLI_asan_poison(node, pool->esize);
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MAKE_MEM_UNDEFINED(node, pool->esize);
+#endif
+}
+
+void BLI_mempool_thread_cache_init(BLI_mempool *pool, BLI_mempool_thread_cache *cache)
+{
+  BLI_assert(pool->flag & BLI_MEMPOOL_THREAD_CACHE);
+  cache->pool = pool;
+  cache->free = nullptr;
+  cache->free_num = 0;
+}
+
+/**
+ * Move up to one chunk worth of free elements from the pool into the empty cache, allocating a
+ * new chunk if the pool has no free elements.
+ */
+static void mempool_thread_cache_refill(BLI_mempool_thread_cache *cache)
+{
+  BLI_mempool *pool = cache->pool;
+  BLI_assert(cache->free == nullptr);
+
+  BLI_spin_lock(&pool->spin);
+  if (pool->free == nullptr) {
+    BLI_mempool_chunk *mpchunk = mempool_chunk_alloc(pool);
+    mempool_chunk_add(pool, mpchunk, nullptr);
+  }
+  BLI_freenode *first = pool->free;
+  BLI_freenode *last = first;
+  BLI_freenode *next = mempool_freenode_next(pool, last);
+  uint num = 1;
+  while (next && num < pool->pchunk) {
+    last = next;
+    next = mempool_freenode_next(pool, last);
+    num++;
+  }
+  pool->free = next;
+  /* Elements in caches are counted as used, so that the pool doesn't free their chunks. */
+  pool->totused += num;
+  BLI_spin_unlock(&pool->spin);
+
+  mempool_freenode_set_next(pool, last, nullptr);
+  cache->free = first;
+  cache->free_num = num;
+}
+
+/** Move the first \a num free elements of the cache back to the pool. */
+static void mempool_thread_cache_release(BLI_mempool_thread_cache *cache, const uint num)
+{
+  BLI_mempool *pool = cache->pool;
+  BLI_assert(num > 0 && num <= cache->free_num);
+
+  BLI_freenode *first = cache->free;
+  BLI_freenode *last = first;
+  for (uint i = 1; i < num; i++) {
+    last = mempool_freenode_next(pool, last);
+  }
+  cache->free = mempool_freenode_next(pool, last);
+  cache->free_num -= num;
+
+  BLI_spin_lock(&pool->spin);
+  mempool_freenode_set_next(pool, last, pool->free);
+  pool->free = first;
+  pool->totused -= num;
+  BLI_spin_unlock(&pool->spin);
+}
+
+void *BLI_mempool_thread_cache_alloc(BLI_mempool_thread_cache *cache)
+{
+  BLI_mempool *pool = cache->pool;
+  if (UNLIKELY(cache->free == nullptr)) {
+    mempool_thread_cache_refill(cache);
+  }
+
+  BLI_freenode *free_pop = cache->free;
+
+  BLI_asan_unpoison(free_pop, pool->esize - POISON_REDZONE_SIZE);
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MEMPOOL_ALLOC(pool, free_pop, pool->esize - POISON_REDZONE_SIZE);
+  VALGRIND_MAKE_MEM_DEFINED(free_pop, pool->esize - POISON_REDZONE_SIZE);
+#endif
+
+  if (pool->flag & BLI_MEMPOOL_ALLOW_ITER) {
+    free_pop->freeword = USEDWORD;
+  }
+
+  cache->free = free_pop->next;
+  cache->free_num--;
+
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MAKE_MEM_UNDEFINED(free_pop, pool->esize - POISON_REDZONE_SIZE);
+#endif
+
+  return (void *)free_pop;
+}
+
+void BLI_mempool_thread_cache_free(BLI_mempool_thread_cache *cache, void *addr)
+{
+  BLI_mempool *pool = cache->pool;
+  BLI_freenode *newhead = static_cast<BLI_freenode *>(addr);
+
+#ifndef NDEBUG
+  if (UNLIKELY(mempool_debug_memset)) {
+    memset(addr, 255, pool->esize - POISON_REDZONE_SIZE);
+  }
+#endif
+
+  if (pool->flag & BLI_MEMPOOL_ALLOW_ITER) {
+#ifndef NDEBUG
+    /* This will detect double free's. */
+    BLI_assert(newhead->freeword != FREEWORD);
+#endif
+    newhead->freeword = FREEWORD;
+  }
+
+  newhead->next = cache->free;
+  cache->free = newhead;
+  cache->free_num++;
+
+  BLI_asan_poison(newhead, pool->esize);
+
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MEMPOOL_FREE(pool, addr);
+#endif
+
+  /* Keep one chunk worth of elements for following allocations, give the rest to other threads. */
+  if (UNLIKELY(cache->free_num >= pool->pchunk * 2)) {
+    mempool_thread_cache_release(cache, pool->pchunk);
+  }
+}
+
+void BLI_mempool_thread_cache_flush(BLI_mempool_thread_cache *cache)
+{
+  if (cache->free_num > 0) {
+    mempool_thread_cache_release(cache, cache->free_num);
+  }
+}
+
 int BLI_mempool_len(const BLI_mempool *pool)
 {
   int ret = int(pool->totused);
@@ -841,6 +1009,10 @@ void BLI_mempool_destroy(BLI_mempool *pool)
 {
   mempool_chunk_free_all(pool->chunks, pool);
 
+  if (pool->flag & BLI_MEMPOOL_THREAD_CACHE) {
+    BLI_spin_end(&pool->spin);
+  }
+
 #ifdef WITH_MEM_VALGRIND
   VALGRIND_DESTROY_MEMPOOL(pool);
 #endif
@@ -14,14 +14,16 @@
  *  - Literals:
  *      floating point and decimal integer.
  *  - Constants:
- *      pi, True, False
+ *      pi, tau, e, True, False
  *  - Operators:
  *      +, -, *, /, ==, !=, <, <=, >, >=, and, or, not, ternary if
  *  - Functions:
  *      min, max, radians, degrees,
- *      abs, fabs, floor, ceil, trunc, int,
+ *      abs, fabs, floor, ceil, trunc, int, float, bool,
  *      sin, cos, tan, asin, acos, atan, atan2,
- *      exp, log, sqrt, pow, fmod
+ *      sinh, cosh, tanh, asinh, acosh, atanh,
+ *      exp, log, log2, log10, sqrt, pow, fmod, hypot, copysign,
+ *      lerp, clamp, smoothstep
  *
  * The implementation has no global state and can be used multi-threaded.
  */
@@ -313,6 +315,16 @@ static double op_log2(double a, double b)
   return log(a) / log(b);
 }
 
+static double op_float(double arg)
+{
+  return arg;
+}
+
+static double op_bool(double arg)
+{
+  return arg ? 1.0 : 0.0;
+}
+
 static double op_lerp(double a, double b, double x)
 {
   return a * (1.0 - x) + b * x;
@@ -378,7 +390,13 @@ struct BuiltinConstDef {
 };
 
 static BuiltinConstDef builtin_consts[] = {
-    {"pi", M_PI}, {"True", 1.0}, {"False", 0.0}, {nullptr, 0.0}};
+    {"pi", M_PI},
+    {"tau", 2.0 * M_PI},
+    {"e", M_E},
+    {"True", 1.0},
+    {"False", 0.0},
+    {nullptr, 0.0},
+};
 
 struct BuiltinOpDef {
   const char *name;
@@ -419,6 +437,8 @@ static BuiltinOpDef builtin_ops[] = {
     {"trunc", UnaryOpFunc(trunc)},
     {"round", UnaryOpFunc(round)},
     {"int", UnaryOpFunc(trunc)},
+    {"float", UnaryOpFunc(op_float)},
+    {"bool", UnaryOpFunc(op_bool)},
     {"sin", UnaryOpFunc(sin)},
     {"cos", UnaryOpFunc(cos)},
     {"tan", UnaryOpFunc(tan)},
@@ -426,12 +446,22 @@ static BuiltinOpDef builtin_ops[] = {
     {"acos", UnaryOpFunc(acos)},
     {"atan", UnaryOpFunc(atan)},
     {"atan2", BinaryOpFunc(atan2)},
+    {"sinh", UnaryOpFunc(sinh)},
+    {"cosh", UnaryOpFunc(cosh)},
+    {"tanh", UnaryOpFunc(tanh)},
+    {"asinh", UnaryOpFunc(asinh)},
+    {"acosh", UnaryOpFunc(acosh)},
+    {"atanh", UnaryOpFunc(atanh)},
     {"exp", UnaryOpFunc(exp)},
     {"log", UnaryOpFunc(log)},
     {"log", BinaryOpFunc(op_log2)},
+    {"log2", UnaryOpFunc(log2)},
+    {"log10", UnaryOpFunc(log10)},
     {"sqrt", UnaryOpFunc(sqrt)},
     {"pow", BinaryOpFunc(pow)},
     {"fmod", BinaryOpFunc(fmod)},
+    {"hypot", BinaryOpFunc(hypot)},
+    {"copysign", BinaryOpFunc(copysign)},
     {"lerp", TernaryOpFunc(op_lerp)},
     {"clamp", UnaryOpFunc(op_clamp)},
     {"clamp", TernaryOpFunc(op_clamp3)},
@@ -129,3 +129,12 @@ FileReader *BLI_filereader_new_mmap(int filedes)
 
   return (FileReader *)mem;
 }
+
+void *BLI_filereader_mmap_memory(FileReader *reader)
+{
+  if (reader->close != memory_close_mmap) {
+    return nullptr;
+  }
+  MemoryReader *mem = (MemoryReader *)reader;
+  return BLI_mmap_get_pointer(mem->mmap);
+}
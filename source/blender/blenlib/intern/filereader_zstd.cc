@@ -7,11 +7,14 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <zstd.h>
 
 #include "BLI_fileops.hh"
 #include "BLI_filereader.h"
+#include "BLI_task.hh"
+#include "BLI_threads.h"
 
 #include "MEM_guardedalloc.h"
 
@@ -29,8 +32,21 @@ struct ZstdReader {
     size_t *compressed_ofs;
     size_t *uncompressed_ofs;
 
+    /**
+     * Decompressed content of the frames `[cached_frame, cached_frame + cached_frames_num)`,
+     * stored contiguously.
+     */
     char *cached_content;
     int cached_frame;
+    int cached_frames_num;
+
+    /**
+     * Number of frames decompressed at once on the next cache miss. This grows while the
+     * stream is read sequentially (as is the case for #BHead parsing) and is reset on random
+     * access, so that e.g. only reading the file header & thumbnail stays cheap.
+     */
+    int prefetch_frames_num;
+    int prefetch_frames_max;
   } seek;
 };
 
@@ -126,6 +142,10 @@ static bool zstd_read_seek_table(ZstdReader *zstd)
   }
 
   zstd->seek.cached_frame = -1;
+  zstd->seek.prefetch_frames_num = 1;
+  /* Give every thread a couple of frames to work on, while keeping the window memory bounded
+   * (Blender writes frames of 1 MB, see `ZSTD_CHUNK_SIZE` in `writefile.cc`). */
+  zstd->seek.prefetch_frames_max = std::max(1, std::min(2 * BLI_system_thread_count(), 64));
 
   return true;
 }
@@ -153,19 +173,88 @@ static int zstd_frame_from_pos(ZstdReader *zstd, size_t pos)
   return low;
 }
 
-/* Ensure that the currently loaded frame is the correct one. */
+/* Decompress the frames `[first_frame, first_frame + frames_num)`, which are stored
+ * contiguously in `compressed_data`, into `uncompressed_data`. */
+static bool zstd_decompress_frames(ZstdReader *zstd,
+                                   const int first_frame,
+                                   const int frames_num,
+                                   const char *compressed_data,
+                                   char *uncompressed_data)
+{
+  const size_t compressed_base = zstd->seek.compressed_ofs[first_frame];
+  const size_t uncompressed_base = zstd->seek.uncompressed_ofs[first_frame];
+
+  auto decompress_frame = [&](ZSTD_DCtx *ctx, const int frame) {
+    const size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] -
+                                   zstd->seek.compressed_ofs[frame];
+    const size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
+                                     zstd->seek.uncompressed_ofs[frame];
+    const size_t res = ZSTD_decompressDCtx(
+        ctx,
+        uncompressed_data + (zstd->seek.uncompressed_ofs[frame] - uncompressed_base),
+        uncompressed_size,
+        compressed_data + (zstd->seek.compressed_ofs[frame] - compressed_base),
+        compressed_size);
+    return !ZSTD_isError(res) && res >= uncompressed_size;
+  };
+
+  if (frames_num == 1) {
+    return decompress_frame(zstd->ctx, first_frame);
+  }
+
+  /* Frames are independent, so decompress them in parallel. Each task needs its own context
+   * since they are not thread-safe, the cost of creating one is negligible compared to
+   * decompressing a frame. */
+  std::atomic<bool> success = true;
+  blender::threading::parallel_for(
+      blender::IndexRange(first_frame, frames_num), 1, [&](const blender::IndexRange range) {
+        ZSTD_DCtx *ctx = ZSTD_createDCtx();
+        for (const int frame : range) {
+          if (!success || !decompress_frame(ctx, frame)) {
+            success = false;
+            break;
+          }
+        }
+        ZSTD_freeDCtx(ctx);
+      });
+  return success;
+}
+
+/* Ensure that the frame is loaded, returning a pointer to its decompressed content. */
 static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
 {
-  if (zstd->seek.cached_frame == frame) {
-    /* Cached frame matches, so just return it. */
-    return zstd->seek.cached_content;
+  if (frame >= zstd->seek.cached_frame &&
+      frame < zstd->seek.cached_frame + zstd->seek.cached_frames_num)
+  {
+    /* Cached window contains the frame, so just return it. */
+    return zstd->seek.cached_content +
+           (zstd->seek.uncompressed_ofs[frame] -
+            zstd->seek.uncompressed_ofs[zstd->seek.cached_frame]);
   }
 
-  /* Cached frame doesn't match, so discard it and cache the wanted one instead. */
+  /* Grow the prefetch window while reading sequentially, start over on random access. */
+  if (zstd->seek.cached_frame >= 0 &&
+      frame == zstd->seek.cached_frame + zstd->seek.cached_frames_num)
+  {
+    zstd->seek.prefetch_frames_num = std::min(zstd->seek.prefetch_frames_num * 2,
+                                              zstd->seek.prefetch_frames_max);
+  }
+  else {
+    zstd->seek.prefetch_frames_num = 1;
+  }
+
+  /* Cached window doesn't match, so discard it and cache the wanted frames instead. */
   MEM_SAFE_FREE(zstd->seek.cached_content);
+  zstd->seek.cached_frame = -1;
+  zstd->seek.cached_frames_num = 0;
+
+  const int frames_num = std::min(zstd->seek.prefetch_frames_num,
+                                  zstd->seek.frames_num - frame);
+  const int end_frame = frame + frames_num;
 
-  size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] - zstd->seek.compressed_ofs[frame];
-  size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
+  size_t compressed_size = zstd->seek.compressed_ofs[end_frame] -
+                           zstd->seek.compressed_ofs[frame];
+  size_t uncompressed_size = zstd->seek.uncompressed_ofs[end_frame] -
                              zstd->seek.uncompressed_ofs[frame];
 
   char *uncompressed_data = MEM_malloc_arrayN<char>(uncompressed_size, __func__);
@@ -178,15 +267,16 @@ static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
     return nullptr;
   }
 
-  size_t res = ZSTD_decompressDCtx(
-      zstd->ctx, uncompressed_data, uncompressed_size, compressed_data, compressed_size);
+  const bool success = zstd_decompress_frames(
+      zstd, frame, frames_num, compressed_data, uncompressed_data);
   MEM_freeN(compressed_data);
-  if (ZSTD_isError(res) || res < uncompressed_size) {
+  if (!success) {
     MEM_freeN(uncompressed_data);
     return nullptr;
   }
 
   zstd->seek.cached_frame = frame;
+  zstd->seek.cached_frames_num = frames_num;
   zstd->seek.cached_content = uncompressed_data;
   return uncompressed_data;
 }
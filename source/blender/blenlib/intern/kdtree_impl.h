@@ -8,12 +8,17 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
+#include "BLI_array_utils.hh"
 #include "BLI_kdtree_impl.h"
 #include "BLI_math_base.h"
+#include "BLI_sort.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 
 #include "BLI_strict_flags.h" /* IWYU pragma: keep. Keep last. */
@@ -801,6 +806,224 @@ finally:
   }
 }
 
+/* -------------------------------------------------------------------- */
+/** \name BLI_kdtree_3d_find_nearest_batch
+ * \{ */
+
+/** Number of bits per axis used to compute the Morton code of query points. */
+#define KD_BATCH_MORTON_BITS_PER_AXIS (KD_DIMS == 1 ? 32 : 63 / KD_DIMS)
+
+/**
+ * Same as #BLI_kdtree_3d_find_nearest, but starts with an existing candidate node. A close
+ * candidate allows skipping most of the tree early on.
+ *
+ * \param r_node: On input, the candidate node or #KD_NODE_UNSET. On output, the nearest node.
+ */
+static void kdtree_find_nearest_from_candidate(const KDTree *tree,
+                                               const float co[KD_DIMS],
+                                               const int skip_index,
+                                               uint *r_node,
+                                               float *r_dist_sq)
+{
+  const KDTreeNode *nodes = tree->nodes;
+  uint *stack, stack_default[KD_STACK_INIT];
+  uint stack_len_capacity, cur = 0;
+
+  uint min_node = KD_NODE_UNSET;
+  float min_dist = FLT_MAX;
+  if (*r_node != KD_NODE_UNSET && nodes[*r_node].index != skip_index) {
+    min_node = *r_node;
+    min_dist = len_squared_vnvn(nodes[min_node].co, co);
+  }
+
+  stack = stack_default;
+  stack_len_capacity = KD_STACK_INIT;
+  stack[cur++] = tree->root;
+
+  while (cur--) {
+    const uint node_index = stack[cur];
+    const KDTreeNode *node = &nodes[node_index];
+    const float plane_dist = node->co[node->d] - co[node->d];
+    const float plane_dist_sq = plane_dist * plane_dist;
+
+    /* Visit the child on the same side of the split plane as the query point last, so that it
+     * is popped first. */
+    const uint near_child = (plane_dist < 0.0f) ? node->right : node->left;
+    const uint far_child = (plane_dist < 0.0f) ? node->left : node->right;
+
+    /* Points at exactly the current distance still have to be visited to break ties by index,
+     * otherwise the result would depend on the candidate the search started with. */
+    if (plane_dist_sq <= min_dist) {
+      if (node->index != skip_index) {
+        const float dist_sq = len_squared_vnvn(node->co, co);
+        if (dist_sq < min_dist ||
+            (dist_sq == min_dist && min_node != KD_NODE_UNSET &&
+             node->index < nodes[min_node].index))
+        {
+          min_dist = dist_sq;
+          min_node = node_index;
+        }
+      }
+      if (far_child != KD_NODE_UNSET) {
+        stack[cur++] = far_child;
+      }
+    }
+    if (near_child != KD_NODE_UNSET) {
+      stack[cur++] = near_child;
+    }
+    if (UNLIKELY(cur + KD_DIMS > stack_len_capacity)) {
+      stack = realloc_nodes(stack, &stack_len_capacity, stack_default != stack);
+    }
+  }
+
+  if (stack != stack_default) {
+    MEM_freeN(stack);
+  }
+
+  *r_node = min_node;
+  *r_dist_sq = min_dist;
+}
+
+/**
+ * Convert a coordinate that is already scaled to the quantization range to an integer. Written
+ * so that NaN results in zero, because casting it to an integer is undefined.
+ */
+static uint64_t kdtree_quantize_coord(const float value, const float max_value)
+{
+  if (!(value > 0.0f)) {
+    return 0;
+  }
+  return uint64_t(std::min(value, max_value));
+}
+
+static uint64_t kdtree_morton_code(const float co[KD_DIMS],
+                                   const float min[KD_DIMS],
+                                   const float scale[KD_DIMS])
+{
+  constexpr uint bits = KD_BATCH_MORTON_BITS_PER_AXIS;
+  constexpr float max_value = float((uint64_t(1) << bits) - 1);
+  uint64_t quantized[KD_DIMS];
+  for (uint j = 0; j < KD_DIMS; j++) {
+    quantized[j] = kdtree_quantize_coord((co[j] - min[j]) * scale[j], max_value);
+  }
+  uint64_t code = 0;
+  for (uint bit = 0; bit < bits; bit++) {
+    for (uint j = 0; j < KD_DIMS; j++) {
+      code |= ((quantized[j] >> bit) & 1) << (bit * KD_DIMS + j);
+    }
+  }
+  return code;
+}
+
+/**
+ * Compute the order in which query points are processed. Points that are close to each other are
+ * close in the order as well, so that the result of a query is a good candidate for the next one.
+ */
+static blender::Array<uint> kdtree_batch_order(const float (*co)[KD_DIMS], const uint co_len)
+{
+  using namespace blender;
+  float min[KD_DIMS], max[KD_DIMS];
+  for (uint j = 0; j < KD_DIMS; j++) {
+    min[j] = FLT_MAX;
+    max[j] = -FLT_MAX;
+  }
+  /* Ignore infinite and NaN coordinates, so that they don't affect the order of all other
+   * points. */
+  for (uint i = 0; i < co_len; i++) {
+    bool is_finite = true;
+    for (uint j = 0; j < KD_DIMS; j++) {
+      is_finite &= bool(std::isfinite(co[i][j]));
+    }
+    if (!is_finite) {
+      continue;
+    }
+    for (uint j = 0; j < KD_DIMS; j++) {
+      min[j] = std::min(min[j], co[i][j]);
+      max[j] = std::max(max[j], co[i][j]);
+    }
+  }
+  float scale[KD_DIMS];
+  for (uint j = 0; j < KD_DIMS; j++) {
+    const float size = max[j] - min[j];
+    scale[j] = size > 0.0f ? float((uint64_t(1) << KD_BATCH_MORTON_BITS_PER_AXIS) - 1) / size :
+                             0.0f;
+  }
+
+  Array<std::pair<uint64_t, uint>> codes(co_len, NoInitialization());
+  threading::parallel_for(IndexRange(co_len), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      codes[i] = {kdtree_morton_code(co[i], min, scale), uint(i)};
+    }
+  });
+  parallel_sort(codes.begin(), codes.end());
+
+  Array<uint> order(co_len, NoInitialization());
+  threading::parallel_for(IndexRange(co_len), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      order[i] = codes[i].second;
+    }
+  });
+  return order;
+}
+
+/**
+ * Find the nearest point for many query points at once.
+ *
+ * The queries are sorted along a Morton curve and processed in parallel. Within each task, the
+ * result of the previous query is used as candidate for the next one, which skips most of the
+ * traversal for coherent queries.
+ *
+ * \param skip_indices: Optional index per query that is ignored in the tree,
+ * e.g. to find the nearest point that is not the query point itself.
+ * \param r_indices: The index of the nearest point for every query, or -1 if there is none.
+ * \param r_dist_sq: Optional squared distance to the nearest point for every query.
+ *
+ * \note On exact ties the point with the lowest index is chosen, so the result does not depend on
+ * how the queries are split into tasks.
+ */
+void BLI_kdtree_nd_(find_nearest_batch)(const KDTree *tree,
+                                        const float (*co)[KD_DIMS],
+                                        const uint co_len,
+                                        const int *skip_indices,
+                                        int *r_indices,
+                                        float *r_dist_sq)
+{
+  using namespace blender;
+
+#ifndef NDEBUG
+  BLI_assert(tree->is_balanced == true);
+#endif
+
+  if (UNLIKELY(tree->root == KD_NODE_UNSET)) {
+    for (uint i = 0; i < co_len; i++) {
+      r_indices[i] = -1;
+      if (r_dist_sq) {
+        r_dist_sq[i] = FLT_MAX;
+      }
+    }
+    return;
+  }
+
+  const Array<uint> order = kdtree_batch_order(co, co_len);
+
+  threading::parallel_for(order.index_range(), 512, [&](const IndexRange range) {
+    uint node = KD_NODE_UNSET;
+    for (const uint i : order.as_span().slice(range)) {
+      const int skip_index = skip_indices ? skip_indices[i] : -1;
+      float dist_sq;
+      kdtree_find_nearest_from_candidate(tree, co[i], skip_index, &node, &dist_sq);
+      r_indices[i] = node == KD_NODE_UNSET ? -1 : tree->nodes[node].index;
+      if (r_dist_sq) {
+        r_dist_sq[i] = dist_sq;
+      }
+    }
+  });
+}
+
+#undef KD_BATCH_MORTON_BITS_PER_AXIS
+
+/** \} */
+
 /**
  * Use when we want to loop over nodes ordered by index.
  * Requires indices to be aligned with nodes.
@@ -824,41 +1047,57 @@ struct DeDuplicateParams {
   const KDTreeNode *nodes;
   float range;
   float range_sq;
-  int *duplicates;
-  int *duplicates_found;
+  const int *duplicates;
 
   /* Per Search */
   float search_co[KD_DIMS];
   int search;
+  int64_t candidates_max;
 };
 
-static void deduplicate_recursive(const DeDuplicateParams *p, uint i)
+/**
+ * Find the nodes in range of the search coordinate that are still candidates to be merged.
+ * This only reads #DeDuplicateParams.duplicates, so many searches can run in parallel.
+ *
+ * \return False when the search stopped early, because #DeDuplicateParams.candidates_max
+ * candidates were found.
+ */
+static bool deduplicate_recursive(const DeDuplicateParams *p,
+                                  uint i,
+                                  blender::Vector<int> &r_candidates)
 {
   const KDTreeNode *node = &p->nodes[i];
   if (p->search_co[node->d] + p->range <= node->co[node->d]) {
     if (node->left != KD_NODE_UNSET) {
-      deduplicate_recursive(p, node->left);
+      return deduplicate_recursive(p, node->left, r_candidates);
     }
   }
   else if (p->search_co[node->d] - p->range >= node->co[node->d]) {
     if (node->right != KD_NODE_UNSET) {
-      deduplicate_recursive(p, node->right);
+      return deduplicate_recursive(p, node->right, r_candidates);
     }
   }
   else {
     if ((p->search != node->index) && (p->duplicates[node->index] == -1)) {
       if (len_squared_vnvn(node->co, p->search_co) <= p->range_sq) {
-        p->duplicates[node->index] = (int)p->search;
-        *p->duplicates_found += 1;
+        if (r_candidates.size() == p->candidates_max) {
+          return false;
+        }
+        r_candidates.append(node->index);
       }
     }
     if (node->left != KD_NODE_UNSET) {
-      deduplicate_recursive(p, node->left);
+      if (!deduplicate_recursive(p, node->left, r_candidates)) {
+        return false;
+      }
     }
     if (node->right != KD_NODE_UNSET) {
-      deduplicate_recursive(p, node->right);
+      if (!deduplicate_recursive(p, node->right, r_candidates)) {
+        return false;
+      }
     }
   }
+  return true;
 }
 
 /**
@@ -884,6 +1123,7 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
                                          bool use_index_order,
                                          int *duplicates)
 {
+  using namespace blender;
   int found = 0;
 
   DeDuplicateParams p = {};
@@ -891,42 +1131,80 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
   p.range = range;
   p.range_sq = square_f(range);
   p.duplicates = duplicates;
-  p.duplicates_found = &found;
 
+  /* The nodes to search from, in the order in which their duplicates are merged. */
+  Vector<int> search_nodes;
   if (use_index_order) {
-    blender::Vector<int> order = kdtree_order(tree);
-    for (int i = 0; i < tree->max_node_index + 1; i++) {
-      const int node_index = order[i];
-      if (node_index == -1) {
+    search_nodes = kdtree_order(tree);
+    search_nodes.remove_if([](const int node_index) { return node_index == -1; });
+  }
+  else {
+    search_nodes.resize(tree->nodes_len);
+    array_utils::fill_index_range<int>(search_nodes);
+  }
+
+  /* Searching for the candidates of each node is the expensive part, and it only reads the
+   * duplicates. So the candidates are found for a batch of nodes in parallel. Then they are
+   * merged on a single thread in the same order as before, which gives the same result as
+   * searching one node after another. Entries that aren't -1 never become candidates again,
+   * so the candidates only have to be checked again, not searched again.
+   *
+   * In dense clusters every node of the batch would find the whole cluster, so the number of
+   * candidates found in parallel is limited. Nodes that reach the limit are searched again when
+   * merging, against the current state, which skips everything merged in the meantime. */
+  constexpr int batch_size = 16384;
+  constexpr int64_t batch_candidates_max = 64;
+  Array<Vector<int>> candidates(std::min<int64_t>(search_nodes.size(), batch_size));
+  Array<bool> candidates_complete(candidates.size());
+  Vector<int> dense_candidates;
+
+  for (int64_t batch_start = 0; batch_start < search_nodes.size(); batch_start += batch_size) {
+    const Span<int> batch = search_nodes.as_span().slice(
+        batch_start, std::min<int64_t>(batch_size, search_nodes.size() - batch_start));
+
+    threading::parallel_for(batch.index_range(), 512, [&](const IndexRange batch_range) {
+      for (const int64_t i : batch_range) {
+        candidates[i].clear();
+        candidates_complete[i] = true;
+        const KDTreeNode &node = tree->nodes[batch[i]];
+        if (!ELEM(duplicates[node.index], -1, node.index)) {
+          continue;
+        }
+        DeDuplicateParams p_search = p;
+        p_search.search = node.index;
+        p_search.candidates_max = batch_candidates_max;
+        copy_vn_vn(p_search.search_co, node.co);
+        candidates_complete[i] = deduplicate_recursive(&p_search, tree->root, candidates[i]);
+      }
+    });
+
+    for (const int64_t i : batch.index_range()) {
+      const KDTreeNode &node = tree->nodes[batch[i]];
+      const int index = node.index;
+      if (!ELEM(duplicates[index], -1, index)) {
         continue;
       }
-      const int index = i;
-      if (ELEM(duplicates[index], -1, index)) {
-        p.search = index;
-        copy_vn_vn(p.search_co, tree->nodes[node_index].co);
-        int found_prev = found;
-        deduplicate_recursive(&p, tree->root);
-        if (found != found_prev) {
-          /* Prevent chains of doubles. */
-          duplicates[index] = index;
-        }
+      Span<int> node_candidates = candidates[i];
+      if (!candidates_complete[i]) {
+        dense_candidates.clear();
+        DeDuplicateParams p_search = p;
+        p_search.search = index;
+        p_search.candidates_max = INT64_MAX;
+        copy_vn_vn(p_search.search_co, node.co);
+        deduplicate_recursive(&p_search, tree->root, dense_candidates);
+        node_candidates = dense_candidates;
       }
-    }
-  }
-  else {
-    for (uint i = 0; i < tree->nodes_len; i++) {
-      const uint node_index = i;
-      const int index = p.nodes[node_index].index;
-      if (ELEM(duplicates[index], -1, index)) {
-        p.search = index;
-        copy_vn_vn(p.search_co, tree->nodes[node_index].co);
-        int found_prev = found;
-        deduplicate_recursive(&p, tree->root);
-        if (found != found_prev) {
-          /* Prevent chains of doubles. */
-          duplicates[index] = index;
+      const int found_prev = found;
+      for (const int candidate : node_candidates) {
+        if (duplicates[candidate] == -1) {
+          duplicates[candidate] = index;
+          found++;
         }
       }
+      if (found != found_prev) {
+        /* Prevent chains of doubles. */
+        duplicates[index] = index;
+      }
     }
   }
   return found;
@@ -0,0 +1,74 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_linear_allocator.hh"
+
+namespace blender {
+
+namespace linear_allocator_arena {
+
+/**
+ * Upper bound for the memory that is kept around per thread while an arena is active. Chunks
+ * that are freed when the cache is full are given back to the system immediately.
+ */
+static constexpr int64_t max_cached_chunks = 256;
+
+struct ThreadArena {
+  /** Number of nested #LinearAllocatorArenaScope on this thread. */
+  int users = 0;
+  Vector<void *, 0> free_chunks;
+};
+
+static thread_local ThreadArena thread_arena;
+
+void *try_allocate_chunk()
+{
+  ThreadArena &arena = thread_arena;
+  if (arena.users == 0) {
+    return nullptr;
+  }
+  if (!arena.free_chunks.is_empty()) {
+    return arena.free_chunks.pop_last();
+  }
+  return MEM_mallocN_aligned(chunk_size, chunk_alignment, "LinearAllocator chunk");
+}
+
+void free_chunk(void *chunk)
+{
+  ThreadArena &arena = thread_arena;
+  if (arena.users > 0 && arena.free_chunks.size() < max_cached_chunks) {
+    arena.free_chunks.append(chunk);
+    return;
+  }
+  MEM_freeN(chunk);
+}
+
+}  // namespace linear_allocator_arena
+
+LinearAllocatorArenaScope::LinearAllocatorArenaScope()
+{
+  linear_allocator_arena::thread_arena.users++;
+}
+
+LinearAllocatorArenaScope::~LinearAllocatorArenaScope()
+{
+  linear_allocator_arena::ThreadArena &arena = linear_allocator_arena::thread_arena;
+  BLI_assert(arena.users > 0);
+  arena.users--;
+  if (arena.users == 0) {
+    for (void *chunk : arena.free_chunks) {
+      MEM_freeN(chunk);
+    }
+    /* Also free the buffer of the vector itself, so that nothing is left when the thread ends. */
+    arena.free_chunks.clear_and_shrink();
+  }
+}
+
+}  // namespace blender
@@ -10,6 +10,7 @@
 
 #include "BLI_math_rotation.hh"
 #include "BLI_simd.hh"
+#include "BLI_task.hh"
 
 #include <Eigen/Core>
 #include <Eigen/Dense>
@@ -434,6 +435,89 @@ template double4x4 interpolate_fast(const double4x4 &a, const double4x4 &b, doub
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Transform Arrays
+ *
+ * Positions are stored as tightly packed #float3, so the SSE path loads each component
+ * separately and never writes past the end of the current element. That keeps in-place
+ * transformation valid and avoids touching memory outside of the span.
+ * \{ */
+
+#if BLI_HAVE_SSE2
+BLI_INLINE void transform_float3_sse(const __m128 col0,
+                                     const __m128 col1,
+                                     const __m128 col2,
+                                     const __m128 col3,
+                                     const float3 &src,
+                                     float3 &dst)
+{
+  const __m128 x = _mm_mul_ps(col0, _mm_set1_ps(src.x));
+  const __m128 y = _mm_mul_ps(col1, _mm_set1_ps(src.y));
+  const __m128 z = _mm_mul_ps(col2, _mm_set1_ps(src.z));
+  const __m128 result = _mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, col3));
+  _mm_storel_pi(reinterpret_cast<__m64 *>(&dst.x), result);
+  _mm_store_ss(&dst.z, _mm_movehl_ps(result, result));
+}
+#endif
+
+static void transform_float3_array(const float4x4 &transform,
+                                   const bool use_location,
+                                   const Span<float3> src,
+                                   MutableSpan<float3> dst)
+{
+  BLI_assert(src.size() == dst.size());
+#if BLI_HAVE_SSE2
+  const __m128 col0 = _mm_loadu_ps(transform[0]);
+  const __m128 col1 = _mm_loadu_ps(transform[1]);
+  const __m128 col2 = _mm_loadu_ps(transform[2]);
+  const __m128 col3 = use_location ? _mm_loadu_ps(transform[3]) : _mm_setzero_ps();
+  for (const int64_t i : src.index_range()) {
+    transform_float3_sse(col0, col1, col2, col3, src[i], dst[i]);
+  }
+#else
+  if (use_location) {
+    for (const int64_t i : src.index_range()) {
+      dst[i] = transform_point(transform, src[i]);
+    }
+  }
+  else {
+    for (const int64_t i : src.index_range()) {
+      dst[i] = transform_direction(transform, src[i]);
+    }
+  }
+#endif
+}
+
+void transform_points(const float4x4 &transform, MutableSpan<float3> points)
+{
+  transform_points(points, transform, points);
+}
+
+void transform_points(const Span<float3> src, const float4x4 &transform, MutableSpan<float3> dst)
+{
+  BLI_assert(src.size() == dst.size());
+  threading::parallel_for(src.index_range(), 1024, [&](const IndexRange range) {
+    transform_float3_array(transform, true, src.slice(range), dst.slice(range));
+  });
+}
+
+void transform_normals(const float3x3 &transform, MutableSpan<float3> normals)
+{
+  transform_normals(normals, transform, normals);
+}
+
+void transform_normals(const Span<float3> src, const float3x3 &transform, MutableSpan<float3> dst)
+{
+  BLI_assert(src.size() == dst.size());
+  /* Pad the columns so the same kernel as for points can be used. */
+  const float4x4 transform_padded(transform);
+  threading::parallel_for(src.index_range(), 1024, [&](const IndexRange range) {
+    transform_float3_array(transform_padded, false, src.slice(range), dst.slice(range));
+  });
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Legacy
  * \{ */
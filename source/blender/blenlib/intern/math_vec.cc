@@ -9,6 +9,8 @@
 #include "BLI_hash.hh"
 #include "BLI_math_vector.hh"
 #include "BLI_math_vector_mpq_types.hh"
+#include "BLI_simd.hh"
+#include "BLI_task.hh"
 
 namespace blender::math {
 
@@ -114,4 +116,133 @@ uint64_t hash_mpq_class(const mpq_class &value)
 
 #endif
 
+/* -------------------------------------------------------------------- */
+/** \name Batch Operations
+ *
+ * The SSE paths process four vectors at a time. They load them as three registers, transpose
+ * them to one register per component, and transpose the result back before storing it. All
+ * four vectors are loaded before anything is stored, so the operations also work in place.
+ * \{ */
+
+#if BLI_HAVE_SSE2
+struct Float3x4 {
+  __m128 x;
+  __m128 y;
+  __m128 z;
+};
+
+BLI_INLINE Float3x4 load_float3x4(const float3 *src)
+{
+  const float *ptr = &src->x;
+  /* (x0, y0, z0, x1), (y1, z1, x2, y2), (z2, x3, y3, z3). */
+  const __m128 a = _mm_loadu_ps(ptr);
+  const __m128 b = _mm_loadu_ps(ptr + 4);
+  const __m128 c = _mm_loadu_ps(ptr + 8);
+  Float3x4 result;
+  result.x = _mm_shuffle_ps(
+      a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+  result.y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+                            _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)),
+                            _MM_SHUFFLE(2, 0, 2, 0));
+  result.z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+                            _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)),
+                            _MM_SHUFFLE(2, 0, 2, 0));
+  return result;
+}
+
+BLI_INLINE void store_float3x4(const Float3x4 &value, float3 *dst)
+{
+  const __m128 &x = value.x;
+  const __m128 &y = value.y;
+  const __m128 &z = value.z;
+  const __m128 a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+                                  _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)),
+                                  _MM_SHUFFLE(2, 0, 2, 0));
+  const __m128 b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+                                  _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)),
+                                  _MM_SHUFFLE(2, 0, 2, 0));
+  const __m128 c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+                                  _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)),
+                                  _MM_SHUFFLE(2, 0, 2, 0));
+  float *ptr = &dst->x;
+  _mm_storeu_ps(ptr, a);
+  _mm_storeu_ps(ptr + 4, b);
+  _mm_storeu_ps(ptr + 8, c);
+}
+
+BLI_INLINE __m128 dot_float3x4(const Float3x4 &a, const Float3x4 &b)
+{
+  return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a.x, b.x), _mm_mul_ps(a.y, b.y)),
+                    _mm_mul_ps(a.z, b.z));
+}
+#endif
+
+void normalize_array(const Span<float3> src, MutableSpan<float3> dst)
+{
+  BLI_assert(src.size() == dst.size());
+  threading::parallel_for(src.index_range(), 1024, [&](const IndexRange range) {
+    int64_t i = range.start();
+#if BLI_HAVE_SSE2
+    /* Same threshold as #normalize_and_get_length, NaN lengths fail the comparison too. */
+    const __m128 threshold = _mm_set1_ps(1.0e-35f);
+    for (; i + 4 <= range.one_after_last(); i += 4) {
+      const Float3x4 v = load_float3x4(&src[i]);
+      const __m128 length_sq = dot_float3x4(v, v);
+      const __m128 mask = _mm_cmpgt_ps(length_sq, threshold);
+      const __m128 length = _mm_sqrt_ps(length_sq);
+      Float3x4 result;
+      result.x = _mm_and_ps(mask, _mm_div_ps(v.x, length));
+      result.y = _mm_and_ps(mask, _mm_div_ps(v.y, length));
+      result.z = _mm_and_ps(mask, _mm_div_ps(v.z, length));
+      store_float3x4(result, &dst[i]);
+    }
+#endif
+    for (; i < range.one_after_last(); i++) {
+      dst[i] = normalize(src[i]);
+    }
+  });
+}
+
+void dot_array(const Span<float3> a, const Span<float3> b, MutableSpan<float> dst)
+{
+  BLI_assert(a.size() == b.size());
+  BLI_assert(a.size() == dst.size());
+  threading::parallel_for(a.index_range(), 1024, [&](const IndexRange range) {
+    int64_t i = range.start();
+#if BLI_HAVE_SSE2
+    for (; i + 4 <= range.one_after_last(); i += 4) {
+      _mm_storeu_ps(&dst[i], dot_float3x4(load_float3x4(&a[i]), load_float3x4(&b[i])));
+    }
+#endif
+    for (; i < range.one_after_last(); i++) {
+      dst[i] = dot(a[i], b[i]);
+    }
+  });
+}
+
+void cross_array(const Span<float3> a, const Span<float3> b, MutableSpan<float3> dst)
+{
+  BLI_assert(a.size() == b.size());
+  BLI_assert(a.size() == dst.size());
+  threading::parallel_for(a.index_range(), 1024, [&](const IndexRange range) {
+    int64_t i = range.start();
+#if BLI_HAVE_SSE2
+    for (; i + 4 <= range.one_after_last(); i += 4) {
+      const Float3x4 va = load_float3x4(&a[i]);
+      const Float3x4 vb = load_float3x4(&b[i]);
+      Float3x4 result;
+      result.x = _mm_sub_ps(_mm_mul_ps(va.y, vb.z), _mm_mul_ps(va.z, vb.y));
+      result.y = _mm_sub_ps(_mm_mul_ps(va.z, vb.x), _mm_mul_ps(va.x, vb.z));
+      result.z = _mm_sub_ps(_mm_mul_ps(va.x, vb.y), _mm_mul_ps(va.y, vb.x));
+      store_float3x4(result, &dst[i]);
+    }
+#endif
+    for (; i < range.one_after_last(); i++) {
+      dst[i] = cross(a[i], b[i]);
+    }
+  });
+}
+
+/** \} */
+
 }  // namespace blender::math
@@ -1074,7 +1074,7 @@ static inline mpq3 tti_interp(
 /**
  * Return +1, 0, -1 as a + ad is above, on, or below the oriented plane containing a, b, c in CCW
  * order. This is the same as -oriented(a, b, c, a + ad), but uses fewer arithmetic operations.
- * TODO: change arguments to `const Vert *` and use floating filters.
+ * #filter_tti_above should be tried first, because exact arithmetic is much slower.
  * The ba, ca, n, and dotbuf arguments are used as temporaries; declaring them
  * in the caller can avoid many allocations and frees of mpq3 and mpq_class structures.
  */
@@ -1099,6 +1099,42 @@ static inline int tti_above(const mpq3 &a,
   return sgn(math::dot_with_buffer(ad, n, dotbuf));
 }
 
+/**
+ * Index of the result of #filter_tti_above, with inputs of index 1: `b - a` has index 2, the
+ * coordinates of the cross product have index 6, and the final dot product has index 11.
+ */
+constexpr int index_tti_above = 11;
+
+/**
+ * Floating point filter for #tti_above, using the same error bounds as #filter_plane_side.
+ * Return +1 or -1 if a + ad is definitely above or below the plane containing a, b, c, and 0 if
+ * that can't be decided with double arithmetic, in which case the exact test has to be used.
+ * \param sup_ad: The supremum of ad, i.e. the sum of the absolute values it was computed from.
+ */
+static inline int filter_tti_above(const double3 &a,
+                                   const double3 &b,
+                                   const double3 &c,
+                                   const double3 &ad,
+                                   const double3 &sup_ad)
+{
+  const double3 n = math::cross(b - a, c - a);
+  const double d = math::dot(ad, n);
+  if (d == 0.0) {
+    return 0;
+  }
+  const double3 abs_a = math::abs(a);
+  const double3 sup_ba = math::abs(b) + abs_a;
+  const double3 sup_ca = math::abs(c) + abs_a;
+  const double3 sup_n(sup_ba.y * sup_ca.z + sup_ba.z * sup_ca.y,
+                      sup_ba.z * sup_ca.x + sup_ba.x * sup_ca.z,
+                      sup_ba.x * sup_ca.y + sup_ba.y * sup_ca.x);
+  const double err_bound = math::dot(sup_ad, sup_n) * index_tti_above * DBL_EPSILON;
+  if (fabs(d) > err_bound) {
+    return d > 0 ? 1 : -1;
+  }
+  return 0;
+}
+
 /**
  * Given that triangles (p1, q1, r1) and (p2, q2, r2) are in canonical order,
  * use the classification chart in the Guigue and Devillers paper to find out
@@ -1112,16 +1148,22 @@ static inline int tti_above(const mpq3 &a,
  *   of the plane and at least one of q1 and r1 are off the plane.
  * Similarly for p2, q2, r2 with respect to the first triangle's plane.
  */
-static ITT_value itt_canon2(const mpq3 &p1,
-                            const mpq3 &q1,
-                            const mpq3 &r1,
-                            const mpq3 &p2,
-                            const mpq3 &q2,
-                            const mpq3 &r2,
+static ITT_value itt_canon2(const Vert *vp1,
+                            const Vert *vq1,
+                            const Vert *vr1,
+                            const Vert *vp2,
+                            const Vert *vq2,
+                            const Vert *vr2,
                             const mpq3 &n1,
                             const mpq3 &n2)
 {
   constexpr int dbg_level = 0;
+  const mpq3 &p1 = vp1->co_exact;
+  const mpq3 &q1 = vq1->co_exact;
+  const mpq3 &r1 = vr1->co_exact;
+  const mpq3 &p2 = vp2->co_exact;
+  const mpq3 &q2 = vq2->co_exact;
+  const mpq3 &r2 = vr2->co_exact;
   if (dbg_level > 0) {
     std::cout << "\ntri_tri_intersect_canon:\n";
     std::cout << "p1=" << p1 << " q1=" << q1 << " r1=" << r1 << "\n";
@@ -1137,17 +1179,42 @@ static ITT_value itt_canon2(const mpq3 &p1,
     std::cout << "n1=(" << n1[0].get_d() << "," << n1[1].get_d() << "," << n1[2].get_d() << ")\n";
     std::cout << "n2=(" << n2[0].get_d() << "," << n2[1].get_d() << "," << n2[2].get_d() << ")\n";
   }
-  mpq3 p1p2 = p2 - p1;
+  mpq3 p1p2;
+  bool p1p2_computed = false;
   mpq3 intersect_1;
   mpq3 intersect_2;
   mpq3 buf[4];
   bool no_overlap = false;
+
+  /* All tests of the classification tree are relative to p1 and p1p2. Most of them can be decided
+   * with double arithmetic, so the exact vector is only computed when necessary. */
+  const double3 d_p1p2 = vp2->co - vp1->co;
+  const double3 sup_p1p2 = math::abs(vp2->co) + math::abs(vp1->co);
+  auto above = [&](const Vert *b, const Vert *c) -> int {
+    const int filter_side = filter_tti_above(vp1->co, b->co, c->co, d_p1p2, sup_p1p2);
+    if (filter_side != 0) {
+#  ifdef PERFDEBUG
+      incperfcount(5); /* tti_above decided by filter. */
+#  endif
+      return filter_side;
+    }
+#  ifdef PERFDEBUG
+    incperfcount(6); /* tti_above decided by exact arithmetic. */
+#  endif
+    if (!p1p2_computed) {
+      p1p2 = p2;
+      p1p2 -= p1;
+      p1p2_computed = true;
+    }
+    return tti_above(p1, b->co_exact, c->co_exact, p1p2, buf[0], buf[1], buf[2], buf[3]);
+  };
+
   /* Top test in classification tree. */
-  if (tti_above(p1, q1, r2, p1p2, buf[0], buf[1], buf[2], buf[3]) > 0) {
+  if (above(vq1, vr2) > 0) {
     /* Middle right test in classification tree. */
-    if (tti_above(p1, r1, r2, p1p2, buf[0], buf[1], buf[2], buf[3]) <= 0) {
+    if (above(vr1, vr2) <= 0) {
       /* Bottom right test in classification tree. */
-      if (tti_above(p1, r1, q2, p1p2, buf[0], buf[1], buf[2], buf[3]) > 0) {
+      if (above(vr1, vq2) > 0) {
         /* Overlap is [k [i l] j]. */
         if (dbg_level > 0) {
           std::cout << "overlap [k [i l] j]\n";
@@ -1176,7 +1243,7 @@ static ITT_value itt_canon2(const mpq3 &p1,
   }
   else {
     /* Middle left test in classification tree. */
-    if (tti_above(p1, q1, q2, p1p2, buf[0], buf[1], buf[2], buf[3]) < 0) {
+    if (above(vq1, vq2) < 0) {
       /* No overlap: [i j] [k l]. */
       if (dbg_level > 0) {
         std::cout << "no overlap: [i j] [k l]\n";
@@ -1185,7 +1252,7 @@ static ITT_value itt_canon2(const mpq3 &p1,
     }
     else {
       /* Bottom left test in classification tree. */
-      if (tti_above(p1, r1, q2, p1p2, buf[0], buf[1], buf[2], buf[3]) >= 0) {
+      if (above(vr1, vq2) >= 0) {
         /* Overlap is [k [i j] l]. */
         if (dbg_level > 0) {
           std::cout << "overlap [k [i j] l]\n";
@@ -1222,12 +1289,12 @@ static ITT_value itt_canon2(const mpq3 &p1,
 
 /* Helper function for intersect_tri_tri. Arguments have been canonicalized for triangle 1. */
 
-static ITT_value itt_canon1(const mpq3 &p1,
-                            const mpq3 &q1,
-                            const mpq3 &r1,
-                            const mpq3 &p2,
-                            const mpq3 &q2,
-                            const mpq3 &r2,
+static ITT_value itt_canon1(const Vert *p1,
+                            const Vert *q1,
+                            const Vert *r1,
+                            const Vert *p2,
+                            const Vert *q2,
+                            const Vert *r2,
                             const mpq3 &n1,
                             const mpq3 &n2,
                             int sp2,
@@ -1429,49 +1496,49 @@ static ITT_value intersect_tri_tri(const IMesh &tm, int t1, int t2)
   ITT_value ans;
   if (sp1 > 0) {
     if (sq1 > 0) {
-      ans = itt_canon1(r1, p1, q1, p2, r2, q2, n1, n2, sp2, sr2, sq2);
+      ans = itt_canon1(vr1, vp1, vq1, vp2, vr2, vq2, n1, n2, sp2, sr2, sq2);
     }
     else if (sr1 > 0) {
-      ans = itt_canon1(q1, r1, p1, p2, r2, q2, n1, n2, sp2, sr2, sq2);
+      ans = itt_canon1(vq1, vr1, vp1, vp2, vr2, vq2, n1, n2, sp2, sr2, sq2);
     }
     else {
-      ans = itt_canon1(p1, q1, r1, p2, q2, r2, n1, n2, sp2, sq2, sr2);
+      ans = itt_canon1(vp1, vq1, vr1, vp2, vq2, vr2, n1, n2, sp2, sq2, sr2);
     }
   }
   else if (sp1 < 0) {
     if (sq1 < 0) {
-      ans = itt_canon1(r1, p1, q1, p2, q2, r2, n1, n2, sp2, sq2, sr2);
+      ans = itt_canon1(vr1, vp1, vq1, vp2, vq2, vr2, n1, n2, sp2, sq2, sr2);
     }
     else if (sr1 < 0) {
-      ans = itt_canon1(q1, r1, p1, p2, q2, r2, n1, n2, sp2, sq2, sr2);
+      ans = itt_canon1(vq1, vr1, vp1, vp2, vq2, vr2, n1, n2, sp2, sq2, sr2);
     }
     else {
-      ans = itt_canon1(p1, q1, r1, p2, r2, q2, n1, n2, sp2, sr2, sq2);
+      ans = itt_canon1(vp1, vq1, vr1, vp2, vr2, vq2, n1, n2, sp2, sr2, sq2);
     }
   }
   else {
     if (sq1 < 0) {
       if (sr1 >= 0) {
-        ans = itt_canon1(q1, r1, p1, p2, r2, q2, n1, n2, sp2, sr2, sq2);
+        ans = itt_canon1(vq1, vr1, vp1, vp2, vr2, vq2, n1, n2, sp2, sr2, sq2);
       }
       else {
-        ans = itt_canon1(p1, q1, r1, p2, q2, r2, n1, n2, sp2, sq2, sr2);
+        ans = itt_canon1(vp1, vq1, vr1, vp2, vq2, vr2, n1, n2, sp2, sq2, sr2);
       }
     }
     else if (sq1 > 0) {
       if (sr1 > 0) {
-        ans = itt_canon1(p1, q1, r1, p2, r2, q2, n1, n2, sp2, sr2, sq2);
+        ans = itt_canon1(vp1, vq1, vr1, vp2, vr2, vq2, n1, n2, sp2, sr2, sq2);
       }
       else {
-        ans = itt_canon1(q1, r1, p1, p2, q2, r2, n1, n2, sp2, sq2, sr2);
+        ans = itt_canon1(vq1, vr1, vp1, vp2, vq2, vr2, n1, n2, sp2, sq2, sr2);
       }
     }
     else {
       if (sr1 > 0) {
-        ans = itt_canon1(r1, p1, q1, p2, q2, r2, n1, n2, sp2, sq2, sr2);
+        ans = itt_canon1(vr1, vp1, vq1, vp2, vq2, vr2, n1, n2, sp2, sq2, sr2);
       }
       else if (sr1 < 0) {
-        ans = itt_canon1(r1, p1, q1, p2, r2, q2, n1, n2, sp2, sr2, sq2);
+        ans = itt_canon1(vr1, vp1, vq1, vp2, vr2, vq2, n1, n2, sp2, sr2, sq2);
       }
       else {
         if (dbg_level > 0) {
@@ -3100,6 +3167,14 @@ static void perfdata_init()
   perfdata->count.append(0);
   perfdata->count_name.append("final non-NONE intersects");
 
+  /* count 5. */
+  perfdata->count.append(0);
+  perfdata->count_name.append("tti_above decided by filter");
+
+  /* count 6. */
+  perfdata->count.append(0);
+  perfdata->count_name.append("tti_above decided by exact arithmetic");
+
   /* max 0. */
   perfdata->max.append(0);
   perfdata->max_name.append("total faces");
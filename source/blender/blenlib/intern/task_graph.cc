@@ -17,6 +17,8 @@
 
 #ifdef WITH_TBB
 #  include <tbb/flow_graph.h>
+/* For #TBB_INTERFACE_VERSION_MAJOR, the flow graph header doesn't define it. */
+#  include <tbb/version.h>
 #endif
 
 /* Task Graph */
@@ -48,12 +50,20 @@ struct TaskNode {
   TaskNode(TaskGraph *task_graph,
            TaskGraphNodeRunFunction run_func,
            void *task_data,
-           TaskGraphNodeFreeFunction free_func)
+           TaskGraphNodeFreeFunction free_func,
+           const eTaskPriority priority)
       :
 #ifdef WITH_TBB
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+        tbb_node(task_graph->tbb_graph,
+                 tbb::flow::unlimited,
+                 [&](const tbb::flow::continue_msg input) { run(input); },
+                 tbb_node_priority(priority)),
+#  else
         tbb_node(task_graph->tbb_graph,
                  tbb::flow::unlimited,
                  [&](const tbb::flow::continue_msg input) { run(input); }),
+#  endif
 #endif
         run_func(run_func),
         task_data(task_data),
@@ -61,6 +71,10 @@ struct TaskNode {
   {
 #ifndef WITH_TBB
     UNUSED_VARS(task_graph);
+#endif
+#if !defined(WITH_TBB) || TBB_INTERFACE_VERSION_MAJOR < 12
+    /* Node priorities are only supported since TBB 2021. */
+    UNUSED_VARS(priority);
 #endif
   }
 
@@ -74,6 +88,19 @@ struct TaskNode {
     }
   }
 
+#if defined(WITH_TBB) && TBB_INTERFACE_VERSION_MAJOR >= 12
+  static tbb::flow::node_priority_t tbb_node_priority(const eTaskPriority priority)
+  {
+    switch (priority) {
+      case TASK_PRIORITY_LOW:
+        return tbb::flow::no_priority;
+      case TASK_PRIORITY_HIGH:
+        return 1;
+    }
+    return tbb::flow::no_priority;
+  }
+#endif
+
 #ifdef WITH_TBB
   tbb::flow::continue_msg run(const tbb::flow::continue_msg /*input*/)
   {
@@ -117,7 +144,16 @@ TaskNode *BLI_task_graph_node_create(TaskGraph *task_graph,
                                      void *user_data,
                                      TaskGraphNodeFreeFunction free_func)
 {
-  TaskNode *task_node = new TaskNode(task_graph, run, user_data, free_func);
+  return BLI_task_graph_node_create_ex(task_graph, run, user_data, free_func, TASK_PRIORITY_LOW);
+}
+
+TaskNode *BLI_task_graph_node_create_ex(TaskGraph *task_graph,
+                                        TaskGraphNodeRunFunction run,
+                                        void *user_data,
+                                        TaskGraphNodeFreeFunction free_func,
+                                        const eTaskPriority priority)
+{
+  TaskNode *task_node = new TaskNode(task_graph, run, user_data, free_func, priority);
   task_graph->nodes.push_back(std::unique_ptr<TaskNode>(task_node));
   return task_node;
 }
@@ -166,8 +166,11 @@ static void parallel_for_impl_static_size(const IndexRange range,
                                           const int64_t grain_size,
                                           const FunctionRef<void(IndexRange)> function)
 {
+  /* Attribute memory allocated by the tasks to the same category as the caller. */
+  const eMEMCategory mem_category = MEM_category_get();
   tbb::parallel_for(tbb::blocked_range<int64_t>(range.first(), range.one_after_last(), grain_size),
-                    [function](const tbb::blocked_range<int64_t> &subrange) {
+                    [function, mem_category](const tbb::blocked_range<int64_t> &subrange) {
+                      MEM_CategoryScope mem_category_scope(mem_category);
                       function(IndexRange(subrange.begin(), subrange.size()));
                     });
 }
@@ -0,0 +1,134 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <atomic>
+
+#include "testing/testing.h"
+
+#include "BLI_concurrent_insert_map.hh"
+#include "BLI_map.hh"
+#include "BLI_string_ref.hh"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
+
+#include "BLI_strict_flags.h" /* IWYU pragma: keep. Keep last. */
+
+namespace blender::tests {
+
+TEST(concurrent_insert_map, Empty)
+{
+  ConcurrentInsertMap<int, float> map(10);
+  EXPECT_TRUE(map.is_empty());
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_GE(map.capacity(), 10);
+  EXPECT_FALSE(map.contains(3));
+  EXPECT_EQ(map.lookup_ptr(3), nullptr);
+}
+
+TEST(concurrent_insert_map, AddLookup)
+{
+  ConcurrentInsertMap<int, float> map(10);
+  EXPECT_TRUE(map.add(4, 2.0f));
+  EXPECT_TRUE(map.add(8, 3.0f));
+  EXPECT_FALSE(map.add(4, 5.0f));
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(*map.lookup_ptr(4), 2.0f);
+  EXPECT_EQ(*map.lookup_ptr(8), 3.0f);
+  EXPECT_FALSE(map.contains(5));
+
+  *map.lookup_or_add_default(5) += 1.0f;
+  EXPECT_EQ(*map.lookup_ptr(5), 1.0f);
+  EXPECT_EQ(map.size(), 3);
+}
+
+TEST(concurrent_insert_map, Full)
+{
+  ConcurrentInsertMap<int, int> map(100);
+  const int size = int(map.capacity());
+  for (int i = 0; i < size; i++) {
+    EXPECT_TRUE(map.add(i * 7, i));
+  }
+  EXPECT_EQ(map.size(), size);
+  for (int i = 0; i < size; i++) {
+    EXPECT_EQ(*map.lookup_ptr(i * 7), i);
+  }
+  /* Adding new keys fails, but existing keys can still be found. */
+  EXPECT_FALSE(map.add(-1, 0));
+  EXPECT_EQ(map.lookup_or_add_default(-2), nullptr);
+  EXPECT_EQ(*map.lookup_or_add_default(7), 1);
+  EXPECT_EQ(map.size(), size);
+  EXPECT_FALSE(map.contains(-1));
+}
+
+TEST(concurrent_insert_map, NonTrivialKeys)
+{
+  ConcurrentInsertMap<std::string, Vector<int>> map(4);
+  map.lookup_or_add_default("a")->append(1);
+  map.lookup_or_add_default("b")->append(2);
+  map.lookup_or_add_default("a")->append(3);
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.lookup_ptr("a")->as_span(), Span<int>({1, 3}));
+  EXPECT_EQ(map.lookup_ptr("b")->as_span(), Span<int>({2}));
+}
+
+TEST(concurrent_insert_map, ForeachItem)
+{
+  ConcurrentInsertMap<int, int> map(10);
+  map.add(1, 10);
+  map.add(2, 20);
+  map.add(3, 30);
+  Map<int, int> items;
+  map.foreach_item([&](const int key, const int value) { items.add_new(key, value); });
+  EXPECT_EQ(items.size(), 3);
+  EXPECT_EQ(items.lookup(1), 10);
+  EXPECT_EQ(items.lookup(2), 20);
+  EXPECT_EQ(items.lookup(3), 30);
+}
+
+TEST(concurrent_insert_map, ParallelAdd)
+{
+  /* Many threads add overlapping keys, every key must be created exactly once. */
+  const int keys_num = 10000;
+  ConcurrentInsertMap<int, int> map(keys_num);
+  std::atomic<int> created_num = 0;
+  threading::parallel_for(IndexRange(keys_num * 8), 64, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const int key = int((i * 31) % keys_num);
+      const std::pair<int *, bool> result = map.lookup_or_add_cb(key, [&]() {
+        created_num++;
+        return key * 2;
+      });
+      EXPECT_EQ(*result.first, key * 2);
+    }
+  });
+  EXPECT_EQ(created_num, keys_num);
+  EXPECT_EQ(map.size(), keys_num);
+  for (int key = 0; key < keys_num; key++) {
+    EXPECT_EQ(*map.lookup_ptr(key), key * 2);
+  }
+}
+
+TEST(concurrent_insert_map, ParallelAddFull)
+{
+  /* Adding more keys than the map can hold from many threads fails without losing keys. */
+  ConcurrentInsertMap<int, int> map(1000);
+  const int keys_num = int(map.capacity()) * 4;
+  std::atomic<int> added_num = 0;
+  threading::parallel_for(IndexRange(keys_num), 64, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      if (map.add(int(i), int(i))) {
+        added_num++;
+      }
+    }
+  });
+  EXPECT_EQ(added_num, map.size());
+  EXPECT_LE(map.size(), map.capacity());
+  int found_num = 0;
+  for (int key = 0; key < keys_num; key++) {
+    found_num += map.contains(key);
+  }
+  EXPECT_EQ(found_num, added_num);
+}
+
+}  // namespace blender::tests
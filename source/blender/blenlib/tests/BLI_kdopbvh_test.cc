@@ -68,8 +68,12 @@ static void optimal_check_callback(void *userdata,
  * Note that a small epsilon is added to the BVH nodes bounds, even if we pass in zero.
  * Use rounding to ensure very close nodes don't cause the wrong node to be found as nearest.
  */
-static void find_nearest_points_test(
-    int points_len, float scale, int round, int random_seed, bool optimal = false)
+static void find_nearest_points_test(int points_len,
+                                     float scale,
+                                     int round,
+                                     int random_seed,
+                                     bool optimal = false,
+                                     int balance_flag = 0)
 {
   RNG *rng = BLI_rng_new(random_seed);
   BVHTree *tree = BLI_bvhtree_new(points_len, 0.0, 8, 8);
@@ -81,7 +85,7 @@ static void find_nearest_points_test(
     rng_v3_round(points[i], 3, rng, round, scale);
     BLI_bvhtree_insert(tree, i, points[i], 1);
   }
-  BLI_bvhtree_balance(tree);
+  BLI_bvhtree_balance_ex(tree, balance_flag);
 
   /* first find each point */
   BVHTree_NearestPointCallback callback = optimal ? optimal_check_callback : nullptr;
@@ -134,3 +138,51 @@ TEST(kdopbvh, OptimalFindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
+
+TEST(kdopbvh, SAHFindNearest_500)
+{
+  find_nearest_points_test(500, 1.0, 1000, 12, false, BVH_BALANCE_USE_SAH);
+}
+TEST(kdopbvh, SAHOptimalFindNearest_500)
+{
+  find_nearest_points_test(500, 1.0, 1000, 12, true, BVH_BALANCE_USE_SAH);
+}
+
+TEST(kdopbvh, CopyAndRefit)
+{
+  const int points_len = 500;
+  RNG *rng = BLI_rng_new(1234);
+  BVHTree *tree = BLI_bvhtree_new(points_len, 0.0, 4, 6);
+  float(*points)[3] = MEM_malloc_arrayN<float[3]>(size_t(points_len), __func__);
+  for (int i = 0; i < points_len; i++) {
+    rng_v3_round(points[i], 3, rng, 1000, 1.0f);
+    BLI_bvhtree_insert(tree, i, points[i], 1);
+  }
+  BLI_bvhtree_balance_ex(tree, BVH_BALANCE_USE_SAH);
+  const float area_cost = BLI_bvhtree_get_area_cost(tree);
+  EXPECT_GT(area_cost, 1.0f);
+
+  BVHTree *copy = BLI_bvhtree_copy(tree);
+  BLI_bvhtree_free(tree);
+  EXPECT_EQ(BLI_bvhtree_get_len(copy), points_len);
+  EXPECT_FLOAT_EQ(BLI_bvhtree_get_area_cost(copy), area_cost);
+
+  /* Moving all points by the same amount keeps the structure of the tree just as good. */
+  for (int i = 0; i < points_len; i++) {
+    add_v3_fl(points[i], 10.0f);
+    BLI_bvhtree_update_node(copy, i, points[i], nullptr, 1);
+  }
+  BLI_bvhtree_update_tree(copy);
+  EXPECT_NEAR(BLI_bvhtree_get_area_cost(copy), area_cost, 1e-3f);
+
+  for (int i = 0; i < points_len; i++) {
+    const int j = BLI_bvhtree_find_nearest(copy, points[i], nullptr, nullptr, nullptr);
+    EXPECT_GE(j, 0);
+    EXPECT_LT(j, points_len);
+    EXPECT_EQ_ARRAY(points[i], points[j], 3);
+  }
+
+  BLI_bvhtree_free(copy);
+  BLI_rng_free(rng);
+  MEM_freeN(points);
+}
@@ -5,8 +5,12 @@
 #include "testing/testing.h"
 
 #include "BLI_kdtree.h"
+#include "BLI_math_vector.hh"
+#include "BLI_rand.hh"
+#include "BLI_vector.hh"
 
 #include <cmath>
+#include <limits>
 
 /* -------------------------------------------------------------------- */
 /* Tests */
@@ -54,6 +58,147 @@ static void deduplicate_test()
   }
 }
 
+static void find_nearest_batch_test(const int tree_size, const int queries_num)
+{
+  using namespace blender;
+  RandomNumberGenerator rng(tree_size);
+  auto random_point = [&]() {
+    return float3(rng.get_float(), rng.get_float(), rng.get_float()) * 10.0f;
+  };
+
+  Vector<float3> points;
+  KDTree_3d *tree = BLI_kdtree_3d_new(tree_size);
+  for (int i = 0; i < tree_size; i++) {
+    points.append(random_point());
+    BLI_kdtree_3d_insert(tree, i, points.last());
+  }
+  BLI_kdtree_3d_balance(tree);
+
+  Vector<float3> queries;
+  for (int i = 0; i < queries_num; i++) {
+    queries.append(random_point());
+  }
+  Vector<int> indices(queries_num);
+  Vector<float> dists_sq(queries_num);
+  BLI_kdtree_3d_find_nearest_batch(tree,
+                                   reinterpret_cast<const float(*)[3]>(queries.data()),
+                                   queries_num,
+                                   nullptr,
+                                   indices.data(),
+                                   dists_sq.data());
+  for (int i = 0; i < queries_num; i++) {
+    KDTreeNearest_3d nearest;
+    BLI_kdtree_3d_find_nearest(tree, queries[i], &nearest);
+    EXPECT_NEAR(std::sqrt(dists_sq[i]), nearest.dist, 1e-5f);
+    EXPECT_NEAR(math::distance(points[indices[i]], queries[i]), nearest.dist, 1e-5f);
+  }
+
+  /* Query the tree points themselves, ignoring each query point in the tree. */
+  Vector<int> skip_indices;
+  for (int i = 0; i < tree_size; i++) {
+    skip_indices.append(i);
+  }
+  indices.resize(tree_size);
+  BLI_kdtree_3d_find_nearest_batch(tree,
+                                   reinterpret_cast<const float(*)[3]>(points.data()),
+                                   tree_size,
+                                   skip_indices.data(),
+                                   indices.data(),
+                                   nullptr);
+  for (int i = 0; i < tree_size; i++) {
+    const int expected = BLI_kdtree_3d_find_nearest_cb_cpp(
+        tree, points[i], nullptr, [&](const int index, const float * /*co*/, float /*dist_sq*/) {
+          return index == i ? 0 : 1;
+        });
+    if (tree_size == 1) {
+      EXPECT_EQ(indices[i], -1);
+    }
+    else {
+      EXPECT_NE(indices[i], i);
+      EXPECT_NEAR(math::distance(points[indices[i]], points[i]),
+                  math::distance(points[expected], points[i]),
+                  1e-5f);
+    }
+  }
+
+  BLI_kdtree_3d_free(tree);
+}
+
+/**
+ * Compare to merging the duplicates of one point after another, for more points than are searched
+ * in parallel at once.
+ *
+ * \param clusters_num: The points are placed in clusters on a grid of this size.
+ * \param cluster_size: Size of each cluster, zero makes all points of a cluster coincident.
+ */
+static void calc_duplicates_fast_test(const int tree_size,
+                                      const bool use_index_order,
+                                      const int clusters_num = 20,
+                                      const float cluster_size = 0.1f)
+{
+  using namespace blender;
+  RandomNumberGenerator rng(tree_size);
+  const float range = 0.05f;
+  Vector<float3> points;
+  KDTree_3d *tree = BLI_kdtree_3d_new(tree_size);
+  for (int i = 0; i < tree_size; i++) {
+    /* Clusters of points, with some points far away from others. */
+    const float3 cluster(
+        float(rng.get_int32(clusters_num)), float(rng.get_int32(clusters_num)), 0.0f);
+    points.append(cluster +
+                  float3(rng.get_float(), rng.get_float(), rng.get_float()) * cluster_size);
+    BLI_kdtree_3d_insert(tree, i, points.last());
+  }
+  BLI_kdtree_3d_balance(tree);
+
+  Vector<int> duplicates(tree_size, -1);
+  /* Points that are kept but can still be used as targets. */
+  for (int i = 0; i < tree_size; i += 97) {
+    duplicates[i] = i;
+  }
+  Vector<int> expected = duplicates;
+
+  const int found = BLI_kdtree_3d_calc_duplicates_fast(
+      tree, range, use_index_order, duplicates.data());
+
+  /* With index order, the points are merged in the order of the indices. */
+  int expected_found = 0;
+  for (int i = 0; i < tree_size; i++) {
+    if (!ELEM(expected[i], -1, i)) {
+      continue;
+    }
+    const int found_prev = expected_found;
+    BLI_kdtree_3d_range_search_cb_cpp(
+        tree, points[i], range, [&](const int index, const float * /*co*/, float /*dist_sq*/) {
+          if (index != i && expected[index] == -1) {
+            expected[index] = i;
+            expected_found++;
+          }
+          return true;
+        });
+    if (expected_found != found_prev) {
+      expected[i] = i;
+    }
+  }
+
+  EXPECT_GT(found, 0);
+  if (use_index_order) {
+    EXPECT_EQ(found, expected_found);
+    EXPECT_EQ_SPAN<int>(duplicates, expected);
+  }
+  else {
+    /* The tree order is different, but no point is merged into another merged point. */
+    for (int i = 0; i < tree_size; i++) {
+      if (!ELEM(duplicates[i], -1, i)) {
+        EXPECT_EQ(duplicates[duplicates[i]], duplicates[i]);
+        EXPECT_LE(math::distance(points[i], points[duplicates[i]]), range);
+      }
+    }
+  }
+
+  BLI_kdtree_3d_free(tree);
+}
+
 TEST(kdtree, Standard)
 {
   standard_test();
@@ -63,3 +208,118 @@ TEST(kdtree, Deduplicate)
 {
   deduplicate_test();
 }
+
+TEST(kdtree, CalcDuplicatesFast)
+{
+  calc_duplicates_fast_test(2000, true);
+  calc_duplicates_fast_test(50000, true);
+  calc_duplicates_fast_test(50000, false);
+}
+
+TEST(kdtree, CalcDuplicatesFastCoincident)
+{
+  calc_duplicates_fast_test(40000, true, 1, 0.0f);
+  calc_duplicates_fast_test(40000, true, 4, 0.0f);
+  calc_duplicates_fast_test(40000, false, 4, 0.0f);
+}
+
+TEST(kdtree, FindNearestBatch)
+{
+  find_nearest_batch_test(1, 10);
+  find_nearest_batch_test(7, 100);
+  find_nearest_batch_test(1000, 5000);
+}
+
+TEST(kdtree, FindNearestBatchTies)
+{
+  using namespace blender;
+  /* Every grid point is inserted twice and queries in the middle of grid cells are at the same
+   * distance to eight points, so there are many exact ties. */
+  const int grid_size = 16;
+  Vector<float3> points;
+  for (int z = 0; z < grid_size; z++) {
+    for (int y = 0; y < grid_size; y++) {
+      for (int x = 0; x < grid_size; x++) {
+        points.append(float3(x, y, z));
+      }
+    }
+  }
+  const int grid_points_num = points.size();
+  for (int i = 0; i < grid_points_num; i++) {
+    points.append(points[grid_points_num - 1 - i]);
+  }
+
+  KDTree_3d *tree = BLI_kdtree_3d_new(points.size());
+  for (const int i : points.index_range()) {
+    BLI_kdtree_3d_insert(tree, i, points[i]);
+  }
+  BLI_kdtree_3d_balance(tree);
+
+  Vector<float3> queries;
+  for (const float3 &point : points.as_span().take_front(grid_points_num)) {
+    queries.append(point);
+    queries.append(point + float3(0.5f));
+  }
+  Vector<int> indices(queries.size());
+  BLI_kdtree_3d_find_nearest_batch(tree,
+                                   reinterpret_cast<const float(*)[3]>(queries.data()),
+                                   queries.size(),
+                                   nullptr,
+                                   indices.data(),
+                                   nullptr);
+  for (const int i : queries.index_range()) {
+    int expected = -1;
+    float expected_dist_sq = FLT_MAX;
+    for (const int j : points.index_range()) {
+      const float dist_sq = math::distance_squared(points[j], queries[i]);
+      if (dist_sq < expected_dist_sq) {
+        expected = j;
+        expected_dist_sq = dist_sq;
+      }
+    }
+    EXPECT_EQ(indices[i], expected);
+  }
+
+  BLI_kdtree_3d_free(tree);
+}
+
+TEST(kdtree, FindNearestBatchNonFinite)
+{
+  using namespace blender;
+  RandomNumberGenerator rng(0);
+  const int tree_size = 1000;
+  KDTree_3d *tree = BLI_kdtree_3d_new(tree_size);
+  for (int i = 0; i < tree_size; i++) {
+    const float3 point = float3(rng.get_float(), rng.get_float(), rng.get_float()) * 10.0f;
+    BLI_kdtree_3d_insert(tree, i, point);
+  }
+  BLI_kdtree_3d_balance(tree);
+
+  /* Infinite and NaN queries must not affect the results of the other queries. */
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const float inf = std::numeric_limits<float>::infinity();
+  Vector<float3> queries;
+  for (int i = 0; i < 1000; i++) {
+    queries.append(float3(rng.get_float(), rng.get_float(), rng.get_float()) * 10.0f);
+  }
+  queries[10] = float3(nan);
+  queries[20] = float3(inf, 0.0f, 0.0f);
+  queries[30] = float3(-inf, nan, inf);
+  Vector<int> indices(queries.size());
+  BLI_kdtree_3d_find_nearest_batch(tree,
+                                   reinterpret_cast<const float(*)[3]>(queries.data()),
+                                   queries.size(),
+                                   nullptr,
+                                   indices.data(),
+                                   nullptr);
+  for (const int i : queries.index_range()) {
+    if (ELEM(i, 10, 20, 30)) {
+      continue;
+    }
+    KDTreeNearest_3d nearest;
+    BLI_kdtree_3d_find_nearest(tree, queries[i], &nearest);
+    EXPECT_EQ(indices[i], nearest.index);
+  }
+
+  BLI_kdtree_3d_free(tree);
+}
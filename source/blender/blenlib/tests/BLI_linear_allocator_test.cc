@@ -2,6 +2,8 @@
  *
  * SPDX-License-Identifier: Apache-2.0 */
 
+#include <memory>
+
 #include "testing/testing.h"
 
 #include "BLI_linear_allocator.hh"
@@ -172,4 +174,59 @@ TEST(linear_allocator, TransferOwnership)
   EXPECT_EQ(values[index], value);
 }
 
+TEST(linear_allocator, ArenaScopeReusesChunks)
+{
+  LinearAllocatorArenaScope arena_scope;
+  /* Enough allocations for the allocator to take exactly one chunk from the arena. */
+  const int allocations_num = 100;
+  void *first_last_allocation;
+  {
+    LinearAllocator<> allocator;
+    for ([[maybe_unused]] const int64_t i : IndexRange(allocations_num - 1)) {
+      allocator.allocate(100, 8);
+    }
+    first_last_allocation = allocator.allocate(100, 8);
+  }
+  {
+    /* Small allocators keep using their inline buffer and don't take the cached chunk. */
+    AlignedBuffer<256, 8> inline_buffer;
+    LinearAllocator<> allocator;
+    allocator.provide_buffer(inline_buffer);
+    EXPECT_EQ(allocator.allocate(100, 8), inline_buffer.ptr());
+  }
+  {
+    /* The chunk freed by the first allocator is reused. */
+    LinearAllocator<> allocator;
+    void *last_allocation = nullptr;
+    for ([[maybe_unused]] const int64_t i : IndexRange(allocations_num)) {
+      last_allocation = allocator.allocate(100, 8);
+    }
+    EXPECT_EQ(last_allocation, first_last_allocation);
+    /* Large allocations don't come from the arena. */
+    MutableSpan<int> values = allocator.allocate_array<int>(100'000);
+    values.fill(1);
+  }
+}
+
+TEST(linear_allocator, ArenaScopeOutlivedByAllocator)
+{
+  std::unique_ptr<LinearAllocator<>> allocator = std::make_unique<LinearAllocator<>>();
+  MutableSpan<int> values;
+  {
+    LinearAllocatorArenaScope arena_scope;
+    {
+      LinearAllocatorArenaScope nested_arena_scope;
+      /* Grow the allocator so that the values are allocated in a chunk from the arena. */
+      for ([[maybe_unused]] const int64_t i : IndexRange(100)) {
+        allocator->allocate(100, 8);
+      }
+      values = allocator->allocate_array<int>(10);
+    }
+    values.fill(5);
+  }
+  /* The memory is still owned by the allocator after the scope ended. */
+  EXPECT_EQ(values[9], 5);
+  allocator.reset();
+}
+
 }  // namespace blender::tests
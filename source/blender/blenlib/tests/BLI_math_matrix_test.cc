@@ -4,6 +4,7 @@
 
 #include "testing/testing.h"
 
+#include "BLI_array.hh"
 #include "BLI_math_base.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_matrix.hh"
@@ -570,6 +571,38 @@ TEST(math_matrix, MatrixTransform)
   EXPECT_V2_NEAR(result2, expect2, 1e-5);
 }
 
+TEST(math_matrix, MatrixTransformArray)
+{
+  const float4x4 m4 = from_loc_rot_scale<float4x4>(
+      {10, -2, 5}, EulerXYZ(0.3f, -1.2f, 2.0f), float3(1.5f, 0.5f, 2.0f));
+  const float3x3 m3 = transpose(invert(float3x3(m4)));
+
+  /* Use a size that isn't a multiple of the parallel grain size. */
+  Array<float3> src(2049);
+  for (const int i : src.index_range()) {
+    src[i] = float3(i * 0.5f, -i * 0.25f, float(i % 7));
+  }
+
+  Array<float3> points(src);
+  transform_points(m4, points);
+  for (const int i : src.index_range()) {
+    EXPECT_V3_NEAR(points[i], transform_point(m4, src[i]), 1e-3f);
+  }
+
+  Array<float3> dst(src.size());
+  transform_points(src, m4, dst);
+  EXPECT_EQ_SPAN<float3>(dst, points);
+
+  Array<float3> normals(src);
+  transform_normals(m3, normals);
+  transform_normals(src, m3, dst);
+  for (const int i : src.index_range()) {
+    const float3 expected = m3 * src[i];
+    EXPECT_V3_NEAR(normals[i], expected, 1e-3f);
+    EXPECT_V3_NEAR(dst[i], expected, 1e-3f);
+  }
+}
+
 TEST(math_matrix, MatrixTransform2D)
 {
   const float2 sample_point = float2(2.0f, 3.0f);
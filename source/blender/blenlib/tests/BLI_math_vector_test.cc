@@ -4,6 +4,7 @@
 
 #include "testing/testing.h"
 
+#include "BLI_array.hh"
 #include "BLI_math_vector.h"
 #include "BLI_math_vector.hh"
 #include "BLI_vector.hh"
@@ -207,4 +208,55 @@ TEST(math_vector, square)
   EXPECT_NEAR(result.z, 9.0f, 1e-6f);
 }
 
+static Array<float3> vector_array_for_test(const int size, const float offset)
+{
+  Array<float3> values(size);
+  for (const int i : values.index_range()) {
+    values[i] = float3(float(i) * 0.5f - offset, float(i % 7) - 3.0f, float(i % 3) * offset);
+  }
+  return values;
+}
+
+TEST(math_vector, NormalizeArray)
+{
+  /* Use a size that isn't a multiple of the SIMD width or the parallel grain size. */
+  Array<float3> src = vector_array_for_test(2051, 10.0f);
+  /* Zero length and NaN vectors are normalized to zero. */
+  src[5] = float3(0.0f);
+  src[6] = float3(std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f);
+  Array<float3> dst(src.size());
+  math::normalize_array(src, dst);
+  for (const int i : src.index_range()) {
+    const float3 expected = math::normalize(src[i]);
+    EXPECT_V3_NEAR(dst[i], expected, 1e-6f);
+  }
+  math::normalize_array(src, src);
+  EXPECT_EQ_SPAN<float3>(src, dst);
+}
+
+TEST(math_vector, DotArray)
+{
+  const Array<float3> a = vector_array_for_test(2051, 10.0f);
+  const Array<float3> b = vector_array_for_test(2051, -3.0f);
+  Array<float> dst(a.size());
+  math::dot_array(a, b, dst);
+  for (const int i : a.index_range()) {
+    EXPECT_NEAR(dst[i], math::dot(a[i], b[i]), 1e-2f);
+  }
+}
+
+TEST(math_vector, CrossArray)
+{
+  Array<float3> a = vector_array_for_test(2051, 10.0f);
+  const Array<float3> b = vector_array_for_test(2051, -3.0f);
+  Array<float3> dst(a.size());
+  math::cross_array(a, b, dst);
+  for (const int i : a.index_range()) {
+    const float3 expected = math::cross(a[i], b[i]);
+    EXPECT_V3_NEAR(dst[i], expected, 1e-2f);
+  }
+  math::cross_array(a, b, a);
+  EXPECT_EQ_SPAN<float3>(a, dst);
+}
+
 }  // namespace blender::tests
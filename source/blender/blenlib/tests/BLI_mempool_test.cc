@@ -0,0 +1,136 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_enumerable_thread_specific.hh"
+#include "BLI_mempool.h"
+#include "BLI_task.hh"
+
+namespace blender::tests {
+
+TEST(mempool, AllocFree)
+{
+  BLI_mempool *pool = BLI_mempool_create(sizeof(int), 0, 64, BLI_MEMPOOL_ALLOW_ITER);
+  Array<int *> elems(1000);
+  for (const int i : elems.index_range()) {
+    elems[i] = BLI_mempool_alloc<int>(pool);
+    *elems[i] = i;
+  }
+  EXPECT_EQ(BLI_mempool_len(pool), 1000);
+  for (const int i : elems.index_range()) {
+    EXPECT_EQ(*elems[i], i);
+  }
+  for (int *elem : elems) {
+    BLI_mempool_free(pool, elem);
+  }
+  EXPECT_EQ(BLI_mempool_len(pool), 0);
+  BLI_mempool_destroy(pool);
+}
+
+TEST(mempool, IterAfterFree)
+{
+  BLI_mempool *pool = BLI_mempool_create(sizeof(int), 0, 64, BLI_MEMPOOL_ALLOW_ITER);
+  Array<int *> elems(1000);
+  for (const int i : elems.index_range()) {
+    elems[i] = BLI_mempool_alloc<int>(pool);
+    *elems[i] = i;
+  }
+  for (const int i : elems.index_range()) {
+    if (i % 2 == 1) {
+      BLI_mempool_free(pool, elems[i]);
+    }
+  }
+  EXPECT_EQ(BLI_mempool_len(pool), 500);
+
+  /* The remaining elements are iterated in the order they were allocated. */
+  BLI_mempool_iter iter;
+  BLI_mempool_iternew(pool, &iter);
+  int expected = 0;
+  while (const int *elem = static_cast<const int *>(BLI_mempool_iterstep(&iter))) {
+    EXPECT_EQ(*elem, expected);
+    expected += 2;
+  }
+  EXPECT_EQ(expected, 1000);
+  BLI_mempool_destroy(pool);
+}
+
+TEST(mempool, ThreadCache)
+{
+  BLI_mempool *pool = BLI_mempool_create(
+      sizeof(int), 0, 64, BLI_MEMPOOL_ALLOW_ITER | BLI_MEMPOOL_THREAD_CACHE);
+  threading::EnumerableThreadSpecific<BLI_mempool_thread_cache> caches([&]() {
+    BLI_mempool_thread_cache cache;
+    BLI_mempool_thread_cache_init(pool, &cache);
+    return cache;
+  });
+  auto flush_caches = [&]() {
+    for (BLI_mempool_thread_cache &cache : caches) {
+      BLI_mempool_thread_cache_flush(&cache);
+    }
+  };
+
+  Array<int *> elems(10000);
+  threading::parallel_for(elems.index_range(), 100, [&](const IndexRange range) {
+    BLI_mempool_thread_cache &cache = caches.local();
+    for (const int64_t i : range) {
+      elems[i] = static_cast<int *>(BLI_mempool_thread_cache_alloc(&cache));
+      *elems[i] = int(i);
+    }
+  });
+  flush_caches();
+  EXPECT_EQ(BLI_mempool_len(pool), 10000);
+
+  /* Every element is allocated once. */
+  Array<bool> found(elems.size(), false);
+  BLI_mempool_iter iter;
+  BLI_mempool_iternew(pool, &iter);
+  while (const int *elem = static_cast<const int *>(BLI_mempool_iterstep(&iter))) {
+    EXPECT_FALSE(found[*elem]);
+    found[*elem] = true;
+  }
+  for (const bool value : found) {
+    EXPECT_TRUE(value);
+  }
+
+  /* Free elements in a different order than they were allocated, so that they end up in the
+   * caches of other threads. */
+  threading::parallel_for(elems.index_range(), 100, [&](const IndexRange range) {
+    BLI_mempool_thread_cache &cache = caches.local();
+    for (const int64_t i : range) {
+      const int64_t index = elems.size() - 1 - i;
+      if (index % 2 == 1) {
+        BLI_mempool_thread_cache_free(&cache, elems[index]);
+      }
+    }
+  });
+  flush_caches();
+  EXPECT_EQ(BLI_mempool_len(pool), 5000);
+
+  /* Freed elements are reused. */
+  threading::parallel_for(IndexRange(5000), 100, [&](const IndexRange range) {
+    BLI_mempool_thread_cache &cache = caches.local();
+    for (const int64_t i : range) {
+      int *elem = static_cast<int *>(BLI_mempool_thread_cache_alloc(&cache));
+      *elem = int(i * 2 + 1);
+    }
+  });
+  flush_caches();
+  EXPECT_EQ(BLI_mempool_len(pool), 10000);
+
+  found.fill(false);
+  BLI_mempool_iternew(pool, &iter);
+  while (const int *elem = static_cast<const int *>(BLI_mempool_iterstep(&iter))) {
+    EXPECT_FALSE(found[*elem]);
+    found[*elem] = true;
+  }
+  for (const bool value : found) {
+    EXPECT_TRUE(value);
+  }
+
+  BLI_mempool_destroy(pool);
+}
+
+}  // namespace blender::tests
@@ -4,8 +4,15 @@
 
 #include "testing/testing.h"
 
+#include <vector>
+
 #include "BLI_task.h"
 
+#ifdef WITH_TBB
+#  include <tbb/task_arena.h>
+#  include <tbb/version.h>
+#endif
+
 struct TaskData {
   int value;
   int store;
@@ -188,3 +195,70 @@ TEST(task, GraphTaskData)
   EXPECT_EQ(1, data.value);
   EXPECT_EQ(0, data.store);
 }
+
+TEST(task, GraphPriority)
+{
+  TaskData data = {1};
+  TaskGraph *graph = BLI_task_graph_create();
+  TaskNode *node_a = BLI_task_graph_node_create_ex(
+      graph, TaskData_increase_value, &data, nullptr, TASK_PRIORITY_HIGH);
+  TaskNode *node_b = BLI_task_graph_node_create_ex(
+      graph, TaskData_store_value, &data, nullptr, TASK_PRIORITY_LOW);
+  TaskNode *node_c = BLI_task_graph_node_create_ex(
+      graph, TaskData_multiply_by_two_store, &data, nullptr, TASK_PRIORITY_HIGH);
+  /* Edges between nodes of different priorities are still respected. */
+  BLI_task_graph_edge_create(node_a, node_b);
+  BLI_task_graph_edge_create(node_b, node_c);
+  EXPECT_TRUE(BLI_task_graph_node_push_work(node_a));
+  BLI_task_graph_work_and_wait(graph);
+
+  EXPECT_EQ(2, data.value);
+  EXPECT_EQ(4, data.store);
+  BLI_task_graph_free(graph);
+}
+
+/* Node priorities are only supported since TBB 2021. */
+#if defined(WITH_TBB) && TBB_INTERFACE_VERSION_MAJOR >= 12
+struct OrderTaskData {
+  int id;
+  std::vector<int> *order;
+};
+
+static void OrderTaskData_record(void *taskdata)
+{
+  OrderTaskData *data = (OrderTaskData *)taskdata;
+  data->order->push_back(data->id);
+}
+
+TEST(task, GraphPriorityOrder)
+{
+  if (BLI_task_scheduler_num_threads() < 2) {
+    /* Nodes are executed serially in order. */
+    GTEST_SKIP();
+  }
+  /* Execute on a single worker, so that all successors of the first node are pending when the
+   * next node is picked. */
+  tbb::task_arena arena(1);
+  arena.execute([&]() {
+    std::vector<int> order;
+    OrderTaskData first_data = {-1, &order};
+    OrderTaskData data[4] = {{0, &order}, {1, &order}, {2, &order}, {3, &order}};
+    TaskGraph *graph = BLI_task_graph_create();
+    TaskNode *first_node = BLI_task_graph_node_create(
+        graph, OrderTaskData_record, &first_data, nullptr);
+    for (OrderTaskData &node_data : data) {
+      const eTaskPriority priority = node_data.id == 2 ? TASK_PRIORITY_HIGH : TASK_PRIORITY_LOW;
+      TaskNode *node = BLI_task_graph_node_create_ex(
+          graph, OrderTaskData_record, &node_data, nullptr, priority);
+      BLI_task_graph_edge_create(first_node, node);
+    }
+    EXPECT_TRUE(BLI_task_graph_node_push_work(first_node));
+    BLI_task_graph_work_and_wait(graph);
+    BLI_task_graph_free(graph);
+
+    EXPECT_EQ(order.size(), 5);
+    EXPECT_EQ(order[0], -1);
+    EXPECT_EQ(order[1], 2);
+  });
+}
+#endif
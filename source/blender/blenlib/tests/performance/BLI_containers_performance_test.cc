@@ -0,0 +1,261 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <iostream>
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_index_mask.hh"
+#include "BLI_kdopbvh.hh"
+#include "BLI_kdtree.h"
+#include "BLI_linear_allocator.hh"
+#include "BLI_math_vector.hh"
+#include "BLI_offset_indices.hh"
+#include "BLI_rand.hh"
+#include "BLI_set.hh"
+#include "BLI_sort.hh"
+#include "BLI_task.hh"
+#include "BLI_timeit.hh"
+#include "BLI_utility_mixins.hh"
+#include "BLI_vector_set.hh"
+
+namespace blender::tests {
+
+/* Number of elements used by the tests, big enough to not fit into caches. */
+static constexpr int ELEMENTS_NUM = 10000000;
+
+/**
+ * Same as #SCOPED_TIMER, but additionally prints the result as a JSON object on its own line, so
+ * that scripts can collect the results from the output and compare them between runs.
+ */
+class BenchmarkTimer : NonCopyable, NonMovable {
+ private:
+  std::string name_;
+  timeit::TimePoint start_;
+
+ public:
+  BenchmarkTimer(std::string name) : name_(std::move(name)), start_(timeit::Clock::now()) {}
+
+  ~BenchmarkTimer()
+  {
+    const timeit::Nanoseconds duration = timeit::Clock::now() - start_;
+    std::cout << "Timer '" << name_ << "' took ";
+    timeit::print_duration(duration);
+    std::cout << "\n{\"name\": \"" << name_ << "\", \"time\": "
+              << std::chrono::duration<double>(duration).count() << "}\n";
+  }
+};
+
+#define BENCHMARK_TIMER(name) BenchmarkTimer benchmark_timer(name)
+
+static Array<int> random_ints(const int size, const int max_value)
+{
+  Array<int> values(size);
+  RandomNumberGenerator rng(0);
+  for (int &value : values) {
+    value = rng.get_int32(max_value);
+  }
+  return values;
+}
+
+template<typename SetType> static void set_tests(const char *id)
+{
+  printf("\n========== STARTING %s ==========\n", id);
+
+  const Array<int> values = random_ints(ELEMENTS_NUM, ELEMENTS_NUM);
+  SetType set;
+  {
+    BENCHMARK_TIMER("int_add");
+    for (const int value : values) {
+      set.add(value);
+    }
+  }
+  {
+    BENCHMARK_TIMER("int_lookup");
+    int found = 0;
+    for (const int value : values) {
+      found += set.contains(value);
+    }
+    EXPECT_EQ(found, ELEMENTS_NUM);
+  }
+
+  printf("========== ENDED %s ==========\n\n", id);
+}
+
+TEST(containers_performance, Set)
+{
+  set_tests<Set<int>>("Set");
+}
+
+TEST(containers_performance, VectorSet)
+{
+  set_tests<VectorSet<int>>("VectorSet");
+}
+
+TEST(containers_performance, IndexMask)
+{
+  const Array<int> values = random_ints(ELEMENTS_NUM, 100);
+  IndexMaskMemory memory;
+
+  IndexMask sparse_mask;
+  {
+    BENCHMARK_TIMER("from_predicate_sparse");
+    sparse_mask = IndexMask::from_predicate(
+        values.index_range(), GrainSize(4096), memory, [&](const int i) { return values[i] < 5; });
+  }
+  IndexMask dense_mask;
+  {
+    BENCHMARK_TIMER("from_predicate_dense");
+    dense_mask = IndexMask::from_predicate(values.index_range(),
+                                           GrainSize(4096),
+                                           memory,
+                                           [&](const int i) { return values[i] < 95; });
+  }
+  {
+    BENCHMARK_TIMER("from_union");
+    const IndexMask mask = IndexMask::from_union(sparse_mask, dense_mask, memory);
+    EXPECT_EQ(mask.size(), dense_mask.size());
+  }
+  {
+    BENCHMARK_TIMER("from_intersection");
+    const IndexMask mask = IndexMask::from_intersection(sparse_mask, dense_mask, memory);
+    EXPECT_EQ(mask.size(), sparse_mask.size());
+  }
+}
+
+TEST(containers_performance, ParallelForGrainSize)
+{
+  Array<float> values(ELEMENTS_NUM, 1.0f);
+  for (const int64_t grain_size : {1, 64, 512, 4096, 65536}) {
+    BENCHMARK_TIMER("parallel_for_grain_size_" + std::to_string(grain_size));
+    threading::parallel_for(values.index_range(), grain_size, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        values[i] = values[i] * 0.5f + 1.0f;
+      }
+    });
+  }
+}
+
+TEST(containers_performance, LinearAllocator)
+{
+  BENCHMARK_TIMER("linear_allocator_allocate");
+  LinearAllocator<> allocator;
+  for (int i = 0; i < ELEMENTS_NUM; i++) {
+    allocator.allocate(16 + i % 64, 8);
+  }
+}
+
+TEST(containers_performance, Sort)
+{
+  Array<int> values = random_ints(ELEMENTS_NUM, ELEMENTS_NUM);
+  {
+    BENCHMARK_TIMER("parallel_sort");
+    parallel_sort(values.begin(), values.end());
+  }
+  EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+}
+
+TEST(containers_performance, AccumulateOffsets)
+{
+  const Array<int> sizes = random_ints(ELEMENTS_NUM, 8);
+  Array<int> offsets(ELEMENTS_NUM + 1);
+  offsets.as_mutable_span().drop_back(1).copy_from(sizes);
+  {
+    BENCHMARK_TIMER("accumulate_counts_to_offsets");
+    offset_indices::accumulate_counts_to_offsets(offsets);
+  }
+}
+
+static Array<float3> random_positions(const int size)
+{
+  Array<float3> positions(size);
+  RandomNumberGenerator rng(0);
+  for (float3 &position : positions) {
+    position = rng.get_unit_float3() * rng.get_float();
+  }
+  return positions;
+}
+
+/* Fewer elements than in the other tests, because every query traverses a tree. */
+static constexpr int POINTS_NUM = 1000000;
+
+TEST(containers_performance, KDTree)
+{
+  const Array<float3> positions = random_positions(POINTS_NUM);
+  const Array<float3> queries = random_positions(POINTS_NUM);
+  KDTree_3d *tree = BLI_kdtree_3d_new(POINTS_NUM);
+  {
+    BENCHMARK_TIMER("kdtree_build");
+    for (const int i : positions.index_range()) {
+      BLI_kdtree_3d_insert(tree, i, positions[i]);
+    }
+    BLI_kdtree_3d_balance(tree);
+  }
+  {
+    BENCHMARK_TIMER("kdtree_find_nearest");
+    threading::parallel_for(queries.index_range(), 1024, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        KDTreeNearest_3d nearest;
+        BLI_kdtree_3d_find_nearest(tree, queries[i], &nearest);
+      }
+    });
+  }
+  {
+    BENCHMARK_TIMER("kdtree_find_nearest_batch");
+    Array<int> indices(POINTS_NUM);
+    BLI_kdtree_3d_find_nearest_batch(tree,
+                                     reinterpret_cast<const float(*)[3]>(queries.data()),
+                                     POINTS_NUM,
+                                     nullptr,
+                                     indices.data(),
+                                     nullptr);
+  }
+  {
+    BENCHMARK_TIMER("kdtree_calc_duplicates_fast");
+    Array<int> duplicates(POINTS_NUM, -1);
+    BLI_kdtree_3d_calc_duplicates_fast(tree, 0.001f, false, duplicates.data());
+  }
+  BLI_kdtree_3d_free(tree);
+}
+
+TEST(containers_performance, BVHTree)
+{
+  const Array<float3> positions = random_positions(POINTS_NUM);
+  const Array<float3> queries = random_positions(POINTS_NUM);
+  BVHTree *tree = BLI_bvhtree_new(POINTS_NUM, 0.0f, 2, 6);
+  {
+    BENCHMARK_TIMER("bvhtree_build");
+    for (const int i : positions.index_range()) {
+      BLI_bvhtree_insert(tree, i, positions[i], 1);
+    }
+    BLI_bvhtree_balance(tree);
+  }
+  {
+    BENCHMARK_TIMER("bvhtree_find_nearest");
+    threading::parallel_for(queries.index_range(), 1024, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        BVHTreeNearest nearest;
+        nearest.index = -1;
+        nearest.dist_sq = FLT_MAX;
+        BLI_bvhtree_find_nearest(tree, queries[i], &nearest, nullptr, nullptr);
+      }
+    });
+  }
+  {
+    BENCHMARK_TIMER("bvhtree_ray_cast");
+    threading::parallel_for(queries.index_range(), 1024, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        BVHTreeRayHit hit;
+        hit.index = -1;
+        hit.dist = FLT_MAX;
+        const float3 direction = math::normalize(-queries[i]);
+        BLI_bvhtree_ray_cast(tree, queries[i], direction, 0.001f, &hit, nullptr, nullptr);
+      }
+    });
+  }
+  BLI_bvhtree_free(tree);
+}
+
+}  // namespace blender::tests
@@ -368,6 +368,19 @@ const blender::ImplicitSharingInfo *BLO_read_shared(
   return shared_data.sharing_info;
 }
 
+/**
+ * Try to use the data directly from the memory-mapped file, without copying it. This is only
+ * possible for large blocks that don't need any DNA conversion, and only for data that does not
+ * contain pointers, since the remapping is skipped. Typically used from within the `read_fn` of
+ * #BLO_read_shared.
+ *
+ * \return The sharing-info owning the data, or null if the data has to be read normally.
+ */
+const blender::ImplicitSharingInfo *BLO_read_shared_mapped(BlendDataReader *reader,
+                                                           const void **ptr_p,
+                                                           size_t expected_size,
+                                                           size_t alignment);
+
 int BLO_read_fileversion_get(BlendDataReader *reader);
 bool BLO_read_data_is_undo(BlendDataReader *reader);
 void BLO_read_data_globmap_add(BlendDataReader *reader, void *oldaddr, void *newaddr);
@@ -33,6 +33,12 @@ struct MemFileChunk {
   const char *buf;
   /** Size in bytes. */
   size_t size;
+  /**
+   * When non-zero, #buf is a zstd frame of this many bytes which decompresses into #size bytes.
+   * Only chunks owning their buffer, and not sharing it with the next step, are compressed
+   * (see #BLO_memfile_compress).
+   */
+  size_t compressed_size;
   /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk */
   bool is_identical;
   /** When true, this chunk is also identical to the one in the next step (used by undo code to
@@ -52,6 +58,8 @@ struct MemFile {
    * without making a copy. This is faster and requires less memory.
    */
   MemFileSharedStorage *shared_storage;
+  /** True once #BLO_memfile_compress has been run on this memfile. */
+  bool is_compressed;
 };
 
 struct MemFileWriteData {
@@ -79,6 +87,11 @@ struct UndoReader {
   int undo_direction;
 
   bool memchunk_identical;
+
+  /** Last compressed chunk decoded into #decompressed_buf, to avoid decoding it on every read. */
+  const MemFileChunk *decompressed_chunk;
+  char *decompressed_buf;
+  size_t decompressed_buf_size;
 };
 
 /* Actually only used `writefile.cc`. */
@@ -107,6 +120,15 @@ void BLO_memfile_merge(MemFile *first, MemFile *second);
  * Clear is_identical_future before adding next memfile.
  */
 void BLO_memfile_clear_future(MemFile *memfile);
+/**
+ * Compress the buffers owned by \a memfile with zstd, to reduce the memory used by older undo
+ * steps. Buffers shared with \a next_memfile (the following step) are kept as is, since the
+ * next step reads and compares them directly. Compressed chunks are decompressed on demand by
+ * the #BLO_memfile_new_filereader reader.
+ *
+ * \return The number of bytes saved, #MemFile.size is updated accordingly.
+ */
+size_t BLO_memfile_compress(MemFile *memfile, const MemFile *next_memfile);
 
 /* Utilities. */
 
@@ -100,6 +100,29 @@ static bool blendhandle_load_id_data_and_validate(FileData *fd,
   return true;
 }
 
+/* Same as #blendhandle_load_id_data_and_validate, but using an entry of the file index instead of
+ * the ID block itself. */
+static bool blendhandle_index_entry_validate(FileData *fd,
+                                             const BHeadIndexEntry &entry,
+                                             const int ofblocktype,
+                                             const bool use_assets_only)
+{
+  if (entry.code != ofblocktype) {
+    return false;
+  }
+  if (!std::memchr(entry.name, '\0', MAX_ID_NAME)) {
+    fd->flags |= FD_FLAGS_HAS_INVALID_ID_NAMES;
+    return false;
+  }
+  if (entry.name[0] == '\0') {
+    return false;
+  }
+  if (use_assets_only && (entry.flag & BHEAD_INDEX_ENTRY_IS_ASSET) == 0) {
+    return false;
+  }
+  return true;
+}
+
 LinkNode *BLO_blendhandle_get_datablock_names(BlendHandle *bh,
                                               int ofblocktype,
                                               const bool use_assets_only,
@@ -110,6 +133,17 @@ LinkNode *BLO_blendhandle_get_datablock_names(BlendHandle *bh,
   BHead *bhead;
   int tot = 0;
 
+  if (const blender::Vector<BHeadIndexEntry> *index = blo_bhead_index_get(fd)) {
+    for (const BHeadIndexEntry &entry : *index) {
+      if (blendhandle_index_entry_validate(fd, entry, ofblocktype, use_assets_only)) {
+        BLI_linklist_prepend(&names, BLI_strdup(entry.name + 2));
+        tot++;
+      }
+    }
+    *r_tot_names = tot;
+    return names;
+  }
+
   for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
     if (bhead->code == ofblocktype) {
       const char *idname;
@@ -132,6 +166,63 @@ LinkNode *BLO_blendhandle_get_datablock_names(BlendHandle *bh,
   return names;
 }
 
+/**
+ * Fast path of #BLO_blendhandle_get_datablock_info, only reading the ID blocks of assets.
+ * \return False if the index does not match the file content, the caller should then fall back
+ * to parsing the whole file.
+ */
+static bool blendhandle_get_datablock_info_from_index(FileData *fd,
+                                                      const blender::Span<BHeadIndexEntry> index,
+                                                      const int ofblocktype,
+                                                      const bool use_assets_only,
+                                                      LinkNode **r_infos,
+                                                      int *r_tot_info_items)
+{
+  LinkNode *infos = nullptr;
+  int tot = 0;
+  bool success = true;
+
+  for (const BHeadIndexEntry &entry : index) {
+    if (!blendhandle_index_entry_validate(fd, entry, ofblocktype, use_assets_only)) {
+      continue;
+    }
+
+    AssetMetaData *asset_meta_data = nullptr;
+    if (entry.flag & BHEAD_INDEX_ENTRY_IS_ASSET) {
+      BHead *bhead = blo_bhead_jump(fd, off64_t(entry.bhead_offset));
+      const char *idname = (bhead && bhead->code == entry.code) ? blo_bhead_id_name(fd, bhead) :
+                                                                  nullptr;
+      if (idname == nullptr || !STREQ(idname, entry.name)) {
+        success = false;
+        break;
+      }
+      asset_meta_data = blo_bhead_id_asset_data_address(fd, bhead);
+      if (asset_meta_data) {
+        blo_read_asset_data_block(fd, bhead, &asset_meta_data);
+      }
+    }
+
+    BLODataBlockInfo *info = MEM_mallocN<BLODataBlockInfo>(__func__);
+    STRNCPY(info->name, entry.name + 2);
+    info->asset_data = asset_meta_data;
+    info->free_asset_data = true;
+    info->no_preview_found = entry.preview_bhead_offset == 0;
+
+    BLI_linklist_prepend(&infos, info);
+    tot++;
+  }
+
+  blo_bhead_jump_end(fd);
+
+  if (!success) {
+    BLO_datablock_info_linklist_free(infos);
+    return false;
+  }
+  *r_infos = infos;
+  *r_tot_info_items = tot;
+  return true;
+}
+
 LinkNode *BLO_blendhandle_get_datablock_info(BlendHandle *bh,
                                              int ofblocktype,
                                              const bool use_assets_only,
@@ -142,6 +233,14 @@ LinkNode *BLO_blendhandle_get_datablock_info(BlendHandle *bh,
   BHead *bhead;
   int tot = 0;
 
+  if (const blender::Vector<BHeadIndexEntry> *index = blo_bhead_index_get(fd)) {
+    if (blendhandle_get_datablock_info_from_index(
+            fd, *index, ofblocktype, use_assets_only, &infos, r_tot_info_items))
+    {
+      return infos;
+    }
+  }
+
   const int sdna_nr_preview_image = DNA_struct_find_with_alias(fd->filesdna, "PreviewImage");
 
   for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
@@ -239,6 +338,60 @@ static BHead *blo_blendhandle_read_preview_rects(FileData *fd,
   return bhead;
 }
 
+/**
+ * Read the preview stored in the given block, and the rects stored in the blocks following it.
+ */
+static PreviewImage *blo_blendhandle_read_preview(FileData *fd, BHead *bhead)
+{
+  PreviewImage *preview_from_file = static_cast<PreviewImage *>(
+      BLO_library_read_struct(fd, bhead, "PreviewImage"));
+
+  if (preview_from_file == nullptr) {
+    return nullptr;
+  }
+
+  PreviewImage *result = static_cast<PreviewImage *>(MEM_dupallocN(preview_from_file));
+  result->runtime = MEM_new<blender::bke::PreviewImageRuntime>(__func__);
+  blo_blendhandle_read_preview_rects(fd, bhead, result, preview_from_file);
+  MEM_freeN(preview_from_file);
+  return result;
+}
+
+/**
+ * Fast path of #BLO_blendhandle_get_preview_for_id, jumping directly to the preview block.
+ * \return False if the index does not match the file content, the caller should then fall back
+ * to parsing the whole file.
+ */
+static bool blo_blendhandle_get_preview_for_id_from_index(
+    FileData *fd,
+    const blender::Span<BHeadIndexEntry> index,
+    const int ofblocktype,
+    const char *name,
+    const int sdna_preview_image,
+    PreviewImage **r_preview)
+{
+  *r_preview = nullptr;
+  for (const BHeadIndexEntry &entry : index) {
+    if (!blendhandle_index_entry_validate(fd, entry, ofblocktype, false) ||
+        !STREQ(entry.name + 2, name))
+    {
+      continue;
+    }
+    if (entry.preview_bhead_offset == 0) {
+      return true;
+    }
+    BHead *bhead = blo_bhead_jump(fd, off64_t(entry.preview_bhead_offset));
+    const bool is_valid = bhead && bhead->code == BLO_CODE_DATA &&
+                          bhead->SDNAnr == sdna_preview_image;
+    if (is_valid) {
+      *r_preview = blo_blendhandle_read_preview(fd, bhead);
+    }
+    blo_bhead_jump_end(fd);
+    return is_valid;
+  }
+  return true;
+}
+
 PreviewImage *BLO_blendhandle_get_preview_for_id(BlendHandle *bh,
                                                  int ofblocktype,
                                                  const char *name)
@@ -247,21 +400,19 @@ PreviewImage *BLO_blendhandle_get_preview_for_id(BlendHandle *bh,
   bool looking = false;
   const int sdna_preview_image = DNA_struct_find_with_alias(fd->filesdna, "PreviewImage");
 
+  if (const blender::Vector<BHeadIndexEntry> *index = blo_bhead_index_get(fd)) {
+    PreviewImage *result;
+    if (blo_blendhandle_get_preview_for_id_from_index(
+            fd, *index, ofblocktype, name, sdna_preview_image, &result))
+    {
+      return result;
+    }
+  }
+
   for (BHead *bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
     if (bhead->code == BLO_CODE_DATA) {
       if (looking && bhead->SDNAnr == sdna_preview_image) {
-        PreviewImage *preview_from_file = static_cast<PreviewImage *>(
-            BLO_library_read_struct(fd, bhead, "PreviewImage"));
-
-        if (preview_from_file == nullptr) {
-          break;
-        }
-
-        PreviewImage *result = static_cast<PreviewImage *>(MEM_dupallocN(preview_from_file));
-        result->runtime = MEM_new<blender::bke::PreviewImageRuntime>(__func__);
-        bhead = blo_blendhandle_read_preview_rects(fd, bhead, result, preview_from_file);
-        MEM_freeN(preview_from_file);
-        return result;
+        return blo_blendhandle_read_preview(fd, bhead);
       }
     }
     else if (looking || bhead->code == BLO_CODE_ENDB) {
@@ -287,6 +438,19 @@ LinkNode *BLO_blendhandle_get_linkable_groups(BlendHandle *bh)
   LinkNode *names = nullptr;
   BHead *bhead;
 
+  if (const blender::Vector<BHeadIndexEntry> *index = blo_bhead_index_get(fd)) {
+    for (const BHeadIndexEntry &entry : *index) {
+      if (BKE_idtype_idcode_is_valid(entry.code) && BKE_idtype_idcode_is_linkable(entry.code)) {
+        const char *str = BKE_idtype_idcode_to_name(entry.code);
+        if (BLI_gset_add(gathered, (void *)str)) {
+          BLI_linklist_prepend(&names, BLI_strdup(str));
+        }
+      }
+    }
+    BLI_gset_free(gathered, nullptr);
+    return names;
+  }
+
   for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
     if (bhead->code == BLO_CODE_ENDB) {
       break;
@@ -59,6 +59,7 @@
 #include "BLI_threads.h"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
 
@@ -174,6 +175,12 @@
  */
 #define USE_BHEAD_READ_ON_DEMAND
 
+/**
+ * Data blocks at least this large are used directly from the memory-mapped file when possible,
+ * instead of being copied, see #BLO_read_shared_mapped.
+ */
+#define MAPPED_DATA_MIN_SIZE (1 << 16)
+
 static CLG_LogRef LOG = {"blend.readfile"};
 static CLG_LogRef LOG_UNDO = {"undo"};
 
@@ -776,6 +783,53 @@ BHead *blo_bhead_next(FileData *fd, BHead *thisblock)
   return bhead;
 }
 
+BHead *blo_bhead_jump(FileData *fd, const off64_t file_offset)
+{
+  BLI_assert(fd->file->seek != nullptr);
+  if (!fd->bhead_jump_stash.is_active) {
+    fd->bhead_jump_stash.bhead_list = fd->bhead_list;
+    fd->bhead_jump_stash.file_offset = fd->file->offset;
+    fd->bhead_jump_stash.is_eof = fd->is_eof;
+    fd->bhead_jump_stash.is_active = true;
+  }
+  else {
+    BLI_freelistN(&fd->bhead_list);
+  }
+  BLI_listbase_clear(&fd->bhead_list);
+
+  if (fd->file->seek(fd->file, file_offset, SEEK_SET) == -1) {
+    fd->is_eof = true;
+    return nullptr;
+  }
+  fd->is_eof = false;
+  return blo_bhead_first(fd);
+}
+
+void blo_bhead_jump_end(FileData *fd)
+{
+  if (!fd->bhead_jump_stash.is_active) {
+    return;
+  }
+  BLI_freelistN(&fd->bhead_list);
+  fd->bhead_list = fd->bhead_jump_stash.bhead_list;
+  fd->is_eof = fd->bhead_jump_stash.is_eof;
+  if (fd->file->seek(fd->file, fd->bhead_jump_stash.file_offset, SEEK_SET) == -1) {
+    fd->is_eof = true;
+  }
+  fd->bhead_jump_stash = {};
+}
+
+const blender::Vector<BHeadIndexEntry> *blo_bhead_index_get(FileData *fd)
+{
+  if (!fd->bhead_index_is_read) {
+    fd->bhead_index_is_read = true;
+    if ((fd->flags & FD_FLAGS_IS_MEMFILE) == 0 && fd->file->seek != nullptr) {
+      fd->bhead_index = BLO_readfile_read_bhead_index(fd->file, fd->blender_header.bhead_type());
+    }
+  }
+  return fd->bhead_index ? &*fd->bhead_index : nullptr;
+}
+
 #ifdef USE_BHEAD_READ_ON_DEMAND
 static bool blo_bhead_read_data(FileData *fd, BHead *thisblock, void *buf)
 {
@@ -1127,6 +1181,43 @@ static void long_id_names_process_action_slots_identifiers(Main *bmain)
 /** \name File Data API
  * \{ */
 
+/** Owns a memory-mapped #FileReader, keeping it open while its memory is used. */
+class MappedFileSharingInfo : public blender::ImplicitSharingMixin {
+ private:
+  FileReader *file_;
+
+ public:
+  MappedFileSharingInfo(FileReader *file) : file_(file) {}
+
+ private:
+  void delete_self() override
+  {
+    file_->close(file_);
+    MEM_delete(this);
+  }
+};
+
+/**
+ * Sharing info for an array that points into the memory of a memory-mapped file. Since the
+ * mapping is copy-on-write, the array may be modified in-place once it is mutable.
+ */
+class MappedDataSharingInfo : public blender::ImplicitSharingMixin {
+ private:
+  blender::ImplicitSharingPtr<> file_sharing_info_;
+
+ public:
+  MappedDataSharingInfo(blender::ImplicitSharingPtr<> file_sharing_info)
+      : file_sharing_info_(std::move(file_sharing_info))
+  {
+  }
+
+ private:
+  void delete_self() override
+  {
+    MEM_delete(this);
+  }
+};
+
 static FileData *filedata_new(BlendFileReadReport *reports)
 {
   BLI_assert(reports != nullptr);
@@ -1303,6 +1394,17 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
 
   FileData *fd = filedata_new(reports);
   fd->file = file;
+#ifdef USE_BHEAD_READ_ON_DEMAND
+  /* Arrays used directly from the mapping keep it open for the whole session. Only do that for
+   * files that can't be written, since overwriting or truncating a mapped file fails on Windows
+   * and silently replaces the mapped data on other platforms (see the `SIGBUS` handler). */
+  char *mapped_memory = static_cast<char *>(BLI_filereader_mmap_memory(file));
+  if (mapped_memory && !BLI_file_is_writable(filepath)) {
+    fd->mapped_memory = mapped_memory;
+    fd->mapped_file_sharing_info = blender::ImplicitSharingPtr<>(
+        MEM_new<MappedFileSharingInfo>(__func__, file));
+  }
+#endif
 
   return fd;
 }
@@ -1403,6 +1505,8 @@ FileData *blo_filedata_from_memfile(MemFile *memfile,
 
 void blo_filedata_free(FileData *fd)
 {
+  blo_bhead_jump_end(fd);
+
   /* Free all BHeadN data blocks */
 #ifdef NDEBUG
   BLI_freelistN(&fd->bhead_list);
@@ -1417,7 +1521,13 @@ void blo_filedata_free(FileData *fd)
     MEM_freeN(new_bhead);
   }
 #endif
-  fd->file->close(fd->file);
+  if (fd->mapped_file_sharing_info) {
+    /* The file is closed once the last array using its mapped memory is freed. */
+    fd->mapped_file_sharing_info.reset();
+  }
+  else {
+    fd->file->close(fd->file);
+  }
 
   if (fd->filesdna) {
     DNA_sdna_free(fd->filesdna);
@@ -1502,16 +1612,43 @@ short BLO_version_from_file(const char *filepath)
 /** \name Old/New Pointer Map
  * \{ */
 
+/**
+ * Copy a data block that was skipped by #read_data_into_datamap into the datamap, because it is
+ * accessed through the regular API instead of #BLO_read_shared_mapped.
+ */
+static void *mapped_data_ensure_in_datamap(FileData *fd, const void *adr)
+{
+  BHead *bhead = fd->mapped_data_bheads.pop_default(adr, nullptr);
+  if (!bhead) {
+    return nullptr;
+  }
+  void *data = read_struct(fd, bhead, "Data from mapped file", INDEX_ID_NULL);
+  if (data) {
+    oldnewmap_insert(fd->datamap, bhead->old, data, 0);
+  }
+  return data;
+}
+
 /* Only direct data-blocks. */
 static void *newdataadr(FileData *fd, const void *adr)
 {
-  return oldnewmap_lookup_and_inc(fd->datamap, adr, true);
+  void *new_adr = oldnewmap_lookup_and_inc(fd->datamap, adr, true);
+  if (UNLIKELY(new_adr == nullptr && adr && !fd->mapped_data_bheads.is_empty())) {
+    if (mapped_data_ensure_in_datamap(fd, adr)) {
+      new_adr = oldnewmap_lookup_and_inc(fd->datamap, adr, true);
+    }
+  }
+  return new_adr;
 }
 
 /* Only direct data-blocks. */
 static void *newdataadr_no_us(FileData *fd, const void *adr)
 {
-  return oldnewmap_lookup_and_inc(fd->datamap, adr, false);
+  void *new_adr = oldnewmap_lookup_and_inc(fd->datamap, adr, false);
+  if (UNLIKELY(new_adr == nullptr && adr && !fd->mapped_data_bheads.is_empty())) {
+    new_adr = mapped_data_ensure_in_datamap(fd, adr);
+  }
+  return new_adr;
 }
 
 void *blo_read_get_new_globaldata_address(FileData *fd, const void *adr)
@@ -1533,16 +1670,23 @@ void *blo_do_versions_newlibadr(FileData *fd,
   return newlibadr(fd, self_id, is_linked_only, adr);
 }
 
-/* increases user number */
-static void change_link_placeholder_to_real_ID_pointer_fd(FileData *fd,
-                                                          const void *old,
-                                                          void *newp)
+/**
+ * Replace the link placeholders in the libmap by their real IDs (or null). All placeholders are
+ * processed in a single pass over the libmap, since calling this for each placeholder separately
+ * is quadratic in the number of linked IDs.
+ */
+static void change_link_placeholders_to_real_ID_pointers_fd(
+    FileData *fd, const blender::Map<const ID *, ID *> &real_id_by_placeholder)
 {
   for (NewAddress &entry : fd->libmap->map.values()) {
-    if (old == entry.newp && entry.nr == ID_LINK_PLACEHOLDER) {
-      entry.newp = newp;
-      if (newp) {
-        entry.nr = GS(((ID *)newp)->name);
+    if (entry.nr != ID_LINK_PLACEHOLDER) {
+      continue;
+    }
+    if (ID *const *newp = real_id_by_placeholder.lookup_ptr(static_cast<const ID *>(entry.newp)))
+    {
+      entry.newp = *newp;
+      if (*newp) {
+        entry.nr = GS((*newp)->name);
       }
     }
   }
@@ -1575,12 +1719,16 @@ static FileData *change_ID_link_filedata_get(Main *bmain, FileData *basefd)
   }
 }
 
-static void change_link_placeholder_to_real_ID_pointer(FileData *basefd, void *old, void *newp)
+static void change_link_placeholders_to_real_ID_pointers(
+    FileData *basefd, const blender::Map<const ID *, ID *> &real_id_by_placeholder)
 {
+  if (real_id_by_placeholder.is_empty()) {
+    return;
+  }
   for (Main *mainptr : *basefd->bmain->split_mains) {
     FileData *fd = change_ID_link_filedata_get(mainptr, basefd);
     if (fd) {
-      change_link_placeholder_to_real_ID_pointer_fd(fd, old, newp);
+      change_link_placeholders_to_real_ID_pointers_fd(fd, real_id_by_placeholder);
     }
   }
 }
@@ -2631,15 +2779,51 @@ static bool direct_link_id(FileData *fd,
   return success;
 }
 
+/**
+ * Whether the data block can be used directly from the memory-mapped file, i.e. it is large
+ * enough to be worth it and it does not need any conversion.
+ */
+static bool blo_bhead_is_mappable(FileData *fd, BHead *bhead)
+{
+#ifdef USE_BHEAD_READ_ON_DEMAND
+  if (fd->mapped_memory == nullptr || (fd->flags & FD_FLAGS_IS_MEMFILE)) {
+    return false;
+  }
+  if (bhead->len < MAPPED_DATA_MIN_SIZE || BHEADN_FROM_BHEAD(bhead)->has_data) {
+    return false;
+  }
+  if (fd->flags & FD_FLAGS_SWITCH_ENDIAN) {
+    return false;
+  }
+  return bhead->SDNAnr == SDNA_RAW_DATA_STRUCT_INDEX ||
+         fd->compflags[bhead->SDNAnr] == SDNA_CMP_EQUAL;
+#else
+  UNUSED_VARS(fd, bhead);
+  return false;
+#endif
+}
+
 /* Read all data associated with a datablock into datamap. */
 static BHead *read_data_into_datamap(FileData *fd,
                                      BHead *bhead,
                                      const char *allocname,
                                      const int id_type_index)
 {
+  fd->mapped_data_bheads.clear();
   bhead = blo_bhead_next(fd, bhead);
 
   while (bhead && bhead->code == BLO_CODE_DATA) {
+    if (blo_bhead_is_mappable(fd, bhead)) {
+      /* Don't copy the data yet, it may be used directly from the mapped file. */
+      if (!fd->mapped_data_bheads.add(bhead->old, bhead)) {
+        CLOG_ERROR(&LOG,
+                   "Blendfile corruption: Invalid, or multiple `bhead` with same old address "
+                   "value (%p) for a given ID.",
+                   bhead->old);
+      }
+      bhead = blo_bhead_next(fd, bhead);
+      continue;
+    }
     void *data = read_struct(fd, bhead, allocname, id_type_index);
     if (data) {
       const bool is_new = oldnewmap_insert(fd->datamap, bhead->old, data, 0);
@@ -3137,6 +3321,7 @@ static BHead *read_libblock(FileData *fd,
   bhead = read_data_into_datamap(fd, bhead, blockname, id_type_index);
   const bool success = direct_link_id(fd, main, id_tag, id_read_tags, id, id_old);
   oldnewmap_clear(fd->datamap);
+  fd->mapped_data_bheads.clear();
 
   if (!success) {
     /* XXX This is probably working OK currently given the very limited scope of that flag.
@@ -3181,6 +3366,7 @@ BHead *blo_read_asset_data_block(FileData *fd, BHead *bhead, AssetMetaData **r_a
   BKE_asset_metadata_read(&reader, *r_asset_data);
 
   oldnewmap_clear(fd->datamap);
+  fd->mapped_data_bheads.clear();
 
   return bhead;
 }
@@ -3664,6 +3850,7 @@ static BHead *read_userdef(BlendFileData *bfd, FileData *fd, BHead *bhead)
 
   /* free fd->datamap again */
   oldnewmap_clear(fd->datamap);
+  fd->mapped_data_bheads.clear();
 
   return bhead;
 }
@@ -3803,6 +3990,7 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
       case BLO_CODE_DNA1:
       case BLO_CODE_TEST: /* used as preview since 2.5x */
       case BLO_CODE_REND:
+      case BLO_CODE_INDX:
         bhead = blo_bhead_next(fd, bhead);
         break;
       case BLO_CODE_GLOB:
@@ -4862,6 +5050,10 @@ static void read_library_linked_id(
 static void read_library_linked_ids(FileData *basefd, FileData *fd, Main *mainvar)
 {
   blender::Map<std::string, ID *> loaded_ids;
+  /* Placeholders are only freed once all of them have been replaced in the libmaps, so that their
+   * addresses cannot be reused by newly read IDs in the meantime. */
+  blender::Map<const ID *, ID *> real_id_by_placeholder;
+  blender::Vector<ID *> placeholders;
 
   MainListsArray lbarray = BKE_main_lists_get(*mainvar);
   int a = lbarray.size();
@@ -4892,10 +5084,10 @@ static void read_library_linked_ids(FileData *basefd, FileData *fd, Main *mainva
          * (known case: some directly linked shape-key from a missing lib...). */
         // BLI_assert(*realid != nullptr);
 
-        /* Now that we have a real ID, replace all pointers to placeholders in
-         * fd->libmap with pointers to the real data-blocks. We do this for all
+        /* Now that we have a real ID, all pointers to the placeholder in fd->libmap
+         * will be replaced with pointers to the real data-block. We do this for all
          * libraries since multiple might be referencing this ID. */
-        change_link_placeholder_to_real_ID_pointer(basefd, id, realid);
+        real_id_by_placeholder.add(id, realid);
 
         /* Transfer the readfile data from the placeholder to the real ID, but
          * only if the real ID has no readfile data yet. The same realid may be
@@ -4910,7 +5102,7 @@ static void read_library_linked_ids(FileData *basefd, FileData *fd, Main *mainva
          * ID, this shouldn't follow any pointers to embedded IDs. */
         BLO_readfile_id_runtime_data_free(*id);
 
-        MEM_freeN(id);
+        placeholders.append(id);
       }
       id = id_next;
     }
@@ -4918,6 +5110,11 @@ static void read_library_linked_ids(FileData *basefd, FileData *fd, Main *mainva
     loaded_ids.clear();
   }
 
+  change_link_placeholders_to_real_ID_pointers(basefd, real_id_by_placeholder);
+  for (ID *id : placeholders) {
+    MEM_freeN(id);
+  }
+
   read_libraries_report_invalid_id_names(fd,
                                          basefd->reports->reports,
                                          mainvar->has_forward_compatibility_issues,
@@ -4928,6 +5125,8 @@ static void read_library_clear_weak_links(FileData *basefd, Main *mainvar)
 {
   /* Any remaining weak links at this point have been lost, silently drop
    * those by setting them to nullptr pointers. */
+  blender::Map<const ID *, ID *> real_id_by_placeholder;
+  blender::Vector<ID *> placeholders;
   MainListsArray lbarray = BKE_main_lists_get(*mainvar);
   int a = lbarray.size();
   while (a--) {
@@ -4942,12 +5141,18 @@ static void read_library_clear_weak_links(FileData *basefd, Main *mainvar)
           (id->flag & ID_FLAG_INDIRECT_WEAK_LINK))
       {
         CLOG_DEBUG(&LOG, "Dropping weak link to '%s'", id->name);
-        change_link_placeholder_to_real_ID_pointer(basefd, id, nullptr);
-        BLI_freelinkN(lbarray[a], id);
+        real_id_by_placeholder.add(id, nullptr);
+        BLI_remlink(lbarray[a], id);
+        placeholders.append(id);
       }
       id = id_next;
     }
   }
+
+  change_link_placeholders_to_real_ID_pointers(basefd, real_id_by_placeholder);
+  for (ID *id : placeholders) {
+    MEM_freeN(id);
+  }
 }
 
 static FileData *read_library_file_data(FileData *basefd, Main *mainl, Main *mainptr)
@@ -5408,6 +5613,33 @@ blender::ImplicitSharingInfoAndData blo_read_shared_impl(
   return shared_data;
 }
 
+const blender::ImplicitSharingInfo *BLO_read_shared_mapped(BlendDataReader *reader,
+                                                           const void **ptr_p,
+                                                           const size_t expected_size,
+                                                           const size_t alignment)
+{
+#ifdef USE_BHEAD_READ_ON_DEMAND
+  FileData *fd = reader->fd;
+  if (fd->mapped_data_bheads.is_empty()) {
+    return nullptr;
+  }
+  BHead *bhead = fd->mapped_data_bheads.lookup_default(*ptr_p, nullptr);
+  if (bhead == nullptr || size_t(bhead->len) != expected_size) {
+    return nullptr;
+  }
+  const char *data = fd->mapped_memory + BHEADN_FROM_BHEAD(bhead)->file_offset;
+  if (uintptr_t(data) % alignment != 0) {
+    return nullptr;
+  }
+  fd->mapped_data_bheads.remove(*ptr_p);
+  *ptr_p = data;
+  return MEM_new<MappedDataSharingInfo>(__func__, fd->mapped_file_sharing_info);
+#else
+  UNUSED_VARS(reader, ptr_p, expected_size, alignment);
+  return nullptr;
+#endif
+}
+
 bool BLO_read_data_is_undo(BlendDataReader *reader)
 {
   return (reader->fd->flags & FD_FLAGS_IS_MEMFILE);
@@ -17,7 +17,9 @@
 #endif
 
 #include "BLI_filereader.h"
+#include "BLI_implicit_sharing_ptr.hh"
 #include "BLI_map.hh"
+#include "BLI_vector.hh"
 
 #include "DNA_sdna_types.h"
 #include "DNA_space_types.h"
@@ -83,6 +85,24 @@ struct FileData {
 
   FileReader *file = nullptr;
 
+  /**
+   * Memory of #file when it is memory-mapped, null otherwise. Large data arrays whose DNA layout
+   * matches the current one can then be used directly from the mapping instead of being copied,
+   * see #BLO_read_shared_mapped.
+   */
+  const char *mapped_memory = nullptr;
+  /**
+   * Owns #file when it is memory-mapped, so that it stays open as long as there are arrays that
+   * point into #mapped_memory.
+   */
+  blender::ImplicitSharingPtr<> mapped_file_sharing_info;
+  /**
+   * Data blocks of the ID currently being read which were not copied into #datamap because they
+   * may be used from the mapped memory directly. They are only copied when accessed through the
+   * regular #BLO_read_struct_array (& co) API.
+   */
+  blender::Map<const void *, BHead *> mapped_data_bheads;
+
   /**
    * Whether we are undoing (< 0) or redoing (> 0), used to choose which 'unchanged' flag to use
    * to detect unchanged data from memfile.
@@ -150,6 +170,21 @@ struct FileData {
 
   std::optional<blender::Map<blender::StringRefNull, BHead *>> bhead_idname_map;
 
+  /**
+   * Index of the ID blocks stored at the end of the file, see #BHeadIndexEntry. Read on first use
+   * by #blo_bhead_index_get, empty when the file has no (valid) index.
+   */
+  std::optional<blender::Vector<BHeadIndexEntry>> bhead_index;
+  bool bhead_index_is_read = false;
+
+  /** Regular block list and read position, kept aside while #blo_bhead_jump is used. */
+  struct {
+    ListBase bhead_list;
+    off64_t file_offset;
+    bool is_eof;
+    bool is_active;
+  } bhead_jump_stash = {};
+
   Main *bmain = nullptr;
   /** Used for undo. */
   Main *old_bmain = nullptr;
@@ -210,6 +245,20 @@ BHead *blo_bhead_first(FileData *fd) ATTR_NONNULL(1);
 BHead *blo_bhead_next(FileData *fd, BHead *thisblock) ATTR_NONNULL(1);
 BHead *blo_bhead_prev(FileData *fd, BHead *thisblock) ATTR_NONNULL(1, 2);
 
+/**
+ * Read blocks starting at the given file offset, instead of from the start of the file: the
+ * #BHead at \a file_offset is returned and #blo_bhead_next continues from there. The regular
+ * block list is kept aside until #blo_bhead_jump_end, which also frees all blocks read since the
+ * first jump. Requires a file that can seek.
+ */
+BHead *blo_bhead_jump(FileData *fd, off64_t file_offset) ATTR_NONNULL(1);
+void blo_bhead_jump_end(FileData *fd) ATTR_NONNULL(1);
+
+/**
+ * Get the index of ID blocks of the file, or null if there is none (see #BHeadIndexEntry).
+ */
+const blender::Vector<BHeadIndexEntry> *blo_bhead_index_get(FileData *fd) ATTR_NONNULL(1);
+
 /**
  * Warning! Caller's responsibility to ensure given bhead **is** an ID one!
  *
@@ -18,11 +18,16 @@
 #  include <io.h>
 #endif
 
+#include <zstd.h>
+
 #include "MEM_guardedalloc.h"
 
 #include "DNA_listBase.h"
 
 #include "BLI_implicit_sharing.hh"
+#include "BLI_set.hh"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "BLO_readfile.hh"
 #include "BLO_undofile.hh"
@@ -94,6 +99,70 @@ void BLO_memfile_clear_future(MemFile *memfile)
   }
 }
 
+/** Compressing small chunks gains too little to justify the decompression cost on undo. */
+#define MEMFILE_COMPRESS_MIN_SIZE 4096
+/** Favor speed, undo steps are compressed while the user is working. */
+#define MEMFILE_COMPRESS_LEVEL 1
+
+size_t BLO_memfile_compress(MemFile *memfile, const MemFile *next_memfile)
+{
+  if (memfile->is_compressed) {
+    return 0;
+  }
+  memfile->is_compressed = true;
+
+  /* Buffers of this memfile that are re-used by the next step must stay uncompressed. Since
+   * buffers are only shared between consecutive steps, checking the next one is enough. */
+  blender::Set<const char *> buffers_used_by_next;
+  if (next_memfile != nullptr) {
+    LISTBASE_FOREACH (const MemFileChunk *, chunk, &next_memfile->chunks) {
+      if (chunk->is_identical) {
+        buffers_used_by_next.add(chunk->buf);
+      }
+    }
+  }
+
+  blender::Vector<MemFileChunk *> chunks;
+  LISTBASE_FOREACH (MemFileChunk *, chunk, &memfile->chunks) {
+    if (!chunk->is_identical && chunk->compressed_size == 0 &&
+        chunk->size >= MEMFILE_COMPRESS_MIN_SIZE && !buffers_used_by_next.contains(chunk->buf))
+    {
+      chunks.append(chunk);
+    }
+  }
+
+  blender::threading::parallel_for(chunks.index_range(), 4, [&](const blender::IndexRange range) {
+    for (MemFileChunk *chunk : chunks.as_span().slice(range)) {
+      const size_t bound = ZSTD_compressBound(chunk->size);
+      char *buf_compressed = MEM_malloc_arrayN<char>(bound, "Chunk buffer compressed");
+      const size_t compressed_size = ZSTD_compress(
+          buf_compressed, bound, chunk->buf, chunk->size, MEMFILE_COMPRESS_LEVEL);
+      if (ZSTD_isError(compressed_size) || compressed_size >= chunk->size) {
+        MEM_freeN(buf_compressed);
+        continue;
+      }
+      /* Don't keep the slack of the compression bound around. */
+      char *buf_new = MEM_malloc_arrayN<char>(compressed_size, "Chunk buffer");
+      memcpy(buf_new, buf_compressed, compressed_size);
+      MEM_freeN(buf_compressed);
+
+      MEM_freeN(chunk->buf);
+      chunk->buf = buf_new;
+      chunk->compressed_size = compressed_size;
+    }
+  });
+
+  size_t saved_size = 0;
+  for (const MemFileChunk *chunk : chunks) {
+    if (chunk->compressed_size != 0) {
+      saved_size += chunk->size - chunk->compressed_size;
+    }
+  }
+  BLI_assert(saved_size <= memfile->size);
+  memfile->size -= saved_size;
+  return saved_size;
+}
+
 void BLO_memfile_write_init(MemFileWriteData *mem_data,
                             MemFile *written_memfile,
                             MemFile *reference_memfile)
@@ -133,6 +202,7 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   MemFileChunk *curchunk = MEM_mallocN<MemFileChunk>("MemFileChunk");
   curchunk->size = size;
   curchunk->buf = nullptr;
+  curchunk->compressed_size = 0;
   curchunk->is_identical = false;
   /* This is unsafe in the sense that an app handler or other code that does not
    * perform an undo push may make changes after the last undo push that
@@ -144,7 +214,8 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   /* we compare compchunk with buf */
   if (*compchunk_step != nullptr) {
     MemFileChunk *compchunk = *compchunk_step;
-    if (compchunk->size == curchunk->size) {
+    /* Compressed chunks are never shared, the next step gets its own copy of that data. */
+    if (compchunk->size == curchunk->size && compchunk->compressed_size == 0) {
       if (memcmp(compchunk->buf, buf, size) == 0) {
         curchunk->buf = compchunk->buf;
         curchunk->is_identical = true;
@@ -182,6 +253,32 @@ Main *BLO_memfile_main_get(MemFile *memfile, Main *bmain, Scene **r_scene)
   return bmain_undo;
 }
 
+/**
+ * Get the uncompressed data of a chunk, decompressing it into the reader's buffer if needed.
+ */
+static const char *undo_chunk_data_get(UndoReader *undo, const MemFileChunk *chunk)
+{
+  if (chunk->compressed_size == 0) {
+    return chunk->buf;
+  }
+  if (undo->decompressed_chunk == chunk) {
+    return undo->decompressed_buf;
+  }
+  if (undo->decompressed_buf_size < chunk->size) {
+    MEM_SAFE_FREE(undo->decompressed_buf);
+    undo->decompressed_buf = MEM_malloc_arrayN<char>(chunk->size, "Chunk buffer decompressed");
+    undo->decompressed_buf_size = chunk->size;
+  }
+  const size_t size = ZSTD_decompress(
+      undo->decompressed_buf, chunk->size, chunk->buf, chunk->compressed_size);
+  if (ZSTD_isError(size) || size != chunk->size) {
+    undo->decompressed_chunk = nullptr;
+    return nullptr;
+  }
+  undo->decompressed_chunk = chunk;
+  return undo->decompressed_buf;
+}
+
 static int64_t undo_read(FileReader *reader, void *buffer, size_t size)
 {
   UndoReader *undo = (UndoReader *)reader;
@@ -238,7 +335,13 @@ static int64_t undo_read(FileReader *reader, void *buffer, size_t size)
         readsize = chunk->size - chunkoffset;
       }
 
-      memcpy(POINTER_OFFSET(buffer, totread), chunk->buf + chunkoffset, readsize);
+      const char *chunk_data = undo_chunk_data_get(undo, chunk);
+      if (chunk_data == nullptr) {
+        printf("illegal read, chunk decompression failed\n");
+        return 0;
+      }
+
+      memcpy(POINTER_OFFSET(buffer, totread), chunk_data + chunkoffset, readsize);
       totread += readsize;
       undo->reader.offset += (off64_t)readsize;
       seek += readsize;
@@ -259,6 +362,8 @@ static int64_t undo_read(FileReader *reader, void *buffer, size_t size)
 
 static void undo_close(FileReader *reader)
 {
+  UndoReader *undo = (UndoReader *)reader;
+  MEM_SAFE_FREE(undo->decompressed_buf);
   MEM_freeN(reader);
 }
 
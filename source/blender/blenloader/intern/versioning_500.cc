@@ -12,8 +12,10 @@
 
 #include "DNA_ID.h"
 #include "DNA_curves_types.h"
+#include "DNA_defaults.h"
 #include "DNA_grease_pencil_types.h"
 #include "DNA_mesh_types.h"
+#include "DNA_modifier_types.h"
 #include "DNA_node_types.h"
 #include "DNA_rigidbody_types.h"
 #include "DNA_screen_types.h"
@@ -1164,17 +1166,17 @@ void blo_do_versions_500(FileData * /*fd*/, Library * /*lib*/, Main *bmain)
 {
   using namespace blender;
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 500, 1)) {
-    LISTBASE_FOREACH (Mesh *, mesh, &bmain->meshes) {
-      bke::mesh_sculpt_mask_to_generic(*mesh);
-      bke::mesh_custom_normals_to_generic(*mesh);
-      rename_mesh_uv_seam_attribute(*mesh);
-    }
+    version_foreach_id_parallel<Mesh>(bmain->meshes, [](Mesh &mesh) {
+      bke::mesh_sculpt_mask_to_generic(mesh);
+      bke::mesh_custom_normals_to_generic(mesh);
+      rename_mesh_uv_seam_attribute(mesh);
+    });
   }
 
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 500, 2)) {
-    LISTBASE_FOREACH (PointCloud *, pointcloud, &bmain->pointclouds) {
-      blender::bke::pointcloud_convert_customdata_to_storage(*pointcloud);
-    }
+    version_foreach_id_parallel<PointCloud>(bmain->pointclouds, [](PointCloud &pointcloud) {
+      blender::bke::pointcloud_convert_customdata_to_storage(pointcloud);
+    });
   }
 
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 500, 3)) {
@@ -1400,9 +1402,9 @@ void blo_do_versions_500(FileData * /*fd*/, Library * /*lib*/, Main *bmain)
   }
 
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 500, 33)) {
-    LISTBASE_FOREACH (Curves *, curves, &bmain->hair_curves) {
-      blender::bke::curves_convert_customdata_to_storage(curves->geometry.wrap());
-    }
+    version_foreach_id_parallel<Curves>(bmain->hair_curves, [](Curves &curves) {
+      blender::bke::curves_convert_customdata_to_storage(curves.geometry.wrap());
+    });
     LISTBASE_FOREACH (GreasePencil *, grease_pencil, &bmain->grease_pencils) {
       blender::bke::grease_pencil_convert_customdata_to_storage(*grease_pencil);
       for (const int i : IndexRange(grease_pencil->drawing_array_num)) {
@@ -1499,6 +1501,18 @@ void blo_do_versions_500(FileData * /*fd*/, Library * /*lib*/, Main *bmain)
     FOREACH_NODETREE_END;
   }
 
+  if (!MAIN_VERSION_FILE_ATLEAST(bmain, 500, 39)) {
+    const SubsurfModifierData *smd_default = DNA_struct_default_get(SubsurfModifierData);
+    LISTBASE_FOREACH (Object *, object, &bmain->objects) {
+      LISTBASE_FOREACH (ModifierData *, md, &object->modifiers) {
+        if (md->type == eModifierType_Subsurf) {
+          SubsurfModifierData *smd = reinterpret_cast<SubsurfModifierData *>(md);
+          smd->adaptive_edge_pixels = smd_default->adaptive_edge_pixels;
+        }
+      }
+    }
+  }
+
   /**
    * Always bump subversion in BKE_blender_version.h when adding versioning
    * code here, and wrap it inside a MAIN_VERSION_FILE_ATLEAST check.
@@ -1508,7 +1522,6 @@ void blo_do_versions_500(FileData * /*fd*/, Library * /*lib*/, Main *bmain)
 
   /* Keep this versioning always enabled at the bottom of the function; it can only be moved behind
    * a subversion bump when the file format is changed. */
-  LISTBASE_FOREACH (Mesh *, mesh, &bmain->meshes) {
-    bke::mesh_freestyle_marks_to_generic(*mesh);
-  }
+  version_foreach_id_parallel<Mesh>(
+      bmain->meshes, [](Mesh &mesh) { bke::mesh_freestyle_marks_to_generic(mesh); });
 }
@@ -19,6 +19,8 @@
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_animsys.h"
 #include "BKE_grease_pencil_legacy_convert.hh"
@@ -53,6 +55,21 @@
 using blender::Map;
 using blender::StringRef;
 
+void version_foreach_id_parallel_impl(ListBase &ids, FunctionRef<void(ID &id)> fn)
+{
+  blender::Vector<ID *> ids_vector;
+  LISTBASE_FOREACH (ID *, id, &ids) {
+    ids_vector.append(id);
+  }
+  /* Each ID typically contains enough data to be worth its own task. */
+  blender::threading::parallel_for(
+      ids_vector.index_range(), 1, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          fn(*ids_vector[i]);
+        }
+      });
+}
+
 short do_versions_new_to_old_idcode_get(const short id_code_new)
 {
   switch (id_code_new) {
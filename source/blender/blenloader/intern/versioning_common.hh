@@ -74,6 +74,21 @@ ARegion *do_versions_ensure_region(ListBase *regionbase,
  */
 ID *do_versions_rename_id(Main *bmain, short id_type, const char *name_src, const char *name_dst);
 
+/**
+ * Run a versioning step on all IDs of the given list, using multiple threads.
+ *
+ * The callback must only read and modify data owned by the given ID (including its embedded IDs).
+ * It must not access other IDs or #Main, nor add, remove or rename IDs. Versioning that crosses
+ * IDs has to use a regular loop.
+ */
+void version_foreach_id_parallel_impl(ListBase &ids, FunctionRef<void(ID &id)> fn);
+
+template<typename IDType, typename Fn>
+inline void version_foreach_id_parallel(ListBase &ids, const Fn &fn)
+{
+  version_foreach_id_parallel_impl(ids, [&](ID &id) { fn(reinterpret_cast<IDType &>(id)); });
+}
+
 bool version_node_socket_is_used(bNodeSocket *sock);
 
 void version_node_socket_name(bNodeTree *ntree,
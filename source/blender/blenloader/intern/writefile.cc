@@ -54,11 +54,13 @@
  * - write #BLO_CODE_GLOB (#RenderInfo struct. 128x128 blend file preview is optional).
  * - write #BLO_CODE_GLOB (#FileGlobal struct) (some global vars).
  * - write #BLO_CODE_DNA1 (#SDNA struct)
+ * - write #BLO_CODE_INDX (index of the ID blocks, not for undo).
  * - write #BLO_CODE_USER (#UserDef struct) for file paths:
  *   - #BLENDER_STARTUP_FILE (on UNIX `~/.config/blender/X.X/config/startup.blend`).
  *   - #BLENDER_USERPREF_FILE (on UNIX `~/.config/blender/X.X/config/userpref.blend`).
  */
 
+#include <atomic>
 #include <cerrno>
 #include <climits>
 #include <cstdio>
@@ -85,28 +87,36 @@
 /* Allow writefile to use deprecated functionality (for forward compatibility code). */
 #define DNA_DEPRECATED_ALLOW
 
+#include "DNA_curves_types.h"
 #include "DNA_fileglobal_types.h"
 #include "DNA_genfile.h"
 #include "DNA_key_types.h"
+#include "DNA_mesh_types.h"
+#include "DNA_pointcloud_types.h"
 #include "DNA_print.hh"
 #include "DNA_sdna_types.h"
 #include "DNA_userdef_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_endian_defines.h"
 #include "BLI_fileops.hh"
 #include "BLI_implicit_sharing.hh"
 #include "BLI_math_base.h"
+#include "BLI_memory_counter.hh"
 #include "BLI_multi_value_map.hh"
 #include "BLI_path_utils.hh"
 #include "BLI_set.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
+#include "BLI_vector.hh"
 
 #include "MEM_guardedalloc.h" /* MEM_freeN */
 
 #include "BKE_asset.hh"
 #include "BKE_blender_version.h"
 #include "BKE_bpath.hh"
+#include "BKE_curves.hh"
 #include "BKE_global.hh" /* For #Global `G`. */
 #include "BKE_idprop.hh"
 #include "BKE_idtype.hh"
@@ -156,6 +166,14 @@
 
 #define ZSTD_COMPRESSION_LEVEL 3
 
+/** Maximum number of IDs serialized in memory at the same time when writing them in parallel. */
+#define WRITE_ID_PARALLEL_BATCH_SIZE 64
+/**
+ * Estimated size in bytes of the IDs serialized in memory at the same time when writing them in
+ * parallel. A single bigger ID is still written on its own.
+ */
+#define WRITE_ID_PARALLEL_BATCH_BYTES (int64_t(256) << 20)
+
 static CLG_LogRef LOG = {"blend.writefile"};
 
 /** Use if we want to store how many bytes have been written to the file. */
@@ -428,6 +446,14 @@ struct WriteData {
   size_t write_len;
 #endif
 
+  /** Offset of the next byte written by #mywrite, from the start of the uncompressed output. */
+  uint64_t stream_offset = 0;
+
+  /** Index of written ID blocks, stored at the end of the file (not used for undo). */
+  blender::Vector<BHeadIndexEntry> bhead_index;
+  /** Index in #bhead_index of the entry of the ID currently written, or -1. */
+  int64_t bhead_index_current = -1;
+
   /** Whether writefile code is currently writing an ID. */
   bool is_writing_id;
 
@@ -462,6 +488,12 @@ struct WriteData {
    * Will be nullptr for UNDO.
    */
   WriteWrap *ww;
+
+  /**
+   * When set, written data is appended to this buffer instead of being passed to #ww.
+   * Used to serialize IDs from worker threads, see #write_local_ids.
+   */
+  blender::Vector<uchar> *capture_dst = nullptr;
 };
 
 struct BlendWriter {
@@ -510,6 +542,9 @@ static void writedata_do_write(WriteData *wd, const void *mem, const size_t meml
   if (wd->use_memfile) {
     BLO_memfile_chunk_add(&wd->mem, static_cast<const char *>(mem), memlen);
   }
+  else if (wd->capture_dst) {
+    wd->capture_dst->extend(blender::Span(static_cast<const uchar *>(mem), int64_t(memlen)));
+  }
   else {
     if (!wd->ww->write(mem, memlen)) {
       wd->validation_data.critical_error = true;
@@ -562,6 +597,7 @@ static void mywrite(WriteData *wd, const void *adr, size_t len)
 #ifdef USE_WRITE_DATA_LEN
   wd->write_len += len;
 #endif
+  wd->stream_offset += len;
 
   if (wd->buffer.buf == nullptr) {
     writedata_do_write(wd, adr, len);
@@ -692,6 +728,7 @@ static void mywrite_id_end(WriteData *wd, ID * /*id*/)
 
   wd->validation_data.per_id_addresses_set.clear();
   wd->per_id_written_shared_addresses.clear();
+  wd->bhead_index_current = -1;
 
   BLI_assert(wd->is_writing_id == true);
   wd->is_writing_id = false;
@@ -807,6 +844,15 @@ static void writestruct_at_address_nr(WriteData *wd,
     blender::dna::print_structs_at_address(*wd->sdna, struct_nr, data, adr, nr, *wd->debug_dst);
   }
 
+  if (wd->bhead_index_current != -1 &&
+      struct_nr == blender::dna::sdna_struct_id_get<PreviewImage>())
+  {
+    BHeadIndexEntry &entry = wd->bhead_index[wd->bhead_index_current];
+    if (entry.preview_bhead_offset == 0) {
+      entry.preview_bhead_offset = wd->stream_offset;
+    }
+  }
+
   write_bhead(wd, bh);
   mywrite(wd, data, size_t(bh.len));
 }
@@ -1123,6 +1169,131 @@ static void write_id(WriteData *wd, ID *id)
   mywrite_id_end(wd, id);
 }
 
+/**
+ * Serialize an ID into \a r_buffer, in the exact same way as #write_id would write it to a file.
+ * \return False on critical error.
+ */
+static bool write_id_to_buffer(ID *id,
+                               blender::Vector<uchar> &r_buffer,
+                               blender::Vector<BHeadIndexEntry> &r_bhead_index)
+{
+  WriteData *wd = writedata_new(nullptr);
+  wd->capture_dst = &r_buffer;
+  write_id(wd, id);
+  mywrite_flush(wd);
+  r_bhead_index = std::move(wd->bhead_index);
+  const bool success = !wd->validation_data.critical_error;
+  writedata_free(wd);
+  return success;
+}
+
+/**
+ * Rough estimate of the size of the serialized ID, used to bound the memory used by the buffers
+ * when writing IDs in parallel.
+ */
+static int64_t write_id_size_estimate(const ID *id)
+{
+  const IDTypeInfo *id_type = BKE_idtype_get_info_from_id(id);
+  blender::MemoryCount count;
+  blender::MemoryCounter memory{count};
+  switch (GS(id->name)) {
+    case ID_ME:
+      reinterpret_cast<const Mesh *>(id)->count_memory(memory);
+      break;
+    case ID_CV:
+      reinterpret_cast<const Curves *>(id)->geometry.wrap().count_memory(memory);
+      break;
+    case ID_PT:
+      reinterpret_cast<const PointCloud *>(id)->count_memory(memory);
+      break;
+    default:
+      break;
+  }
+  return int64_t(id_type->struct_size) + count.total_bytes;
+}
+
+static bool write_id_is_threadsafe(const ID *id)
+{
+  const IDTypeInfo *id_type = BKE_idtype_get_info_from_id(id);
+  return (id_type->flags & IDTYPE_FLAGS_BLEND_WRITE_THREADSAFE) != 0;
+}
+
+/**
+ * Write the given local IDs in order.
+ *
+ * When saving to a file, consecutive IDs whose type supports it are serialized in parallel into
+ * separate buffers, which are then written in the original order. This keeps the file content
+ * independent of the number of threads.
+ */
+static void write_local_ids(WriteData *wd, const blender::Span<ID *> ids)
+{
+  const bool use_threads = !wd->use_memfile && wd->debug_dst == nullptr &&
+                           BLI_system_thread_count() > 1;
+  if (!use_threads) {
+    for (ID *id : ids) {
+      write_id(wd, id);
+    }
+    return;
+  }
+
+  blender::Vector<ID *> batch;
+  int64_t batch_bytes = 0;
+  blender::Array<blender::Vector<uchar>> buffers(WRITE_ID_PARALLEL_BATCH_SIZE);
+  blender::Array<blender::Vector<BHeadIndexEntry>> bhead_indices(WRITE_ID_PARALLEL_BATCH_SIZE);
+
+  auto write_batch = [&]() {
+    if (batch.is_empty()) {
+      return;
+    }
+    std::atomic<bool> success = true;
+    blender::threading::parallel_for(batch.index_range(), 1, [&](const blender::IndexRange range) {
+      for (const int64_t i : range) {
+        if (!write_id_to_buffer(batch[i], buffers[i], bhead_indices[i])) {
+          success = false;
+        }
+      }
+    });
+    if (!success) {
+      wd->validation_data.critical_error = true;
+    }
+    for (const int64_t i : batch.index_range()) {
+      for (BHeadIndexEntry &entry : bhead_indices[i]) {
+        entry.bhead_offset += wd->stream_offset;
+        if (entry.preview_bhead_offset != 0) {
+          entry.preview_bhead_offset += wd->stream_offset;
+        }
+        wd->bhead_index.append(entry);
+      }
+      bhead_indices[i].clear();
+      if (!buffers[i].is_empty()) {
+        mywrite(wd, buffers[i].data(), size_t(buffers[i].size()));
+      }
+      buffers[i].clear_and_shrink();
+    }
+    batch.clear();
+    batch_bytes = 0;
+  };
+
+  for (ID *id : ids) {
+    if (!write_id_is_threadsafe(id)) {
+      write_batch();
+      write_id(wd, id);
+      continue;
+    }
+    /* Bound the memory used by the serialized buffers of a batch. */
+    const int64_t id_bytes = write_id_size_estimate(id);
+    if (batch_bytes + id_bytes > WRITE_ID_PARALLEL_BATCH_BYTES) {
+      write_batch();
+    }
+    batch.append(id);
+    batch_bytes += id_bytes;
+    if (batch.size() == WRITE_ID_PARALLEL_BATCH_SIZE) {
+      write_batch();
+    }
+  }
+  write_batch();
+}
+
 /** Keep it last of `write_*_data` functions. */
 static void write_libraries(WriteData *wd, Main *bmain)
 {
@@ -1358,6 +1529,35 @@ static int write_id_direct_linked_data_process_cb(LibraryIDLinkCallbackData *cb_
   return IDWALK_RET_NOP;
 }
 
+/**
+ * Write the index of ID blocks, directly before the end block, see #BHeadIndexEntry.
+ */
+static void write_bhead_index(WriteData *wd)
+{
+  const size_t entries_size = size_t(wd->bhead_index.size()) * sizeof(BHeadIndexEntry);
+  const size_t len = entries_size + sizeof(BHeadIndexFooter);
+  if (len > INT_MAX) {
+    /* Too big for #SmallBHead8, the index is optional so just skip it. */
+    return;
+  }
+
+  BHead bh;
+  bh.code = BLO_CODE_INDX;
+  bh.old = wd->bhead_index.data();
+  bh.nr = 1;
+  bh.SDNAnr = SDNA_RAW_DATA_STRUCT_INDEX;
+  bh.len = int64_t(len);
+  write_bhead(wd, bh);
+
+  if (entries_size > 0) {
+    mywrite(wd, wd->bhead_index.data(), entries_size);
+  }
+  BHeadIndexFooter footer{};
+  footer.entries_num = uint64_t(wd->bhead_index.size());
+  memcpy(footer.magic, BHEAD_INDEX_MAGIC, sizeof(footer.magic));
+  mywrite(wd, &footer, sizeof(footer));
+}
+
 static std::string get_blend_file_header()
 {
   if (SYSTEM_SUPPORTS_WRITING_FILE_VERSION_1 &&
@@ -1564,9 +1764,7 @@ static bool write_file_handle(Main *mainvar,
   }
 
   /* Actually write local data-blocks to the file. */
-  for (ID *id : local_ids_to_write) {
-    write_id(wd, id);
-  }
+  write_local_ids(wd, local_ids_to_write);
 
   /* Write libraries about libraries and linked data-blocks. */
   write_libraries(wd, mainvar);
@@ -1584,6 +1782,10 @@ static bool write_file_handle(Main *mainvar,
    * so writing each time uses the same address and doesn't cause unnecessary undo overhead. */
   writedata(wd, BLO_CODE_DNA1, size_t(wd->sdna->data_size), wd->sdna->data);
 
+  if (!wd->use_memfile) {
+    write_bhead_index(wd);
+  }
+
   /* End of file. */
   BHead bhead{};
   bhead.code = BLO_CODE_ENDB;
@@ -1967,7 +2169,17 @@ void blo_write_id_struct(BlendWriter *writer,
                          const void *id_address,
                          const ID *id)
 {
-  writestruct_at_address_nr(writer->wd, GS(id->name), struct_id, 1, id_address, id);
+  WriteData *wd = writer->wd;
+  if (!wd->use_memfile && wd->is_writing_id) {
+    BHeadIndexEntry entry{};
+    entry.bhead_offset = wd->stream_offset;
+    entry.code = GS(id->name);
+    entry.flag = id->asset_data ? BHEAD_INDEX_ENTRY_IS_ASSET : 0;
+    static_assert(sizeof(entry.name) >= MAX_ID_NAME);
+    STRNCPY(entry.name, id->name);
+    wd->bhead_index_current = wd->bhead_index.append_and_get_index(entry);
+  }
+  writestruct_at_address_nr(wd, GS(id->name), struct_id, 1, id_address, id);
 }
 
 int BLO_get_struct_id_by_name(const BlendWriter *writer, const char *struct_name)
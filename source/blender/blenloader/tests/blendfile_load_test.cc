@@ -3,7 +3,20 @@
  * SPDX-License-Identifier: GPL-2.0-or-later */
 #include "blendfile_loading_base_test.h"
 
+#include <string>
+
+#include "BKE_appdir.hh"
+
+#include "BLI_fileops.h"
 #include "BLI_path_utils.hh"
+#include "BLI_set.hh"
+
+#include "BLO_readfile.hh"
+#include "BLO_writefile.hh"
+
+#include "DNA_ID_enums.h"
+
+#include "intern/readfile.hh"
 
 class BlendfileLoadingTest : public BlendfileLoadingBaseTest {};
 
@@ -16,3 +29,54 @@ TEST_F(BlendfileLoadingTest, CanaryTest)
   depsgraph_create(DAG_EVAL_RENDER);
   EXPECT_NE(nullptr, this->depsgraph);
 }
+
+TEST_F(BlendfileLoadingTest, BHeadIndexRoundTrip)
+{
+  if (!blendfile_load("modifier_stack" SEP_STR "array_test.blend")) {
+    return;
+  }
+
+  BKE_tempdir_init(nullptr);
+  char filepath[FILE_MAX];
+  BLI_path_join(filepath, sizeof(filepath), BKE_tempdir_base(), "bhead_index_test.blend");
+
+  BlendFileWriteParams params{};
+  params.remap_mode = BLO_WRITE_PATH_REMAP_NONE;
+  ASSERT_TRUE(BLO_write_file(this->bfile->main, filepath, 0, &params, nullptr));
+
+  BlendFileReadReport bf_reports{};
+  BlendHandle *bh = BLO_blendhandle_from_file(filepath, &bf_reports);
+  ASSERT_NE(nullptr, bh);
+  FileData *fd = reinterpret_cast<FileData *>(bh);
+
+  /* Walk over all blocks like readers that don't know about the index do: the index block has to
+   * be skipped like any other block, and the end block has to be the last one. */
+  blender::Set<std::string> scanned_names;
+  int index_blocks_num = 0;
+  int last_code = 0;
+  for (BHead *bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
+    if (bhead->code == BLO_CODE_INDX) {
+      index_blocks_num++;
+    }
+    else if (bhead->code == ID_OB) {
+      scanned_names.add(blo_bhead_id_name(fd, bhead));
+    }
+    last_code = bhead->code;
+  }
+  EXPECT_EQ(BLO_CODE_ENDB, last_code);
+  EXPECT_EQ(1, index_blocks_num);
+
+  const blender::Vector<BHeadIndexEntry> *index = blo_bhead_index_get(fd);
+  ASSERT_NE(nullptr, index);
+  blender::Set<std::string> index_names;
+  for (const BHeadIndexEntry &entry : *index) {
+    if (entry.code == ID_OB) {
+      index_names.add(entry.name);
+    }
+  }
+  EXPECT_FALSE(index_names.is_empty());
+  EXPECT_EQ(scanned_names, index_names);
+
+  BLO_blendhandle_close(bh);
+  BLI_delete(filepath, false, false);
+}
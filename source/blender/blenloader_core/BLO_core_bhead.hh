@@ -8,6 +8,7 @@
 
 #include "BLI_endian_switch.h"
 #include "BLI_sys_types.h"
+#include "BLI_vector.hh"
 
 struct FileReader;
 
@@ -99,12 +100,68 @@ enum {
    * (written to #BLENDER_STARTUP_FILE & #BLENDER_USERPREF_FILE).
    */
   BLO_CODE_USER = BLEND_MAKE_ID('U', 'S', 'E', 'R'),
+  /**
+   * Index of the ID blocks of the file, see #BHeadIndexEntry.
+   * (ignored for regular file reading).
+   */
+  BLO_CODE_INDX = BLEND_MAKE_ID('I', 'N', 'D', 'X'),
   /**
    * Terminate reading (no data).
    */
   BLO_CODE_ENDB = BLEND_MAKE_ID('E', 'N', 'D', 'B'),
 };
 
+/**
+ * Entry of the optional index of ID blocks that is stored in a #BLO_CODE_INDX block, directly
+ * before the #BLO_CODE_ENDB block. It allows listing the IDs of a file (as done by the asset
+ * browser) without parsing all of its blocks.
+ *
+ * The data of the block is made of #BHeadIndexFooter.entries_num entries, followed by the
+ * #BHeadIndexFooter, so that it can be found from the end of the file. Offsets are positions in
+ * the uncompressed file. Readers that don't know about the index skip the block like any other
+ * unknown block.
+ */
+struct BHeadIndexEntry {
+  /** Offset of the #BHead of the ID block. */
+  uint64_t bhead_offset;
+  /** Offset of the #BHead of the ID's #PreviewImage, zero if it has none. */
+  uint64_t preview_bhead_offset;
+  /** ID code, same as the #BHead.code of the ID block. */
+  int32_t code;
+  /** #eBHeadIndexEntryFlag. */
+  int32_t flag;
+  /**
+   * Full ID name (including the ID code prefix), null-terminated.
+   * Sized as #MAX_ID_NAME rounded up so that the struct has no padding.
+   */
+  char name[264];
+};
+BLI_STATIC_ASSERT(sizeof(BHeadIndexEntry) == 288, "BHeadIndexEntry must not have padding")
+
+enum eBHeadIndexEntryFlag {
+  /** The ID has asset meta-data. */
+  BHEAD_INDEX_ENTRY_IS_ASSET = 1 << 0,
+};
+
+#define BHEAD_INDEX_MAGIC "BLENDIDX"
+
+struct BHeadIndexFooter {
+  /** Number of #BHeadIndexEntry stored before the footer. */
+  uint64_t entries_num;
+  /** Always #BHEAD_INDEX_MAGIC (without null terminator). */
+  char magic[8];
+};
+
+/**
+ * Read the index of ID blocks from the #BLO_CODE_INDX block at the end of the file (see
+ * #BHeadIndexEntry). The read position of the file is restored afterwards.
+ *
+ * \return #std::nullopt if the file cannot seek, has no index, or if the index does not match
+ * the content of the file.
+ */
+std::optional<blender::Vector<BHeadIndexEntry>> BLO_readfile_read_bhead_index(FileReader *file,
+                                                                            BHeadType type);
+
 /**
  * Parse the next #BHead in the file, increasing the file reader to after the #BHead.
  * This automatically converts the stored BHead (one of #BHeadType) to the runtime #BHead type.
@@ -2,6 +2,8 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <cstring>
+
 #include "BLI_filereader.h"
 
 #include "BLO_core_bhead.hh"
@@ -85,3 +87,88 @@ std::optional<BHead> BLO_readfile_read_bhead(FileReader *file, const BHeadType t
   }
   return std::nullopt;
 }
+
+static int64_t bhead_size_on_disk(const BHeadType type)
+{
+  switch (type) {
+    case BHeadType::BHead4:
+      return sizeof(BHead4);
+    case BHeadType::SmallBHead8:
+      return sizeof(SmallBHead8);
+    case BHeadType::LargeBHead8:
+      return sizeof(LargeBHead8);
+  }
+  return 0;
+}
+
+static std::optional<blender::Vector<BHeadIndexEntry>> read_bhead_index(FileReader *file,
+                                                                        const BHeadType type)
+{
+  const int64_t bhead_size = bhead_size_on_disk(type);
+
+  /* The footer ends the data of the index block, which is directly followed by the end block. */
+  const off64_t footer_offset = file->seek(
+      file, -off64_t(sizeof(BHeadIndexFooter) + bhead_size), SEEK_END);
+  if (footer_offset < 0) {
+    return std::nullopt;
+  }
+  BHeadIndexFooter footer;
+  if (file->read(file, &footer, sizeof(footer)) != sizeof(footer)) {
+    return std::nullopt;
+  }
+  if (memcmp(footer.magic, BHEAD_INDEX_MAGIC, sizeof(footer.magic)) != 0) {
+    return std::nullopt;
+  }
+  const std::optional<BHead> endb = BLO_readfile_read_bhead(file, type);
+  if (!endb.has_value() || endb->code != BLO_CODE_ENDB) {
+    return std::nullopt;
+  }
+  if (footer.entries_num > uint64_t(footer_offset) / sizeof(BHeadIndexEntry)) {
+    return std::nullopt;
+  }
+  const int64_t entries_size = int64_t(footer.entries_num * sizeof(BHeadIndexEntry));
+  const off64_t index_bhead_offset = footer_offset - entries_size - bhead_size;
+  if (index_bhead_offset < 0) {
+    return std::nullopt;
+  }
+
+  /* Check that the footer actually belongs to an index block, otherwise the file has been
+   * modified by some other tool and the offsets cannot be trusted. */
+  if (file->seek(file, index_bhead_offset, SEEK_SET) == -1) {
+    return std::nullopt;
+  }
+  const std::optional<BHead> index_bhead = BLO_readfile_read_bhead(file, type);
+  if (!index_bhead.has_value() || index_bhead->code != BLO_CODE_INDX ||
+      index_bhead->len != entries_size + int64_t(sizeof(BHeadIndexFooter)))
+  {
+    return std::nullopt;
+  }
+
+  blender::Vector<BHeadIndexEntry> entries(int64_t(footer.entries_num));
+  if (file->read(file, entries.data(), size_t(entries_size)) != entries_size) {
+    return std::nullopt;
+  }
+  for (const BHeadIndexEntry &entry : entries) {
+    if (entry.bhead_offset >= uint64_t(index_bhead_offset) ||
+        entry.preview_bhead_offset >= uint64_t(index_bhead_offset) ||
+        !memchr(entry.name, '\0', sizeof(entry.name)))
+    {
+      return std::nullopt;
+    }
+  }
+  return entries;
+}
+
+std::optional<blender::Vector<BHeadIndexEntry>> BLO_readfile_read_bhead_index(FileReader *file,
+                                                                            const BHeadType type)
+{
+  if (file->seek == nullptr) {
+    return std::nullopt;
+  }
+  const off64_t offset_backup = file->offset;
+  std::optional<blender::Vector<BHeadIndexEntry>> entries = read_bhead_index(file, type);
+  if (file->seek(file, offset_backup, SEEK_SET) == -1) {
+    return std::nullopt;
+  }
+  return entries;
+}
@@ -14,6 +14,7 @@
 
 #include "GPU_shader.hh"
 
+#include "COM_cpu_buffer_pool.hh"
 #include "COM_domain.hh"
 #include "COM_meta_data.hh"
 #include "COM_profiler.hh"
@@ -40,12 +41,15 @@ ENUM_OPERATORS(OutputTypes, OutputTypes::Previews)
  * necessary data and functionalities for the correct operation of the evaluator. This includes
  * providing input data like render passes and the active scene, as well as references to the data
  * where the output of the evaluator will be written. Finally, the class have an instance of a
- * static resource manager for acquiring cached resources efficiently. */
+ * static resource manager for acquiring cached resources efficiently and a pool of CPU buffers for
+ * the results of the evaluation. */
 class Context {
  private:
   /* A static cache manager that can be used to acquire cached resources for the compositor
    * efficiently. */
   StaticCacheManager cache_manager_;
+  /* A pool of CPU buffers that pooled results allocated on the CPU acquire their data from. */
+  CPUBufferPool cpu_buffer_pool_;
 
  public:
   /* Get the compositing scene. */
@@ -167,6 +171,9 @@ class Context {
 
   /* Get a reference to the static cache manager of this context. */
   StaticCacheManager &cache_manager();
+
+  /* Get a reference to the CPU buffer pool of this context. */
+  CPUBufferPool &cpu_buffer_pool();
 };
 
 }  // namespace blender::compositor
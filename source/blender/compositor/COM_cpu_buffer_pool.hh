@@ -0,0 +1,69 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+#include <cstdint>
+
+#include "BLI_mutex.hh"
+#include "BLI_vector.hh"
+
+namespace blender::compositor {
+
+/* -------------------------------------------------------------------------------------------------
+ * CPU Buffer Pool
+ *
+ * A pool of CPU buffers that can be reused by results allocated from the pool, analogous to the
+ * GPU texture pool used for GPU results. When a pooled result is freed, its buffer is released
+ * back into the pool instead of being freed, so that later results of the same size can reuse it
+ * without allocating and page faulting large images again.
+ *
+ * Buffers that were not reused since the previous evaluation are freed when the pool is reset,
+ * which happens before every evaluation. Since buffers are only reused for an exact size match,
+ * released buffers can also pile up within a single evaluation, for instance when many results of
+ * different sizes are computed. So the total size of the unused buffers is limited to a budget,
+ * and the buffers that were released the longest time ago are freed when it is exceeded. */
+class CPUBufferPool {
+ public:
+  /* The default maximum total size in bytes of the buffers kept for reuse. */
+  static constexpr int64_t default_max_unused_bytes = int64_t(1) << 30;
+
+ private:
+  struct Buffer {
+    void *data;
+    int64_t size;
+    int64_t alignment;
+    /* Counts the number of reset() calls since the buffer was last released. */
+    int unused_cycles;
+  };
+
+  /* Buffers ready to be reused, ordered from the least to the most recently released. */
+  Vector<Buffer> pool_;
+  /* The total size in bytes of the buffers in the pool. */
+  int64_t unused_bytes_ = 0;
+  /* The maximum total size in bytes of the buffers in the pool. */
+  int64_t max_unused_bytes_;
+  /* Results might be allocated and freed from multiple threads. */
+  Mutex mutex_;
+
+ public:
+  CPUBufferPool(int64_t max_unused_bytes = default_max_unused_bytes);
+  ~CPUBufferPool();
+
+  /* Acquire an uninitialized buffer of the given size in bytes and alignment, reusing a released
+   * buffer if one with the same size and alignment exists. */
+  void *acquire(int64_t size, int64_t alignment);
+
+  /* Release a buffer acquired from the pool with the given size and alignment so that it can be
+   * reused. Frees the least recently released buffers if the pool exceeds its budget. */
+  void release(void *data, int64_t size, int64_t alignment);
+
+  /* Free the buffers that were not reused since the previous reset. */
+  void reset();
+
+  /* The total size in bytes of the buffers that are currently kept for reuse. */
+  int64_t unused_bytes();
+};
+
+}  // namespace blender::compositor
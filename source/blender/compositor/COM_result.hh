@@ -139,9 +139,9 @@ class Result {
    * This is set up by a call to the wrap_external method. In that case, when the reference count
    * eventually reach zero, the data will not be freed. */
   bool is_external_ = false;
-  /* If true, the GPU texture that holds the data was allocated from the texture pool of the
-   * context and should be released back into the pool instead of being freed. For CPU storage,
-   * this is irrelevant. */
+  /* If true, the GPU texture or CPU buffer that holds the data was allocated from the texture
+   * pool or the CPU buffer pool of the context and should be released back into the pool instead
+   * of being freed. */
   bool is_from_pool_ = false;
   /* Stores resources that are derived from this result. Lazily allocated if needed. See the class
    * description for more information. */
@@ -453,11 +453,11 @@ class Result {
    * passed to storage_type, in which case, the data will be allocated on the device of the
    * result's context as specified by context.use_gpu().
    *
-   * If from_pool is true, GPU textures will be allocated from the texture pool of the context,
-   * otherwise, a new texture will be allocated. Pooling should not be used for persistent results
-   * that might span more than one evaluation, like cached resources. While pooling should be used
-   * for most other cases where the result will be allocated then later released in the same
-   * evaluation. */
+   * If from_pool is true, GPU textures will be allocated from the texture pool of the context and
+   * CPU buffers from the CPU buffer pool of the context, otherwise, new data will be allocated.
+   * Pooling should not be used for persistent results that might span more than one evaluation,
+   * like cached resources. While pooling should be used for most other cases where the result
+   * will be allocated then later released in the same evaluation. */
   void allocate_data(const int2 size,
                      const bool from_pool = true,
                      const std::optional<ResultStorageType> storage_type = std::nullopt);
@@ -3,7 +3,11 @@
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
 #include "BLI_assert.h"
+#include "BLI_index_range.hh"
+#include "BLI_math_base.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "GPU_shader.hh"
 
@@ -23,26 +27,42 @@ static void blur_pass(const Result &input, const Result &weights, Result &output
   /* Notice that the size is transposed, see the note on the horizontal pass method for more
    * information on the reasoning behind this. */
   const int2 size = int2(output.domain().size.y, output.domain().size.x);
-  parallel_for(size, [&](const int2 texel) {
-    T accumulated_color = T(0);
-
-    /* First, compute the contribution of the center pixel. */
-    T center_color = input.load_pixel_extended<T>(texel);
-    accumulated_color += center_color * weights.load_pixel<float>(int2(0));
-
-    /* Then, compute the contributions of the pixel to the right and left, noting that the
-     * weights texture only stores the weights for the positive half, but since the filter is
-     * symmetric, the same weight is used for the negative half and we add both of their
-     * contributions. */
-    for (int i = 1; i < weights.domain().size.x; i++) {
-      float weight = weights.load_pixel<float>(int2(i, 0));
-      accumulated_color += input.load_pixel_extended<T>(texel + int2(i, 0)) * weight;
-      accumulated_color += input.load_pixel_extended<T>(texel + int2(-i, 0)) * weight;
+  const Span<T> input_pixels = input.cpu_data().typed<T>();
+  const Span<float> weights_values = weights.cpu_data().typed<float>();
+  const int radius = int(weights_values.size()) - 1;
+
+  threading::parallel_for(IndexRange(size.y), 1, [&](const IndexRange sub_y_range) {
+    for (const int64_t y : sub_y_range) {
+      const Span<T> row = input_pixels.slice(y * size.x, size.x);
+      for (const int x : IndexRange(size.x)) {
+        /* First, compute the contribution of the center pixel. */
+        T accumulated_color = row[x] * weights_values[0];
+
+        /* Then, compute the contributions of the pixel to the right and left, noting that the
+         * weights texture only stores the weights for the positive half, but since the filter is
+         * symmetric, the same weight is used for the negative half and we add both of their
+         * contributions. Pixels whose whole window is inside the row are accumulated without
+         * clamping, which is most pixels for radii that are small relative to the image. */
+        if (x >= radius && x + radius < size.x) {
+          for (int i = 1; i <= radius; i++) {
+            const float weight = weights_values[i];
+            accumulated_color += row[x + i] * weight;
+            accumulated_color += row[x - i] * weight;
+          }
+        }
+        else {
+          for (int i = 1; i <= radius; i++) {
+            const float weight = weights_values[i];
+            accumulated_color += row[math::min(x + i, size.x - 1)] * weight;
+            accumulated_color += row[math::max(x - i, 0)] * weight;
+          }
+        }
+
+        /* Write the color using the transposed texel. See the horizontal_pass method for more
+         * information on the rational behind this. */
+        output.store_pixel(int2(y, x), accumulated_color);
+      }
     }
-
-    /* Write the color using the transposed texel. See the horizontal_pass method for more
-     * information on the rational behind this. */
-    output.store_pixel(int2(texel.y, texel.x), accumulated_color);
   });
 }
 
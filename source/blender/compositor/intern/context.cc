@@ -14,6 +14,7 @@
 #include "BKE_node_runtime.hh"
 
 #include "COM_context.hh"
+#include "COM_cpu_buffer_pool.hh"
 #include "COM_profiler.hh"
 #include "COM_render_context.hh"
 #include "COM_static_cache_manager.hh"
@@ -55,6 +56,7 @@ bool Context::is_canceled() const
 void Context::reset()
 {
   cache_manager_.reset();
+  cpu_buffer_pool_.reset();
 }
 
 int2 Context::get_compositing_region_size() const
@@ -116,4 +118,9 @@ StaticCacheManager &Context::cache_manager()
   return cache_manager_;
 }
 
+CPUBufferPool &Context::cpu_buffer_pool()
+{
+  return cpu_buffer_pool_;
+}
+
 }  // namespace blender::compositor
@@ -0,0 +1,89 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include <mutex>
+
+#include "MEM_guardedalloc.h"
+
+#include "COM_cpu_buffer_pool.hh"
+
+namespace blender::compositor {
+
+CPUBufferPool::CPUBufferPool(const int64_t max_unused_bytes) : max_unused_bytes_(max_unused_bytes)
+{
+}
+
+CPUBufferPool::~CPUBufferPool()
+{
+  for (const Buffer &buffer : pool_) {
+    MEM_freeN(buffer.data);
+  }
+}
+
+void *CPUBufferPool::acquire(const int64_t size, const int64_t alignment)
+{
+  {
+    std::scoped_lock lock(mutex_);
+    /* Prefer the most recently released buffers, which are more likely to still be cached. */
+    for (int64_t i = pool_.size() - 1; i >= 0; i--) {
+      const Buffer &buffer = pool_[i];
+      if (buffer.size == size && buffer.alignment == alignment) {
+        void *data = buffer.data;
+        unused_bytes_ -= size;
+        pool_.remove(i);
+        return data;
+      }
+    }
+  }
+
+  return MEM_mallocN_aligned(size, alignment, __func__);
+}
+
+void CPUBufferPool::release(void *data, const int64_t size, const int64_t alignment)
+{
+  if (size > max_unused_bytes_) {
+    MEM_freeN(data);
+    return;
+  }
+
+  std::scoped_lock lock(mutex_);
+  pool_.append({data, size, alignment, 0});
+  unused_bytes_ += size;
+
+  int64_t evicted_num = 0;
+  while (unused_bytes_ > max_unused_bytes_) {
+    const Buffer &buffer = pool_[evicted_num];
+    MEM_freeN(buffer.data);
+    unused_bytes_ -= buffer.size;
+    evicted_num++;
+  }
+  pool_.remove(0, evicted_num);
+}
+
+void CPUBufferPool::reset()
+{
+  std::scoped_lock lock(mutex_);
+  /* Compact the remaining buffers in place to keep them in the order they were released. */
+  int64_t kept_num = 0;
+  for (const int64_t i : pool_.index_range()) {
+    Buffer &buffer = pool_[i];
+    if (buffer.unused_cycles >= 1) {
+      MEM_freeN(buffer.data);
+      unused_bytes_ -= buffer.size;
+    }
+    else {
+      buffer.unused_cycles++;
+      pool_[kept_num++] = buffer;
+    }
+  }
+  pool_.resize(kept_num);
+}
+
+int64_t CPUBufferPool::unused_bytes()
+{
+  std::scoped_lock lock(mutex_);
+  return unused_bytes_;
+}
+
+}  // namespace blender::compositor
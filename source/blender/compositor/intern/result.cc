@@ -660,7 +660,14 @@ void Result::free()
       gpu_texture_ = nullptr;
       break;
     case ResultStorageType::CPU:
-      MEM_freeN(this->cpu_data().data());
+      if (is_from_pool_) {
+        const CPPType &cpp_type = this->cpu_data().type();
+        context_->cpu_buffer_pool().release(
+            this->cpu_data().data(), this->cpu_data().size_in_bytes(), cpp_type.alignment);
+      }
+      else {
+        MEM_freeN(this->cpu_data().data());
+      }
       cpu_data_ = GMutableSpan();
       break;
   }
@@ -802,6 +809,7 @@ void Result::allocate_data(const int2 size,
   }
   else {
     storage_type_ = ResultStorageType::CPU;
+    is_from_pool_ = from_pool;
 
     const CPPType &cpp_type = this->get_cpp_type();
     const int64_t item_size = cpp_type.size;
@@ -809,7 +817,8 @@ void Result::allocate_data(const int2 size,
     const int64_t array_size = int64_t(size.x) * int64_t(size.y);
     const int64_t memory_size = array_size * item_size;
 
-    void *data = MEM_mallocN_aligned(memory_size, alignment, AT);
+    void *data = from_pool ? context_->cpu_buffer_pool().acquire(memory_size, alignment) :
+                             MEM_mallocN_aligned(memory_size, alignment, AT);
     cpp_type.default_construct_n(data, array_size);
 
     cpu_data_ = GMutableSpan(cpp_type, data, array_size);
@@ -0,0 +1,81 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "testing/testing.h"
+
+#include "COM_cpu_buffer_pool.hh"
+
+namespace blender::compositor::tests {
+
+TEST(cpu_buffer_pool, ReuseSameSize)
+{
+  CPUBufferPool pool;
+  void *a = pool.acquire(1024, 16);
+  pool.release(a, 1024, 16);
+  EXPECT_EQ(pool.unused_bytes(), 1024);
+
+  /* A different alignment can not reuse the buffer. */
+  void *b = pool.acquire(1024, 64);
+  EXPECT_NE(a, b);
+  EXPECT_EQ(pool.unused_bytes(), 1024);
+
+  void *c = pool.acquire(1024, 16);
+  EXPECT_EQ(a, c);
+  EXPECT_EQ(pool.unused_bytes(), 0);
+
+  pool.release(b, 1024, 64);
+  pool.release(c, 1024, 16);
+}
+
+TEST(cpu_buffer_pool, ReleaseOverBudget)
+{
+  CPUBufferPool pool(4096);
+  void *a = pool.acquire(1024, 16);
+  void *b = pool.acquire(2048, 16);
+  void *c = pool.acquire(2048, 16);
+  pool.release(a, 1024, 16);
+  pool.release(b, 2048, 16);
+  EXPECT_EQ(pool.unused_bytes(), 3072);
+
+  /* The least recently released buffer is freed to stay within the budget. */
+  pool.release(c, 2048, 16);
+  EXPECT_EQ(pool.unused_bytes(), 4096);
+
+  /* The most recently released buffer is reused first. */
+  void *d = pool.acquire(2048, 16);
+  EXPECT_EQ(d, c);
+  EXPECT_EQ(pool.unused_bytes(), 2048);
+
+  /* Buffers larger than the budget are never kept. */
+  void *e = pool.acquire(8192, 16);
+  pool.release(e, 8192, 16);
+  EXPECT_EQ(pool.unused_bytes(), 2048);
+
+  pool.release(d, 2048, 16);
+}
+
+TEST(cpu_buffer_pool, Reset)
+{
+  CPUBufferPool pool;
+  void *a = pool.acquire(1024, 16);
+  void *b = pool.acquire(2048, 16);
+  pool.release(a, 1024, 16);
+  pool.release(b, 2048, 16);
+
+  /* Buffers are kept for one evaluation. */
+  pool.reset();
+  EXPECT_EQ(pool.unused_bytes(), 3072);
+
+  a = pool.acquire(1024, 16);
+  pool.release(a, 1024, 16);
+
+  /* The buffer that was not reused in the previous evaluation is freed. */
+  pool.reset();
+  EXPECT_EQ(pool.unused_bytes(), 1024);
+
+  pool.reset();
+  EXPECT_EQ(pool.unused_bytes(), 0);
+}
+
+}  // namespace blender::compositor::tests
@@ -53,6 +53,22 @@ void DEG_debug_stats_gnuplot(const Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/**
+ * Start or stop recording the evaluation timeline: which thread evaluated which operation and
+ * when. Stopping discards everything that was recorded.
+ */
+void DEG_debug_timeline_enable(Depsgraph *graph, bool enable);
+
+/** Whether the evaluation timeline is currently being recorded. */
+bool DEG_debug_timeline_is_enabled(const Depsgraph *graph);
+
+/**
+ * Write all evaluations recorded since the timeline was enabled, in the Chrome trace event JSON
+ * format that can be loaded in Perfetto.
+ * \return False if the timeline is not being recorded.
+ */
+bool DEG_debug_timeline_write_chrome_trace(const Depsgraph *graph, FILE *fp);
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
@@ -10,6 +10,10 @@
 
 #include "DNA_anim_types.h"
 
+#include "BLI_enumerable_thread_specific.hh"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
+
 #include "BKE_anim_data.hh"
 
 #include "RNA_access.hh"
@@ -63,6 +67,15 @@ uint64_t AnimatedPropertyID::hash() const
 AnimatedPropertyStorage::AnimatedPropertyStorage() : is_fully_initialized(false) {}
 
 void AnimatedPropertyStorage::initializeFromID(DepsgraphBuilderCache *builder_cache, const ID *id)
+{
+  initializeFromID(id, [&](const ID *owner_id, const AnimatedPropertyID &property_id) {
+    builder_cache->ensureAnimatedPropertyStorage(owner_id)->tagPropertyAsAnimated(property_id);
+  });
+}
+
+void AnimatedPropertyStorage::initializeFromID(
+    const ID *id,
+    FunctionRef<void(const ID *owner_id, const AnimatedPropertyID &property_id)> tag_other_id)
 {
   PointerRNA own_pointer_rna = RNA_id_pointer_create(const_cast<ID *>(id));
   BKE_fcurves_id_cb(const_cast<ID *>(id), [&](ID * /*id*/, FCurve *fcurve) {
@@ -77,15 +90,16 @@ void AnimatedPropertyStorage::initializeFromID(DepsgraphBuilderCache *builder_ca
     {
       return;
     }
-    /* Get storage for the ID.
-     * This is needed to deal with cases when nested datablock is animated by its parent. */
-    AnimatedPropertyStorage *animated_property_storage = this;
+    /* Set the property as animated.
+     * Storage of other IDs is needed to deal with cases when nested datablock is animated by its
+     * parent. */
+    const AnimatedPropertyID property_id(&pointer_rna, property_rna);
     if (pointer_rna.owner_id != own_pointer_rna.owner_id) {
-      animated_property_storage = builder_cache->ensureAnimatedPropertyStorage(
-          pointer_rna.owner_id);
+      tag_other_id(pointer_rna.owner_id, property_id);
+    }
+    else {
+      tagPropertyAsAnimated(property_id);
     }
-    /* Set the property as animated. */
-    animated_property_storage->tagPropertyAsAnimated(&pointer_rna, property_rna);
   });
 }
 
@@ -145,4 +159,45 @@ AnimatedPropertyStorage *DepsgraphBuilderCache::ensureInitializedAnimatedPropert
   return animated_property_storage;
 }
 
+void DepsgraphBuilderCache::ensureInitializedAnimatedPropertyStorages(Span<const ID *> ids)
+{
+  /* Create all storages up-front, the map is not modified from the threads. IDs without animation
+   * data have nothing to resolve. */
+  Vector<std::pair<const ID *, AnimatedPropertyStorage *>> storages_to_initialize;
+  for (const ID *id : ids) {
+    AnimatedPropertyStorage *animated_property_storage = ensureAnimatedPropertyStorage(id);
+    if (animated_property_storage->is_fully_initialized) {
+      continue;
+    }
+    if (BKE_animdata_from_id(id) == nullptr) {
+      animated_property_storage->is_fully_initialized = true;
+      continue;
+    }
+    storages_to_initialize.append({id, animated_property_storage});
+  }
+
+  /* Properties of other IDs are gathered per thread and tagged afterwards. */
+  using OtherIDProperties = Vector<std::pair<const ID *, AnimatedPropertyID>>;
+  threading::EnumerableThreadSpecific<OtherIDProperties> other_id_properties_per_thread;
+  threading::parallel_for(storages_to_initialize.index_range(), 8, [&](const IndexRange range) {
+    OtherIDProperties &other_id_properties = other_id_properties_per_thread.local();
+    for (const int64_t i : range) {
+      const auto [id, animated_property_storage] = storages_to_initialize[i];
+      animated_property_storage->initializeFromID(
+          id, [&](const ID *owner_id, const AnimatedPropertyID &property_id) {
+            other_id_properties.append({owner_id, property_id});
+          });
+    }
+  });
+
+  for (const auto &item : storages_to_initialize) {
+    item.second->is_fully_initialized = true;
+  }
+  for (const OtherIDProperties &other_id_properties : other_id_properties_per_thread) {
+    for (const auto &[owner_id, property_id] : other_id_properties) {
+      ensureAnimatedPropertyStorage(owner_id)->tagPropertyAsAnimated(property_id);
+    }
+  }
+}
+
 }  // namespace blender::deg
@@ -12,8 +12,10 @@
 
 #include "RNA_types.hh"
 
+#include "BLI_function_ref.hh"
 #include "BLI_map.hh"
 #include "BLI_set.hh"
+#include "BLI_span.hh"
 
 struct ID;
 struct PointerRNA;
@@ -48,6 +50,12 @@ class AnimatedPropertyStorage {
   AnimatedPropertyStorage();
 
   void initializeFromID(DepsgraphBuilderCache *builder_cache, const ID *id);
+  /* Same as above, but properties of other IDs that are animated by this ID are passed to the
+   * callback instead of being tagged in the cache. Does not modify the builder cache, so it can be
+   * used from multiple threads. */
+  void initializeFromID(
+      const ID *id,
+      FunctionRef<void(const ID *owner_id, const AnimatedPropertyID &property_id)> tag_other_id);
 
   void tagPropertyAsAnimated(const AnimatedPropertyID &property_id);
   void tagPropertyAsAnimated(const PointerRNA *pointer_rna, const PropertyRNA *property_rna);
@@ -76,6 +84,10 @@ class DepsgraphBuilderCache {
   AnimatedPropertyStorage *ensureAnimatedPropertyStorage(const ID *id);
   AnimatedPropertyStorage *ensureInitializedAnimatedPropertyStorage(const ID *id);
 
+  /* Initialize animated property storage of all the given IDs, using multiple threads. This avoids
+   * resolving all F-Curve paths one ID at a time when the builders query the storage later on. */
+  void ensureInitializedAnimatedPropertyStorages(Span<const ID *> ids);
+
   /* Shortcuts to go through ensureInitializedAnimatedPropertyStorage and its
    * isPropertyAnimated.
    *
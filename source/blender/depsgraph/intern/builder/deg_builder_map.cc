@@ -30,6 +30,11 @@ bool BuilderMap::check_is_built_and_tag(ID *id, int tag)
   return result;
 }
 
+void BuilderMap::reserve(const int64_t ids_num)
+{
+  id_tags_.reserve(ids_num);
+}
+
 int BuilderMap::get_ID_tag(ID *id) const
 {
   return id_tags_.lookup_default(id, 0);
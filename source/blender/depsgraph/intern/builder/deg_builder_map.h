@@ -48,6 +48,9 @@ class BuilderMap {
    * handled otherwise and return false. */
   bool check_is_built_and_tag(ID *id, int tag = TAG_COMPLETE);
 
+  /* Pre-allocate space for the given number of IDs. */
+  void reserve(int64_t ids_num);
+
   template<typename T> bool check_is_built(T *datablock, int tag = TAG_COMPLETE) const
   {
     return this->check_is_built(&datablock->id, tag);
@@ -375,6 +375,12 @@ ID *DepsgraphNodeBuilder::ensure_cow_id(ID *id_orig)
 
 void DepsgraphNodeBuilder::begin_build()
 {
+  /* When the graph is rebuilt, it is likely to contain mostly the same IDs again. Reserve space
+   * up-front to avoid growing the hash tables many times on large scenes. */
+  const int64_t previous_id_nodes_num = graph_->id_nodes.size();
+  id_info_hash_.reserve(previous_id_nodes_num);
+  built_map_.reserve(previous_id_nodes_num);
+
   /* Store existing evaluated versions of datablock, so we can re-use
    * them for new ID nodes. */
   for (IDNode *id_node : graph_->id_nodes) {
@@ -415,6 +421,7 @@ void DepsgraphNodeBuilder::begin_build()
   graph_->clear_all_nodes();
   graph_->operations.clear();
   graph_->entry_tags.clear();
+  graph_->id_hash.reserve(previous_id_nodes_num);
 }
 
 /* Utility callbacks for `BKE_library_foreach_ID_link`, used to detect when an evaluated ID is
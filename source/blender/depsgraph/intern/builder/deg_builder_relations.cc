@@ -510,7 +510,10 @@ Depsgraph *DepsgraphRelationBuilder::getGraph()
 
 /* **** Functions to build relations between entities  **** */
 
-void DepsgraphRelationBuilder::begin_build() {}
+void DepsgraphRelationBuilder::begin_build()
+{
+  built_map_.reserve(graph_->id_nodes.size());
+}
 
 void DepsgraphRelationBuilder::build_id(ID *id)
 {
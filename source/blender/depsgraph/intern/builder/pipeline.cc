@@ -6,6 +6,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
 
 #include "BKE_global.hh"
 
@@ -57,6 +58,14 @@ void AbstractBuilderPipeline::build_step_nodes()
   node_builder->begin_build();
   build_nodes(*node_builder);
   node_builder->end_build();
+  /* Resolve the animated properties of all IDs in parallel before building relations, which
+   * queries them for most IDs. */
+  Vector<const ID *> ids;
+  ids.reserve(deg_graph_->id_nodes.size());
+  for (const IDNode *id_node : deg_graph_->id_nodes) {
+    ids.append(id_node->id_orig);
+  }
+  builder_cache_.ensureInitializedAnimatedPropertyStorages(ids);
 }
 
 void AbstractBuilderPipeline::build_step_relations()
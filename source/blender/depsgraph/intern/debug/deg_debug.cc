@@ -7,6 +7,7 @@
  */
 
 #include "intern/debug/deg_debug.h"
+#include "intern/debug/deg_debug_timeline.h"
 
 #include "BLI_console.h"
 #include "BLI_hash.h"
@@ -19,6 +20,8 @@ namespace blender::deg {
 
 DepsgraphDebug::DepsgraphDebug() : flags(G.debug), graph_evaluation_start_time_(0) {}
 
+DepsgraphDebug::~DepsgraphDebug() = default;
+
 bool DepsgraphDebug::do_time_debug() const
 {
   return ((G.debug & G_DEBUG_DEPSGRAPH_TIME) != 0);
@@ -0,0 +1,130 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/debug/deg_debug_timeline.h"
+
+#include <atomic>
+
+#include "BLI_string.h"
+#include "BLI_time.h"
+#include "BLI_utildefines.h"
+
+#include "intern/depsgraph.hh"
+#include "intern/node/deg_node_component.hh"
+#include "intern/node/deg_node_id.hh"
+#include "intern/node/deg_node_operation.hh"
+
+namespace blender::deg {
+
+namespace {
+
+/* Small and stable index of the current thread, used as thread identifier in the trace. */
+int timeline_thread_index()
+{
+  static std::atomic<int> threads_num = 0;
+  static thread_local int thread_index = threads_num.fetch_add(1);
+  return thread_index;
+}
+
+void write_json_string(FILE *file, const std::string &str)
+{
+  fputc('"', file);
+  for (const char c : str) {
+    if (ELEM(c, '"', '\\')) {
+      fputc('\\', file);
+      fputc(c, file);
+    }
+    else if (uchar(c) < 0x20) {
+      fprintf(file, "\\u%04x", uchar(c));
+    }
+    else {
+      fputc(c, file);
+    }
+  }
+  fputc('"', file);
+}
+
+}  // namespace
+
+DepsgraphTimeline::DepsgraphTimeline()
+    : start_time_(BLI_time_now_seconds()),
+      graph_evaluation_start_time_(0.0),
+      graph_evaluation_frame_(0.0f)
+{
+}
+
+void DepsgraphTimeline::begin_graph_evaluation(const Depsgraph &graph)
+{
+  graph_evaluation_start_time_ = BLI_time_now_seconds();
+  graph_evaluation_frame_ = graph.ctime;
+}
+
+void DepsgraphTimeline::record_operation(const OperationNode &operation_node,
+                                         const double start_time,
+                                         const double end_time)
+{
+  operations_per_thread_.local().append(
+      {&operation_node, timeline_thread_index(), start_time, end_time});
+}
+
+void DepsgraphTimeline::end_graph_evaluation()
+{
+  char name[64];
+  SNPRINTF(name, "Depsgraph evaluation (frame %.2f)", graph_evaluation_frame_);
+  events_.append({name,
+                  "",
+                  "",
+                  timeline_thread_index(),
+                  graph_evaluation_start_time_,
+                  BLI_time_now_seconds()});
+
+  for (Vector<RecordedOperation> &operations : operations_per_thread_) {
+    for (const RecordedOperation &operation : operations) {
+      const OperationNode &operation_node = *operation.operation_node;
+      const ComponentNode &component_node = *operation_node.owner;
+      std::string component_name = nodeTypeAsString(component_node.type);
+      if (!component_node.name.empty()) {
+        component_name += "/" + component_node.name;
+      }
+      events_.append({operation_node.identifier(),
+                      component_node.owner->name,
+                      std::move(component_name),
+                      operation.thread,
+                      operation.start_time,
+                      operation.end_time});
+    }
+    operations.clear();
+  }
+}
+
+void DepsgraphTimeline::write_chrome_trace(FILE *file) const
+{
+  fprintf(file, "{\"traceEvents\":[\n");
+  for (const int64_t i : events_.index_range()) {
+    const Event &event = events_[i];
+    fprintf(file,
+            "{\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"name\":",
+            event.thread,
+            (event.start_time - start_time_) * 1e6,
+            (event.end_time - event.start_time) * 1e6);
+    write_json_string(file, event.name);
+    if (!event.id_name.empty()) {
+      fprintf(file, ",\"cat\":");
+      write_json_string(file, event.component_name);
+      fprintf(file, ",\"args\":{\"id\":");
+      write_json_string(file, event.id_name);
+      fprintf(file, ",\"component\":");
+      write_json_string(file, event.component_name);
+      fprintf(file, "}");
+    }
+    fprintf(file, "}%s\n", (i == events_.size() - 1) ? "" : ",");
+  }
+  fprintf(file, "],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+}  // namespace blender::deg
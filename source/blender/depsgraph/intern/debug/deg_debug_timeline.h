@@ -0,0 +1,64 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+
+#include "BLI_enumerable_thread_specific.hh"
+#include "BLI_vector.hh"
+
+namespace blender::deg {
+
+struct Depsgraph;
+struct OperationNode;
+
+/* Records which thread evaluated which operation node and when, for every evaluation of the
+ * graph while the timeline is enabled. The result can be written in the Chrome trace event format,
+ * which can be opened in Perfetto or `chrome://tracing`. */
+class DepsgraphTimeline {
+ public:
+  DepsgraphTimeline();
+
+  void begin_graph_evaluation(const Depsgraph &graph);
+  /* Thread-safe. */
+  void record_operation(const OperationNode &operation_node, double start_time, double end_time);
+  void end_graph_evaluation();
+
+  void write_chrome_trace(FILE *file) const;
+
+ private:
+  struct RecordedOperation {
+    const OperationNode *operation_node;
+    int thread;
+    double start_time;
+    double end_time;
+  };
+
+  /* Operation nodes are only valid until the graph is rebuilt, so the names are copied at the end
+   * of every evaluation. */
+  struct Event {
+    std::string name;
+    std::string id_name;
+    std::string component_name;
+    int thread;
+    double start_time;
+    double end_time;
+  };
+
+  threading::EnumerableThreadSpecific<Vector<RecordedOperation>> operations_per_thread_;
+  Vector<Event> events_;
+
+  /* Point in time the timeline was created, timestamps are written relative to it. */
+  double start_time_;
+  double graph_evaluation_start_time_;
+  float graph_evaluation_frame_;
+};
+
+}  // namespace blender::deg
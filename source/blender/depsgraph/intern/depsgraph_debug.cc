@@ -18,6 +18,7 @@
 #include "DEG_depsgraph_query.hh"
 
 #include "intern/debug/deg_debug.h"
+#include "intern/debug/deg_debug_timeline.h"
 #include "intern/depsgraph.hh"
 #include "intern/depsgraph_relation.hh"
 #include "intern/node/deg_node_component.hh"
@@ -52,6 +53,33 @@ const char *DEG_debug_name_get(Depsgraph *depsgraph)
   return deg_graph->debug.name.c_str();
 }
 
+void DEG_debug_timeline_enable(Depsgraph *depsgraph, const bool enable)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(depsgraph);
+  if (!enable) {
+    deg_graph->debug.timeline.reset();
+  }
+  else if (!deg_graph->debug.timeline) {
+    deg_graph->debug.timeline = std::make_unique<deg::DepsgraphTimeline>();
+  }
+}
+
+bool DEG_debug_timeline_is_enabled(const Depsgraph *depsgraph)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(depsgraph);
+  return deg_graph->debug.timeline != nullptr;
+}
+
+bool DEG_debug_timeline_write_chrome_trace(const Depsgraph *depsgraph, FILE *fp)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(depsgraph);
+  if (!deg_graph->debug.timeline) {
+    return false;
+  }
+  deg_graph->debug.timeline->write_chrome_trace(fp);
+  return true;
+}
+
 bool DEG_debug_compare(const Depsgraph *graph1, const Depsgraph *graph2)
 {
   BLI_assert(graph1 != nullptr);
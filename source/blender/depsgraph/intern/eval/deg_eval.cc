@@ -8,6 +8,7 @@
  * Evaluation engine entry-points for Depsgraph Engine.
  */
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 
@@ -17,6 +18,7 @@
 #include "BLI_gsqueue.h"
 #include "BLI_task.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
 
 #include "BKE_global.hh"
 
@@ -32,6 +34,7 @@
 
 #include "atomic_ops.h"
 
+#include "intern/debug/deg_debug_timeline.h"
 #include "intern/depsgraph.hh"
 #include "intern/depsgraph_relation.hh"
 #include "intern/depsgraph_tag.hh"
@@ -79,6 +82,8 @@ enum class EvaluationStage {
 struct DepsgraphEvalState {
   Depsgraph *graph;
   bool do_stats;
+  /* Null when the evaluation timeline is not recorded. */
+  DepsgraphTimeline *timeline;
   EvaluationStage stage;
   bool need_update_pending_parents = true;
   bool need_single_thread_pass = false;
@@ -90,14 +95,18 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
 
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
-  /* Perform operation. */
+  /* Perform operation. The timing is always needed to estimate the critical path of the next
+   * evaluation. */
+  const double start_time = BLI_time_now_seconds();
+  operation_node->evaluate(depsgraph);
+  const double end_time = BLI_time_now_seconds();
+  const double eval_time = end_time - start_time;
+  operation_node->eval_time = float(eval_time);
   if (state->do_stats) {
-    const double start_time = BLI_time_now_seconds();
-    operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += BLI_time_now_seconds() - start_time;
+    operation_node->stats.current_time += eval_time;
   }
-  else {
-    operation_node->evaluate(depsgraph);
+  if (state->timeline) {
+    state->timeline->record_operation(*operation_node, start_time, end_time);
   }
 
   /* Clear the flag early on, allowing partial updates without re-evaluating the same node multiple
@@ -112,14 +121,26 @@ void deg_task_run_func(TaskPool *pool, void *taskdata)
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  while (operation_node != nullptr) {
+    /* Evaluate node. */
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, [&](OperationNode *node) {
-    BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
-  });
+    /* Schedule children. The child with the longest critical path is evaluated directly by this
+     * thread, so that long chains of operations are not delayed behind cheap ones. */
+    OperationNode *next_node = nullptr;
+    schedule_children(state, operation_node, [&](OperationNode *node) {
+      if (next_node == nullptr) {
+        next_node = node;
+        return;
+      }
+      if (node->critical_path_time > next_node->critical_path_time) {
+        std::swap(node, next_node);
+      }
+      BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+    });
+    operation_node = next_node;
+  }
 }
 
 bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode *op_node)
@@ -185,6 +206,66 @@ void calculate_pending_parents_if_needed(DepsgraphEvalState *state)
   state->need_update_pending_parents = false;
 }
 
+bool need_evaluate_operation(const DepsgraphEvalState *state, OperationNode *node)
+{
+  return (node->flag & DEPSOP_FLAG_NEEDS_UPDATE) && check_operation_node_visible(state, node);
+}
+
+/* Update #OperationNode::critical_path_time of all operations which are to be evaluated, based on
+ * the evaluation times of the previous evaluation. Cyclic relations are ignored. */
+void calculate_critical_path_times(const DepsgraphEvalState *state)
+{
+  enum { CRITICAL_PATH_NOT_VISITED = 0, CRITICAL_PATH_IN_PROGRESS = 1, CRITICAL_PATH_DONE = 2 };
+
+  for (OperationNode *node : state->graph->operations) {
+    node->custom_flags = CRITICAL_PATH_NOT_VISITED;
+  }
+
+  /* Depth first traversal along the outgoing relations, the time of a node is known once all its
+   * children are done. The second value is the index of the next outgoing relation to visit. */
+  Vector<std::pair<OperationNode *, int64_t>> stack;
+  for (OperationNode *root : state->graph->operations) {
+    if (root->custom_flags != CRITICAL_PATH_NOT_VISITED || !need_evaluate_operation(state, root)) {
+      continue;
+    }
+    root->custom_flags = CRITICAL_PATH_IN_PROGRESS;
+    stack.append({root, 0});
+    while (!stack.is_empty()) {
+      auto &[node, next_relation] = stack.last();
+      OperationNode *child_to_visit = nullptr;
+      while (next_relation < node->outlinks.size()) {
+        const Relation *rel = node->outlinks[next_relation++];
+        if (rel->flag & RELATION_FLAG_CYCLIC) {
+          continue;
+        }
+        OperationNode *child = (OperationNode *)rel->to;
+        if (child->custom_flags == CRITICAL_PATH_NOT_VISITED &&
+            need_evaluate_operation(state, child))
+        {
+          child_to_visit = child;
+          break;
+        }
+      }
+      if (child_to_visit != nullptr) {
+        child_to_visit->custom_flags = CRITICAL_PATH_IN_PROGRESS;
+        stack.append({child_to_visit, 0});
+        continue;
+      }
+      float children_time = 0.0f;
+      for (const Relation *rel : node->outlinks) {
+        const OperationNode *child = (const OperationNode *)rel->to;
+        /* Children which are still in progress are part of a dependency cycle. */
+        if (child->custom_flags == CRITICAL_PATH_DONE && (rel->flag & RELATION_FLAG_CYCLIC) == 0) {
+          children_time = std::max(children_time, child->critical_path_time);
+        }
+      }
+      node->critical_path_time = node->eval_time + children_time;
+      node->custom_flags = CRITICAL_PATH_DONE;
+      stack.pop_last();
+    }
+  }
+}
+
 void initialize_execution(DepsgraphEvalState *state, Depsgraph *graph)
 {
   /* Clear tags and other things which needs to be clear. */
@@ -316,9 +397,20 @@ void evaluate_graph_threaded_stage(DepsgraphEvalState *state,
 
   calculate_pending_parents_if_needed(state);
 
-  schedule_graph(state, [&](OperationNode *node) {
+  if (stage == EvaluationStage::THREADED_EVALUATION) {
+    calculate_critical_path_times(state);
+  }
+
+  /* Start operations with the longest critical path first. */
+  Vector<OperationNode *> root_nodes;
+  schedule_graph(state, [&](OperationNode *node) { root_nodes.append(node); });
+  std::stable_sort(
+      root_nodes.begin(), root_nodes.end(), [](const OperationNode *a, const OperationNode *b) {
+        return a->critical_path_time > b->critical_path_time;
+      });
+  for (OperationNode *node : root_nodes) {
     BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
-  });
+  }
   BLI_task_pool_work_and_wait(task_pool);
 }
 
@@ -410,6 +502,10 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   DepsgraphEvalState state;
   state.graph = graph;
   state.do_stats = graph->debug.do_time_debug();
+  state.timeline = graph->debug.timeline.get();
+  if (state.timeline) {
+    state.timeline->begin_graph_evaluation(*graph);
+  }
 
   /* Prepare all nodes for evaluation. */
   initialize_execution(&state, graph);
@@ -464,6 +560,9 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   if (state.do_stats) {
     deg_eval_stats_aggregate(graph);
   }
+  if (state.timeline) {
+    state.timeline->end_graph_evaluation();
+  }
 
   /* Clear any uncleared tags. */
   deg_graph_clear_tags(graph);
@@ -863,6 +863,7 @@ ID *deg_update_eval_copy_datablock(const Depsgraph *depsgraph, const IDNode *id_
     }
   }
 
+  MEM_CategoryScope mem_category_scope(MEM_CATEGORY_DEPSGRAPH);
   RuntimeBackup backup(depsgraph);
   backup.init_from_id(id_cow);
   deg_free_eval_copy_datablock(id_cow);
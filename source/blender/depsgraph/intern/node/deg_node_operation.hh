@@ -287,6 +287,13 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Time in seconds it took to evaluate this operation the last time it was evaluated. */
+  float eval_time;
+  /* Estimated time in seconds to evaluate this operation and the most expensive chain of
+   * operations depending on it. Among the operations that are ready to be evaluated, the ones with
+   * the longest chain are started first. */
+  float critical_path_time;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
@@ -1167,6 +1167,13 @@ GPUMaterial *ShaderModule::material_shader_get(::Material *blender_mat,
 
   CallbackThunk thunk = {this, default_mat};
 
+  /* Shadow and planar probe passes only indirectly affect what is on screen and are drawn with
+   * the default material until ready. Compile them after the surface passes, so that visible
+   * materials replace their placeholder sooner. */
+  const bool is_secondary_pass = ELEM(pipeline_type, MAT_PIPE_SHADOW, MAT_PIPE_PREPASS_PLANAR);
+  const CompilationPriority priority = is_secondary_pass ? CompilationPriority::Low :
+                                                           CompilationPriority::Medium;
+
   return GPU_material_from_nodetree(blender_mat,
                                     nodetree,
                                     &blender_mat->gpumaterial,
@@ -1176,7 +1183,8 @@ GPUMaterial *ShaderModule::material_shader_get(::Material *blender_mat,
                                     deferred_compilation,
                                     codegen_callback,
                                     &thunk,
-                                    is_default_material ? nullptr : pass_replacement_cb);
+                                    is_default_material ? nullptr : pass_replacement_cb,
+                                    priority);
 }
 
 GPUMaterial *ShaderModule::world_shader_get(::World *blender_world,
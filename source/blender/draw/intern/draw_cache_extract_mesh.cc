@@ -153,28 +153,30 @@ void mesh_buffer_cache_create_requested(TaskGraph & /*task_graph*/,
   ensure_dependency_data(mr, ibo_requests, vbo_requests, mbc);
 
   Array<gpu::IndexBufPtr, 16> created_ibos(ibos_to_create.size());
+  Array<gpu::VertBufPtr, 16> created_vbos(vbos_to_create.size());
 
-  {
-    /* Because lines and loose lines are stored in the same buffer, they're handled separately
-     * rather than from potentially multiple threads in the parallel_for_each loop below. */
-    const int lines_index = ibos_to_create.as_span().first_index_try(IBOType::Lines);
-    const int loose_lines_index = ibos_to_create.as_span().first_index_try(IBOType::LinesLoose);
-    if (lines_index != -1 || loose_lines_index != -1) {
-      extract_lines(mr,
-                    lines_index == -1 ? nullptr : &created_ibos[lines_index],
-                    loose_lines_index == -1 ? nullptr : &created_ibos[loose_lines_index],
-                    cache.no_loose_wire);
-    }
-  }
+  const int lines_index = ibos_to_create.as_span().first_index_try(IBOType::Lines);
+  const int loose_lines_index = ibos_to_create.as_span().first_index_try(IBOType::LinesLoose);
+  /* Because lines and loose lines are stored in the same buffer, they're extracted together by a
+   * single task rather than from potentially multiple threads. */
+  const int lines_task_index = lines_index == -1 ? loose_lines_index : lines_index;
+
+  const bool do_hq_normals = (scene.r.perf_flag & SCE_PERF_HQ_NORMALS) != 0 ||
+                             GPU_use_hq_normals_workaround();
 
-  threading::parallel_for_each(ibos_to_create.index_range(), [&](const int i) {
+  auto create_ibo = [&](const int i) {
     switch (ibos_to_create[i]) {
       case IBOType::Tris:
         created_ibos[i] = extract_tris(mr, mesh_render_data_faces_sorted_ensure(mr, mbc));
         break;
       case IBOType::Lines:
       case IBOType::LinesLoose:
-        /* Handled as a special case above. */
+        if (i == lines_task_index) {
+          extract_lines(mr,
+                        lines_index == -1 ? nullptr : &created_ibos[lines_index],
+                        loose_lines_index == -1 ? nullptr : &created_ibos[loose_lines_index],
+                        cache.no_loose_wire);
+        }
         break;
       case IBOType::Points:
         created_ibos[i] = extract_points(mr);
@@ -204,14 +206,9 @@ void mesh_buffer_cache_create_requested(TaskGraph & /*task_graph*/,
         created_ibos[i] = extract_edituv_face_dots(mr);
         break;
     }
-  });
-
-  Array<gpu::VertBufPtr, 16> created_vbos(vbos_to_create.size());
-
-  const bool do_hq_normals = (scene.r.perf_flag & SCE_PERF_HQ_NORMALS) != 0 ||
-                             GPU_use_hq_normals_workaround();
+  };
 
-  threading::parallel_for_each(vbos_to_create.index_range(), [&](const int i) {
+  auto create_vbo = [&](const int i) {
     switch (vbos_to_create[i]) {
       case VBOType::Position:
         created_vbos[i] = extract_positions(mr);
@@ -308,7 +305,19 @@ void mesh_buffer_cache_create_requested(TaskGraph & /*task_graph*/,
         created_vbos[i] = extract_paint_overlay_flags(mr);
         break;
     }
-  });
+  };
+
+  /* The extractors don't depend on each other, so all index and vertex buffers are created in a
+   * single parallel loop. That way a slow extractor doesn't delay the start of the others. */
+  threading::parallel_for_each(
+      IndexRange(ibos_to_create.size() + vbos_to_create.size()), [&](const int i) {
+        if (i < ibos_to_create.size()) {
+          create_ibo(i);
+        }
+        else {
+          create_vbo(i - ibos_to_create.size());
+        }
+      });
 
   for (const int i : ibos_to_create.index_range()) {
     buffers.ibos.add_new(ibos_to_create[i], std::move(created_ibos[i]));
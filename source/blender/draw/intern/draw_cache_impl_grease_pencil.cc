@@ -1097,12 +1097,15 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       ed::greasepencil::retrieve_visible_drawings(scene, grease_pencil, true);
 
   /* First, count how many vertices and triangles are needed for the whole object. Also record the
-   * offsets into the curves for the vertices and triangles. */
+   * offsets of each visible curve into the vertex buffers and the index buffer, so that the curves
+   * can be written in parallel afterwards. */
   int total_verts_num = 0;
   int total_triangles_num = 0;
   int v_offset = 0;
+  int ibo_offset = 0;
   Vector<Array<int>> verts_start_offsets_per_visible_drawing;
   Vector<Array<int>> tris_start_offsets_per_visible_drawing;
+  Vector<Array<int>> ibo_start_offsets_per_visible_drawing;
   for (const ed::greasepencil::DrawingInfo &info : drawings) {
     const bke::CurvesGeometry &curves = info.drawing.strokes();
     const OffsetIndices<int> points_by_curve = curves.evaluated_points_by_curve();
@@ -1112,10 +1115,9 @@ static void grease_pencil_geom_batch_ensure(Object &object,
         object, info.drawing, memory);
 
     const int num_curves = visible_strokes.size();
-    const int verts_start_offsets_size = num_curves;
-    const int tris_start_offsets_size = num_curves;
-    Array<int> verts_start_offsets(verts_start_offsets_size);
-    Array<int> tris_start_offsets(tris_start_offsets_size);
+    Array<int> verts_start_offsets(num_curves);
+    Array<int> tris_start_offsets(num_curves);
+    Array<int> ibo_start_offsets(num_curves);
 
     /* Calculate the triangle offsets for all the visible curves. */
     int t_offset = 0;
@@ -1131,7 +1133,8 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       }
     }
 
-    /* Calculate the vertex offsets for all the visible curves. */
+    /* Calculate the vertex and index buffer offsets for all the visible curves. Each curve writes
+     * its fill triangles first, followed by two triangles for each drawn point. */
     int num_cyclic = 0;
     int num_points = 0;
     visible_strokes.foreach_index([&](const int curve_i, const int pos) {
@@ -1145,6 +1148,12 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       verts_start_offsets[pos] = v_offset;
       v_offset += 1 + points.size() + (is_cyclic ? 1 : 0) + 1;
       num_points += points.size();
+
+      ibo_start_offsets[pos] = ibo_offset;
+      if (points.size() >= 3) {
+        ibo_offset += points.size() - 2;
+      }
+      ibo_offset += (points.size() + (is_cyclic ? 1 : 0)) * 2;
     });
 
     /* One vertex is stored before and after as padding. Cyclic strokes have one extra vertex. */
@@ -1154,6 +1163,7 @@ static void grease_pencil_geom_batch_ensure(Object &object,
 
     verts_start_offsets_per_visible_drawing.append(std::move(verts_start_offsets));
     tris_start_offsets_per_visible_drawing.append(std::move(tris_start_offsets));
+    ibo_start_offsets_per_visible_drawing.append(std::move(ibo_start_offsets));
   }
 
   GPUUsageType vbo_flag = GPU_USAGE_STATIC | GPU_USAGE_FLAG_BUFFER_TEXTURE_ONLY;
@@ -1172,7 +1182,6 @@ static void grease_pencil_geom_batch_ensure(Object &object,
   GPUIndexBufBuilder ibo;
   GPU_indexbuf_init(&ibo, GPU_PRIM_TRIS, total_triangles_num, INT_MAX);
   MutableSpan<uint3> triangle_ibo_data = GPU_indexbuf_get_data(&ibo).cast<uint3>();
-  int triangle_ibo_index = 0;
 
   /* Fill buffers with data. */
   for (const int drawing_i : drawings.index_range()) {
@@ -1226,6 +1235,7 @@ static void grease_pencil_geom_batch_ensure(Object &object,
     const Span<float4x2> texture_matrices = info.drawing.texture_matrices();
     const Span<int> verts_start_offsets = verts_start_offsets_per_visible_drawing[drawing_i];
     const Span<int> tris_start_offsets = tris_start_offsets_per_visible_drawing[drawing_i];
+    const Span<int> ibo_start_offsets = ibo_start_offsets_per_visible_drawing[drawing_i];
     IndexMaskMemory memory;
     const IndexMask visible_strokes = ed::greasepencil::retrieve_visible_strokes(
         object, info.drawing, memory);
@@ -1241,7 +1251,8 @@ static void grease_pencil_geom_batch_ensure(Object &object,
                               float u_stroke,
                               const float4x2 &texture_matrix,
                               GreasePencilStrokeVert &s_vert,
-                              GreasePencilColorVert &c_vert) {
+                              GreasePencilColorVert &c_vert,
+                              int &triangle_ibo_index) {
       const float3 pos = math::transform_point(layer_space_to_object_space, positions[point_i]);
       copy_v3_v3(s_vert.pos, pos);
       /* GP data itself does not constrain radii to be positive, but drawing code expects it, and
@@ -1272,11 +1283,12 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       triangle_ibo_index++;
     };
 
-    visible_strokes.foreach_index([&](const int curve_i, const int pos) {
+    visible_strokes.foreach_index(GrainSize(512), [&](const int curve_i, const int pos) {
       const IndexRange points = points_by_curve[curve_i];
       const bool is_cyclic = cyclic[curve_i] && (points.size() > 2);
       const int verts_start_offset = verts_start_offsets[pos];
       const int tris_start_offset = tris_start_offsets[pos];
+      int triangle_ibo_index = ibo_start_offsets[pos];
       const int num_verts = 1 + points.size() + (is_cyclic ? 1 : 0) + 1;
       const IndexRange verts_range = IndexRange(verts_start_offset, num_verts);
       MutableSpan<GreasePencilStrokeVert> verts_slice = verts.slice(verts_range);
@@ -1315,7 +1327,8 @@ static void grease_pencil_geom_batch_ensure(Object &object,
                        u_stroke,
                        texture_matrix,
                        verts_slice[idx],
-                       cols_slice[idx]);
+                       cols_slice[idx],
+                       triangle_ibo_index);
       }
 
       if (is_cyclic) {
@@ -1331,7 +1344,8 @@ static void grease_pencil_geom_batch_ensure(Object &object,
                        u_stroke,
                        texture_matrix,
                        verts_slice[idx],
-                       cols_slice[idx]);
+                       cols_slice[idx],
+                       triangle_ibo_index);
       }
 
       /* Last vertex is not drawn. */
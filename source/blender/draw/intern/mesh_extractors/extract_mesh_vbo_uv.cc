@@ -6,6 +6,7 @@
  * \ingroup draw
  */
 
+#include "BLI_array.hh"
 #include "BLI_array_utils.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_string.h"
@@ -106,21 +107,25 @@ gpu::VertBufPtr extract_uv_maps(const MeshRenderData &mr, const MeshBatchCache &
   threading::memory_bandwidth_bound_task(uv_data.size_in_bytes() * 2, [&]() {
     if (mr.extract_type == MeshExtractType::BMesh) {
       const BMesh &bm = *mr.bm;
+      /* Traverse the loops only once and copy all UV maps from each loop's custom data block while
+       * it is in the cache, instead of walking all faces and loops again for every UV map. */
+      Array<int, MAX_MTFACE> offsets(uv_indices.size());
       for (const int i : uv_indices.index_range()) {
-        MutableSpan<float2> data = uv_data.slice(i * bm.totloop, bm.totloop);
-        const int offset = CustomData_get_n_offset(cd_ldata, CD_PROP_FLOAT2, uv_indices[i]);
-        threading::parallel_for(IndexRange(bm.totface), 2048, [&](const IndexRange range) {
-          for (const int face_index : range) {
-            const BMFace &face = *BM_face_at_index(&const_cast<BMesh &>(bm), face_index);
-            const BMLoop *loop = BM_FACE_FIRST_LOOP(&face);
-            for ([[maybe_unused]] const int i : IndexRange(face.len)) {
-              const int index = BM_elem_index_get(loop);
-              data[index] = BM_ELEM_CD_GET_FLOAT_P(loop, offset);
-              loop = loop->next;
+        offsets[i] = CustomData_get_n_offset(cd_ldata, CD_PROP_FLOAT2, uv_indices[i]);
+      }
+      threading::parallel_for(IndexRange(bm.totface), 2048, [&](const IndexRange range) {
+        for (const int face_index : range) {
+          const BMFace &face = *BM_face_at_index(&const_cast<BMesh &>(bm), face_index);
+          const BMLoop *loop = BM_FACE_FIRST_LOOP(&face);
+          for ([[maybe_unused]] const int i : IndexRange(face.len)) {
+            const int index = BM_elem_index_get(loop);
+            for (const int layer : offsets.index_range()) {
+              uv_data[layer * bm.totloop + index] = BM_ELEM_CD_GET_FLOAT_P(loop, offsets[layer]);
             }
+            loop = loop->next;
           }
-        });
-      }
+        }
+      });
     }
     else {
       const bke::AttributeAccessor attributes = mr.mesh->attributes();
@@ -255,6 +255,7 @@ static wmOperatorStatus wm_ply_import_exec(bContext *C, wmOperator *op)
   params.use_scene_unit = RNA_boolean_get(op->ptr, "use_scene_unit");
   params.global_scale = RNA_float_get(op->ptr, "global_scale");
   params.merge_verts = RNA_boolean_get(op->ptr, "merge_verts");
+  params.sort_spatially = RNA_boolean_get(op->ptr, "sort_spatially");
   params.import_attributes = RNA_boolean_get(op->ptr, "import_attributes");
   params.vertex_colors = ePLYVertexColorMode(RNA_enum_get(op->ptr, "import_colors"));
 
@@ -296,6 +297,7 @@ static void ui_ply_import_settings(const bContext *C, uiLayout *layout, PointerR
   if (uiLayout *panel = layout->panel(C, "PLY_import_options", false, IFACE_("Options"))) {
     uiLayout *col = &panel->column(false);
     col->prop(ptr, "merge_verts", UI_ITEM_NONE, std::nullopt, ICON_NONE);
+    col->prop(ptr, "sort_spatially", UI_ITEM_NONE, std::nullopt, ICON_NONE);
     col->prop(ptr, "import_colors", UI_ITEM_NONE, std::nullopt, ICON_NONE);
   }
 }
@@ -339,6 +341,12 @@ void WM_OT_ply_import(wmOperatorType *ot)
   prop = RNA_def_enum(ot->srna, "up_axis", io_transform_axis, IO_AXIS_Z, "Up Axis", "");
   RNA_def_property_update_runtime(prop, io_ui_up_axis_update);
   RNA_def_boolean(ot->srna, "merge_verts", false, "Merge Vertices", "Merges vertices by distance");
+  RNA_def_boolean(ot->srna,
+                  "sort_spatially",
+                  false,
+                  "Sort Spatially",
+                  "Reorder vertices and faces along a space-filling curve, so that elements that "
+                  "are close to each other are also close in memory");
   RNA_def_enum(ot->srna,
                "import_colors",
                ply_vertex_colors_mode,
@@ -1670,6 +1670,8 @@ void EDBM_stats_update(BMEditMesh *em)
 void EDBM_update(Mesh *mesh, const EDBMUpdate_Params *params)
 {
   BMEditMesh *em = mesh->runtime->edit_mesh.get();
+  /* Any data may have changed. */
+  BKE_editmesh_eval_cache_clear(em);
   /* Order of calling isn't important. */
   DEG_id_tag_update(&mesh->id, ID_RECALC_GEOMETRY);
   WM_main_add_notifier(NC_GEOM | ND_DATA, &mesh->id);
@@ -329,7 +329,10 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
                       request.path->meta_dir.c_str(),
                       (frame_file_name + ".json").c_str());
         BLI_file_ensure_parent_dir_exists(meta_path);
-        bake::DiskBlobWriter blob_writer{request.path->blobs_dir, frame_file_name};
+        /* Compress the data on disk. Packed bakes are not compressed, because they are kept in
+         * memory and the .blend file can be compressed as a whole already. */
+        bake::DiskBlobWriter blob_writer{
+            request.path->blobs_dir, frame_file_name, /*use_compression=*/true};
         fstream meta_file{meta_path, std::ios::out};
         bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
         written_size += blob_writer.written_size();
@@ -128,6 +128,10 @@ void ED_render_scene_update(const DEGEditorUpdateContext *update_ctx, const bool
   recursive_check = true;
 
   wmWindowManager *wm = static_cast<wmWindowManager *>(bmain->wm.first);
+  if (updated) {
+    /* Data may have been changed without an undo push, e.g. from Python. */
+    WM_file_tag_autosave_outdated(wm);
+  }
   LISTBASE_FOREACH (wmWindow *, window, &wm->windows) {
     bScreen *screen = WM_window_get_active_screen(window);
 
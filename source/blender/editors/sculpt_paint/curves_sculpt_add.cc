@@ -58,6 +58,7 @@ class AddOperation : public CurvesSculptStrokeOperation {
  private:
   /** Used when some data should be interpolated from existing curves. */
   KDTree_3d *curve_roots_kdtree_ = nullptr;
+  ReverseUVSamplerCache reverse_uv_sampler_cache_;
 
   friend struct AddOperationExecutor;
 
@@ -197,7 +198,8 @@ struct AddOperationExecutor {
 
     const Span<int3> surface_corner_tris_orig = surface_orig.corner_tris();
     const Span<float3> corner_normals_su = surface_orig.corner_normals();
-    const geometry::ReverseUVSampler reverse_uv_sampler{surface_uv_map, surface_corner_tris_orig};
+    const geometry::ReverseUVSampler &reverse_uv_sampler = self_->reverse_uv_sampler_cache_.get(
+        surface_uv_map, surface_corner_tris_orig);
 
     geometry::AddCurvesOnMeshInputs add_inputs;
     add_inputs.uvs = sampled_uvs;
@@ -406,6 +406,19 @@ CurvesSculptCommonContext::CurvesSculptCommonContext(const bContext &C)
   this->rv3d = CTX_wm_region_view3d(&C);
 }
 
+const geometry::ReverseUVSampler &ReverseUVSamplerCache::get(const Span<float2> uv_map,
+                                                             const Span<int3> corner_tris)
+{
+  if (!sampler_ || uv_map_.data() != uv_map.data() || uv_map_.size() != uv_map.size() ||
+      corner_tris_.data() != corner_tris.data() || corner_tris_.size() != corner_tris.size())
+  {
+    sampler_ = std::make_unique<geometry::ReverseUVSampler>(uv_map, corner_tris);
+    uv_map_ = uv_map;
+    corner_tris_ = corner_tris;
+  }
+  return *sampler_;
+}
+
 void report_empty_original_surface(ReportList *reports)
 {
   BKE_report(reports, RPT_WARNING, "Original surface mesh is empty");
@@ -48,6 +48,7 @@ class DensityAddOperation : public CurvesSculptStrokeOperation {
   /** Root positions of curves that have been added in the current brush stroke. */
   Vector<float3> new_deformed_root_positions_;
   int original_curve_num_ = 0;
+  ReverseUVSamplerCache reverse_uv_sampler_cache_;
 
   friend struct DensityAddOperationExecutor;
 
@@ -254,7 +255,8 @@ struct DensityAddOperationExecutor {
 
     const Span<float3> corner_normals_su = surface_orig_->corner_normals();
     const Span<int3> surface_corner_tris_orig = surface_orig_->corner_tris();
-    const geometry::ReverseUVSampler reverse_uv_sampler{surface_uv_map, surface_corner_tris_orig};
+    const geometry::ReverseUVSampler &reverse_uv_sampler = self_->reverse_uv_sampler_cache_.get(
+        surface_uv_map, surface_corner_tris_orig);
 
     geometry::AddCurvesOnMeshInputs add_inputs;
     add_inputs.uvs = new_uvs;
@@ -328,7 +328,7 @@ struct CurvesEffectOperationExecutor {
     MutableSpan<float3> positions_cu = curves_->positions_for_write();
     self_->effect_->execute(*curves_, curves_mask, move_distances_cu, positions_cu);
 
-    curves_->tag_positions_changed();
+    curves_->tag_positions_changed(curves_mask);
     DEG_id_tag_update(&curves_id_->id, ID_RECALC_GEOMETRY);
     WM_main_add_notifier(NC_GEOM | ND_DATA, &curves_id_->id);
     ED_region_tag_redraw(ctx_.region);
@@ -18,6 +18,8 @@
 
 #include "ED_curves.hh"
 
+#include "GEO_reverse_uv_sampler.hh"
+
 struct ARegion;
 struct RegionView3D;
 struct Depsgraph;
@@ -154,6 +156,22 @@ void report_missing_uv_map_on_original_surface(ReportList *reports);
 void report_missing_uv_map_on_evaluated_surface(ReportList *reports);
 void report_invalid_uv_map(ReportList *reports);
 
+/**
+ * Keeps the #geometry::ReverseUVSampler of the original surface between the steps of a stroke.
+ * Building it is linear in the number of surface triangles, but the original surface does not
+ * change while a stroke is active. The sampler is built again if a different UV map or
+ * triangulation array is passed in.
+ */
+class ReverseUVSamplerCache {
+ private:
+  Span<float2> uv_map_;
+  Span<int3> corner_tris_;
+  std::unique_ptr<geometry::ReverseUVSampler> sampler_;
+
+ public:
+  const geometry::ReverseUVSampler &get(Span<float2> uv_map, Span<int3> corner_tris);
+};
+
 /**
  * Utility class to make it easy for brushes to implement length preservation and surface
  * collision.
@@ -161,7 +161,7 @@ struct PuffOperationExecutor {
 
     self_->constraint_solver_.solve_step(*curves_, curves_mask, surface_, transforms_);
 
-    curves_->tag_positions_changed();
+    curves_->tag_positions_changed(curves_mask);
     DEG_id_tag_update(&curves_id_->id, ID_RECALC_GEOMETRY);
     WM_main_add_notifier(NC_GEOM | ND_DATA, &curves_id_->id);
     ED_region_tag_redraw(ctx_.region);
@@ -66,6 +66,7 @@ class SlideOperation : public CurvesSculptStrokeOperation {
   Array<float3> initial_positions_cu_;
   /** Deformed positions of all curve points at the start of sliding. */
   Array<float3> initial_deformed_positions_cu_;
+  ReverseUVSamplerCache reverse_uv_sampler_cache_;
 
   friend struct SlideOperationExecutor;
 
@@ -239,8 +240,8 @@ struct SlideOperationExecutor {
         *curves_sculpt_,
         math::transform_point(transforms_.curves_to_world, brush_3d->position_cu));
 
-    const ReverseUVSampler reverse_uv_sampler_orig{surface_uv_map_orig_,
-                                                   surface_corner_tris_orig_};
+    const ReverseUVSampler &reverse_uv_sampler_orig = self_->reverse_uv_sampler_cache_.get(
+        surface_uv_map_orig_, surface_corner_tris_orig_);
     for (const float4x4 &brush_transform : brush_transforms) {
       self_->slide_info_.append_as();
       SlideInfo &slide_info = self_->slide_info_.last();
@@ -296,8 +297,8 @@ struct SlideOperationExecutor {
 
   void slide_with_symmetry()
   {
-    const ReverseUVSampler reverse_uv_sampler_orig{surface_uv_map_orig_,
-                                                   surface_corner_tris_orig_};
+    const ReverseUVSampler &reverse_uv_sampler_orig = self_->reverse_uv_sampler_cache_.get(
+        surface_uv_map_orig_, surface_corner_tris_orig_);
     for (const SlideInfo &slide_info : self_->slide_info_) {
       this->slide(slide_info.curves_to_slide, reverse_uv_sampler_orig, slide_info.brush_transform);
     }
@@ -4,7 +4,10 @@
 #include "mesh_brush_common.hh"
 
 #include "BLI_bit_span.hh"
+#include "BLI_rand.hh"
+#include "BLI_timeit.hh"
 
+#include "BKE_brush.hh"
 #include "BKE_idtype.hh"
 #include "BKE_lib_id.hh"
 
@@ -59,4 +62,100 @@ TEST_F(MeshTests, calc_vert_neighbors_interior)
     ASSERT_EQ(result[i].size(), 3);
   }
 }
+/* Sizes that are not a multiple of the SIMD width, to test the remaining elements as well. */
+static constexpr int kernel_test_size = 103;
+
+static Array<float> random_factors(const int size, RandomNumberGenerator &rng)
+{
+  Array<float> factors(size);
+  for (float &factor : factors) {
+    factor = rng.get_float();
+  }
+  return factors;
+}
+
+TEST(brush_kernels, calc_front_face)
+{
+  RandomNumberGenerator rng(0);
+  const float3 view_normal = math::normalize(float3(0.3f, -0.5f, 0.8f));
+  Array<float3> normals(kernel_test_size);
+  for (float3 &normal : normals) {
+    normal = rng.get_unit_float3();
+  }
+  const Array<float> factors_orig = random_factors(kernel_test_size, rng);
+
+  Array<float> factors = factors_orig;
+  calc_front_face(view_normal, normals, factors);
+  for (const int i : normals.index_range()) {
+    const float expected = factors_orig[i] * std::max(math::dot(view_normal, normals[i]), 0.0f);
+    EXPECT_NEAR(factors[i], expected, 1e-6f);
+  }
+}
+
+TEST(brush_kernels, calc_curve_factors)
+{
+  RandomNumberGenerator rng(0);
+  const float radius = 2.0f;
+  Array<float> distances(kernel_test_size);
+  for (float &distance : distances) {
+    /* Include distances outside of the radius. */
+    distance = rng.get_float() * radius * 1.5f;
+  }
+  distances[0] = radius;
+  distances[1] = 0.0f;
+  const Array<float> factors_orig = random_factors(kernel_test_size, rng);
+
+  for (const eBrushCurvePreset preset : {BRUSH_CURVE_SMOOTH,
+                                         BRUSH_CURVE_SPHERE,
+                                         BRUSH_CURVE_ROOT,
+                                         BRUSH_CURVE_SHARP,
+                                         BRUSH_CURVE_LIN,
+                                         BRUSH_CURVE_POW4,
+                                         BRUSH_CURVE_INVSQUARE,
+                                         BRUSH_CURVE_CONSTANT,
+                                         BRUSH_CURVE_SMOOTHER})
+  {
+    Array<float> factors = factors_orig;
+    BKE_brush_calc_curve_factors(preset, nullptr, distances, radius, factors);
+    for (const int i : distances.index_range()) {
+      const float expected = factors_orig[i] *
+                             BKE_brush_curve_strength(preset, nullptr, distances[i], radius);
+      EXPECT_NEAR(factors[i], expected, 1e-5f);
+    }
+  }
+}
+
+/**
+ * Set this to 1 to activate the benchmark of the falloff kernels used by most mesh brushes.
+ */
+#if 0
+TEST(brush_kernels, Benchmark)
+{
+  const int size = 20'000'000;
+  RandomNumberGenerator rng(0);
+  const float3 view_normal = math::normalize(float3(0.3f, -0.5f, 0.8f));
+  Array<float3> normals(size);
+  Array<float> distances(size);
+  for (const int i : IndexRange(size)) {
+    normals[i] = rng.get_unit_float3();
+    distances[i] = rng.get_float() * distances.size();
+  }
+  Array<float> factors(size, 1.0f);
+  for ([[maybe_unused]] const int i : IndexRange(5)) {
+    {
+      SCOPED_TIMER("calc_front_face");
+      calc_front_face(view_normal, normals, factors);
+    }
+    {
+      SCOPED_TIMER("filter_distances_with_radius");
+      filter_distances_with_radius(size * 0.5f, distances, factors);
+    }
+    {
+      SCOPED_TIMER("calc_curve_factors");
+      BKE_brush_calc_curve_factors(BRUSH_CURVE_SMOOTH, nullptr, distances, size * 0.5f, factors);
+    }
+  }
+}
+#endif
+
 }  // namespace blender::ed::sculpt_paint::tests
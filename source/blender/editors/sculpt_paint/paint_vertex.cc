@@ -2058,8 +2058,6 @@ static void vpaint_stroke_update_step(bContext *C,
 
   swap_m4m4(vc.rv3d->persmat, mat);
 
-  BKE_mesh_batch_cache_dirty_tag((Mesh *)ob.data, BKE_MESH_BATCH_DIRTY_ALL);
-
   Brush &brush = *BKE_paint_brush(&vp.paint);
   if (brush.vertex_brush_type == VPAINT_BRUSH_TYPE_SMEAR) {
     vpd.smear.color_prev = vpd.smear.color_curr;
@@ -2073,6 +2071,8 @@ static void vpaint_stroke_update_step(bContext *C,
 
   ED_region_tag_redraw(vc.region);
 
+  /* The viewport draws the evaluated mesh, whose draw cache is rebuilt by this update anyway, so
+   * the original mesh's draw cache does not have to be tagged for every step. */
   DEG_id_tag_update((ID *)ob.data, ID_RECALC_GEOMETRY);
 }
 
@@ -1850,9 +1850,9 @@ static void wpaint_stroke_update_step(bContext *C,
   mul_v3_m4v3(loc_world, ob->object_to_world().ptr(), ss.cache->location);
   vwpaint::last_stroke_update(loc_world, wp.paint);
 
-  BKE_mesh_batch_cache_dirty_tag(&mesh, BKE_MESH_BATCH_DIRTY_ALL);
-
-  DEG_id_tag_update(&mesh.id, 0);
+  /* Only the deform weights changed, so tagging the geometry is enough to update the evaluated
+   * mesh and its draw cache. See #vpaint_stroke_update_step. */
+  DEG_id_tag_update(&mesh.id, ID_RECALC_GEOMETRY);
   WM_event_add_notifier(C, NC_OBJECT | ND_DRAW, ob);
   swap_m4m4(wpd->vc.rv3d->persmat, mat);
 
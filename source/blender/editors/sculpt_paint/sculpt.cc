@@ -27,6 +27,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_rect.h"
 #include "BLI_set.hh"
+#include "BLI_simd.hh"
 #include "BLI_span.hh"
 #include "BLI_task.h"
 #include "BLI_task.hh"
@@ -3610,7 +3611,21 @@ static void sculpt_fix_noise_tear(const Sculpt &sd, Object &ob)
   const MTex *mtex = BKE_brush_mask_texture_get(&brush, OB_MODE_SCULPT);
 
   if (ss.multires.active && mtex->tex && mtex->tex->type == TEX_NOISE) {
-    multires_stitch_grids(&ob);
+    const bke::pbvh::Tree &pbvh = *bke::object::pbvh_get(ob);
+    const SubdivCCG &subdiv_ccg = *ss.subdiv_ccg;
+    IndexMaskMemory memory;
+    const IndexMask node_mask = pbvh.nodes_with_changed_positions(memory);
+    if (node_mask.is_empty()) {
+      /* Brushes that don't change positions, like the mask brush, don't tag changed nodes in a
+       * way that can be retrieved here. */
+      multires_stitch_grids(&ob, subdiv_ccg.faces.index_range());
+      return;
+    }
+    /* Only the faces in the nodes changed by the stroke step can be torn. */
+    multires_stitch_grids(
+        &ob,
+        bke::pbvh::nodes_to_face_selection_grids(
+            subdiv_ccg, pbvh.nodes<bke::pbvh::GridsNode>(), node_mask, memory));
   }
 }
 
@@ -6897,7 +6912,35 @@ void calc_front_face(const float3 &view_normal,
 {
   BLI_assert(normals.size() == factors.size());
 
-  for (const int i : normals.index_range()) {
+  int64_t i = 0;
+#if BLI_HAVE_SSE2
+  const __m128 view_x = _mm_set1_ps(view_normal.x);
+  const __m128 view_y = _mm_set1_ps(view_normal.y);
+  const __m128 view_z = _mm_set1_ps(view_normal.z);
+  const __m128 zero = _mm_setzero_ps();
+  for (; i + 4 <= normals.size(); i += 4) {
+    /* Load four normals (x0 y0 z0 x1, y1 z1 x2 y2, z2 x3 y3 z3) and transpose them into separate
+     * vectors for the X, Y and Z components. */
+    const float *src = &normals[i].x;
+    const __m128 a = _mm_loadu_ps(src);
+    const __m128 b = _mm_loadu_ps(src + 4);
+    const __m128 c = _mm_loadu_ps(src + 8);
+    const __m128 x = _mm_shuffle_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 0)),
+                                    _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2)),
+                                    _MM_SHUFFLE(3, 0, 1, 0));
+    const __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+                                    _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)),
+                                    _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+                                    _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)),
+                                    _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 dot = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(view_x, x), _mm_mul_ps(view_y, y)), _mm_mul_ps(view_z, z));
+    float *dst = factors.data() + i;
+    _mm_storeu_ps(dst, _mm_mul_ps(_mm_loadu_ps(dst), _mm_max_ps(dot, zero)));
+  }
+#endif
+  for (; i < normals.size(); i++) {
     const float dot = math::dot(view_normal, normals[i]);
     factors[i] *= std::max(dot, 0.0f);
   }
@@ -7004,6 +7047,34 @@ void filter_region_clip_factors(const SculptSession &ss,
   }
 }
 
+/**
+ * Squared distance of a point to the line through \a location along the normalized \a axis. The
+ * same as the distance of the point's projection onto the plane with that normal to the location,
+ * but written inline without the plane equation, so that the loops using it are vectorized.
+ */
+BLI_INLINE float distance_squared_to_normalized_axis(const float3 &location,
+                                                     const float3 &axis,
+                                                     const float3 &position)
+{
+  const float3 offset = position - location;
+  return math::length_squared(offset - axis * math::dot(axis, offset));
+}
+
+/** Replace squared distances with distances. */
+static void sqrt_distances(const MutableSpan<float> distances)
+{
+  float *data = distances.data();
+  int64_t i = 0;
+#if BLI_HAVE_SSE2
+  for (; i + 4 <= distances.size(); i += 4) {
+    _mm_storeu_ps(data + i, _mm_sqrt_ps(_mm_loadu_ps(data + i)));
+  }
+#endif
+  for (; i < distances.size(); i++) {
+    data[i] = std::sqrt(data[i]);
+  }
+}
+
 void calc_brush_distances_squared(const SculptSession &ss,
                                   const Span<float3> positions,
                                   const Span<int> verts,
@@ -7017,12 +7088,9 @@ void calc_brush_distances_squared(const SculptSession &ss,
     /* The tube falloff shape requires the cached view normal. */
     const float3 &view_normal = ss.cache ? ss.cache->view_normal_symm :
                                            ss.filter_cache->view_normal;
-    float4 test_plane;
-    plane_from_point_normal_v3(test_plane, test_location, view_normal);
     for (const int i : verts.index_range()) {
-      float3 projected;
-      closest_to_plane_normalized_v3(projected, test_plane, positions[verts[i]]);
-      r_distances[i] = math::distance_squared(projected, test_location);
+      r_distances[i] = distance_squared_to_normalized_axis(
+          test_location, view_normal, positions[verts[i]]);
     }
   }
   else {
@@ -7039,9 +7107,7 @@ void calc_brush_distances(const SculptSession &ss,
                           const MutableSpan<float> r_distances)
 {
   calc_brush_distances_squared(ss, positions, verts, falloff_shape, r_distances);
-  for (float &value : r_distances) {
-    value = std::sqrt(value);
-  }
+  sqrt_distances(r_distances);
 }
 
 void calc_brush_distances_squared(const SculptSession &ss,
@@ -7056,12 +7122,9 @@ void calc_brush_distances_squared(const SculptSession &ss,
     /* The tube falloff shape requires the cached view normal. */
     const float3 &view_normal = ss.cache ? ss.cache->view_normal_symm :
                                            ss.filter_cache->view_normal;
-    float4 test_plane;
-    plane_from_point_normal_v3(test_plane, test_location, view_normal);
     for (const int i : positions.index_range()) {
-      float3 projected;
-      closest_to_plane_normalized_v3(projected, test_plane, positions[i]);
-      r_distances[i] = math::distance_squared(projected, test_location);
+      r_distances[i] = distance_squared_to_normalized_axis(
+          test_location, view_normal, positions[i]);
     }
   }
   else {
@@ -7077,19 +7140,16 @@ void calc_brush_distances(const SculptSession &ss,
                           const MutableSpan<float> r_distances)
 {
   calc_brush_distances_squared(ss, positions, falloff_shape, r_distances);
-  for (float &value : r_distances) {
-    value = std::sqrt(value);
-  }
+  sqrt_distances(r_distances);
 }
 
 void filter_distances_with_radius(const float radius,
                                   const Span<float> distances,
                                   const MutableSpan<float> factors)
 {
+  /* Written without a branch so that the loop is vectorized. */
   for (const int i : distances.index_range()) {
-    if (distances[i] >= radius) {
-      factors[i] = 0.0f;
-    }
+    factors[i] = distances[i] >= radius ? 0.0f : factors[i];
   }
 }
 
@@ -7149,14 +7209,10 @@ void apply_hardness_to_distances(const float radius,
   }
   const float radius_inv = math::rcp(radius);
   const float hardness_inv_rcp = math::rcp(1.0f - hardness);
+  /* Written without a branch so that the loop is vectorized. */
   for (const int i : distances.index_range()) {
-    if (distances[i] < threshold) {
-      distances[i] = 0.0f;
-    }
-    else {
-      const float radius_factor = (distances[i] * radius_inv - hardness) * hardness_inv_rcp;
-      distances[i] = radius_factor * radius;
-    }
+    const float radius_factor = (distances[i] * radius_inv - hardness) * hardness_inv_rcp;
+    distances[i] = distances[i] < threshold ? 0.0f : radius_factor * radius;
   }
 }
 
@@ -7309,6 +7365,42 @@ void apply_crazyspace_to_translations(const Span<float3x3> deform_imats,
   }
 }
 
+namespace {
+
+/**
+ * Clipping of translations against one axis of the mirror modifier's mirror object. Vertices close
+ * to the mirror plane are moved onto the plane along that axis, which only needs the single
+ * component of the position in the mirror space.
+ */
+struct MirrorClipAxis {
+  /** Row of the mirror matrix that computes the clipped component in the mirror space. */
+  float4 mirror_row;
+  /** How much a change of that component in the mirror space moves the local position. */
+  float mirror_inverse_scale;
+  float tolerance;
+
+  MirrorClipAxis(const decltype(StrokeCache::mirror_modifier_clip) &clip_data, const int axis)
+  {
+    const float4x4 &mirror = clip_data.mat;
+    const float4x4 &mirror_inverse = clip_data.mat_inv;
+    mirror_row = float4(mirror[0][axis], mirror[1][axis], mirror[2][axis], mirror[3][axis]);
+    mirror_inverse_scale = mirror_inverse[axis][axis];
+    tolerance = clip_data.tolerance[axis];
+  }
+
+  /**
+   * Transforming into the space of the mirror plane, clearing the component there and transforming
+   * back changes the local component by the mirror space component times the scale.
+   */
+  float clip(const float3 &position, const float translation) const
+  {
+    const float co_mirror = math::dot(mirror_row.xyz(), position) + mirror_row.w;
+    return std::abs(co_mirror) > tolerance ? translation : -co_mirror * mirror_inverse_scale;
+  }
+};
+
+}  // namespace
+
 void clip_and_lock_translations(const Sculpt &sd,
                                 const SculptSession &ss,
                                 const Span<float3> positions,
@@ -7333,20 +7425,9 @@ void clip_and_lock_translations(const Sculpt &sd,
       continue;
     }
 
-    const float4x4 mirror(cache->mirror_modifier_clip.mat);
-    const float4x4 mirror_inverse(cache->mirror_modifier_clip.mat_inv);
+    const MirrorClipAxis clip(cache->mirror_modifier_clip, axis);
     for (const int i : verts.index_range()) {
-      const int vert = verts[i];
-
-      /* Transform into the space of the mirror plane, check translations, then transform back. */
-      float3 co_mirror = math::transform_point(mirror, positions[vert]);
-      if (math::abs(co_mirror[axis]) > cache->mirror_modifier_clip.tolerance[axis]) {
-        continue;
-      }
-      /* Clear the translation in the local space of the mirror object. */
-      co_mirror[axis] = 0.0f;
-      const float3 co_local = math::transform_point(mirror_inverse, co_mirror);
-      translations[i][axis] = co_local[axis] - positions[vert][axis];
+      translations[i][axis] = clip.clip(positions[verts[i]], translations[i][axis]);
     }
   }
 }
@@ -7374,18 +7455,9 @@ void clip_and_lock_translations(const Sculpt &sd,
       continue;
     }
 
-    const float4x4 mirror(cache->mirror_modifier_clip.mat);
-    const float4x4 mirror_inverse(cache->mirror_modifier_clip.mat_inv);
+    const MirrorClipAxis clip(cache->mirror_modifier_clip, axis);
     for (const int i : positions.index_range()) {
-      /* Transform into the space of the mirror plane, check translations, then transform back. */
-      float3 co_mirror = math::transform_point(mirror, positions[i]);
-      if (math::abs(co_mirror[axis]) > cache->mirror_modifier_clip.tolerance[axis]) {
-        continue;
-      }
-      /* Clear the translation in the local space of the mirror object. */
-      co_mirror[axis] = 0.0f;
-      const float3 co_local = math::transform_point(mirror_inverse, co_mirror);
-      translations[i][axis] = co_local[axis] - positions[i][axis];
+      translations[i][axis] = clip.clip(positions[i], translations[i][axis]);
     }
   }
 }
@@ -26,6 +26,8 @@
 
 #include <mutex>
 
+#include <zstd.h>
+
 #include "CLG_log.h"
 
 #include "BLI_array.hh"
@@ -150,6 +152,12 @@ struct Node {
   Array<int, 0> face_sets;
 
   Vector<int> face_indices;
+
+  /**
+   * When not empty, the arrays above are stored in this zstd frame instead, see #compress_node.
+   * Only done for older undo steps.
+   */
+  Array<std::byte, 0> compressed;
 };
 
 struct SculptAttrRef {
@@ -257,6 +265,9 @@ struct StepData {
 
   size_t undo_size;
 
+  /** True when the arrays of all #nodes are compressed, see #compress_step. */
+  bool is_compressed = false;
+
   /** Whether processing code needs to handle the current data as an undo step. */
   bool needs_undo() const
   {
@@ -1786,9 +1797,175 @@ static size_t node_size_in_bytes(const Node &node)
   size += node.grid_hidden.all_bits().size() / 8;
   size += node.face_sets.as_span().size_in_bytes();
   size += node.face_indices.as_span().size_in_bytes();
+  size += node.compressed.size();
   return size;
 }
 
+static size_t step_size_in_bytes(const StepData &step_data)
+{
+  return threading::parallel_reduce(
+      step_data.nodes.index_range(),
+      16,
+      0,
+      [&](const IndexRange range, size_t size) {
+        for (const int i : range) {
+          size += node_size_in_bytes(*step_data.nodes[i]);
+        }
+        return size;
+      },
+      std::plus<size_t>());
+}
+
+/** Call \a fn for all arrays of the node that are worth compressing, always in the same order. */
+template<typename Fn> static void foreach_compressible_array(Node &node, const Fn &fn)
+{
+  fn(node.position);
+  fn(node.orig_position);
+  fn(node.col);
+  fn(node.mask);
+  fn(node.loop_col);
+  fn(node.vert_indices);
+  fn(node.corner_indices);
+  fn(node.grids);
+  fn(node.face_sets);
+  fn(node.face_indices);
+}
+
+/** Compressing small nodes gains too little to justify the decompression cost on undo. */
+static constexpr int64_t node_compress_min_size = 4096;
+/** Favor speed, undo steps are compressed while the user is working. */
+static constexpr int node_compress_level = 1;
+/** Sculpt undo steps this far behind the newest one are compressed. */
+static constexpr int step_compress_distance = 2;
+
+/**
+ * All stored arrays consist of 4 byte values (float, int and their vectors). Storing the first
+ * bytes of all values first, then all second bytes and so on groups the similar exponent and high
+ * order bytes, which compresses much better than the interleaved values.
+ */
+static void shuffle_bytes(const Span<std::byte> src, MutableSpan<std::byte> dst)
+{
+  const int64_t values_num = src.size() / 4;
+  for (const int64_t i : IndexRange(values_num)) {
+    for (const int64_t byte : IndexRange(4)) {
+      dst[byte * values_num + i] = src[i * 4 + byte];
+    }
+  }
+}
+
+static void unshuffle_bytes(const Span<std::byte> src, MutableSpan<std::byte> dst)
+{
+  const int64_t values_num = src.size() / 4;
+  for (const int64_t i : IndexRange(values_num)) {
+    for (const int64_t byte : IndexRange(4)) {
+      dst[i * 4 + byte] = src[byte * values_num + i];
+    }
+  }
+}
+
+/**
+ * Replace the arrays of the node with a single compressed buffer. The uncompressed buffer starts
+ * with the sizes of all arrays, followed by the byte-shuffled data of each array.
+ */
+static void compress_node(Node &node)
+{
+  if (!node.compressed.is_empty()) {
+    return;
+  }
+  Vector<int64_t, 16> sizes;
+  int64_t data_size = 0;
+  foreach_compressible_array(node, [&](const auto &array) {
+    using T = typename std::decay_t<decltype(array)>::value_type;
+    static_assert(sizeof(T) % 4 == 0);
+    sizes.append(array.size());
+    data_size += array.size() * sizeof(T);
+  });
+  if (data_size < node_compress_min_size) {
+    return;
+  }
+
+  const int64_t header_size = sizes.as_span().size_in_bytes();
+  Array<std::byte> raw(header_size + data_size);
+  raw.as_mutable_span().take_front(header_size).copy_from(sizes.as_span().cast<std::byte>());
+  int64_t offset = header_size;
+  foreach_compressible_array(node, [&](const auto &array) {
+    const Span<std::byte> bytes = array.as_span().template cast<std::byte>();
+    shuffle_bytes(bytes, raw.as_mutable_span().slice(offset, bytes.size()));
+    offset += bytes.size();
+  });
+
+  Array<std::byte> buffer(ZSTD_compressBound(raw.size()));
+  const size_t compressed_size = ZSTD_compress(
+      buffer.data(), buffer.size(), raw.data(), raw.size(), node_compress_level);
+  if (ZSTD_isError(compressed_size) || compressed_size >= size_t(data_size)) {
+    return;
+  }
+
+  /* Don't keep the slack of the compression bound around. */
+  node.compressed = buffer.as_span().take_front(compressed_size);
+  foreach_compressible_array(node, [&](auto &array) { array = {}; });
+}
+
+static void decompress_node(Node &node)
+{
+  if (node.compressed.is_empty()) {
+    return;
+  }
+  const unsigned long long raw_size = ZSTD_getFrameContentSize(node.compressed.data(),
+                                                                node.compressed.size());
+  BLI_assert(!ELEM(raw_size, ZSTD_CONTENTSIZE_UNKNOWN, ZSTD_CONTENTSIZE_ERROR));
+  Array<std::byte> raw(raw_size);
+  const size_t size = ZSTD_decompress(
+      raw.data(), raw.size(), node.compressed.data(), node.compressed.size());
+  BLI_assert(!ZSTD_isError(size) && size == raw_size);
+  UNUSED_VARS_NDEBUG(size);
+
+  int64_t offset = 0;
+  foreach_compressible_array(node, [&](const auto & /*array*/) { offset += sizeof(int64_t); });
+  const Span<int64_t> sizes = raw.as_span().take_front(offset).cast<int64_t>();
+  int array_index = 0;
+  foreach_compressible_array(node, [&](auto &array) {
+    array = std::decay_t<decltype(array)>(sizes[array_index++]);
+    const MutableSpan<std::byte> bytes = array.as_mutable_span().template cast<std::byte>();
+    unshuffle_bytes(raw.as_span().slice(offset, bytes.size()), bytes);
+    offset += bytes.size();
+  });
+  node.compressed = {};
+}
+
+/**
+ * Compress the arrays of all nodes of an undo step that is not the newest one anymore. The data of
+ * compressed steps is only accessed when undoing or redoing them, see #step_restore.
+ */
+static void compress_step(SculptUndoStep &us)
+{
+  StepData &step_data = us.data;
+  if (step_data.is_compressed) {
+    return;
+  }
+  threading::parallel_for(step_data.nodes.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      compress_node(*step_data.nodes[i]);
+    }
+  });
+  step_data.is_compressed = true;
+  step_data.undo_size = step_size_in_bytes(step_data);
+  us.step.data_size = step_data.undo_size;
+}
+
+static void decompress_step(StepData &step_data)
+{
+  if (!step_data.is_compressed) {
+    return;
+  }
+  threading::parallel_for(step_data.nodes.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      decompress_node(*step_data.nodes[i]);
+    }
+  });
+  step_data.is_compressed = false;
+}
+
 void push_end_ex(Object &ob, const bool use_nested_undo)
 {
   StepData *step_data = get_step_data();
@@ -1809,17 +1986,7 @@ void push_end_ex(Object &ob, const bool use_nested_undo)
    * just one positions array that has a different semantic meaning depending on whether there are
    * deform modifiers. */
 
-  step_data->undo_size = threading::parallel_reduce(
-      step_data->nodes.index_range(),
-      16,
-      0,
-      [&](const IndexRange range, size_t size) {
-        for (const int i : range) {
-          size += node_size_in_bytes(*step_data->nodes[i]);
-        }
-        return size;
-      },
-      std::plus<size_t>());
+  step_data->undo_size = step_size_in_bytes(*step_data);
 
   /* We could remove this and enforce all callers run in an operator using 'OPTYPE_UNDO'. */
   wmWindowManager *wm = static_cast<wmWindowManager *>(G_MAIN->wm.first);
@@ -1925,14 +2092,39 @@ static bool step_encode(bContext * /*C*/, Main *bmain, UndoStep *us_p)
     bmain->is_memfile_undo_flush_needed = true;
   }
 
+  /* The new step is not part of the stack yet, so the newest sculpt step in the stack is the
+   * first one behind it. */
+  UndoStack *ustack = ED_undo_stack_get();
+  int distance = 0;
+  LISTBASE_FOREACH_BACKWARD (UndoStep *, us_iter, &ustack->steps) {
+    if (us_iter->type == BKE_UNDOSYS_TYPE_SCULPT && ++distance == step_compress_distance) {
+      compress_step(*reinterpret_cast<SculptUndoStep *>(us_iter));
+      break;
+    }
+  }
+
   return true;
 }
 
+/**
+ * Restore the data of a step, which swaps the stored data with the current state. Compressed
+ * steps are decompressed for that and compressed again afterwards.
+ */
+static void step_restore(bContext *C, Depsgraph *depsgraph, SculptUndoStep *us)
+{
+  const bool was_compressed = us->data.is_compressed;
+  decompress_step(us->data);
+  restore_list(C, depsgraph, us->data);
+  if (was_compressed) {
+    compress_step(*us);
+  }
+}
+
 static void step_decode_undo_impl(bContext *C, Depsgraph *depsgraph, SculptUndoStep *us)
 {
   BLI_assert(us->step.is_applied == true);
 
-  restore_list(C, depsgraph, us->data);
+  step_restore(C, depsgraph, us);
   us->step.is_applied = false;
 }
 
@@ -1940,7 +2132,7 @@ static void step_decode_redo_impl(bContext *C, Depsgraph *depsgraph, SculptUndoS
 {
   BLI_assert(us->step.is_applied == false);
 
-  restore_list(C, depsgraph, us->data);
+  step_restore(C, depsgraph, us);
   us->step.is_applied = true;
 }
 
@@ -1497,6 +1497,10 @@ static void createTransEditVerts(bContext * /*C*/, TransInfo *t)
     BMEditMesh *em = BKE_editmesh_from_object(tc->obedit);
     Mesh *mesh = static_cast<Mesh *>(tc->obedit->data);
     BMesh *bm = em->bm;
+
+    /* Convert the whole mesh once for the first update, since the conversion from before
+     * the transform may be outdated. */
+    BKE_editmesh_eval_cache_clear(em);
     BMVert *eve;
     BMIter iter;
     float mtx[3][3], smtx[3][3];
@@ -2063,6 +2067,9 @@ static void recalcData_mesh(TransInfo *t)
 {
   if (t->mode == TFM_NORMAL_ROTATION) {
     FOREACH_TRANS_DATA_CONTAINER (t, tc) {
+      /* Custom normals change, so the previous conversion can't be reused, even when switching
+       * to this mode after moving vertices. */
+      BKE_editmesh_eval_cache_clear(BKE_editmesh_from_object(tc->obedit));
       /* The Rotate Normal mode uses a  custom array and ignores any elements created for the mesh
        * in transData and similar structures. */
       DEG_id_tag_update(static_cast<ID *>(tc->obedit->data), ID_RECALC_GEOMETRY);
@@ -2095,6 +2102,16 @@ static void recalcData_mesh(TransInfo *t)
   mesh_partial_types_calc(t, &partial_state);
 
   FOREACH_TRANS_DATA_CONTAINER (t, tc) {
+    BMEditMesh *em = BKE_editmesh_from_object(tc->obedit);
+    const TransCustomDataMesh *tcmd = static_cast<const TransCustomDataMesh *>(
+        tc->custom.type.data);
+    if (tcmd && tcmd->cd_layer_correct) {
+      /* Face corner attributes like UV maps change as well. */
+      BKE_editmesh_eval_cache_clear(em);
+    }
+    else {
+      BKE_editmesh_eval_cache_tag_positions_changed(em);
+    }
     DEG_id_tag_update(static_cast<ID *>(tc->obedit->data), ID_RECALC_GEOMETRY);
 
     mesh_partial_update(t, tc, &partial_state);
@@ -2112,6 +2129,11 @@ static void special_aftertrans_update__mesh(bContext * /*C*/, TransInfo *t)
   const bool is_canceling = (t->state == TRANS_CANCEL);
   const bool use_automerge = !is_canceling && (t->flag & (T_AUTOMERGE | T_AUTOSPLIT)) != 0;
 
+  /* Other changes than moving vertices may follow, and the conversion isn't needed anymore. */
+  FOREACH_TRANS_DATA_CONTAINER (t, tc) {
+    BKE_editmesh_eval_cache_clear(BKE_editmesh_from_object(tc->obedit));
+  }
+
   if (!is_canceling && ELEM(t->mode, TFM_EDGE_SLIDE, TFM_VERT_SLIDE)) {
     /* NOTE(joeedh): Handle multi-res re-projection,
      * done on transform completion since it's really slow. */
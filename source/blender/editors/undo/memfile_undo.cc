@@ -51,6 +51,36 @@ struct MemFileUndoStep {
   MemFileUndoData *data;
 };
 
+/**
+ * Memfile steps this far behind the newest one get their own buffers compressed, these are
+ * unlikely to be restored soon and typically make up most of the undo memory.
+ */
+#define MEMFILE_UNDO_COMPRESS_STEP_DISTANCE 4
+
+/**
+ * Compress the memfile step that just fell #MEMFILE_UNDO_COMPRESS_STEP_DISTANCE steps behind
+ * \a us_newest (the newest memfile step already in the stack).
+ */
+static void memfile_undosys_step_compress_old(MemFileUndoStep *us_newest)
+{
+  UndoStep *us_old_p = &us_newest->step;
+  for (int i = 1; i < MEMFILE_UNDO_COMPRESS_STEP_DISTANCE && us_old_p; i++) {
+    us_old_p = BKE_undosys_step_same_type_prev(us_old_p);
+  }
+  if (us_old_p == nullptr) {
+    return;
+  }
+  MemFileUndoStep *us_old = (MemFileUndoStep *)us_old_p;
+  if (us_old->data->memfile.is_compressed) {
+    return;
+  }
+  MemFileUndoStep *us_old_next = (MemFileUndoStep *)BKE_undosys_step_same_type_next(us_old_p);
+  const size_t size_saved = BLO_memfile_compress(
+      &us_old->data->memfile, us_old_next ? &us_old_next->data->memfile : nullptr);
+  us_old->data->undo_size -= size_saved;
+  us_old->step.data_size -= size_saved;
+}
+
 static bool memfile_undosys_poll(bContext *C)
 {
   /* other poll functions must run first, this is a catch-all. */
@@ -84,6 +114,12 @@ static bool memfile_undosys_step_encode(bContext * /*C*/, Main *bmain, UndoStep
   us->data = BKE_memfile_undo_encode(bmain, us_prev ? us_prev->data : nullptr);
   us->step.data_size = us->data->undo_size;
 
+  /* Only done once the new step shares its buffers with the previous one, so that compression
+   * never affects data which is still compared against. */
+  if (us_prev) {
+    memfile_undosys_step_compress_old(us_prev);
+  }
+
   /* Store the fact that we should not re-use old data with that undo step, and reset the Main
    * flag. */
   us->step.use_old_bmain_data = !bmain->use_memfile_full_barrier;
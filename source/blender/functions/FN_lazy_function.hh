@@ -250,6 +250,12 @@ class LazyFunction {
    * Allow executing the function even if previously requested values are not yet available.
    */
   bool allow_missing_requested_inputs_ = false;
+  /**
+   * Executing the function is expected to be much cheaper than the overhead of scheduling it on
+   * a separate thread. This is generally the case for functions that only process single values
+   * or build fields.
+   */
+  bool is_cheap_ = false;
 
  public:
   virtual ~LazyFunction() = default;
@@ -313,6 +319,16 @@ class LazyFunction {
     return allow_missing_requested_inputs_;
   }
 
+  /**
+   * If true, the function is expected to execute quickly. The graph executor uses that to avoid
+   * scheduling overhead, e.g. by not enabling multi-threading just because many cheap functions
+   * are ready to run at the same time.
+   */
+  bool is_cheap() const
+  {
+    return is_cheap_;
+  }
+
  private:
   /**
    * Needs to be implemented by subclasses. This is separate from #execute so that additional
@@ -138,6 +138,17 @@ class MultiFunction : NonCopyable, NonMovable {
   virtual ExecutionHints get_execution_hints() const;
 };
 
+/**
+ * Add all parameters of \a full_params to \a r_sliced_params, but only the part that is in the
+ * given index range. This is used to evaluate a function on a shifted mask, so that it does not
+ * have to allocate arrays for all the indices before the range. Only single parameters are
+ * supported.
+ */
+void add_sliced_parameters(const Signature &signature,
+                           Params &full_params,
+                           IndexRange slice_range,
+                           ParamsBuilder &r_sliced_params);
+
 inline ParamsBuilder::ParamsBuilder(const MultiFunction &fn, const IndexMask *mask)
     : ParamsBuilder(fn.signature(), *mask)
 {
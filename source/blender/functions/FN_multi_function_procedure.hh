@@ -262,6 +262,12 @@ class Procedure : NonCopyable, NonMovable {
   DummyInstruction &new_dummy_instruction();
   ReturnInstruction &new_return_instruction();
 
+  /**
+   * Remove an instruction from the procedure. It must not be referenced by any other instruction
+   * anymore. Its outgoing links and variables are reset, so that the procedure stays valid.
+   */
+  void remove_instruction(Instruction &instruction);
+
   void add_parameter(ParamType::InterfaceType interface_type, Variable &variable);
   Span<ConstParameter> params() const;
 
@@ -46,4 +46,25 @@ namespace blender::fn::multi_function::procedure_optimization {
  */
 void move_destructs_up(Procedure &procedure, Instruction &block_end_instr);
 
+/**
+ * Every call instruction in a procedure is evaluated for all indices before the next instruction
+ * starts. So every intermediate variable is stored in an array that is as large as the number of
+ * processed indices. For long chains of cheap element-wise functions (e.g. math nodes), most of
+ * the time is spent writing these arrays to memory and reading them back again.
+ *
+ * This optimization pass replaces sequences of consecutive call instructions that only have
+ * single parameters with a single call to a fused function. The fused function evaluates the
+ * original functions in small chunks, so that intermediate values which are not used outside of
+ * the sequence stay in the CPU cache. Their destruct instructions are removed from the procedure.
+ *
+ * This should run before #move_destructs_up, because it expects that the destruct instructions do
+ * not interrupt the sequences of calls. Like that pass, it only works on a single chain of
+ * instructions.
+ *
+ * \param procedure: The procedure that should be optimized.
+ * \param block_end_instr: The instruction that points to the last instruction within a linear
+ * chain of instructions.
+ */
+void fuse_element_wise_calls(Procedure &procedure, Instruction &block_end_instr);
+
 }  // namespace blender::fn::multi_function::procedure_optimization
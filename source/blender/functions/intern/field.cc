@@ -272,6 +272,7 @@ static void build_multi_function_procedure_for_fields(mf::Procedure &procedure,
 
   mf::ReturnInstruction &return_instr = builder.add_return();
 
+  mf::procedure_optimization::fuse_element_wise_calls(procedure, return_instr);
   mf::procedure_optimization::move_destructs_up(procedure, return_instr);
 
   // std::cout << procedure.to_dot() << "\n";
@@ -222,6 +222,8 @@ struct ScheduledNodes {
   /** Use two stacks of scheduled nodes for different priorities. */
   Vector<const FunctionNode *> priority_;
   Vector<const FunctionNode *> normal_;
+  /** Number of scheduled nodes whose function is not cheap, see #LazyFunction::is_cheap. */
+  int64_t expensive_nodes_num_ = 0;
 
  public:
   void schedule(const FunctionNode &node, const bool is_priority)
@@ -232,17 +234,24 @@ struct ScheduledNodes {
     else {
       this->normal_.append(&node);
     }
+    if (!node.function().is_cheap()) {
+      expensive_nodes_num_++;
+    }
   }
 
   const FunctionNode *pop_next_node()
   {
+    const FunctionNode *node = nullptr;
     if (!this->priority_.is_empty()) {
-      return this->priority_.pop_last();
+      node = this->priority_.pop_last();
     }
-    if (!this->normal_.is_empty()) {
-      return this->normal_.pop_last();
+    else if (!this->normal_.is_empty()) {
+      node = this->normal_.pop_last();
     }
-    return nullptr;
+    if (node != nullptr && !node->function().is_cheap()) {
+      expensive_nodes_num_--;
+    }
+    return node;
   }
 
   bool is_empty() const
@@ -255,6 +264,15 @@ struct ScheduledNodes {
     return priority_.size() + normal_.size();
   }
 
+  /**
+   * Number of scheduled nodes that are not cheap to execute. Only those make it worth to use
+   * multiple threads.
+   */
+  int64_t expensive_nodes_num() const
+  {
+    return expensive_nodes_num_;
+  }
+
   /**
    * Split up the scheduled nodes into two groups that can be worked on in parallel.
    */
@@ -267,6 +285,21 @@ struct ScheduledNodes {
     other.normal_.extend(normal_.as_span().drop_front(normal_split));
     priority_.resize(priority_split);
     normal_.resize(normal_split);
+    this->update_expensive_nodes_num();
+    other.update_expensive_nodes_num();
+  }
+
+ private:
+  void update_expensive_nodes_num()
+  {
+    expensive_nodes_num_ = 0;
+    for (const Span<const FunctionNode *> nodes : {priority_.as_span(), normal_.as_span()}) {
+      for (const FunctionNode *node : nodes) {
+        if (!node->function().is_cheap()) {
+          expensive_nodes_num_++;
+        }
+      }
+    }
   }
 };
 
@@ -814,8 +847,10 @@ class Executor {
       this->run_node_task(*node, current_task, local_data);
 
       /* If there are many nodes scheduled at the same time, it's beneficial to let multiple
-       * threads work on those. */
-      if (current_task.scheduled_nodes.nodes_num() > 128) {
+       * threads work on those. Cheap nodes are not taken into account, because the overhead of
+       * locking every node in multi-threaded mode is larger than what is gained by running them
+       * in parallel. */
+      if (current_task.scheduled_nodes.expensive_nodes_num() > 128) {
         if (this->try_enable_multi_threading()) {
           std::unique_ptr<ScheduledNodes> split_nodes = std::make_unique<ScheduledNodes>();
           current_task.scheduled_nodes.split_into(*split_nodes);
@@ -1196,12 +1231,14 @@ class Executor {
 
     if (input_state.usage == ValueUsage::Used) {
       node_state.missing_required_inputs -= 1;
-      if (node_state.missing_required_inputs == 0 ||
-          (locked_node.node.is_function() && static_cast<const FunctionNode &>(locked_node.node)
-                                                 .function()
-                                                 .allow_missing_requested_inputs()))
-      {
-        this->schedule_node(locked_node, current_task, false);
+      if (!locked_node.node.is_function()) {
+        return;
+      }
+      const LazyFunction &fn = static_cast<const FunctionNode &>(locked_node.node).function();
+      if (node_state.missing_required_inputs == 0 || fn.allow_missing_requested_inputs()) {
+        /* Cheap nodes are run right away, so that chains of them are processed to completion
+         * before other scheduled work, and their inputs can be freed early. */
+        this->schedule_node(locked_node, current_task, fn.is_cheap());
       }
     }
   }
@@ -1446,7 +1483,11 @@ inline void Executor::execute_node(const FunctionNode &node,
     this->push_all_scheduled_nodes_to_task_pool(current_task);
   };
 
-  lazy_threading::HintReceiver blocking_hint_receiver{blocking_hint_fn};
+  /* Cheap nodes don't send hints, so the receiver does not have to be registered. */
+  std::optional<lazy_threading::HintReceiver> blocking_hint_receiver;
+  if (!fn.is_cheap()) {
+    blocking_hint_receiver.emplace(blocking_hint_fn);
+  }
   if (self_.node_execute_wrapper_) {
     self_.node_execute_wrapper_->execute_node(node, node_params, fn_context);
   }
@@ -65,10 +65,10 @@ static int64_t compute_alignment(const int64_t grain_size)
   return 32;
 }
 
-static void add_sliced_parameters(const Signature &signature,
-                                  Params &full_params,
-                                  const IndexRange slice_range,
-                                  ParamsBuilder &r_sliced_params)
+void add_sliced_parameters(const Signature &signature,
+                           Params &full_params,
+                           const IndexRange slice_range,
+                           ParamsBuilder &r_sliced_params)
 {
   for (const int param_index : signature.params.index_range()) {
     const ParamType &param_type = signature.params[param_index].type;
@@ -132,31 +132,46 @@ void MultiFunction::call_auto(const IndexMask &mask, Params params, Context cont
     return;
   }
 
+  auto call_slice = [&](const IndexRange sub_range) {
+    const IndexMask sliced_mask = mask.slice(sub_range);
+    if (!hints.allocates_array) {
+      /* There is no benefit to changing indices in this case. */
+      this->call(sliced_mask, params, context);
+      return;
+    }
+    if (sliced_mask[0] < grain_size) {
+      /* The indices are low, no need to offset them. */
+      this->call(sliced_mask, params, context);
+      return;
+    }
+    const int64_t input_slice_start = sliced_mask[0];
+    const int64_t input_slice_size = sliced_mask.last() - input_slice_start + 1;
+    const IndexRange input_slice_range{input_slice_start, input_slice_size};
+
+    IndexMaskMemory memory;
+    const int64_t offset = -input_slice_start;
+    const IndexMask shifted_mask = mask.slice_and_shift(sub_range, offset, memory);
+
+    ParamsBuilder sliced_params{*this, &shifted_mask};
+    add_sliced_parameters(*signature_ref_, params, input_slice_range, sliced_params);
+    this->call(shifted_mask, sliced_params, context);
+  };
+
   const int64_t alignment = compute_alignment(grain_size);
   threading::parallel_for_aligned(
       mask.index_range(), grain_size, alignment, [&](const IndexRange sub_range) {
-        const IndexMask sliced_mask = mask.slice(sub_range);
+        LinearAllocatorArenaScope allocator_arena_scope;
         if (!hints.allocates_array) {
-          /* There is no benefit to changing indices in this case. */
-          this->call(sliced_mask, params, context);
+          call_slice(sub_range);
           return;
         }
-        if (sliced_mask[0] < grain_size) {
-          /* The indices are low, no need to offset them. */
-          this->call(sliced_mask, params, context);
-          return;
+        /* The scheduler may pass in ranges that are much larger than the grain size. Functions that
+         * allocate intermediate arrays (e.g. procedures with many instructions) are much faster
+         * when those arrays stay small enough to remain in the CPU cache between instructions, so
+         * the range is processed in chunks of the grain size. */
+        for (int64_t start = 0; start < sub_range.size(); start += grain_size) {
+          call_slice(sub_range.slice(start, std::min(grain_size, sub_range.size() - start)));
         }
-        const int64_t input_slice_start = sliced_mask[0];
-        const int64_t input_slice_size = sliced_mask.last() - input_slice_start + 1;
-        const IndexRange input_slice_range{input_slice_start, input_slice_size};
-
-        IndexMaskMemory memory;
-        const int64_t offset = -input_slice_start;
-        const IndexMask shifted_mask = mask.slice_and_shift(sub_range, offset, memory);
-
-        ParamsBuilder sliced_params{*this, &shifted_mask};
-        add_sliced_parameters(*signature_ref_, params, input_slice_range, sliced_params);
-        this->call(shifted_mask, sliced_params, context);
       });
 }
 
@@ -2,6 +2,14 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <algorithm>
+
+#include "BLI_map.hh"
+#include "BLI_set.hh"
+#include "BLI_vector_set.hh"
+
+#include "FN_multi_function_procedure_builder.hh"
+#include "FN_multi_function_procedure_executor.hh"
 #include "FN_multi_function_procedure_optimization.hh"
 
 namespace blender::fn::multi_function::procedure_optimization {
@@ -74,4 +82,303 @@ void move_destructs_up(Procedure &procedure, Instruction &block_end_instr)
   }
 }
 
+/**
+ * Number of indices a fused function evaluates at once. This is small enough so that the
+ * intermediate arrays of typical chains of functions stay in the CPU cache between the
+ * evaluation of the individual functions.
+ */
+static constexpr int64_t fused_chunk_size = 1024;
+
+namespace {
+
+/**
+ * Evaluates a procedure with a linear chain of element-wise functions in small chunks of the
+ * indices. The procedure only allocates the intermediate arrays for a single chunk.
+ */
+class FusedElementWiseFunction : public MultiFunction {
+ private:
+  std::unique_ptr<Procedure> procedure_;
+  ProcedureExecutor executor_;
+  Vector<const MultiFunction *> fns_;
+
+ public:
+  FusedElementWiseFunction(std::unique_ptr<Procedure> procedure,
+                           Vector<const MultiFunction *> fns)
+      : procedure_(std::move(procedure)), executor_(*procedure_), fns_(std::move(fns))
+  {
+    this->set_signature(&executor_.signature());
+  }
+
+  void call(const IndexMask &mask, Params params, Context context) const override
+  {
+    for (int64_t start = 0; start < mask.size(); start += fused_chunk_size) {
+      const IndexRange sub_range = mask.index_range().slice(
+          start, std::min(fused_chunk_size, mask.size() - start));
+      const IndexMask sliced_mask = mask.slice(sub_range);
+      if (sliced_mask[0] == 0) {
+        executor_.call(sliced_mask, params, context);
+        continue;
+      }
+      /* Offset the indices, so that the procedure does not allocate arrays for all the indices
+       * before the chunk. */
+      const int64_t input_slice_start = sliced_mask[0];
+      const int64_t input_slice_size = sliced_mask.last() - input_slice_start + 1;
+      const IndexRange input_slice_range{input_slice_start, input_slice_size};
+
+      IndexMaskMemory memory;
+      const IndexMask shifted_mask = mask.slice_and_shift(sub_range, -input_slice_start, memory);
+
+      ParamsBuilder sliced_params{executor_, &shifted_mask};
+      add_sliced_parameters(executor_.signature(), params, input_slice_range, sliced_params);
+      executor_.call(shifted_mask, sliced_params, context);
+    }
+  }
+
+  std::string debug_name() const override
+  {
+    std::string name = "Fused";
+    for (const MultiFunction *fn : fns_) {
+      name += (fn == fns_.first()) ? ": " : ", ";
+      name += fn->debug_name();
+    }
+    return name;
+  }
+
+ private:
+  ExecutionHints get_execution_hints() const override
+  {
+    ExecutionHints hints;
+    for (const MultiFunction *fn : fns_) {
+      const ExecutionHints fn_hints = fn->execution_hints();
+      hints.min_grain_size = std::min(hints.min_grain_size, fn_hints.min_grain_size);
+      hints.uniform_execution_time &= fn_hints.uniform_execution_time;
+    }
+    return hints;
+  }
+};
+
+}  // namespace
+
+static bool is_element_wise_call(const Instruction &instr)
+{
+  if (instr.type() != InstructionType::Call) {
+    return false;
+  }
+  const MultiFunction &fn = static_cast<const CallInstruction &>(instr).fn();
+  for (const int param_index : fn.param_indices()) {
+    if (!fn.param_type(param_index).data_type().is_single()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Replace the given consecutive call instructions with a single call of a fused function.
+ * \param block_end_index: Index of the first instruction after the calls in the linear block.
+ */
+static void fuse_calls(Procedure &procedure,
+                       const Span<CallInstruction *> calls,
+                       const Map<const Instruction *, int64_t> &index_in_block,
+                       const int64_t block_end_index)
+{
+  Set<const Variable *> procedure_param_variables;
+  for (const ConstParameter &param : procedure.params()) {
+    procedure_param_variables.add(param.variable);
+  }
+  Set<const Instruction *> calls_set;
+  for (const CallInstruction *call_instr : calls) {
+    calls_set.add_new(call_instr);
+  }
+
+  /* All variables used by the calls, in the order of their first use. */
+  VectorSet<Variable *> variables;
+  /* Variables that are initialized by one of the calls. */
+  Set<Variable *> variables_initialized_in_calls;
+  /* Variables that are initialized before the calls and modified by them. */
+  Set<Variable *> variables_modified_in_calls;
+  for (CallInstruction *call_instr : calls) {
+    const MultiFunction &fn = call_instr->fn();
+    for (const int param_index : fn.param_indices()) {
+      Variable *variable = call_instr->params()[param_index];
+      if (variable == nullptr) {
+        continue;
+      }
+      const ParamType::InterfaceType interface_type = fn.param_type(param_index).interface_type();
+      if (variables.add(variable)) {
+        if (interface_type == ParamType::Output) {
+          variables_initialized_in_calls.add_new(variable);
+        }
+      }
+      if (interface_type == ParamType::Mutable && !variables_initialized_in_calls.contains(variable))
+      {
+        variables_modified_in_calls.add(variable);
+      }
+    }
+  }
+
+  /* Variables that are initialized by the calls and are only destructed afterwards. Those don't
+   * have to be arrays for all indices anymore. */
+  Vector<Variable *> internal_variables;
+  for (Variable *variable : variables_initialized_in_calls) {
+    if (procedure_param_variables.contains(variable)) {
+      continue;
+    }
+    bool is_internal = false;
+    for (const Instruction *user : variable->users()) {
+      if (calls_set.contains(user)) {
+        continue;
+      }
+      if (user->type() != InstructionType::Destruct ||
+          index_in_block.lookup_default(user, -1) < block_end_index)
+      {
+        is_internal = false;
+        break;
+      }
+      is_internal = true;
+    }
+    if (is_internal) {
+      internal_variables.append(variable);
+    }
+  }
+  if (internal_variables.is_empty()) {
+    /* All intermediate values are needed later on, so there is nothing to gain. */
+    return;
+  }
+  const Set<Variable *> internal_variables_set(internal_variables.as_span());
+
+  /* Build the procedure that is evaluated by the fused function. */
+  std::unique_ptr<Procedure> fused_procedure = std::make_unique<Procedure>();
+  ProcedureBuilder builder{*fused_procedure};
+  Map<const Variable *, Variable *> fused_variables;
+  Vector<Variable *> fused_call_params;
+  /* Input parameters and internal variables have to be destructed within the fused procedure. */
+  Vector<Variable *> fused_variables_to_destruct;
+  for (Variable *variable : variables) {
+    if (variables_initialized_in_calls.contains(variable)) {
+      continue;
+    }
+    const ParamType::InterfaceType interface_type = variables_modified_in_calls.contains(variable) ?
+                                                        ParamType::Mutable :
+                                                        ParamType::Input;
+    Variable &fused_variable = builder.add_parameter(
+        ParamType(interface_type, variable->data_type()), variable->name());
+    fused_variables.add_new(variable, &fused_variable);
+    fused_call_params.append(variable);
+    if (interface_type == ParamType::Input) {
+      fused_variables_to_destruct.append(&fused_variable);
+    }
+  }
+  Vector<const MultiFunction *> fns;
+  for (CallInstruction *call_instr : calls) {
+    Vector<Variable *> fused_params;
+    for (const Variable *variable : call_instr->params()) {
+      if (variable == nullptr) {
+        fused_params.append(nullptr);
+        continue;
+      }
+      fused_params.append(fused_variables.lookup_or_add_cb(variable, [&]() {
+        return &fused_procedure->new_variable(variable->data_type(), variable->name());
+      }));
+    }
+    builder.add_call_with_all_variables(call_instr->fn(), fused_params);
+    fns.append(&call_instr->fn());
+  }
+  for (Variable *variable : variables) {
+    if (variables_initialized_in_calls.contains(variable) &&
+        !internal_variables_set.contains(variable))
+    {
+      builder.add_output_parameter(*fused_variables.lookup(variable));
+      fused_call_params.append(variable);
+    }
+  }
+  for (const Variable *variable : internal_variables) {
+    fused_variables_to_destruct.append(fused_variables.lookup(variable));
+  }
+  builder.add_destruct(fused_variables_to_destruct);
+  ReturnInstruction &fused_return_instr = builder.add_return();
+  move_destructs_up(*fused_procedure, fused_return_instr);
+  BLI_assert(fused_procedure->validate());
+
+  /* Replace the original calls with a call to the fused function. */
+  const MultiFunction &fused_fn = procedure.construct_function<FusedElementWiseFunction>(
+      std::move(fused_procedure), std::move(fns));
+  CallInstruction &fused_call_instr = procedure.new_call_instruction(fused_fn);
+  fused_call_instr.set_params(fused_call_params);
+
+  CallInstruction &first_call_instr = *calls.first();
+  Instruction *after_calls_instr = calls.last()->next();
+  while (!first_call_instr.prev().is_empty()) {
+    /* Do a copy of the cursor, because #set_next modifies the previous cursors. */
+    const InstructionCursor cursor = first_call_instr.prev()[0];
+    cursor.set_next(procedure, &fused_call_instr);
+  }
+  fused_call_instr.set_next(after_calls_instr);
+  for (CallInstruction *call_instr : calls) {
+    procedure.remove_instruction(*call_instr);
+  }
+
+  /* The internal variables are destructed by the fused function already. */
+  for (Variable *variable : internal_variables) {
+    const Vector<Instruction *> users = variable->users();
+    for (Instruction *user : users) {
+      DestructInstruction &destruct_instr = static_cast<DestructInstruction &>(*user);
+      Instruction *after_destruct_instr = destruct_instr.next();
+      while (!destruct_instr.prev().is_empty()) {
+        const InstructionCursor cursor = destruct_instr.prev()[0];
+        cursor.set_next(procedure, after_destruct_instr);
+      }
+      procedure.remove_instruction(destruct_instr);
+    }
+  }
+}
+
+void fuse_element_wise_calls(Procedure &procedure, Instruction &block_end_instr)
+{
+  /* Gather the linear chain of instructions that ends with the given instruction. */
+  Vector<Instruction *> block;
+  Instruction *current_instr = &block_end_instr;
+  while (current_instr != nullptr) {
+    block.append(current_instr);
+    const Span<InstructionCursor> prev_cursors = current_instr->prev();
+    if (prev_cursors.size() != 1) {
+      /* Stop when there is some branching before this instruction. */
+      break;
+    }
+    current_instr = prev_cursors[0].instruction();
+  }
+  std::reverse(block.begin(), block.end());
+
+  Map<const Instruction *, int64_t> index_in_block;
+  for (const int64_t i : block.index_range()) {
+    index_in_block.add_new(block[i], i);
+  }
+
+  /* Find all sequences first, because fusing them removes instructions from the block. */
+  Vector<IndexRange> sequences;
+  int64_t sequence_start = 0;
+  while (sequence_start < block.size()) {
+    if (!is_element_wise_call(*block[sequence_start])) {
+      sequence_start++;
+      continue;
+    }
+    int64_t sequence_end = sequence_start + 1;
+    while (sequence_end < block.size() && is_element_wise_call(*block[sequence_end])) {
+      sequence_end++;
+    }
+    if (sequence_end - sequence_start >= 2) {
+      sequences.append(IndexRange::from_begin_end(sequence_start, sequence_end));
+    }
+    sequence_start = sequence_end;
+  }
+
+  for (const IndexRange sequence : sequences) {
+    Vector<CallInstruction *> calls;
+    for (Instruction *instr : block.as_span().slice(sequence)) {
+      calls.append(static_cast<CallInstruction *>(instr));
+    }
+    fuse_calls(procedure, calls, index_in_block, sequence.one_after_last());
+  }
+}
+
 }  // namespace blender::fn::multi_function::procedure_optimization
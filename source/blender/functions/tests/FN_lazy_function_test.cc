@@ -30,6 +30,14 @@ class AddLazyFunction : public LazyFunction {
   }
 };
 
+class CheapAddLazyFunction : public AddLazyFunction {
+ public:
+  CheapAddLazyFunction()
+  {
+    is_cheap_ = true;
+  }
+};
+
 class StoreValueFunction : public LazyFunction {
  private:
   int *dst1_;
@@ -178,4 +186,50 @@ TEST(lazy_function, GraphWithCycle)
   EXPECT_EQ(result, 10 * 2 * 5);
 }
 
+TEST(lazy_function, ManyCheapNodes)
+{
+  BLI_task_scheduler_init();
+  const CheapAddLazyFunction add_fn;
+
+  Graph graph;
+  GraphInputSocket &input_socket = graph.add_input(CPPType::get<int>());
+  GraphOutputSocket &output_socket = graph.add_output(CPPType::get<int>());
+
+  /* Many independent chains of cheap nodes that are all ready at the same time, joined at the
+   * end. */
+  const int chains_num = 500;
+  const int chain_length = 10;
+  const int value_1 = 1;
+  const int value_0 = 0;
+  OutputSocket *sum_socket = nullptr;
+  for ([[maybe_unused]] const int chain_i : IndexRange(chains_num)) {
+    OutputSocket *prev_socket = &input_socket;
+    for ([[maybe_unused]] const int i : IndexRange(chain_length)) {
+      FunctionNode &node = graph.add_function(add_fn);
+      graph.add_link(*prev_socket, node.input(0));
+      node.input(1).set_default_value(&value_1);
+      prev_socket = &node.output(0);
+    }
+    FunctionNode &sum_node = graph.add_function(add_fn);
+    graph.add_link(*prev_socket, sum_node.input(0));
+    if (sum_socket) {
+      graph.add_link(*sum_socket, sum_node.input(1));
+    }
+    else {
+      sum_node.input(1).set_default_value(&value_0);
+    }
+    sum_socket = &sum_node.output(0);
+  }
+  graph.add_link(*sum_socket, output_socket);
+
+  graph.update_node_indices();
+
+  GraphExecutor executor_fn{graph, {&input_socket}, {&output_socket}, nullptr, nullptr, nullptr};
+  int result = 0;
+  execute_lazy_function_eagerly(
+      executor_fn, nullptr, nullptr, std::make_tuple(3), std::make_tuple(&result));
+
+  EXPECT_EQ(result, chains_num * (3 + chain_length));
+}
+
 }  // namespace blender::fn::lazy_function::tests
@@ -7,6 +7,7 @@
 #include "FN_multi_function_builder.hh"
 #include "FN_multi_function_procedure_builder.hh"
 #include "FN_multi_function_procedure_executor.hh"
+#include "FN_multi_function_procedure_optimization.hh"
 #include "FN_multi_function_test_common.hh"
 
 namespace blender::fn::multi_function::tests {
@@ -423,4 +424,67 @@ TEST(multi_function_procedure, OutputBufferReplaced)
   EXPECT_EQ(output[2], output_value);
 }
 
+TEST(multi_function_procedure, FuseElementWiseCalls)
+{
+  /**
+   * procedure(int var1, int *var5) {
+   *   int var2 = var1 + var1;
+   *   int var3 = var2 + var1;
+   *   int var4 = var3 + var2;
+   *   var5 = var4 + var1;
+   * }
+   */
+
+  auto add_fn = mf::build::SI2_SO<int, int, int>("add", [](int a, int b) { return a + b; });
+
+  Procedure procedure;
+  ProcedureBuilder builder{procedure};
+
+  Variable *var1 = &builder.add_single_input_parameter<int>();
+  auto [var2] = builder.add_call<1>(add_fn, {var1, var1});
+  auto [var3] = builder.add_call<1>(add_fn, {var2, var1});
+  auto [var4] = builder.add_call<1>(add_fn, {var3, var2});
+  auto [var5] = builder.add_call<1>(add_fn, {var4, var1});
+  builder.add_destruct({var1, var2, var3, var4});
+  ReturnInstruction &return_instr = builder.add_return();
+  builder.add_output_parameter(*var5);
+
+  procedure_optimization::fuse_element_wise_calls(procedure, return_instr);
+  procedure_optimization::move_destructs_up(procedure, return_instr);
+  EXPECT_TRUE(procedure.validate());
+
+  /* All calls are replaced by a single fused call and only the input is destructed. */
+  const Instruction *entry = procedure.entry();
+  ASSERT_EQ(entry->type(), InstructionType::Call);
+  const CallInstruction &fused_call = static_cast<const CallInstruction &>(*entry);
+  EXPECT_EQ(fused_call.fn().param_amount(), 2);
+  ASSERT_EQ(fused_call.next()->type(), InstructionType::Destruct);
+  const DestructInstruction &destruct = static_cast<const DestructInstruction &>(
+      *fused_call.next());
+  EXPECT_EQ(destruct.variable(), var1);
+  EXPECT_EQ(destruct.next(), &return_instr);
+
+  ProcedureExecutor executor{procedure};
+
+  const int size = 5000;
+  Array<int> input_array(size);
+  for (const int i : IndexRange(size)) {
+    input_array[i] = i;
+  }
+  Array<int> output_array(size, -1);
+
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_predicate(
+      IndexRange(size), GrainSize(1024), memory, [](const int64_t i) { return i % 3 != 0; });
+  ParamsBuilder params{executor, &mask};
+  params.add_readonly_single_input(input_array.as_span());
+  params.add_uninitialized_single_output(output_array.as_mutable_span());
+  ContextBuilder context;
+  executor.call(mask, params, context);
+
+  for (const int i : IndexRange(size)) {
+    EXPECT_EQ(output_array[i], (i % 3 == 0) ? -1 : i * 6);
+  }
+}
+
 }  // namespace blender::fn::multi_function::tests
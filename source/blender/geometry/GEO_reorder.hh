@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "BLI_array.hh"
+#include "BLI_math_vector_types.hh"
 #include "BLI_multi_value_map.hh"
 #include "BLI_span.hh"
 
@@ -16,6 +18,27 @@ namespace blender::geometry {
 const MultiValueMap<bke::GeometryComponent::Type, bke::AttrDomain> &
 components_supported_reordering();
 
+/**
+ * Compute the position of every element along a Z-order (Morton) curve through the bounding box
+ * of all positions. Sorting elements by these keys puts elements that are close in space close
+ * to each other in memory as well, which improves cache locality of later spatial queries.
+ * Infinite and NaN positions are ignored for the bounds and are clamped to them, NaN coordinates
+ * to the minimum.
+ */
+void calc_spatial_sort_keys(Span<float3> positions, MutableSpan<uint64_t> r_keys);
+
+/**
+ * Order of the elements along a Z-order curve, which can be used as `old_by_new_map` for the
+ * reorder functions below. Elements with the same key keep their original order.
+ */
+Array<int> spatially_sorted_indices(Span<float3> positions);
+
+/**
+ * Sort the vertices and the faces of the mesh spatially, faces by their centers. Face corners are
+ * moved together with their faces, edges keep their order.
+ */
+Mesh *reorder_mesh_spatially(const Mesh &src_mesh, const bke::AttributeFilter &attribute_filter);
+
 Mesh *reorder_mesh(const Mesh &src_mesh,
                    Span<int> old_by_new_map,
                    bke::AttrDomain domain,
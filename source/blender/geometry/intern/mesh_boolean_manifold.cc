@@ -8,6 +8,7 @@
 
 #  include "BLI_array.hh"
 #  include "BLI_array_utils.hh"
+#  include "BLI_disjoint_set.hh"
 #  include "BLI_map.hh"
 #  include "BLI_math_geom.h"
 #  include "BLI_math_matrix.h"
@@ -1909,6 +1910,100 @@ static bke::GeometrySet join_meshes_with_transforms(const Span<const Mesh *> mes
       geometry::RealizeInstancesOptions());
 }
 
+/**
+ * Group the manifolds into clusters whose bounding boxes overlap transitively. Manifolds in
+ * different clusters can't intersect each other.
+ */
+static Vector<Vector<int>> get_overlapping_clusters(const Span<Manifold> manifolds)
+{
+  Array<manifold::Box> bounds(manifolds.size());
+  threading::parallel_for(manifolds.index_range(), 64, [&](const IndexRange range) {
+    for (const int i : range) {
+      bounds[i] = manifolds[i].BoundingBox();
+    }
+  });
+
+  /* Sweep along the X axis, so that only manifolds overlapping in X have to be compared. */
+  Array<int> sorted_indices(manifolds.size());
+  array_utils::fill_index_range<int>(sorted_indices);
+  std::sort(sorted_indices.begin(), sorted_indices.end(), [&](const int a, const int b) {
+    return bounds[a].min.x < bounds[b].min.x;
+  });
+  DisjointSet<int> clusters(manifolds.size());
+  for (const int i : sorted_indices.index_range()) {
+    const manifold::Box &box = bounds[sorted_indices[i]];
+    for (const int j : sorted_indices.index_range().drop_front(i + 1)) {
+      const manifold::Box &other_box = bounds[sorted_indices[j]];
+      if (other_box.min.x > box.max.x) {
+        break;
+      }
+      if (box.DoesOverlap(other_box)) {
+        clusters.join(sorted_indices[i], sorted_indices[j]);
+      }
+    }
+  }
+
+  Map<int, int> cluster_by_root;
+  Vector<Vector<int>> result;
+  for (const int i : manifolds.index_range()) {
+    const int cluster = cluster_by_root.lookup_or_add_cb(clusters.find_root(i), [&]() {
+      result.append({});
+      return result.size() - 1;
+    });
+    result[cluster].append(i);
+  }
+  return result;
+}
+
+/**
+ * Same as #Manifold::BatchBoolean with #manifold::OpType::Add, but operands that can't intersect
+ * each other are not passed through the boolean at all. Clusters of operands with overlapping
+ * bounds are evaluated in parallel, and their results are simply concatenated. This is a common
+ * case when e.g. scattered instances are joined.
+ */
+static Manifold union_manifolds(const std::vector<Manifold> &manifolds)
+{
+  const Vector<Vector<int>> clusters = get_overlapping_clusters(manifolds);
+  if (clusters.size() == 1) {
+    return Manifold::BatchBoolean(manifolds, manifold::OpType::Add);
+  }
+  std::vector<Manifold> cluster_results(clusters.size());
+  threading::parallel_for_each(clusters.index_range(), [&](const int cluster_i) {
+    const Span<int> cluster = clusters[cluster_i];
+    if (cluster.size() == 1) {
+      cluster_results[cluster_i] = manifolds[cluster.first()];
+      return;
+    }
+    std::vector<Manifold> operands(cluster.size());
+    for (const int i : cluster.index_range()) {
+      operands[i] = manifolds[cluster[i]];
+    }
+    cluster_results[cluster_i] = Manifold::BatchBoolean(operands, manifold::OpType::Add);
+  });
+  for (const Manifold &cluster_result : cluster_results) {
+    if (cluster_result.Status() != Manifold::Error::NoError) {
+      return cluster_result;
+    }
+  }
+  return Manifold::Compose(cluster_results);
+}
+
+/**
+ * Same as #Manifold::BatchBoolean with #manifold::OpType::Subtract, but operands that don't
+ * overlap the bounds of the first manifold are skipped, because they can't change it.
+ */
+static Manifold difference_manifolds(const std::vector<Manifold> &manifolds)
+{
+  const manifold::Box bounds = manifolds[0].BoundingBox();
+  std::vector<Manifold> operands = {manifolds[0]};
+  for (const int i : IndexRange(manifolds.size()).drop_front(1)) {
+    if (manifolds[i].BoundingBox().DoesOverlap(bounds)) {
+      operands.push_back(manifolds[i]);
+    }
+  }
+  return Manifold::BatchBoolean(operands, manifold::OpType::Subtract);
+}
+
 Mesh *mesh_boolean_manifold(Span<const Mesh *> meshes,
                             const Span<float4x4> transforms,
                             const Span<Array<short>> material_remaps,
@@ -1962,14 +2057,21 @@ Mesh *mesh_boolean_manifold(Span<const Mesh *> meshes,
       }
     }
     else {
-      manifold::OpType mop = op == Operation::Intersect ?
-                                 manifold::OpType::Intersect :
-                                 (op == Operation::Union ? manifold::OpType::Add :
-                                                           manifold::OpType::Subtract);
 #  ifdef DEBUG_TIME
       timeit::ScopedTimer timer_bool("DOING BOOLEAN, GETTING MESH_GL RESULT");
 #  endif
-      Manifold man_result = Manifold::BatchBoolean(manifolds, mop);
+      Manifold man_result;
+      switch (op) {
+        case Operation::Intersect:
+          man_result = Manifold::BatchBoolean(manifolds, manifold::OpType::Intersect);
+          break;
+        case Operation::Union:
+          man_result = union_manifolds(manifolds);
+          break;
+        case Operation::Difference:
+          man_result = difference_manifolds(manifolds);
+          break;
+      }
       meshgl_result = man_result.GetMeshGL();
       /* Have to wait until after converting to MeshGL to check status. */
       if (man_result.Status() != Manifold::Error::NoError) {
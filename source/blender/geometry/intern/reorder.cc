@@ -2,6 +2,8 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <cmath>
+
 #include "BKE_attribute.hh"
 #include "BKE_attribute_filters.hh"
 #include "BKE_attribute_math.hh"
@@ -10,12 +12,18 @@
 #include "BKE_deform.hh"
 #include "BKE_geometry_set.hh"
 #include "BKE_instances.hh"
+#include "BKE_lib_id.hh"
 #include "BKE_mesh.hh"
 #include "BKE_pointcloud.hh"
 
 #include "BLI_array.hh"
 #include "BLI_array_utils.hh"
+#include "BLI_bounds.hh"
+#include "BLI_index_mask.hh"
+#include "BLI_math_vector.hh"
 #include "BLI_multi_value_map.hh"
+#include "BLI_sort.hh"
+#include "BLI_task.hh"
 
 #include "DNA_curves_types.h"
 #include "DNA_mesh_types.h"
@@ -43,6 +51,79 @@ components_supported_reordering()
   return supported_types_and_domains;
 }
 
+/** Spread the lower 21 bits of the value, so that there are two zero bits between each of them. */
+static uint64_t expand_bits_3d(uint64_t value)
+{
+  value &= 0x1fffff;
+  value = (value | value << 32) & 0x1f00000000ffff;
+  value = (value | value << 16) & 0x1f0000ff0000ff;
+  value = (value | value << 8) & 0x100f00f00f00f00f;
+  value = (value | value << 4) & 0x10c30c30c30c30c3;
+  value = (value | value << 2) & 0x1249249249249249;
+  return value;
+}
+
+/**
+ * Convert a coordinate that is already scaled to the quantization range to an integer. Written
+ * so that NaN results in zero, because casting it to an integer is undefined.
+ */
+static uint64_t quantize_coordinate(const float value, const float max_value)
+{
+  if (!(value > 0.0f)) {
+    return 0;
+  }
+  return uint64_t(std::min(value, max_value));
+}
+
+void calc_spatial_sort_keys(const Span<float3> positions, MutableSpan<uint64_t> r_keys)
+{
+  BLI_assert(positions.size() == r_keys.size());
+  /* Ignore infinite and NaN positions for the bounds, so that they don't affect the keys of all
+   * other positions. */
+  IndexMaskMemory memory;
+  const IndexMask finite_positions = IndexMask::from_predicate(
+      positions.index_range(), GrainSize(4096), memory, [&](const int64_t i) {
+        const float3 &position = positions[i];
+        return std::isfinite(position.x) && std::isfinite(position.y) &&
+               std::isfinite(position.z);
+      });
+  const std::optional<Bounds<float3>> bounds = bounds::min_max(finite_positions, positions);
+  if (!bounds) {
+    r_keys.fill(0);
+    return;
+  }
+  /* Quantize every axis to 21 bits separately, so that the interleaved key fits into 64 bits. */
+  const float max_coord = float((1 << 21) - 1);
+  const float3 size = bounds->size();
+  float3 scale;
+  for (const int axis : IndexRange(3)) {
+    scale[axis] = size[axis] > 0.0f ? max_coord / size[axis] : 0.0f;
+  }
+  threading::parallel_for(positions.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const float3 coord = (positions[i] - bounds->min) * scale;
+      r_keys[i] = expand_bits_3d(quantize_coordinate(coord.x, max_coord)) |
+                  (expand_bits_3d(quantize_coordinate(coord.y, max_coord)) << 1) |
+                  (expand_bits_3d(quantize_coordinate(coord.z, max_coord)) << 2);
+    }
+  });
+}
+
+Array<int> spatially_sorted_indices(const Span<float3> positions)
+{
+  Array<uint64_t> keys(positions.size());
+  calc_spatial_sort_keys(positions, keys);
+  Array<int> indices(positions.size());
+  array_utils::fill_index_range<int>(indices);
+  parallel_sort(indices.begin(), indices.end(), [&](const int index_a, const int index_b) {
+    if (UNLIKELY(keys[index_a] == keys[index_b])) {
+      return index_a < index_b;
+    }
+    return keys[index_a] < keys[index_b];
+  });
+  return indices;
+}
+
 static void reorder_attributes_group_to_group(const bke::AttributeAccessor src_attributes,
                                               const bke::AttrDomain domain,
                                               const OffsetIndices<int> src_offsets,
@@ -336,6 +417,28 @@ Mesh *reorder_mesh(const Mesh &src_mesh,
   return dst_mesh;
 }
 
+Mesh *reorder_mesh_spatially(const Mesh &src_mesh, const bke::AttributeFilter &attribute_filter)
+{
+  const Array<int> vert_order = spatially_sorted_indices(src_mesh.vert_positions());
+  Mesh *sorted_verts_mesh = reorder_mesh(
+      src_mesh, vert_order, bke::AttrDomain::Point, attribute_filter);
+
+  const Span<float3> positions = sorted_verts_mesh->vert_positions();
+  const OffsetIndices faces = sorted_verts_mesh->faces();
+  const Span<int> corner_verts = sorted_verts_mesh->corner_verts();
+  Array<float3> face_centers(faces.size());
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int face : range) {
+      face_centers[face] = bke::mesh::face_center_calc(positions, corner_verts.slice(faces[face]));
+    }
+  });
+  const Array<int> face_order = spatially_sorted_indices(face_centers);
+  Mesh *dst_mesh = reorder_mesh(
+      *sorted_verts_mesh, face_order, bke::AttrDomain::Face, attribute_filter);
+  BKE_id_free(nullptr, &sorted_verts_mesh->id);
+  return dst_mesh;
+}
+
 PointCloud *reorder_points(const PointCloud &src_pointcloud,
                            Span<int> old_by_new_map,
                            const bke::AttributeFilter &attribute_filter)
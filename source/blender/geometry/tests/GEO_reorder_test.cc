@@ -0,0 +1,65 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <limits>
+
+#include "BLI_array.hh"
+#include "BLI_math_vector_types.hh"
+
+#include "GEO_reorder.hh"
+
+#include "testing/testing.h"
+
+namespace blender::geometry::tests {
+
+/* All 63 bits of the interleaved key are set at the maximum corner of the bounds. */
+static constexpr uint64_t max_key = (uint64_t(1) << 63) - 1;
+
+TEST(reorder, SpatialSortKeys)
+{
+  const Array<float3> positions = {float3(0.0f), float3(1.0f), float3(1.0f, 0.0f, 0.0f)};
+  Array<uint64_t> keys(positions.size());
+  calc_spatial_sort_keys(positions, keys);
+  EXPECT_EQ(keys[0], 0);
+  EXPECT_EQ(keys[1], max_key);
+  EXPECT_GT(keys[2], keys[0]);
+  EXPECT_LT(keys[2], keys[1]);
+}
+
+TEST(reorder, SpatialSortKeysNonFinite)
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const float inf = std::numeric_limits<float>::infinity();
+  const Array<float3> positions = {float3(0.0f),
+                                   float3(1.0f),
+                                   float3(nan),
+                                   float3(inf),
+                                   float3(-inf),
+                                   float3(nan, 1.0f, 1.0f)};
+  Array<uint64_t> keys(positions.size());
+  calc_spatial_sort_keys(positions, keys);
+  /* Non-finite positions don't change the bounds used for the other positions. */
+  EXPECT_EQ(keys[0], 0);
+  EXPECT_EQ(keys[1], max_key);
+  /* NaN is treated like the minimum, infinity is clamped to the bounds. */
+  EXPECT_EQ(keys[2], 0);
+  EXPECT_EQ(keys[3], max_key);
+  EXPECT_EQ(keys[4], 0);
+  EXPECT_EQ(keys[5], max_key & ~uint64_t(0x1249249249249249));
+
+  const Array<int> indices = spatially_sorted_indices(positions);
+  EXPECT_EQ(indices.as_span(), Span<int>({0, 2, 4, 5, 1, 3}));
+}
+
+TEST(reorder, SpatialSortKeysAllNonFinite)
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const Array<float3> positions = {float3(nan), float3(nan, 0.0f, 0.0f)};
+  Array<uint64_t> keys(positions.size(), 1);
+  calc_spatial_sort_keys(positions, keys);
+  EXPECT_EQ(keys[0], 0);
+  EXPECT_EQ(keys[1], 0);
+}
+
+}  // namespace blender::geometry::tests
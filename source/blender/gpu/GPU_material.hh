@@ -93,7 +93,12 @@ using GPUCodegenCallbackFn = void (*)(void *thunk,
  */
 using GPUMaterialPassReplacementCallbackFn = GPUPass *(*)(void *thunk, GPUMaterial *mat);
 
-/** WARNING: gpumaterials thread safety must be ensured by the caller. */
+/**
+ * WARNING: gpumaterials thread safety must be ensured by the caller.
+ *
+ * \param priority: Priority of the deferred compilation of the pass. Engines can use a lower
+ * priority for passes that don't directly contribute to what is visible on screen.
+ */
 GPUMaterial *GPU_material_from_nodetree(
     Material *ma,
     bNodeTree *ntree,
@@ -104,7 +109,8 @@ GPUMaterial *GPU_material_from_nodetree(
     bool deferred_compilation,
     GPUCodegenCallbackFn callback,
     void *thunk,
-    GPUMaterialPassReplacementCallbackFn pass_replacement_cb = nullptr);
+    GPUMaterialPassReplacementCallbackFn pass_replacement_cb = nullptr,
+    CompilationPriority priority = CompilationPriority::Medium);
 
 /* A callback passed to GPU_material_from_callbacks to construct the material graph by adding and
  * linking the necessary GPU material nodes. */
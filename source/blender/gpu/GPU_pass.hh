@@ -28,6 +28,7 @@ GPUPass *GPU_generate_pass(GPUMaterial *material,
                            const char *debug_name,
                            eGPUMaterialEngine engine,
                            bool deferred_compilation,
+                           CompilationPriority priority,
                            GPUCodegenCallbackFn finalize_source_cb,
                            void *thunk,
                            bool optimize_graph);
@@ -138,7 +138,8 @@ GPUMaterial *GPU_material_from_nodetree(Material *ma,
                                         bool deferred_compilation,
                                         GPUCodegenCallbackFn callback,
                                         void *thunk,
-                                        GPUMaterialPassReplacementCallbackFn pass_replacement_cb)
+                                        GPUMaterialPassReplacementCallbackFn pass_replacement_cb,
+                                        CompilationPriority priority)
 {
   /* Search if this material is not already compiled. */
   LISTBASE_FOREACH (LinkData *, link, gpumaterials) {
@@ -176,15 +177,29 @@ GPUMaterial *GPU_material_from_nodetree(Material *ma,
   }
   else {
     /* Create source code and search pass cache for an already compiled version. */
-    mat->pass = GPU_generate_pass(
-        mat, &mat->graph, mat->name.c_str(), engine, deferred_compilation, callback, thunk, false);
+    mat->pass = GPU_generate_pass(mat,
+                                  &mat->graph,
+                                  mat->name.c_str(),
+                                  engine,
+                                  deferred_compilation,
+                                  priority,
+                                  callback,
+                                  thunk,
+                                  false);
   }
 
   /* Determine whether we should generate an optimized variant of the graph.
    * Heuristic is based on complexity of default material pass and shader node graph. */
   if (GPU_pass_should_optimize(mat->pass)) {
-    mat->optimized_pass = GPU_generate_pass(
-        mat, &mat->graph, mat->name.c_str(), engine, true, callback, thunk, true);
+    mat->optimized_pass = GPU_generate_pass(mat,
+                                            &mat->graph,
+                                            mat->name.c_str(),
+                                            engine,
+                                            true,
+                                            CompilationPriority::Low,
+                                            callback,
+                                            thunk,
+                                            true);
   }
 
   gpu_node_graph_free_nodes(&mat->graph);
@@ -223,6 +238,7 @@ GPUMaterial *GPU_material_from_callbacks(eGPUMaterialEngine engine,
                                      __func__,
                                      engine,
                                      false,
+                                     CompilationPriority::Medium,
                                      generate_code_function_cb,
                                      thunk,
                                      false);
@@ -235,6 +251,7 @@ GPUMaterial *GPU_material_from_callbacks(eGPUMaterialEngine engine,
                                                  __func__,
                                                  engine,
                                                  true,
+                                                 CompilationPriority::Low,
                                                  generate_code_function_cb,
                                                  thunk,
                                                  true);
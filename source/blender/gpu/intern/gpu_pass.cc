@@ -51,14 +51,18 @@ struct GPUPass {
    *  Based on a complexity heuristic from pass code generation. */
   bool should_optimize = false;
   bool is_optimization_pass = false;
+  /** Priority of the deferred compilation. Optimization passes always use the lowest one. */
+  CompilationPriority priority = CompilationPriority::Medium;
 
   GPUPass(GPUCodegenCreateInfo *info,
           bool deferred_compilation,
+          CompilationPriority priority,
           bool is_optimization_pass,
           bool should_optimize)
       : create_info(info),
         should_optimize(should_optimize),
-        is_optimization_pass(is_optimization_pass)
+        is_optimization_pass(is_optimization_pass),
+        priority(priority)
   {
     BLI_assert(!is_optimization_pass || !should_optimize);
     if (is_optimization_pass && deferred_compilation) {
@@ -92,7 +96,7 @@ struct GPUPass {
 
   CompilationPriority compilation_priority()
   {
-    return is_optimization_pass ? CompilationPriority::Low : CompilationPriority::Medium;
+    return is_optimization_pass ? CompilationPriority::Low : priority;
   }
 
   void finalize_compilation()
@@ -228,6 +232,7 @@ class GPUPassCache {
   void add(eGPUMaterialEngine engine,
            GPUCodegen &codegen,
            bool deferred_compilation,
+           CompilationPriority priority,
            bool is_optimization_pass)
   {
     std::lock_guard lock(mutex_);
@@ -236,6 +241,7 @@ class GPUPassCache {
         codegen.hash_get(),
         std::make_unique<GPUPass>(codegen.create_info,
                                   deferred_compilation,
+                                  priority,
                                   is_optimization_pass,
                                   codegen.should_optimize_heuristic()));
   };
@@ -369,6 +375,7 @@ GPUPass *GPU_generate_pass(GPUMaterial *material,
                            const char *debug_name,
                            eGPUMaterialEngine engine,
                            bool deferred_compilation,
+                           CompilationPriority priority,
                            GPUCodegenCallbackFn finalize_source_cb,
                            void *thunk,
                            bool optimize_graph)
@@ -414,7 +421,7 @@ GPUPass *GPU_generate_pass(GPUMaterial *material,
   finalize_source_cb(thunk, material, &codegen.output);
 
   codegen.create_info->finalize();
-  g_cache->add(engine, codegen, deferred_compilation, optimize_graph);
+  g_cache->add(engine, codegen, deferred_compilation, priority, optimize_graph);
   codegen.create_info = nullptr;
 
   return g_cache->get(engine, codegen.hash_get(), deferred_compilation, optimize_graph);
@@ -6,9 +6,14 @@
  * \ingroup gpu
  */
 
+#include "BLI_fileops.hh"
 #include "BLI_math_matrix.h"
 #include "BLI_string.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
+#ifdef _WIN32
+#  include "BLI_winstuff.h"
+#endif
 
 #include "GPU_capabilities.hh"
 #include "GPU_debug.hh"
@@ -25,6 +30,7 @@
 #include "gpu_shader_dependency_private.hh"
 #include "gpu_shader_private.hh"
 
+#include <algorithm>
 #include <string>
 
 extern "C" char datatoc_gpu_shader_colorspace_lib_glsl[];
@@ -409,6 +415,53 @@ void GPU_shader_cache_dir_clear_old()
   GPUBackend::get()->shader_cache_dir_clear_old();
 }
 
+namespace blender::gpu {
+
+void shader_cache_dir_clear_old(const StringRefNull cache_dir)
+{
+  /* Files that haven't been used for 30 days are always removed. */
+  const time_t delete_threshold = 60 /*seconds*/ * 60 /*minutes*/ * 24 /*hours*/ * 30 /*days*/;
+  /* Upper bound of the cache size, so caches of large projects don't grow without bounds. */
+  const int64_t max_cache_size = int64_t(2) * 1024 * 1024 * 1024;
+  const time_t ts_now = time(nullptr);
+
+  direntry *entries = nullptr;
+  const uint32_t dir_len = BLI_filelist_dir_contents(cache_dir.c_str(), &entries);
+
+  Vector<const direntry *> kept_entries;
+  int64_t cache_size = 0;
+  for (const int i : IndexRange(dir_len)) {
+    const direntry &entry = entries[i];
+    if (S_ISDIR(entry.s.st_mode)) {
+      continue;
+    }
+    if (entry.s.st_mtime + delete_threshold < ts_now) {
+      BLI_delete(entry.path, false, false);
+      continue;
+    }
+    kept_entries.append(&entry);
+    cache_size += entry.s.st_size;
+  }
+
+  if (cache_size > max_cache_size) {
+    /* Remove the least recently used files first. */
+    std::sort(kept_entries.begin(),
+              kept_entries.end(),
+              [](const direntry *a, const direntry *b) { return a->s.st_mtime < b->s.st_mtime; });
+    for (const direntry *entry : kept_entries) {
+      if (cache_size <= max_cache_size) {
+        break;
+      }
+      BLI_delete(entry->path, false, false);
+      cache_size -= entry->s.st_size;
+    }
+  }
+
+  BLI_filelist_free(entries, dir_len);
+}
+
+}  // namespace blender::gpu
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -346,6 +346,14 @@ class GPULogParser {
 void printf_begin(Context *ctx);
 void printf_end(Context *ctx);
 
+/**
+ * Remove files from an on-disk shader cache directory that have not been used for a month. When
+ * the remaining files are still larger than the cache size limit, the least recently used files
+ * are removed as well. Backends touch the cache files when they are used, so the modification
+ * time is the time of the last use.
+ */
+void shader_cache_dir_clear_old(StringRefNull cache_dir);
+
 }  // namespace blender::gpu
 
 /* XXX do not use it. Special hack to use OCIO with batch API. */
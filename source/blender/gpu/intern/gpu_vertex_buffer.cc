@@ -68,6 +68,7 @@ void VertBuf::allocate(uint vert_len)
   BLI_assert(vertex_alloc != vert_len || data_ == nullptr);
   vertex_len = vertex_alloc = vert_len;
 
+  MEM_CategoryScope mem_category_scope(MEM_CATEGORY_GPU);
   this->acquire_data();
 
   flag |= GPU_VERTBUF_DATA_DIRTY;
@@ -79,6 +80,7 @@ void VertBuf::resize(uint vert_len)
   BLI_assert(vertex_alloc != vert_len);
   vertex_len = vertex_alloc = vert_len;
 
+  MEM_CategoryScope mem_category_scope(MEM_CATEGORY_GPU);
   this->resize_data();
 
   flag |= GPU_VERTBUF_DATA_DIRTY;
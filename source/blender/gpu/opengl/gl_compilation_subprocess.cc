@@ -17,6 +17,7 @@
 #  include "GPU_context.hh"
 #  include "GPU_init_exit.hh"
 #  include "gpu_capabilities_private.hh"
+#  include "gpu_shader_private.hh"
 #  include <iostream>
 #  include <string>
 
@@ -302,22 +303,7 @@ void GPU_compilation_subprocess_run(const char *subprocess_name)
 namespace blender::gpu {
 void GL_shader_cache_dir_clear_old()
 {
-  std::string cache_dir = GL_shader_cache_dir_get();
-
-  direntry *entries = nullptr;
-  uint32_t dir_len = BLI_filelist_dir_contents(cache_dir.c_str(), &entries);
-  for (int i : blender::IndexRange(dir_len)) {
-    direntry entry = entries[i];
-    if (S_ISDIR(entry.s.st_mode)) {
-      continue;
-    }
-    const time_t ts_now = time(nullptr);
-    const time_t delete_threshold = 60 /*seconds*/ * 60 /*minutes*/ * 24 /*hours*/ * 30 /*days*/;
-    if (entry.s.st_mtime + delete_threshold < ts_now) {
-      BLI_delete(entry.path, false, false);
-    }
-  }
-  BLI_filelist_free(entries, dir_len);
+  shader_cache_dir_clear_old(GL_shader_cache_dir_get());
 }
 }  // namespace blender::gpu
 
@@ -141,6 +141,11 @@ BLI_INLINE bool node_type_is_rendering(VKNodeType node_type)
          node_type_is_within_rendering(node_type);
 }
 
+BLI_INLINE bool node_type_is_dispatch(VKNodeType node_type)
+{
+  return ELEM(node_type, VKNodeType::DISPATCH, VKNodeType::DISPATCH_INDIRECT);
+}
+
 /**
  * Info class for a node type.
  *
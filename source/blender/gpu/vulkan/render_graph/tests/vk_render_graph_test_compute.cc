@@ -396,4 +396,71 @@ TEST_F(VKRenderGraphTestCompute, dispatch_indirect_dispatch_indirect_read_back)
   EXPECT_EQ("dispatch_indirect(buffer=0x2, offset=12)", log[5]);
 }
 
+/**
+ * Test that independent dispatches are reordered, so their barriers can be recorded as a single
+ * pipeline barrier.
+ */
+TEST_F(VKRenderGraphTestCompute, dispatch_independent_chains)
+{
+  VkHandle<VkBuffer> buffer_a(1u);
+  VkHandle<VkBuffer> buffer_b(2u);
+  VkHandle<VkBuffer> buffer_c(3u);
+  VkHandle<VkBuffer> buffer_d(4u);
+  VkHandle<VkPipeline> pipeline(5u);
+  VkHandle<VkPipelineLayout> pipeline_layout(6u);
+  VkHandle<VkDescriptorSet> descriptor_set(7u);
+
+  resources.add_buffer(buffer_a);
+  resources.add_buffer(buffer_b);
+  resources.add_buffer(buffer_c);
+  resources.add_buffer(buffer_d);
+
+  auto add_dispatch = [&](VkBuffer read_buffer, VkBuffer write_buffer, uint32_t group_count) {
+    VKResourceAccessInfo access_info = {};
+    if (read_buffer != VK_NULL_HANDLE) {
+      access_info.buffers.append({read_buffer, VK_ACCESS_SHADER_READ_BIT});
+    }
+    access_info.buffers.append({write_buffer, VK_ACCESS_SHADER_WRITE_BIT});
+    VKDispatchNode::CreateInfo dispatch_info(access_info);
+    dispatch_info.dispatch_node.pipeline_data.vk_pipeline = pipeline;
+    dispatch_info.dispatch_node.pipeline_data.vk_pipeline_layout = pipeline_layout;
+    dispatch_info.dispatch_node.pipeline_data.vk_descriptor_set = descriptor_set;
+    dispatch_info.dispatch_node.group_count_x = group_count;
+    dispatch_info.dispatch_node.group_count_y = 1;
+    dispatch_info.dispatch_node.group_count_z = 1;
+    render_graph->add_node(dispatch_info);
+  };
+
+  /* Two chains of two dispatches that don't depend on each other. */
+  add_dispatch(VK_NULL_HANDLE, buffer_a, 1);
+  add_dispatch(buffer_a, buffer_b, 2);
+  add_dispatch(VK_NULL_HANDLE, buffer_c, 3);
+  add_dispatch(buffer_c, buffer_d, 4);
+  submit(render_graph, command_buffer);
+  EXPECT_EQ(7, log.size());
+  EXPECT_EQ("bind_pipeline(pipeline_bind_point=VK_PIPELINE_BIND_POINT_COMPUTE, pipeline=0x5)",
+            log[0]);
+  EXPECT_EQ(
+      "bind_descriptor_sets(pipeline_bind_point=VK_PIPELINE_BIND_POINT_COMPUTE, layout=0x6, "
+      "p_descriptor_sets=0x7)",
+      log[1]);
+  EXPECT_EQ("dispatch(group_count_x=1, group_count_y=1, group_count_z=1)", log[2]);
+  EXPECT_EQ("dispatch(group_count_x=3, group_count_y=1, group_count_z=1)", log[3]);
+  EXPECT_EQ(
+      "pipeline_barrier(src_stage_mask=VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, "
+      "dst_stage_mask=VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT" +
+          endl() +
+          " - buffer_barrier(src_access_mask=VK_ACCESS_SHADER_WRITE_BIT, "
+          "dst_access_mask=VK_ACCESS_SHADER_READ_BIT, buffer=0x1, offset=0, "
+          "size=18446744073709551615)" +
+          endl() +
+          " - buffer_barrier(src_access_mask=VK_ACCESS_SHADER_WRITE_BIT, "
+          "dst_access_mask=VK_ACCESS_SHADER_READ_BIT, buffer=0x3, offset=0, "
+          "size=18446744073709551615)" +
+          endl() + ")",
+      log[4]);
+  EXPECT_EQ("dispatch(group_count_x=2, group_count_y=1, group_count_z=1)", log[5]);
+  EXPECT_EQ("dispatch(group_count_x=4, group_count_y=1, group_count_z=1)", log[6]);
+}
+
 }  // namespace blender::gpu::render_graph
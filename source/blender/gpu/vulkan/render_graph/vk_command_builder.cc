@@ -52,12 +52,66 @@ void VKCommandBuilder::groups_init(const VKRenderGraph &render_graph,
       }
       node_group = nodes_range.slice(0, node_group.size() + 1);
     }
+    if (node_type_is_dispatch(node.type)) {
+      node_group = nodes_range.slice(
+          0, independent_dispatches_len(render_graph, node_handles.slice(nodes_range)));
+    }
 
     group_nodes_.append(node_group);
     nodes_range = nodes_range.drop_front(node_group.size());
   }
 }
 
+int64_t VKCommandBuilder::independent_dispatches_len(const VKRenderGraph &render_graph,
+                                                     Span<NodeHandle> node_handles)
+{
+  /* Resources read or written by the dispatches of the group. Images are always considered a
+   * dependency as the dispatches could require different layouts. */
+  group_read_buffers_.clear();
+  group_written_resources_.clear();
+  group_images_.clear();
+
+  int64_t len = 0;
+  for (NodeHandle node_handle : node_handles) {
+    const VKRenderGraphNode &node = render_graph.nodes_[node_handle];
+    if (!node_type_is_dispatch(node.type)) {
+      break;
+    }
+    const VKRenderGraphNodeLinks &links = render_graph.links_[node_handle];
+    bool has_dependency = false;
+    for (const VKRenderGraphLink &link : links.inputs) {
+      const ResourceHandle handle = link.resource.handle;
+      has_dependency |= group_written_resources_.contains(handle) ||
+                        group_images_.contains(handle);
+    }
+    for (const VKRenderGraphLink &link : links.outputs) {
+      const ResourceHandle handle = link.resource.handle;
+      has_dependency |= group_written_resources_.contains(handle) ||
+                        group_read_buffers_.contains(handle) || group_images_.contains(handle);
+    }
+    if (len > 0 && has_dependency) {
+      break;
+    }
+
+    for (const VKRenderGraphLink &link : links.inputs) {
+      if (link.is_link_to_buffer()) {
+        group_read_buffers_.add(link.resource.handle);
+      }
+      else {
+        group_images_.add(link.resource.handle);
+      }
+    }
+    for (const VKRenderGraphLink &link : links.outputs) {
+      group_written_resources_.add(link.resource.handle);
+      if (!link.is_link_to_buffer()) {
+        group_images_.add(link.resource.handle);
+      }
+    }
+    len++;
+  }
+  return std::max<int64_t>(len, 1);
+}
+
 void VKCommandBuilder::groups_extract_barriers(VKRenderGraph &render_graph,
                                                Span<NodeHandle> node_handles,
                                                bool use_local_read)
@@ -94,6 +148,26 @@ void VKCommandBuilder::groups_extract_barriers(VKRenderGraph &render_graph,
       Barrier barrier = {};
       build_pipeline_barriers(
           render_graph, node_handle, node.pipeline_stage_get(), layered_tracker, barrier);
+      if (!barrier.is_empty() && node_type_is_dispatch(node.type) &&
+          barrier_list_.size() > group_pre_barriers.start())
+      {
+        /* The dispatches of a group don't depend on each other, so their barriers can be
+         * recorded as a single pipeline barrier. */
+        Barrier &prev_barrier = barrier_list_.last();
+        if (prev_barrier.buffer_memory_barriers.one_after_last() ==
+                barrier.buffer_memory_barriers.start() &&
+            prev_barrier.image_memory_barriers.one_after_last() ==
+                barrier.image_memory_barriers.start())
+        {
+          prev_barrier.src_stage_mask |= barrier.src_stage_mask;
+          prev_barrier.dst_stage_mask |= barrier.dst_stage_mask;
+          prev_barrier.buffer_memory_barriers = prev_barrier.buffer_memory_barriers.with_new_end(
+              barrier.buffer_memory_barriers.one_after_last());
+          prev_barrier.image_memory_barriers = prev_barrier.image_memory_barriers.with_new_end(
+              barrier.image_memory_barriers.one_after_last());
+          barrier = {};
+        }
+      }
       if (!barrier.is_empty()) {
 #if 0
         std::cout << __func__ << ": node_group=" << group_index
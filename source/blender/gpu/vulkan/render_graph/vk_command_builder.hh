@@ -175,6 +175,11 @@ class VKCommandBuilder {
   /** List of all generated barriers. */
   Vector<Barrier> barrier_list_;
 
+  /** Resources accessed by the dispatch group that is being created by `groups_init`. */
+  Set<ResourceHandle> group_read_buffers_;
+  Set<ResourceHandle> group_written_resources_;
+  Set<ResourceHandle> group_images_;
+
  public:
   /**
    * Build execution groups and barriers.
@@ -199,10 +204,19 @@ class VKCommandBuilder {
    *  Split the node_handles in logical groups.
    *
    * A new group is created when the next node is switching from data/compute to graphics and each
-   * data/compute is also put in its own group.
+   * data/compute is also put in its own group. Dispatches that don't depend on each other share
+   * a group.
    */
   void groups_init(const VKRenderGraph &render_graph, Span<NodeHandle> node_handles);
 
+  /**
+   * Number of dispatch nodes at the start of `node_handles` that don't depend on each other.
+   * These dispatches are put in a single group, so their barriers are recorded together before
+   * the first dispatch of the group. Always returns at least 1.
+   */
+  int64_t independent_dispatches_len(const VKRenderGraph &render_graph,
+                                     Span<NodeHandle> node_handles);
+
   /**
    * Extract the memory/buffer/image barriers from the command groups and add them to the pre/post
    * barriers.
@@ -11,7 +11,9 @@
 #include "vk_render_graph.hh"
 #include "vk_scheduler.hh"
 
+#include "BLI_array_utils.hh"
 #include "BLI_index_range.hh"
+#include "BLI_map.hh"
 #include "BLI_set.hh"
 
 namespace blender::gpu::render_graph {
@@ -34,6 +36,7 @@ void VKScheduler::reorder_nodes(const VKRenderGraph &render_graph)
 {
   move_initial_transfer_to_start(render_graph);
   move_transfer_and_dispatch_outside_rendering_scope(render_graph);
+  reorder_independent_dispatches(render_graph);
 }
 
 std::optional<std::pair<int64_t, int64_t>> VKScheduler::find_rendering_scope(
@@ -207,6 +210,85 @@ void VKScheduler::move_transfer_and_dispatch_outside_rendering_scope(
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Reorder - group independent dispatches
+ * \{ */
+
+void VKScheduler::reorder_independent_dispatches(const VKRenderGraph &render_graph)
+{
+  /* Per resource the last level that wrote to it and the highest level that read from it. */
+  Map<ResourceHandle, int> write_levels;
+  Map<ResourceHandle, int> read_levels;
+  Vector<int> levels;
+  Vector<NodeHandle> run_nodes;
+  Vector<int> order;
+
+  int64_t index = 0;
+  while (index < result_.size()) {
+    if (!node_type_is_dispatch(render_graph.nodes_[result_[index]].type)) {
+      index++;
+      continue;
+    }
+    int64_t run_end = index + 1;
+    while (run_end < result_.size() &&
+           node_type_is_dispatch(render_graph.nodes_[result_[run_end]].type))
+    {
+      run_end++;
+    }
+    const IndexRange run = IndexRange::from_begin_end(index, run_end);
+    index = run_end;
+    if (run.size() < 3) {
+      /* Two dispatches are either independent or they have to stay in this order. */
+      continue;
+    }
+
+    /* A dispatch has to be executed after all dispatches in the run that write a resource it
+     * accesses, and after all dispatches that read a resource it writes. */
+    write_levels.clear();
+    read_levels.clear();
+    levels.clear();
+    int max_level = 0;
+    for (const int64_t run_index : run) {
+      const VKRenderGraphNodeLinks &links = render_graph.links_[result_[run_index]];
+      int level = 0;
+      for (const VKRenderGraphLink &input : links.inputs) {
+        level = std::max(level, write_levels.lookup_default(input.resource.handle, -1) + 1);
+      }
+      for (const VKRenderGraphLink &output : links.outputs) {
+        level = std::max(level, write_levels.lookup_default(output.resource.handle, -1) + 1);
+        level = std::max(level, read_levels.lookup_default(output.resource.handle, -1) + 1);
+      }
+      for (const VKRenderGraphLink &input : links.inputs) {
+        int &read_level = read_levels.lookup_or_add(input.resource.handle, level);
+        read_level = std::max(read_level, level);
+      }
+      for (const VKRenderGraphLink &output : links.outputs) {
+        write_levels.add_overwrite(output.resource.handle, level);
+      }
+      levels.append(level);
+      max_level = std::max(max_level, level);
+    }
+    if (max_level == 0 || max_level == run.size() - 1) {
+      /* All dispatches are independent, or they form a single chain. */
+      continue;
+    }
+
+    /* Stable sort by level. Dispatches of the same level don't depend on each other, which allows
+     * the command builder to record their barriers together. */
+    run_nodes = result_.as_span().slice(run);
+    order.resize(run.size());
+    array_utils::fill_index_range<int>(order);
+    std::stable_sort(order.begin(), order.end(), [&](const int a, const int b) {
+      return levels[a] < levels[b];
+    });
+    for (const int64_t i : run.index_range()) {
+      result_[run[i]] = run_nodes[order[i]];
+    }
+  }
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Debug
  * \{ */
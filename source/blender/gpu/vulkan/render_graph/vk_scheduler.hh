@@ -90,6 +90,16 @@ class VKScheduler {
    */
   void move_transfer_and_dispatch_outside_rendering_scope(const VKRenderGraph &render_graph);
 
+  /**
+   * Reorder consecutive dispatch nodes, so dispatches that don't depend on each other are
+   * scheduled next to each other. Dependencies between the dispatches are kept.
+   *
+   * Without reordering a chain of dispatches that alternate between two independent passes would
+   * need a barrier before each dispatch. After reordering the command builder can record the
+   * barriers of independent dispatches as a single pipeline barrier.
+   */
+  void reorder_independent_dispatches(const VKRenderGraph &render_graph);
+
   /**
    * Find the first rendering scope inside the given search range of the result_.
    */
@@ -120,21 +120,7 @@ void VKShaderCompiler::cache_dir_clear_old()
   if (!cache_dir_get().has_value()) {
     return;
   }
-
-  direntry *entries = nullptr;
-  uint32_t dir_len = BLI_filelist_dir_contents(cache_dir_get()->c_str(), &entries);
-  for (int i : blender::IndexRange(dir_len)) {
-    direntry entry = entries[i];
-    if (S_ISDIR(entry.s.st_mode)) {
-      continue;
-    }
-    const time_t ts_now = time(nullptr);
-    const time_t delete_threshold = 60 /*seconds*/ * 60 /*minutes*/ * 24 /*hours*/ * 30 /*days*/;
-    if (entry.s.st_mtime + delete_threshold < ts_now) {
-      BLI_delete(entry.path, false, false);
-    }
-  }
-  BLI_filelist_free(entries, dir_len);
+  shader_cache_dir_clear_old(*cache_dir_get());
 }
 
 /** \} */
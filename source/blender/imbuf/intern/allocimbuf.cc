@@ -326,6 +326,7 @@ void *imb_alloc_pixels(
   }
 
   size_t size = size_t(x) * size_t(y) * size_t(channels) * typesize;
+  MEM_CategoryScope mem_category_scope(MEM_CATEGORY_IMAGE);
   return initialize_pixels ? MEM_callocN(size, alloc_name) : MEM_mallocN(size, alloc_name);
 }
 
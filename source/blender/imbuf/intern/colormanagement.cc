@@ -28,6 +28,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_color.h"
 #include "BLI_math_color.hh"
@@ -3491,13 +3492,19 @@ void IMB_colormanagement_processor_apply_byte(
    * but for now it's not so important.
    */
   BLI_assert(channels == 4);
-  float pixel[4];
+
+  /* Convert and process a scan-line at a time, so that the processor is applied to a whole row
+   * of pixels at once instead of going through the much slower per-pixel path. */
+  blender::Array<float> row_buffer(size_t(width) * channels);
+  float *row = row_buffer.data();
   for (int y = 0; y < height; y++) {
+    uchar *row_bytes = buffer + channels * size_t(y) * width;
+    for (int x = 0; x < width; x++) {
+      rgba_uchar_to_float(row + channels * x, row_bytes + channels * x);
+    }
+    IMB_colormanagement_processor_apply(cm_processor, row, width, 1, channels, false);
     for (int x = 0; x < width; x++) {
-      size_t offset = channels * (size_t(y) * width + x);
-      rgba_uchar_to_float(pixel, buffer + offset);
-      IMB_colormanagement_processor_apply_v4(cm_processor, pixel);
-      rgba_float_to_uchar(buffer + offset, pixel);
+      rgba_float_to_uchar(row_bytes + channels * x, row + channels * x);
     }
   }
 }
@@ -51,6 +51,10 @@ struct CDStreamConfig {
 
   bool pack_uvs = false;
 
+  /* When reading into an existing mesh whose topology matches the sample, face offsets, corner
+   * vertices and edges are kept and only per-corner data like UVs is read. */
+  bool use_existing_topology = false;
+
   /* TODO(kevin): might need a better way to handle adding and/or updating
    * custom data such that it updates the custom data holder and its pointers properly. */
   Mesh *mesh = nullptr;
@@ -179,6 +179,56 @@ void read_mverts(Mesh &mesh, const P3fArraySamplePtr positions, const N3fArraySa
   }
 }
 
+/**
+ * Check whether the edges of a reused mesh are exactly the edges that #bke::mesh_calc_edges
+ * would create from its faces: every corner references the edge to the next corner, and there
+ * are no loose edges. This is much cheaper than calculating the edges again.
+ */
+static bool mesh_edges_match_faces(const Mesh &mesh)
+{
+  const OffsetIndices<int> faces = mesh.faces();
+  const Span<int2> edges = mesh.edges();
+  const Span<int> corner_verts = mesh.corner_verts();
+  const Span<int> corner_edges = mesh.corner_edges();
+  if (corner_edges.size() != corner_verts.size()) {
+    return false;
+  }
+
+  Array<bool> edge_used(edges.size(), false);
+  for (const int face : faces.index_range()) {
+    const IndexRange face_corners = faces[face];
+    for (const int corner : face_corners) {
+      const int edge = corner_edges[corner];
+      if (!edges.index_range().contains(edge)) {
+        return false;
+      }
+      const int next_corner = bke::mesh::face_corner_next(face_corners, corner);
+      if (OrderedEdge(edges[edge]) !=
+          OrderedEdge(corner_verts[corner], corner_verts[next_corner]))
+      {
+        return false;
+      }
+      edge_used[edge] = true;
+    }
+  }
+  return !edge_used.as_span().contains(false);
+}
+
+/** Remove edge attributes, like #bke::mesh_calc_edges does when it rebuilds the edges. */
+static void remove_edge_attributes(Mesh &mesh)
+{
+  bke::MutableAttributeAccessor attributes = mesh.attributes_for_write();
+  Vector<std::string> names;
+  attributes.foreach_attribute([&](const bke::AttributeIter &iter) {
+    if (iter.domain == bke::AttrDomain::Edge && iter.name != ".edge_verts") {
+      names.append(iter.name);
+    }
+  });
+  for (const StringRef name : names) {
+    attributes.remove(name);
+  }
+}
+
 static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
 {
   int *face_offsets = config.face_offsets;
@@ -195,6 +245,7 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
   const bool do_uvs = (mloopuvs && uvs && uvs_indices);
   const bool do_uvs_per_loop = do_uvs && mesh_data.uv_scope == ABC_UV_SCOPE_LOOP;
   BLI_assert(!do_uvs || mesh_data.uv_scope != ABC_UV_SCOPE_NONE);
+  const bool do_topology = !config.use_existing_topology;
   uint loop_index = 0;
   uint rev_loop_index = 0;
   uint uv_index = 0;
@@ -203,7 +254,9 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
   for (int i = 0; i < face_counts->size(); i++) {
     const int face_size = (*face_counts)[i];
 
-    face_offsets[i] = loop_index;
+    if (do_topology) {
+      face_offsets[i] = loop_index;
+    }
 
     /* Polygons are always assumed to be smooth-shaded. If the Alembic mesh should be flat-shaded,
      * this is encoded in custom loop normals. See #71246. */
@@ -214,7 +267,9 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
     uint last_vertex_index = 0;
     for (int f = 0; f < face_size; f++, loop_index++, rev_loop_index--) {
       const int vert = (*face_indices)[loop_index];
-      corner_verts[rev_loop_index] = vert;
+      if (do_topology) {
+        corner_verts[rev_loop_index] = vert;
+      }
 
       if (f > 0 && vert == last_vertex_index) {
         /* This face is invalid, as it has consecutive loops from the same vertex. This is caused
@@ -237,7 +292,15 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
     }
   }
 
-  bke::mesh_calc_edges(*config.mesh, false, false);
+  /* The faces of a reused mesh match the sample, but its edges may not match its faces, for
+   * example when it has loose edges. Then the edges are rebuilt as if the topology was read. */
+  if (do_topology || seen_invalid_geometry || !mesh_edges_match_faces(*config.mesh)) {
+    bke::mesh_calc_edges(*config.mesh, false, false);
+  }
+  else {
+    remove_edge_attributes(*config.mesh);
+    config.mesh->tag_loose_edges_none();
+  }
   if (seen_invalid_geometry) {
     if (config.modifier_error_message) {
       *config.modifier_error_message = "Mesh hash invalid geometry; more details on the console";
@@ -481,13 +544,21 @@ static void read_mesh_sample(const std::string &iobject_full_name,
   }
 }
 
-static CDStreamConfig get_config(Mesh *mesh)
+static CDStreamConfig get_config(Mesh *mesh, const bool use_existing_topology = false)
 {
   CDStreamConfig config;
   config.mesh = mesh;
   config.positions = mesh->vert_positions_for_write().data();
-  config.corner_verts = mesh->corner_verts_for_write().data();
-  config.face_offsets = mesh->face_offsets_for_write().data();
+  config.use_existing_topology = use_existing_topology;
+  if (use_existing_topology) {
+    /* The topology is only read, so don't copy its arrays when they are shared. */
+    config.corner_verts = const_cast<int *>(mesh->corner_verts().data());
+    config.face_offsets = const_cast<int *>(mesh->face_offsets().data());
+  }
+  else {
+    config.corner_verts = mesh->corner_verts_for_write().data();
+    config.face_offsets = mesh->face_offsets_for_write().data();
+  }
   config.totvert = mesh->verts_num;
   config.totloop = mesh->corners_num;
   config.faces_num = mesh->faces_num;
@@ -653,6 +724,14 @@ bool AbcMeshReader::accepts_object_type(
   return true;
 }
 
+bool AbcMeshReader::topology_compares_connectivity() const
+{
+  /* Check first if we indeed have multiple samples, unless we read a file sequence in which case
+   * we need to do a full topology comparison. */
+  return m_is_reading_a_file_sequence || m_schema.getFaceIndicesProperty().getNumSamples() != 1 ||
+         m_schema.getFaceCountsProperty().getNumSamples() != 1;
+}
+
 bool AbcMeshReader::topology_changed(const Mesh *existing_mesh, const ISampleSelector &sample_sel)
 {
   IPolyMeshSchema::Sample sample;
@@ -681,11 +760,7 @@ bool AbcMeshReader::topology_changed(const Mesh *existing_mesh, const ISampleSel
     return true;
   }
 
-  /* Check first if we indeed have multiple samples, unless we read a file sequence in which case
-   * we need to do a full topology comparison. */
-  if (!m_is_reading_a_file_sequence && (m_schema.getFaceIndicesProperty().getNumSamples() == 1 &&
-                                        m_schema.getFaceCountsProperty().getNumSamples() == 1))
-  {
+  if (!topology_compares_connectivity()) {
     return false;
   }
 
@@ -809,7 +884,11 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
   }
 
   Mesh *mesh_to_export = new_mesh ? new_mesh : existing_mesh;
-  CDStreamConfig config = get_config(mesh_to_export);
+  /* When the connectivity of the existing mesh was just compared with the sample, there is no need
+   * to rebuild it and recompute edges on every frame. With a single topology sample only the
+   * element counts are compared, so the existing mesh may still have a different topology. */
+  const bool use_existing_topology = new_mesh == nullptr && topology_compares_connectivity();
+  CDStreamConfig config = get_config(mesh_to_export, use_existing_topology);
   config.time = sample_sel.getRequestedTime();
   config.modifier_error_message = r_err_str;
 
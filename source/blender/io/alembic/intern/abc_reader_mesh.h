@@ -48,6 +48,12 @@ class AbcMeshReader final : public AbcObjectReader {
                         const Alembic::Abc::ISampleSelector &sample_sel) override;
 
  private:
+  /**
+   * Whether #topology_changed compares the connectivity of the mesh with the sample, and not only
+   * the number of elements.
+   */
+  bool topology_compares_connectivity() const;
+
   void readFaceSetsSample(Main *bmain,
                           Mesh *mesh,
                           const Alembic::AbcGeom::ISampleSelector &sample_sel);
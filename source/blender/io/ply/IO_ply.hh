@@ -64,6 +64,8 @@ struct PLYImportParams {
   ePLYVertexColorMode vertex_colors = ePLYVertexColorMode::sRGB;
   bool import_attributes = true;
   bool merge_verts = false;
+  /** Sort vertices and faces spatially to improve memory locality of the imported mesh. */
+  bool sort_spatially = false;
 
   ReportList *reports = nullptr;
 };
@@ -27,6 +27,19 @@ FileBuffer::FileBuffer(const char *filepath, size_t buffer_chunk_size)
   }
 }
 
+FileBuffer::FileBuffer(size_t buffer_chunk_size)
+    : buffer_chunk_size_(buffer_chunk_size), filepath_(nullptr), outfile_(nullptr)
+{
+}
+
+void FileBuffer::append_from(FileBuffer &other)
+{
+  for (VectorChar &block : other.blocks_) {
+    blocks_.append(std::move(block));
+  }
+  other.blocks_.clear();
+}
+
 void FileBuffer::write_to_file()
 {
   for (const VectorChar &b : blocks_) {
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "BLI_string_ref.hh"
 #include "BLI_utility_mixins.hh"
 #include "BLI_vector.hh"
@@ -37,6 +39,13 @@ class FileBuffer : private NonMovable {
 
   virtual ~FileBuffer() = default;
 
+  /* Create an empty buffer of the same format that is not connected to a file. It can be filled
+   * on another thread and then be appended to this buffer with #append_from. */
+  virtual std::unique_ptr<FileBuffer> create_memory_buffer() const = 0;
+
+  /* Move the contents of the given buffer to the end of this buffer. */
+  void append_from(FileBuffer &other);
+
   /* Write contents to the buffer(s) into a file, and clear the buffers. */
   void write_to_file();
 
@@ -69,6 +78,14 @@ class FileBuffer : private NonMovable {
   void write_newline();
 
  protected:
+  /* Create a buffer that is only kept in memory, see #create_memory_buffer. */
+  explicit FileBuffer(size_t buffer_chunk_size);
+
+  size_t buffer_chunk_size() const
+  {
+    return buffer_chunk_size_;
+  }
+
   /* Ensure the last block contains at least this amount of free space.
    * If not, add a new block with max of block size & the amount of space needed. */
   void ensure_space(size_t at_least)
@@ -11,6 +11,12 @@
 #include "BLI_math_vector_types.hh"
 
 namespace blender::io::ply {
+
+std::unique_ptr<FileBuffer> FileBufferBinary::create_memory_buffer() const
+{
+  return std::unique_ptr<FileBuffer>(new FileBufferBinary(this->buffer_chunk_size()));
+}
+
 void FileBufferBinary::write_vertex(float x, float y, float z)
 {
   float3 vector(x, y, z);
@@ -11,6 +11,7 @@
 #include "BKE_mesh.hh"
 
 #include "GEO_mesh_merge_by_distance.hh"
+#include "GEO_reorder.hh"
 
 #include "BLI_color.hh"
 #include "BLI_math_vector.h"
@@ -158,6 +159,12 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
     }
   }
 
+  if (params.sort_spatially) {
+    Mesh *sorted_mesh = blender::geometry::reorder_mesh_spatially(*mesh, {});
+    BKE_id_free(nullptr, &mesh->id);
+    mesh = sorted_mesh;
+  }
+
   return mesh;
 }
 }  // namespace blender::io::ply
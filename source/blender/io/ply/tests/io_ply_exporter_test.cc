@@ -417,6 +417,94 @@ TEST_F(PLYExportTest, WriteVertexNormalsBinary)
   }
 }
 
+/* More elements than fit into a single chunk of the parallel writers. */
+static std::unique_ptr<PlyData> load_many_elements()
+{
+  const int elements_num = 100000;
+  std::unique_ptr<PlyData> plyData = std::make_unique<PlyData>();
+  for (int i = 0; i < elements_num; i++) {
+    plyData->vertices.append({i * 0.5f, i * -0.25f, i * 0.125f});
+    plyData->vertex_normals.append({0.0f, i % 2 ? 1.0f : -1.0f, 0.0f});
+    /* Faces of different sizes, so that their starts are not a multiple of the index. */
+    const int face_size = 3 + i % 3;
+    plyData->face_sizes.append(face_size);
+    for (int j = 0; j < face_size; j++) {
+      plyData->face_vertices.append((i + j) % elements_num);
+    }
+    plyData->edges.append({i, (i + 1) % elements_num});
+  }
+  return plyData;
+}
+
+/* Write the elements one after another, like the exporter did before writing chunks in
+ * parallel. */
+static void write_elements_serial(FileBuffer &buffer, const PlyData &ply_data)
+{
+  for (const int i : ply_data.vertices.index_range()) {
+    buffer.write_vertex(ply_data.vertices[i].x, ply_data.vertices[i].y, ply_data.vertices[i].z);
+    buffer.write_vertex_normal(
+        ply_data.vertex_normals[i].x, ply_data.vertex_normals[i].y, ply_data.vertex_normals[i].z);
+    buffer.write_vertex_end();
+  }
+  int64_t face_start = 0;
+  for (const uint32_t face_size : ply_data.face_sizes) {
+    buffer.write_face(char(face_size),
+                      ply_data.face_vertices.as_span().slice(face_start, face_size));
+    face_start += face_size;
+  }
+  for (const std::pair<int, int> &edge : ply_data.edges) {
+    buffer.write_edge(edge.first, edge.second);
+  }
+  buffer.write_to_file();
+}
+
+static void write_elements_parallel(FileBuffer &buffer, const PlyData &ply_data)
+{
+  write_vertices(buffer, ply_data);
+  write_faces(buffer, ply_data);
+  write_edges(buffer, ply_data);
+}
+
+TEST_F(PLYExportTest, WriteManyElementsAscii)
+{
+  const std::string serial_path = get_temp_ply_filename("serial.ply");
+  const std::string parallel_path = get_temp_ply_filename("parallel.ply");
+  std::unique_ptr<PlyData> plyData = load_many_elements();
+
+  FileBufferAscii serial_buffer(serial_path.c_str());
+  write_elements_serial(serial_buffer, *plyData);
+  serial_buffer.close_file();
+
+  FileBufferAscii parallel_buffer(parallel_path.c_str());
+  write_elements_parallel(parallel_buffer, *plyData);
+  parallel_buffer.close_file();
+
+  const std::string expected = read_temp_file_in_string(serial_path);
+  const std::string result = read_temp_file_in_string(parallel_path);
+  EXPECT_FALSE(expected.empty());
+  EXPECT_TRUE(result == expected);
+}
+
+TEST_F(PLYExportTest, WriteManyElementsBinary)
+{
+  const std::string serial_path = get_temp_ply_filename("serial.ply");
+  const std::string parallel_path = get_temp_ply_filename("parallel.ply");
+  std::unique_ptr<PlyData> plyData = load_many_elements();
+
+  FileBufferBinary serial_buffer(serial_path.c_str());
+  write_elements_serial(serial_buffer, *plyData);
+  serial_buffer.close_file();
+
+  FileBufferBinary parallel_buffer(parallel_path.c_str());
+  write_elements_parallel(parallel_buffer, *plyData);
+  parallel_buffer.close_file();
+
+  const std::vector<char> expected = read_temp_file_in_vectorchar(serial_path);
+  const std::vector<char> result = read_temp_file_in_vectorchar(parallel_path);
+  EXPECT_FALSE(expected.empty());
+  EXPECT_TRUE(result == expected);
+}
+
 class PLYExportPLYDataTest : public PLYExportTest {
  public:
   PlyData load_ply_data_from_blendfile(const std::string &blendfile, PLYExportParams &params)
@@ -63,8 +63,10 @@ void MeshData::update()
 {
   Object *object = (Object *)id;
   if ((id->recalc & ID_RECALC_GEOMETRY) || (((ID *)object->data)->recalc & ID_RECALC_GEOMETRY)) {
+    /* Copying is cheap because #pxr::VtArray shares its data until it is modified. */
+    const Vector<SubMesh> prev_submeshes = submeshes_;
     init();
-    update_prims();
+    update_prims(prev_submeshes);
     return;
   }
 
@@ -420,14 +422,22 @@ void MeshData::write_submeshes(const Mesh *mesh)
   submeshes_.remove_if([](const SubMesh &submesh) { return submesh.face_vertex_counts.empty(); });
 }
 
-void MeshData::update_prims()
+void MeshData::update_prims(const Span<SubMesh> prev_submeshes)
 {
   auto &render_index = scene_delegate_->GetRenderIndex();
   int i;
   for (i = 0; i < submeshes_.size(); ++i) {
     pxr::SdfPath p = submesh_prim_id(i);
     if (i < submeshes_count_) {
-      render_index.GetChangeTracker().MarkRprimDirty(p, pxr::HdChangeTracker::AllDirty);
+      pxr::HdDirtyBits bits = pxr::HdChangeTracker::AllDirty;
+      if (i < prev_submeshes.size() &&
+          prev_submeshes[i].face_vertex_counts == submeshes_[i].face_vertex_counts &&
+          prev_submeshes[i].face_vertex_indices == submeshes_[i].face_vertex_indices)
+      {
+        /* Only deformed, avoid rebuilding the topology in the render delegate. */
+        bits &= ~pxr::HdChangeTracker::DirtyTopology;
+      }
+      render_index.GetChangeTracker().MarkRprimDirty(p, bits);
       ID_LOGN("Update %d", i);
     }
     else {
@@ -57,7 +57,11 @@ class MeshData : public ObjectData {
   pxr::SdfPath submesh_prim_id(int index) const;
   const SubMesh &submesh(pxr::SdfPath const &id) const;
   void write_submeshes(const Mesh *mesh);
-  void update_prims();
+  /**
+   * Insert, remove or tag the render index prims of all sub-meshes.
+   * \param prev_submeshes: Sub-meshes before the update, used to detect unchanged topology.
+   */
+  void update_prims(Span<SubMesh> prev_submeshes = {});
 };
 
 }  // namespace blender::io::hydra
@@ -69,13 +69,12 @@ Mesh *MeshFromGeometry::create_mesh(const OBJImportParams &import_params)
 }
 
 Object *MeshFromGeometry::create_mesh_object(
+    Mesh *mesh,
     Main *bmain,
     Map<std::string, std::unique_ptr<MTLMaterial>> &materials,
     Map<std::string, Material *> &created_materials,
     const OBJImportParams &import_params)
 {
-  Mesh *mesh = this->create_mesh(import_params);
-
   if (mesh == nullptr) {
     return nullptr;
   }
@@ -36,9 +36,18 @@ class MeshFromGeometry : NonMovable, NonCopyable {
   {
   }
 
+  /**
+   * Create the mesh of the geometry. This does not add anything to #Main, so it can be called
+   * for different geometries in parallel.
+   */
   Mesh *create_mesh(const OBJImportParams &import_params);
 
-  Object *create_mesh_object(Main *bmain,
+  /**
+   * Create an object in #Main for the given mesh, which was created by #create_mesh. The mesh is
+   * consumed, null is returned if it is null.
+   */
+  Object *create_mesh_object(Mesh *mesh,
+                             Main *bmain,
                              Map<std::string, std::unique_ptr<MTLMaterial>> &materials,
                              Map<std::string, Material *> &created_materials,
                              const OBJImportParams &import_params);
@@ -615,6 +615,7 @@
     .uv_smooth = SUBSURF_UV_SMOOTH_PRESERVE_BOUNDARIES, \
     .quality = 3, \
     .boundary_smooth = SUBSURF_BOUNDARY_SMOOTH_ALL, \
+    .adaptive_edge_pixels = 8, \
     .emCache = NULL, \
     .mCache = NULL, \
   }
@@ -233,6 +233,7 @@ typedef enum {
   eSubsurfModifierFlag_UseCrease = (1 << 4),
   eSubsurfModifierFlag_UseCustomNormals = (1 << 5),
   eSubsurfModifierFlag_UseRecursiveSubdivision = (1 << 6),
+  eSubsurfModifierFlag_UseAdaptiveLevels = (1 << 7),
 } SubsurfModifierFlag;
 
 typedef enum {
@@ -267,7 +268,11 @@ typedef struct SubsurfModifierData {
   short quality;
   /** #eSubsurfBoundarySmooth. */
   short boundary_smooth;
-  char _pad[2];
+  /**
+   * Target length of subdivided edges in pixels of the scene camera, used to lower the levels
+   * when #eSubsurfModifierFlag_UseAdaptiveLevels is set.
+   */
+  short adaptive_edge_pixels;
 
   /* TODO(sergey): Get rid of those with the old CCG subdivision code. */
   void *emCache, *mCache;
@@ -2565,6 +2570,10 @@ typedef struct NodesModifierData {
 
 typedef enum NodesModifierFlag {
   NODES_MODIFIER_HIDE_DATABLOCK_SELECTOR = (1 << 0),
+  /** Reuse outputs of nodes whose inputs did not change since the previous evaluation. */
+  NODES_MODIFIER_CACHE_NODE_RESULTS = (1 << 1),
+  /** Count the memory and elements of the geometries that every node outputs. */
+  NODES_MODIFIER_PROFILE_MEMORY = (1 << 2),
 } NodesModifierFlag;
 
 typedef struct MeshToVolumeModifierData {
@@ -3269,6 +3269,11 @@ typedef enum GeometryNodeRaycastMapMode {
   GEO_NODE_RAYCAST_NEAREST = 1,
 } GeometryNodeRaycastMapMode;
 
+typedef enum GeometryNodeSortElementsMode {
+  GEO_NODE_SORT_ELEMENTS_WEIGHT = 0,
+  GEO_NODE_SORT_ELEMENTS_SPATIAL = 1,
+} GeometryNodeSortElementsMode;
+
 typedef enum GeometryNodeCurveFillMode {
   GEO_NODE_CURVE_FILL_MODE_TRIANGULATED = 0,
   GEO_NODE_CURVE_FILL_MODE_NGONS = 1,
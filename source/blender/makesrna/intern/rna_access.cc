@@ -5106,8 +5106,30 @@ static int rna_raw_access(ReportList *reports,
         return 1;
       }
 
-      /* Could also be faster with non-matching types,
-       * for now we just do slower loop. */
+      if (!set && ELEM(itemtype, PROP_INT, PROP_FLOAT)) {
+        /* Non-matching types, e.g. reading a float property into a double buffer. Convert the
+         * values the same way the property getters do, but read them from the raw array directly
+         * instead of going through the getters for every item. Setting still uses the slower loop
+         * below, since the setters also clamp the values to the property range. */
+        RawArray out_item = out;
+        int a = 0;
+        for (int i = 0; i < out.len; i++) {
+          for (int j = 0; j < item_len; j++, a++) {
+            if (itemtype == PROP_INT) {
+              int value;
+              RAW_GET(int, value, out_item, j);
+              RAW_SET(int, in, a, value);
+            }
+            else {
+              float value;
+              RAW_GET(float, value, out_item, j);
+              RAW_SET(float, in, a, value);
+            }
+          }
+          out_item.array = static_cast<char *>(out_item.array) + out.stride;
+        }
+        return 1;
+      }
     }
     BLI_assert_msg(array_len == 0 || itemtype != PROP_ENUM,
                    "Enum array properties should not exist");
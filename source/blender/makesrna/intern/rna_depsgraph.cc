@@ -280,6 +280,28 @@ static void rna_Depsgraph_debug_stats_gnuplot(Depsgraph *depsgraph,
   fclose(f);
 }
 
+static void rna_Depsgraph_debug_timeline_enable(Depsgraph *depsgraph, bool enable)
+{
+  DEG_debug_timeline_enable(depsgraph, enable);
+}
+
+static void rna_Depsgraph_debug_timeline_write(Depsgraph *depsgraph,
+                                               ReportList *reports,
+                                               const char *filepath)
+{
+  if (!DEG_debug_timeline_is_enabled(depsgraph)) {
+    BKE_report(reports, RPT_ERROR, "Timeline recording is not enabled");
+    return;
+  }
+  FILE *f = fopen(filepath, "w");
+  if (f == nullptr) {
+    BKE_reportf(reports, RPT_ERROR, "Cannot open file \"%s\" for writing", filepath);
+    return;
+  }
+  DEG_debug_timeline_write_chrome_trace(depsgraph, f);
+  fclose(f);
+}
+
 static void rna_Depsgraph_debug_tag_update(Depsgraph *depsgraph)
 {
   DEG_graph_tag_relations_update(depsgraph);
@@ -730,6 +752,20 @@ static void rna_def_depsgraph(BlenderRNA *brna)
                                   "File name where gnuplot script will save the result");
   RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
 
+  func = RNA_def_function(srna, "debug_timeline_enable", "rna_Depsgraph_debug_timeline_enable");
+  RNA_def_function_ui_description(
+      func, "Start or stop recording which thread evaluates which operation and when");
+  parm = RNA_def_boolean(func, "enable", true, "Enable", "");
+  RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
+
+  func = RNA_def_function(srna, "debug_timeline_write", "rna_Depsgraph_debug_timeline_write");
+  RNA_def_function_ui_description(
+      func, "Write the recorded evaluation timeline in the Chrome trace format used by Perfetto");
+  RNA_def_function_flag(func, FUNC_USE_REPORTS);
+  parm = RNA_def_string_file_path(
+      func, "filepath", nullptr, FILE_MAX, "File Name", "Output path for the trace file");
+  RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
+
   func = RNA_def_function(srna, "debug_tag_update", "rna_Depsgraph_debug_tag_update");
 
   func = RNA_def_function(srna, "debug_stats", "rna_Depsgraph_debug_stats");
@@ -834,6 +834,7 @@ static const EnumPropertyItem grease_pencil_build_time_mode_items[] = {
 
 #  include <algorithm>
 #  include <fmt/format.h>
+#  include <sstream>
 
 #  include "DNA_curve_types.h"
 #  include "DNA_fluid_types.h"
@@ -857,6 +858,7 @@ static const EnumPropertyItem grease_pencil_build_time_mode_items[] = {
 #  include "BKE_particle.h"
 
 #  include "BLI_sort_utils.h"
+#  include "BLI_string.h"
 #  include "BLI_string_utils.hh"
 
 #  include "DEG_depsgraph.hh"
@@ -1998,6 +2000,20 @@ static int rna_NodesModifier_node_warnings_length(PointerRNA *ptr)
   return get_node_modifier_warnings(*nmd).size();
 }
 
+static void rna_NodesModifier_profile_as_json(NodesModifierData *nmd,
+                                              Main *bmain,
+                                              const char **result,
+                                              int *r_result_len)
+{
+  std::stringstream stream;
+  if (nmd->runtime->eval_log) {
+    nmd->runtime->eval_log->write_profile_json(stream, *bmain);
+  }
+  const std::string str = stream.str();
+  *result = BLI_strdupn(str.data(), str.size());
+  *r_result_len = str.size();
+}
+
 static void rna_NodesModifierWarning_message_get(PointerRNA *ptr, char *r_value)
 {
   const auto *warning = static_cast<const blender::nodes::geo_eval_log::NodeWarning *>(ptr->data);
@@ -2541,6 +2557,24 @@ static void rna_def_modifier_subsurf(BlenderRNA *brna)
                            "levels of subdivision (smoothest possible shape)");
   RNA_def_property_update(prop, 0, "rna_Modifier_update");
 
+  prop = RNA_def_property(srna, "use_adaptive_levels", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "flags", eSubsurfModifierFlag_UseAdaptiveLevels);
+  RNA_def_property_ui_text(prop,
+                           "Camera Adaptive Levels",
+                           "Lower the number of subdivisions for objects that are small or far "
+                           "away in the view of the scene camera");
+  RNA_def_property_update(prop, 0, "rna_Modifier_dependency_update");
+
+  prop = RNA_def_property(srna, "adaptive_edge_pixels", PROP_INT, PROP_PIXEL);
+  RNA_def_property_int_sdna(prop, nullptr, "adaptive_edge_pixels");
+  RNA_def_property_range(prop, 1, 1000);
+  RNA_def_property_ui_range(prop, 1, 100, 1, -1);
+  RNA_def_property_ui_text(prop,
+                           "Edge Length",
+                           "Subdivide until the average edge is shorter than this number of "
+                           "pixels in the render of the scene camera, but no more than the levels");
+  RNA_def_property_update(prop, 0, "rna_Modifier_update");
+
   rna_def_modifier_panel_open_prop(srna, "open_adaptive_subdivision_panel", 0);
   rna_def_modifier_panel_open_prop(srna, "open_advanced_panel", 1);
 
@@ -8033,6 +8067,8 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
 {
   StructRNA *srna;
   PropertyRNA *prop;
+  FunctionRNA *func;
+  PropertyRNA *parm;
 
   rna_def_modifier_nodes_data_block(brna);
 
@@ -8090,6 +8126,23 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
   RNA_def_property_flag(prop, PROP_NO_DEG_UPDATE);
   RNA_def_property_update(prop, NC_OBJECT | ND_MODIFIER, nullptr);
 
+  prop = RNA_def_property(srna, "use_node_result_cache", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "flag", NODES_MODIFIER_CACHE_NODE_RESULTS);
+  RNA_def_property_ui_text(prop,
+                           "Cache Node Results",
+                           "Reuse the outputs of nodes whose inputs did not change since the "
+                           "previous evaluation in the viewport. This uses more memory and can "
+                           "make other nodes slower because geometries can't be modified in place");
+  RNA_def_property_update(prop, 0, "rna_Modifier_update");
+
+  prop = RNA_def_property(srna, "use_memory_profiling", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "flag", NODES_MODIFIER_PROFILE_MEMORY);
+  RNA_def_property_ui_text(prop,
+                           "Profile Memory",
+                           "Log the memory used by the geometries that every node outputs. This "
+                           "makes the evaluation slower");
+  RNA_def_property_update(prop, 0, "rna_Modifier_update");
+
   prop = RNA_def_property(srna, "node_warnings", PROP_COLLECTION, PROP_NONE);
   RNA_def_property_collection_funcs(prop,
                                     "rna_NodesModifier_node_warnings_iterator_begin",
@@ -8102,6 +8155,16 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
                                     nullptr);
   RNA_def_property_struct_type(prop, "NodesModifierWarning");
 
+  func = RNA_def_function(srna, "profile_as_json", "rna_NodesModifier_profile_as_json");
+  RNA_def_function_ui_description(
+      func,
+      "Return the execution times, output element counts and allocated memory of the nodes from "
+      "the last evaluation in the active depsgraph as JSON. Memory is only included when "
+      "memory profiling is enabled");
+  RNA_def_function_flag(func, FUNC_USE_MAIN);
+  parm = RNA_def_string(func, "profile", "Profile", 0, "", "");
+  RNA_def_parameter_flags(parm, PROP_DYNAMIC, PARM_OUTPUT);
+
   rna_def_modifier_panel_open_prop(
       srna, "open_output_attributes_panel", NODES_MODIFIER_PANEL_OUTPUT_ATTRIBUTES);
   rna_def_modifier_panel_open_prop(srna, "open_manage_panel", NODES_MODIFIER_PANEL_MANAGE);
@@ -15,6 +15,9 @@ struct NodesModifierBake;
 namespace blender::bke::bake {
 struct ModifierCache;
 }
+namespace blender::nodes {
+class NodeResultCache;
+}
 namespace blender::nodes::geo_eval_log {
 class GeoNodesLog;
 }
@@ -42,6 +45,12 @@ struct NodesModifierRuntime {
    * used by the evaluated modifier.
    */
   std::shared_ptr<bke::bake::ModifierCache> cache;
+  /**
+   * Outputs of individual nodes from previous evaluations. Only used when
+   * #NODES_MODIFIER_CACHE_NODE_RESULTS is enabled. Shared between the original and evaluated
+   * modifier like the simulation cache.
+   */
+  std::shared_ptr<nodes::NodeResultCache> node_result_cache;
 };
 
 void nodes_modifier_data_block_destruct(NodesModifierDataBlock *data_block, bool do_id_user);
@@ -13,6 +13,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_cache_mutex.hh"
 #include "BLI_listbase.h"
 #include "BLI_multi_value_map.hh"
 #include "BLI_set.hh"
@@ -71,6 +72,7 @@
 #include "RNA_enum_types.hh"
 #include "RNA_prototypes.hh"
 
+#include "DEG_depsgraph.hh"
 #include "DEG_depsgraph_build.hh"
 #include "DEG_depsgraph_query.hh"
 #include "DEG_depsgraph_writeback_sync.hh"
@@ -89,6 +91,7 @@
 #include "NOD_geometry_nodes_execute.hh"
 #include "NOD_geometry_nodes_gizmos.hh"
 #include "NOD_geometry_nodes_lazy_function.hh"
+#include "NOD_geometry_nodes_node_result_cache.hh"
 #include "NOD_node_declaration.hh"
 #include "NOD_socket_usage_inference.hh"
 
@@ -108,6 +111,7 @@ static void init_data(ModifierData *md)
   MEMCPY_STRUCT_AFTER(nmd, DNA_struct_default_get(NodesModifierData), modifier);
   nmd->runtime = MEM_new<NodesModifierRuntime>(__func__);
   nmd->runtime->cache = std::make_shared<bake::ModifierCache>();
+  nmd->runtime->node_result_cache = std::make_shared<nodes::NodeResultCache>();
 }
 
 static void find_dependencies_from_settings(const NodesModifierSettings &settings,
@@ -1808,6 +1812,191 @@ static void add_data_block_items_writeback(const ModifierEvalContext &ctx,
       });
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Result Sharing Between Objects
+ *
+ * Scenes often contain many objects that use the same mesh with the same geometry nodes modifier.
+ * When the modifier gets an unmodified copy of the mesh as input and the node tree does not
+ * depend on the object it is evaluated on, the result is the same for all these objects. Then it
+ * is computed only once per depsgraph evaluation and shared through implicit sharing.
+ * \{ */
+
+class SharedModifierResults : public ImplicitSharingMixin {
+ public:
+  struct Entry {
+    /** See #DEG_get_update_count. Results are only shared within one depsgraph evaluation. */
+    uint64_t update_count;
+    const bNodeTree *tree;
+    ModifierApplyFlag apply_flag;
+    /** Copy of the modifier properties, owned by the entry. */
+    IDProperty *properties;
+
+    CacheMutex result_mutex;
+    bke::GeometrySet result;
+
+    Entry(const uint64_t update_count,
+          const bNodeTree &tree,
+          const ModifierApplyFlag apply_flag,
+          const IDProperty *properties)
+        : update_count(update_count),
+          tree(&tree),
+          apply_flag(apply_flag),
+          properties(properties ? IDP_CopyProperty(properties) : nullptr)
+    {
+    }
+
+    ~Entry()
+    {
+      if (properties) {
+        IDP_FreeProperty(properties);
+      }
+    }
+  };
+
+  Mutex mutex;
+  Vector<std::shared_ptr<Entry>> entries;
+
+ private:
+  void delete_self() override
+  {
+    delete this;
+  }
+};
+
+/**
+ * Returns false if the node tree or one of the node groups it uses contains nodes that depend on
+ * the evaluated object or on state stored in the modifier.
+ */
+static bool node_tree_supports_result_sharing(const bNodeTree &tree, Set<const bNodeTree *> &done)
+{
+  if (!done.add(&tree)) {
+    return true;
+  }
+  tree.ensure_topology_cache();
+  for (const bNode *node : tree.all_nodes()) {
+    if (node->is_muted()) {
+      continue;
+    }
+    if (ELEM(node->type_legacy,
+             GEO_NODE_SELF_OBJECT,
+             GEO_NODE_OBJECT_INFO,
+             GEO_NODE_COLLECTION_INFO,
+             GEO_NODE_DEFORM_CURVES_ON_SURFACE,
+             GEO_NODE_SIMULATION_INPUT,
+             GEO_NODE_SIMULATION_OUTPUT,
+             GEO_NODE_BAKE,
+             GEO_NODE_VIEWER))
+    {
+      return false;
+    }
+    if (node->is_group()) {
+      if (const bNodeTree *group = reinterpret_cast<const bNodeTree *>(node->id)) {
+        if (!node_tree_supports_result_sharing(*group, done)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+static bool custom_data_is_shared(const CustomData &a, const CustomData &b)
+{
+  if (a.totlayer != b.totlayer) {
+    return false;
+  }
+  for (const int i : IndexRange(a.totlayer)) {
+    const CustomDataLayer &layer_a = a.layers[i];
+    const CustomDataLayer &layer_b = b.layers[i];
+    if (layer_a.type != layer_b.type || layer_a.data != layer_b.data ||
+        layer_a.flag != layer_b.flag || !STREQ(layer_a.name, layer_b.name))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Returns true if the mesh still references all the data of the mesh it was copied from, which
+ * means that no modifier before changed it.
+ */
+static bool mesh_is_unmodified_copy(const Mesh &mesh, const Mesh &src)
+{
+  return mesh.verts_num == src.verts_num && mesh.edges_num == src.edges_num &&
+         mesh.faces_num == src.faces_num && mesh.corners_num == src.corners_num &&
+         mesh.face_offset_indices == src.face_offset_indices &&
+         mesh.totcol == src.totcol &&
+         Span(mesh.mat, mesh.totcol) == Span(src.mat, src.totcol) &&
+         custom_data_is_shared(mesh.vert_data, src.vert_data) &&
+         custom_data_is_shared(mesh.edge_data, src.edge_data) &&
+         custom_data_is_shared(mesh.face_data, src.face_data) &&
+         custom_data_is_shared(mesh.corner_data, src.corner_data);
+}
+
+/**
+ * Finds the mesh whose evaluation results can be reused by other objects, or null if the result
+ * of this evaluation can't be shared.
+ */
+static const Mesh *find_mesh_for_result_sharing(const NodesModifierData &nmd,
+                                                const ModifierEvalContext &ctx,
+                                                const bke::GeometrySet &geometry_set)
+{
+  if (ctx.object->type != OB_MESH || !(ctx.object->id.tag & ID_TAG_COPIED_ON_EVAL)) {
+    return nullptr;
+  }
+  if (ctx.flag & MOD_APPLY_TO_ORIGINAL) {
+    return nullptr;
+  }
+  const Mesh *mesh = geometry_set.get_mesh();
+  if (!mesh || geometry_set.get_components().size() != 1) {
+    return nullptr;
+  }
+  const Mesh *src_mesh = BKE_object_get_pre_modified_mesh(ctx.object);
+  if (!src_mesh || src_mesh->runtime->edit_mesh || !mesh_is_unmodified_copy(*mesh, *src_mesh)) {
+    return nullptr;
+  }
+  Set<const bNodeTree *> done;
+  if (!node_tree_supports_result_sharing(*nmd.node_group, done)) {
+    return nullptr;
+  }
+  return src_mesh;
+}
+
+static std::shared_ptr<SharedModifierResults::Entry> lookup_or_add_shared_result(
+    const Mesh &src_mesh, const NodesModifierData &nmd, const ModifierEvalContext &ctx)
+{
+  SharedModifierResults *results;
+  {
+    std::lock_guard lock{src_mesh.runtime->eval_mutex};
+    ImplicitSharingPtr<> &results_ptr = src_mesh.runtime->shared_modifier_results;
+    if (!results_ptr) {
+      results_ptr = ImplicitSharingPtr<>(new SharedModifierResults());
+    }
+    results = static_cast<SharedModifierResults *>(
+        const_cast<ImplicitSharingInfo *>(results_ptr.get()));
+  }
+
+  const uint64_t update_count = DEG_get_update_count(ctx.depsgraph);
+  std::lock_guard lock{results->mutex};
+  /* Results of previous depsgraph evaluations are not used anymore. */
+  results->entries.remove_if([&](const std::shared_ptr<SharedModifierResults::Entry> &entry) {
+    return entry->update_count != update_count;
+  });
+  for (const std::shared_ptr<SharedModifierResults::Entry> &entry : results->entries) {
+    if (entry->tree == nmd.node_group && entry->apply_flag == ctx.flag &&
+        IDP_EqualsProperties(entry->properties, nmd.settings.properties))
+    {
+      return entry;
+    }
+  }
+  results->entries.append(std::make_shared<SharedModifierResults::Entry>(
+      update_count, *nmd.node_group, ctx.flag, nmd.settings.properties));
+  return results->entries.last();
+}
+
+/** \} */
+
 static void modifyGeometry(ModifierData *md,
                            const ModifierEvalContext *ctx,
                            bke::GeometrySet &geometry_set)
@@ -1873,6 +2062,20 @@ static void modifyGeometry(ModifierData *md,
   nodes::GeoNodesModifierData modifier_eval_data{};
   modifier_eval_data.depsgraph = ctx->depsgraph;
   modifier_eval_data.self_object = ctx->object;
+  nodes::NodeResultCache *node_result_cache = nullptr;
+  if (nmd->runtime->node_result_cache) {
+    if ((nmd->flag & NODES_MODIFIER_CACHE_NODE_RESULTS) && DEG_is_active(ctx->depsgraph) &&
+        !(ctx->flag & MOD_APPLY_TO_ORIGINAL))
+    {
+      node_result_cache = nmd->runtime->node_result_cache.get();
+      node_result_cache->begin_evaluation();
+    }
+    else if (!(nmd->flag & NODES_MODIFIER_CACHE_NODE_RESULTS)) {
+      /* Free the cached outputs when the option is disabled. */
+      nmd->runtime->node_result_cache->clear();
+    }
+  }
+  modifier_eval_data.node_result_cache = node_result_cache;
   auto eval_log = std::make_unique<geo_log::GeoNodesLog>();
   call_data.modifier_data = &modifier_eval_data;
 
@@ -1884,6 +2087,7 @@ static void modifyGeometry(ModifierData *md,
   Set<ComputeContextHash> socket_log_contexts;
   if (logging_enabled(ctx)) {
     call_data.eval_log = eval_log.get();
+    modifier_eval_data.profile_memory = nmd->flag & NODES_MODIFIER_PROFILE_MEMORY;
 
     find_socket_log_contexts(*nmd, *ctx, socket_log_contexts);
     call_data.socket_log_contexts = &socket_log_contexts;
@@ -1895,8 +2099,38 @@ static void modifyGeometry(ModifierData *md,
 
   bke::ModifierComputeContext modifier_compute_context{nullptr, *nmd};
 
-  geometry_set = nodes::execute_geometry_nodes_on_geometry(
-      tree, properties, modifier_compute_context, call_data, std::move(geometry_set));
+  std::shared_ptr<SharedModifierResults::Entry> shared_result;
+  if (socket_log_contexts.is_empty() && side_effect_nodes.nodes_by_context.is_empty()) {
+    if (const Mesh *src_mesh = find_mesh_for_result_sharing(*nmd, *ctx, geometry_set)) {
+      shared_result = lookup_or_add_shared_result(*src_mesh, *nmd, *ctx);
+    }
+  }
+
+  bool is_evaluated = false;
+  auto evaluate = [&]() {
+    geometry_set = nodes::execute_geometry_nodes_on_geometry(
+        tree, properties, modifier_compute_context, call_data, std::move(geometry_set));
+    is_evaluated = true;
+  };
+  if (shared_result) {
+    shared_result->result_mutex.ensure([&]() {
+      evaluate();
+      shared_result->result = geometry_set;
+    });
+    if (!is_evaluated) {
+      geometry_set = shared_result->result;
+      /* Warnings and other logged data are only available on the object that computed the
+       * result. */
+      eval_log.reset();
+    }
+  }
+  else {
+    evaluate();
+  }
+
+  if (node_result_cache) {
+    node_result_cache->end_evaluation();
+  }
 
   if (logging_enabled(ctx)) {
     nmd_orig->runtime->eval_log = std::move(eval_log);
@@ -2105,6 +2339,7 @@ static void blend_read(BlendDataReader *reader, ModifierData *md)
 
   nmd->runtime = MEM_new<NodesModifierRuntime>(__func__);
   nmd->runtime->cache = std::make_shared<bake::ModifierCache>();
+  nmd->runtime->node_result_cache = std::make_shared<nodes::NodeResultCache>();
 }
 
 static void copy_data(const ModifierData *md, ModifierData *target, const int flag)
@@ -2163,11 +2398,13 @@ static void copy_data(const ModifierData *md, ModifierData *target, const int fl
   if (flag & LIB_ID_COPY_SET_COPIED_ON_WRITE) {
     /* Share the simulation cache between the original and evaluated modifier. */
     tnmd->runtime->cache = nmd->runtime->cache;
+    tnmd->runtime->node_result_cache = nmd->runtime->node_result_cache;
     /* Keep bake path in the evaluated modifier. */
     tnmd->bake_directory = nmd->bake_directory ? BLI_strdup(nmd->bake_directory) : nullptr;
   }
   else {
     tnmd->runtime->cache = std::make_shared<bake::ModifierCache>();
+    tnmd->runtime->node_result_cache = std::make_shared<nodes::NodeResultCache>();
     /* Clear the bake path when duplicating. */
     tnmd->bake_directory = nullptr;
   }
@@ -13,6 +13,10 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_bounds.hh"
+#include "BLI_math_matrix.h"
+#include "BLI_math_matrix.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.hh"
@@ -23,6 +27,7 @@
 #include "DNA_scene_types.h"
 #include "DNA_screen_types.h"
 
+#include "BKE_camera.h"
 #include "BKE_context.hh"
 #include "BKE_editmesh.hh"
 #include "BKE_global.hh"
@@ -45,6 +50,7 @@
 #include "RNA_prototypes.hh"
 
 #include "DEG_depsgraph.hh"
+#include "DEG_depsgraph_build.hh"
 #include "DEG_depsgraph_query.hh"
 
 #include "MOD_modifiertypes.hh"
@@ -111,12 +117,97 @@ static bool is_disabled(const Scene *scene, ModifierData *md, bool use_render_pa
   return get_render_subsurf_level(&scene->r, levels, use_render_params != 0) == 0;
 }
 
+static void update_depsgraph(ModifierData *md, const ModifierUpdateDepsgraphContext *ctx)
+{
+  SubsurfModifierData *smd = (SubsurfModifierData *)md;
+  if (smd->flags & eSubsurfModifierFlag_UseAdaptiveLevels) {
+    DEG_add_scene_camera_relation(
+        ctx->node, ctx->scene, DEG_OB_COMP_TRANSFORM, "Subdivision Surface Modifier");
+    DEG_add_scene_camera_relation(
+        ctx->node, ctx->scene, DEG_OB_COMP_PARAMETERS, "Subdivision Surface Modifier");
+    DEG_add_depends_on_transform_relation(ctx->node, "Subdivision Surface Modifier");
+  }
+}
+
+/**
+ * Number of subdivisions that make the average edge of the mesh shorter than the target length in
+ * pixels of the scene camera render. The whole mesh uses the same level, so that neighboring faces
+ * always match without cracks. Returns std::nullopt when there is no camera to measure with.
+ */
+static std::optional<int> subdiv_adaptive_levels_get(const SubsurfModifierData *smd,
+                                                     const ModifierEvalContext *ctx,
+                                                     const Scene *scene,
+                                                     const Mesh &mesh)
+{
+  using namespace blender;
+  const Object *camera = scene->camera;
+  if (camera == nullptr || camera->type != OB_CAMERA) {
+    return std::nullopt;
+  }
+  const std::optional<Bounds<float3>> bounds = mesh.bounds_min_max();
+  if (!bounds || mesh.edges_num == 0) {
+    return 0;
+  }
+
+  const Span<float3> positions = mesh.vert_positions();
+  const Span<int2> edges = mesh.edges();
+  const float length_sum = threading::parallel_reduce(
+      edges.index_range(),
+      4096,
+      0.0f,
+      [&](const IndexRange range, float sum) {
+        for (const int2 edge : edges.slice(range)) {
+          sum += math::distance(positions[edge[0]], positions[edge[1]]);
+        }
+        return sum;
+      },
+      std::plus<>());
+  const float4x4 &object_to_world = ctx->object->object_to_world();
+  const float edge_length = length_sum / edges.size() * mat4_to_scale(object_to_world.ptr());
+
+  CameraParams params;
+  BKE_camera_params_init(&params);
+  BKE_camera_params_from_object(&params, camera);
+  int width, height;
+  BKE_render_resolution(&scene->r, false, &width, &height);
+  BKE_camera_params_compute_viewplane(&params, width, height, scene->r.xasp, scene->r.yasp);
+
+  /* For perspective cameras the pixel size grows with the distance to the part of the object
+   * that is closest to the camera. */
+  float pixel_size = params.viewdx;
+  if (!params.is_ortho) {
+    const float3 camera_location = camera->object_to_world().location();
+    const float3 local_location = math::transform_point(ctx->object->world_to_object(),
+                                                        camera_location);
+    const float3 closest = math::clamp(local_location, bounds->min, bounds->max);
+    const float distance = math::distance(math::transform_point(object_to_world, closest),
+                                          camera_location);
+    pixel_size *= std::max(distance, params.clip_start) / params.clip_start;
+  }
+
+  /* Every level halves the length of the edges. */
+  const float edge_pixels = edge_length / std::max(pixel_size, FLT_MIN);
+  const float target_pixels = std::max(int(smd->adaptive_edge_pixels), 1);
+  if (edge_pixels <= target_pixels) {
+    return 0;
+  }
+  return int(std::ceil(std::log2(edge_pixels / target_pixels)));
+}
+
 static int subdiv_levels_for_modifier_get(const SubsurfModifierData *smd,
-                                          const ModifierEvalContext *ctx)
+                                          const ModifierEvalContext *ctx,
+                                          const Mesh &mesh)
 {
   Scene *scene = DEG_get_evaluated_scene(ctx->depsgraph);
   const bool use_render_params = (ctx->flag & MOD_APPLY_RENDER);
-  const int requested_levels = (use_render_params) ? smd->renderLevels : smd->levels;
+  int requested_levels = (use_render_params) ? smd->renderLevels : smd->levels;
+  if (smd->flags & eSubsurfModifierFlag_UseAdaptiveLevels) {
+    if (const std::optional<int> adaptive_levels = subdiv_adaptive_levels_get(
+            smd, ctx, scene, mesh))
+    {
+      requested_levels = std::min(requested_levels, *adaptive_levels);
+    }
+  }
   return get_render_subsurf_level(&scene->r, requested_levels, use_render_params);
 }
 
@@ -124,9 +215,10 @@ static int subdiv_levels_for_modifier_get(const SubsurfModifierData *smd,
 
 static void subdiv_mesh_settings_init(blender::bke::subdiv::ToMeshSettings *settings,
                                       const SubsurfModifierData *smd,
-                                      const ModifierEvalContext *ctx)
+                                      const ModifierEvalContext *ctx,
+                                      const Mesh &mesh)
 {
-  const int level = subdiv_levels_for_modifier_get(smd, ctx);
+  const int level = subdiv_levels_for_modifier_get(smd, ctx, mesh);
   settings->resolution = (1 << level) + 1;
   settings->use_optimal_display = (smd->flags & eSubsurfModifierFlag_ControlEdges) &&
                                   !(ctx->flag & MOD_APPLY_TO_ORIGINAL);
@@ -139,7 +231,7 @@ static Mesh *subdiv_as_mesh(SubsurfModifierData *smd,
 {
   Mesh *result = mesh;
   blender::bke::subdiv::ToMeshSettings mesh_settings;
-  subdiv_mesh_settings_init(&mesh_settings, smd, ctx);
+  subdiv_mesh_settings_init(&mesh_settings, smd, ctx, *mesh);
   if (mesh_settings.resolution < 3) {
     return result;
   }
@@ -151,9 +243,10 @@ static Mesh *subdiv_as_mesh(SubsurfModifierData *smd,
 
 static void subdiv_ccg_settings_init(SubdivToCCGSettings *settings,
                                      const SubsurfModifierData *smd,
-                                     const ModifierEvalContext *ctx)
+                                     const ModifierEvalContext *ctx,
+                                     const Mesh &mesh)
 {
-  const int level = subdiv_levels_for_modifier_get(smd, ctx);
+  const int level = subdiv_levels_for_modifier_get(smd, ctx, mesh);
   settings->resolution = (1 << level) + 1;
   settings->need_normal = true;
   settings->need_mask = false;
@@ -166,7 +259,7 @@ static Mesh *subdiv_as_ccg(SubsurfModifierData *smd,
 {
   Mesh *result = mesh;
   SubdivToCCGSettings ccg_settings;
-  subdiv_ccg_settings_init(&ccg_settings, smd, ctx);
+  subdiv_ccg_settings_init(&ccg_settings, smd, ctx, *mesh);
   if (ccg_settings.resolution < 3) {
     return result;
   }
@@ -183,7 +276,7 @@ static void subdiv_cache_mesh_wrapper_settings(const ModifierEvalContext *ctx,
                                                const bool has_gpu_subdiv)
 {
   blender::bke::subdiv::ToMeshSettings mesh_settings;
-  subdiv_mesh_settings_init(&mesh_settings, smd, ctx);
+  subdiv_mesh_settings_init(&mesh_settings, smd, ctx, *mesh);
 
   runtime_data->has_gpu_subdiv = has_gpu_subdiv;
   runtime_data->resolution = mesh_settings.resolution;
@@ -401,6 +494,12 @@ static void panel_draw(const bContext *C, Panel *panel)
 
   layout->prop(ptr, "show_only_control_edges", UI_ITEM_NONE, std::nullopt, ICON_NONE);
 
+  col = &layout->column(true);
+  col->prop(ptr, "use_adaptive_levels", UI_ITEM_NONE, std::nullopt, ICON_NONE);
+  uiLayout *sub = &col->column(true);
+  sub->active_set(RNA_boolean_get(ptr, "use_adaptive_levels"));
+  sub->prop(ptr, "adaptive_edge_pixels", UI_ITEM_NONE, std::nullopt, ICON_NONE);
+
   Depsgraph *depsgraph = CTX_data_depsgraph_pointer(C);
   SubsurfModifierData *smd = static_cast<SubsurfModifierData *>(ptr->data);
   Object *ob = static_cast<Object *>(ob_ptr.data);
@@ -509,7 +608,7 @@ ModifierTypeInfo modifierType_Subsurf = {
     /*required_data_mask*/ nullptr,
     /*free_data*/ free_data,
     /*is_disabled*/ is_disabled,
-    /*update_depsgraph*/ nullptr,
+    /*update_depsgraph*/ update_depsgraph,
     /*depends_on_time*/ nullptr,
     /*depends_on_normals*/ nullptr,
     /*foreach_ID_link*/ nullptr,
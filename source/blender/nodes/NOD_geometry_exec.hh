@@ -6,6 +6,7 @@
 
 #include "BLI_color.hh"
 #include "BLI_math_quaternion_types.hh"
+#include "BLI_memory_counter.hh"
 
 #include "FN_field.hh"
 #include "FN_lazy_function.hh"
@@ -63,13 +64,40 @@ using geo_eval_log::NamedAttributeUsage;
 class NodeAttributeFilter : public AttributeFilter {
  private:
   const GeometryNodesReferenceSet &set_;
+  /** Named attributes that are not built-in are not used by any node after this one. */
+  bool skip_generic_attributes_;
 
  public:
-  NodeAttributeFilter(const GeometryNodesReferenceSet &set) : set_(set) {}
+  NodeAttributeFilter(const GeometryNodesReferenceSet &set,
+                      const bool skip_generic_attributes = false)
+      : set_(set), skip_generic_attributes_(skip_generic_attributes)
+  {
+  }
 
   Result filter(StringRef attribute_name) const override;
 };
 
+/**
+ * Returns true if the named attributes that are not built-in on the geometry passed to the given
+ * output can't affect the result of the evaluation. That is the case when the geometry is only used
+ * by nodes that only read built-in attributes, like the Bounding Box node. The result only depends
+ * on the links in the node tree.
+ */
+bool generic_attributes_are_unused(const bNodeSocket &geometry_output);
+
+/**
+ * Statistics about the geometries that a node outputs, gathered for profiling.
+ */
+struct NodeGeometryOutputStatistics {
+  /**
+   * Contains the input geometries before the node is executed, so that data the outputs share
+   * with the inputs is not counted again.
+   */
+  MemoryCount memory;
+  /** Total number of points, vertices and instances in the output geometries. */
+  int64_t elements_num = 0;
+};
+
 class GeoNodeExecParams {
  private:
   const bNode &node_;
@@ -78,6 +106,7 @@ class GeoNodeExecParams {
   const Span<int> lf_input_for_output_bsocket_usage_;
   const Span<int> lf_input_for_attribute_propagation_to_output_;
   const FunctionRef<std::string(int)> get_output_attribute_id_;
+  NodeGeometryOutputStatistics *output_statistics_;
 
  public:
   GeoNodeExecParams(const bNode &node,
@@ -85,14 +114,16 @@ class GeoNodeExecParams {
                     const lf::Context &lf_context,
                     const Span<int> lf_input_for_output_bsocket_usage,
                     const Span<int> lf_input_for_attribute_propagation_to_output,
-                    const FunctionRef<std::string(int)> get_output_attribute_id)
+                    const FunctionRef<std::string(int)> get_output_attribute_id,
+                    NodeGeometryOutputStatistics *output_statistics = nullptr)
       : node_(node),
         params_(params),
         lf_context_(lf_context),
         lf_input_for_output_bsocket_usage_(lf_input_for_output_bsocket_usage),
         lf_input_for_attribute_propagation_to_output_(
             lf_input_for_attribute_propagation_to_output),
-        get_output_attribute_id_(get_output_attribute_id)
+        get_output_attribute_id_(get_output_attribute_id),
+        output_statistics_(output_statistics)
   {
   }
 
@@ -205,6 +236,9 @@ class GeoNodeExecParams {
 #endif
       if constexpr (std::is_same_v<StoredT, GeometrySet>) {
         this->check_output_geometry_set(value);
+        if (output_statistics_) {
+          this->count_output_geometry(value);
+        }
       }
       const int index = this->get_output_index(identifier);
       params_.set_output(index, std::forward<T>(value));
@@ -319,7 +353,8 @@ class GeoNodeExecParams {
         lf_input_for_attribute_propagation_to_output_[node_.output_by_identifier(output_identifier)
                                                           .index_in_all_outputs()];
     const GeometryNodesReferenceSet &set = params_.get_input<GeometryNodesReferenceSet>(lf_index);
-    return NodeAttributeFilter(set);
+    return NodeAttributeFilter(
+        set, generic_attributes_are_unused(node_.output_by_identifier(output_identifier)));
   }
 
   /**
@@ -332,6 +367,7 @@ class GeoNodeExecParams {
   /* Utilities for detecting common errors at when using this class. */
   void check_input_access(StringRef identifier, const CPPType *requested_type = nullptr) const;
   void check_output_access(StringRef identifier, const CPPType &value_type) const;
+  void count_output_geometry(const GeometrySet &geometry_set) const;
 
   /* Find the active socket with the input name (not the identifier). */
   const bNodeSocket *find_available_socket(const StringRef name) const;
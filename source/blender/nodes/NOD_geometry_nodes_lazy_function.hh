@@ -46,6 +46,8 @@ using lf::LazyFunction;
 using mf::MultiFunction;
 using ReferenceSetIndex = int;
 
+class NodeResultCache;
+
 /** The structs in here describe the different possible behaviors of a simulation input node. */
 namespace sim_input {
 
@@ -167,6 +169,13 @@ struct GeoNodesModifierData {
   const Object *self_object = nullptr;
   /** Depsgraph that is evaluating the modifier. */
   Depsgraph *depsgraph = nullptr;
+  /** Optional cache for the outputs of individual nodes from previous evaluations. */
+  NodeResultCache *node_result_cache = nullptr;
+  /**
+   * Log the memory and element counts of the geometries output by every node. This is slow
+   * because all geometries have to be traversed, so it is only done when requested.
+   */
+  bool profile_memory = false;
 };
 
 struct GeoNodesOperatorDepsgraphs {
@@ -542,6 +551,17 @@ class LazyFunctionForLogicalOr : public lf::LazyFunction {
   void execute_impl(lf::Params &params, const lf::Context &context) const override;
 };
 
+/**
+ * Joins the geometries generated by independent iterations of a repeat zone, in the order of the
+ * inputs. All attributes are kept.
+ */
+class LazyFunctionForJoinIterationGeometries : public lf::LazyFunction {
+ public:
+  LazyFunctionForJoinIterationGeometries(const int inputs_num);
+
+  void execute_impl(lf::Params &params, const lf::Context &context) const override;
+};
+
 struct ZoneFunctionIndices {
   struct {
     Vector<int> main;
@@ -272,6 +272,13 @@ class GeoTreeLogger {
     TimePoint start;
     TimePoint end;
   };
+  struct NodeGeometryStatistics {
+    int32_t node_id;
+    /** Number of points, vertices and instances in the output geometries. */
+    int64_t elements_num;
+    /** Memory used by the output geometries that is not shared with the input geometries. */
+    int64_t allocated_bytes;
+  };
   struct ViewerNodeLogWithNode {
     int32_t node_id;
     destruct_ptr<ViewerNodeLog> viewer_log;
@@ -293,6 +300,7 @@ class GeoTreeLogger {
   linear_allocator::ChunkedList<SocketValueLog, 16> input_socket_values;
   linear_allocator::ChunkedList<SocketValueLog, 16> output_socket_values;
   linear_allocator::ChunkedList<NodeExecutionTime, 16> node_execution_times;
+  linear_allocator::ChunkedList<NodeGeometryStatistics, 16> node_geometry_statistics;
   linear_allocator::ChunkedList<ViewerNodeLogWithNode> viewer_node_logs;
   linear_allocator::ChunkedList<AttributeUsageWithNode> used_named_attributes;
   linear_allocator::ChunkedList<DebugMessage> debug_messages;
@@ -320,6 +328,10 @@ class GeoNodeLog {
   VectorSet<NodeWarning> warnings;
   /** Time spent in this node. */
   std::chrono::nanoseconds execution_time{0};
+  /** Number of geometry elements that the node output, see #NodeGeometryStatistics. */
+  int64_t output_elements_num = 0;
+  /** Memory that the node allocated for its output geometries. */
+  int64_t allocated_bytes = 0;
   /** Maps from socket indices to their values. */
   Map<int, ValueLog *> input_values_;
   Map<int, ValueLog *> output_values_;
@@ -466,6 +478,14 @@ class GeoNodesLog {
    */
   GeoTreeLog &get_tree_log(const ComputeContextHash &compute_context_hash);
 
+  /**
+   * Writes the execution times, output element counts and allocated memory of all evaluated
+   * nodes as JSON, for profiling node trees outside of the node editor. Times are also split up
+   * by the thread that executed the node. The original node trees in \a bmain are used to look up
+   * tree and node names.
+   */
+  void write_profile_json(std::ostream &stream, const Main &bmain);
+
   /**
    * Utility accessor to logged data.
    */
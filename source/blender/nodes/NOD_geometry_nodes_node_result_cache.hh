@@ -0,0 +1,146 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup nodes
+ *
+ * The node result cache allows reusing the outputs of individual geometry nodes across
+ * evaluations of a modifier. When only some inputs of a node tree change, nodes that don't depend
+ * on these inputs get exactly the same inputs as in the previous evaluation and don't have to be
+ * executed again.
+ *
+ * Single values and fields are compared by value. Geometries are compared by the data they
+ * reference, see #GeometryCacheKey. The cache only keeps weak references to the input data, but it
+ * keeps the outputs alive. Because of that, nodes following a cached node can't modify its output geometry
+ * in place anymore and have to copy it instead. That is why the cache is opt-in.
+ */
+
+#include <memory>
+
+#include "BLI_compute_context.hh"
+#include "BLI_function_ref.hh"
+#include "BLI_implicit_sharing_ptr.hh"
+#include "BLI_map.hh"
+#include "BLI_mutex.hh"
+#include "BLI_struct_equality_utils.hh"
+#include "BLI_vector.hh"
+
+#include "BKE_geometry_set.hh"
+
+#include "FN_lazy_function.hh"
+
+struct bNode;
+struct Material;
+
+namespace blender::nodes {
+
+namespace geo_eval_log {
+class GeoTreeLogger;
+}
+
+namespace lf = fn::lazy_function;
+
+/**
+ * Returns true if the outputs of the node only depend on its inputs and properties, so that the
+ * results can be reused when these have not changed. Nodes that access state outside of the node
+ * tree (e.g. the scene time or other objects) are not supported. Neither are nodes with pointers
+ * in their storage, because their properties can't be compared cheaply.
+ */
+bool node_supports_result_caching(const bNode &node);
+
+/**
+ * Information about a geometry that is enough to detect whether the same geometry is passed in
+ * again.
+ *
+ * Meshes, curves and point clouds are identified by the #ImplicitSharingInfo and version of their
+ * arrays, so that new components referencing the same data match. That is necessary because e.g.
+ * the modifier gets a new evaluated copy of the original mesh in every evaluation, which still
+ * shares all of its arrays with the original. Other components are identified by their address and
+ * version. Only weak users are added, so that the data is not kept alive by the key, while its
+ * address can't be reused for other data.
+ */
+class GeometryCacheKey {
+  struct SharedDataKey {
+    ImplicitSharingPtr<ImplicitSharingInfo, false> sharing_info;
+    int64_t version;
+    /** Attribute name, empty for other arrays. */
+    std::string name;
+  };
+
+  struct ComponentKey {
+    bke::GeometryComponent::Type type;
+    /** Only set for components whose data can't be identified by #shared_data. */
+    ImplicitSharingPtr<bke::GeometryComponent, false> component;
+    int64_t component_version = 0;
+    Vector<SharedDataKey> shared_data;
+    Vector<int, 4> domain_sizes;
+    Vector<std::string> vertex_group_names;
+    Vector<const Material *> materials;
+
+    bool matches(const ComponentKey &other) const;
+  };
+
+  Vector<ComponentKey, 2> components_;
+  std::string name_;
+
+  static ComponentKey create_component_key(const bke::GeometryComponent &component);
+  static bool try_add_data_keys(const bke::GeometryComponent &component, ComponentKey &r_key);
+
+ public:
+  explicit GeometryCacheKey(const bke::GeometrySet &geometry);
+
+  bool matches(const bke::GeometrySet &geometry) const;
+};
+
+class NodeResultCache : NonCopyable, NonMovable {
+ public:
+  struct Entry;
+
+ private:
+  struct NodeKey {
+    ComputeContextHash context_hash;
+    int32_t node_id;
+
+    uint64_t hash() const
+    {
+      return get_default_hash(context_hash, node_id);
+    }
+
+    BLI_STRUCT_EQUALITY_OPERATORS_2(NodeKey, context_hash, node_id)
+  };
+
+  Mutex mutex_;
+  Map<NodeKey, std::shared_ptr<const Entry>> entries_;
+  /** Incremented with every evaluation, used to find entries of nodes that are not used anymore. */
+  int64_t evaluation_counter_ = 0;
+
+ public:
+  NodeResultCache();
+  ~NodeResultCache();
+
+  /**
+   * Either outputs the values that the node computed in a previous evaluation with the same inputs
+   * and properties, or calls \a execute_fn and remembers the outputs it sets. All inputs of the
+   * node have to be available already.
+   *
+   * \param tree_logger: Optional logger for the current compute context. Warnings and named
+   * attribute usages of the node are replayed on it when the cached outputs are used.
+   */
+  void execute_node(const bNode &node,
+                    const ComputeContextHash &context_hash,
+                    lf::Params &params,
+                    geo_eval_log::GeoTreeLogger *tree_logger,
+                    FunctionRef<void(lf::Params &params)> execute_fn);
+
+  /** Has to be called before every evaluation of the node tree that uses the cache. */
+  void begin_evaluation();
+  /** Removes the results of nodes that have not been executed since #begin_evaluation. */
+  void end_evaluation();
+
+  void clear();
+};
+
+}  // namespace blender::nodes
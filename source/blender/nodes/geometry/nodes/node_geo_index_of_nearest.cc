@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
 #include "BLI_array.hh"
+#include "BLI_array_utils.hh"
 #include "BLI_kdtree.h"
 #include "BLI_map.hh"
 #include "BLI_task.hh"
@@ -46,9 +47,26 @@ static void find_neighbors(const KDTree_3d &tree,
                            const IndexMask &mask,
                            MutableSpan<int> r_indices)
 {
-  mask.foreach_index(GrainSize(1024), [&](const int index) {
-    r_indices[index] = find_nearest_non_self(tree, positions[index], index);
-  });
+  /* The batch lookup has some overhead for sorting the queries, which only pays off for larger
+   * numbers of queries. */
+  if (mask.size() < 1024) {
+    mask.foreach_index([&](const int index) {
+      r_indices[index] = find_nearest_non_self(tree, positions[index], index);
+    });
+    return;
+  }
+  Array<int> indices(mask.size());
+  mask.to_indices<int>(indices);
+  Array<float3> query_positions(mask.size());
+  array_utils::gather(positions, indices.as_span(), query_positions.as_mutable_span());
+  Array<int> nearest(mask.size());
+  BLI_kdtree_3d_find_nearest_batch(&tree,
+                                   reinterpret_cast<const float(*)[3]>(query_positions.data()),
+                                   uint(query_positions.size()),
+                                   indices.data(),
+                                   nearest.data(),
+                                   nullptr);
+  array_utils::scatter(nearest.as_span(), indices.as_span(), r_indices);
 }
 
 class IndexOfNearestFieldInput final : public bke::GeometryFieldInput {
@@ -34,26 +34,39 @@ static void node_declare(NodeDeclarationBuilder &b)
   b.add_output<decl::Geometry>("Geometry").propagate_all().align_with_previous();
   b.add_input<decl::Bool>("Selection").default_value(true).field_on_all().hide_value();
   b.add_input<decl::Int>("Group ID").field_on_all().hide_value();
-  b.add_input<decl::Float>("Sort Weight").field_on_all().hide_value();
+  auto &weight = b.add_input<decl::Float>("Sort Weight")
+                     .field_on_all()
+                     .hide_value()
+                     .make_available([](bNode &node) {
+                       node.custom2 = GEO_NODE_SORT_ELEMENTS_WEIGHT;
+                     });
+
+  if (const bNode *node = b.node_or_null()) {
+    weight.available(GeometryNodeSortElementsMode(node->custom2) ==
+                     GEO_NODE_SORT_ELEMENTS_WEIGHT);
+  }
 }
 
 static void node_layout(uiLayout *layout, bContext * /*C*/, PointerRNA *ptr)
 {
   layout->prop(ptr, "domain", UI_ITEM_NONE, "", ICON_NONE);
+  layout->prop(ptr, "mode", UI_ITEM_NONE, "", ICON_NONE);
 }
 
 static void node_init(bNodeTree * /*tree*/, bNode *node)
 {
   node->custom1 = int(bke::AttrDomain::Point);
+  node->custom2 = GEO_NODE_SORT_ELEMENTS_WEIGHT;
 }
 
+template<typename T>
 static void grouped_sort(const OffsetIndices<int> offsets,
-                         const Span<float> weights,
+                         const Span<T> weights,
                          MutableSpan<int> indices)
 {
   const auto comparator = [&](const int index_a, const int index_b) {
-    const float weight_a = weights[index_a];
-    const float weight_b = weights[index_b];
+    const T weight_a = weights[index_a];
+    const T weight_b = weights[index_b];
     if (UNLIKELY(weight_a == weight_b)) {
       /* Approach to make it stable. */
       return index_a < index_b;
@@ -125,7 +138,8 @@ static std::optional<Array<int>> sorted_indices(const fn::FieldContext &field_co
                                                 const int domain_size,
                                                 const Field<bool> selection_field,
                                                 const Field<int> group_id_field,
-                                                const Field<float> weight_field)
+                                                const Field<float> weight_field,
+                                                const GeometryNodeSortElementsMode mode)
 {
   if (domain_size == 0) {
     return std::nullopt;
@@ -134,11 +148,16 @@ static std::optional<Array<int>> sorted_indices(const fn::FieldContext &field_co
   FieldEvaluator evaluator(field_context, domain_size);
   evaluator.set_selection(selection_field);
   evaluator.add(group_id_field);
-  evaluator.add(weight_field);
+  if (mode == GEO_NODE_SORT_ELEMENTS_SPATIAL) {
+    evaluator.add(bke::AttributeFieldInput::from<float3>("position"));
+  }
+  else {
+    evaluator.add(weight_field);
+  }
   evaluator.evaluate();
   const IndexMask mask = evaluator.get_evaluated_selection_as_mask();
   const VArray<int> group_id = evaluator.get_evaluated<int>(0);
-  const VArray<float> weight = evaluator.get_evaluated<float>(1);
+  const GVArray &weight = evaluator.get_evaluated(1);
 
   if (group_id.is_single() && weight.is_single()) {
     return std::nullopt;
@@ -149,11 +168,34 @@ static std::optional<Array<int>> sorted_indices(const fn::FieldContext &field_co
 
   Array<int> gathered_indices(mask.size());
 
-  if (group_id.is_single()) {
+  if (mode == GEO_NODE_SORT_ELEMENTS_SPATIAL) {
+    Array<int> offsets_to_sort({0, int(mask.size())});
+    if (group_id.is_single()) {
+      array_utils::fill_index_range<int>(gathered_indices);
+    }
+    else {
+      Array<int> gathered_group_id(mask.size());
+      array_utils::gather(group_id, mask, gathered_group_id.as_mutable_span());
+      const int total_groups = identifiers_to_indices(gathered_group_id);
+      offsets_to_sort.reinitialize(total_groups + 1);
+      offsets_to_sort.fill(0);
+      find_points_by_group_index(gathered_group_id, offsets_to_sort, gathered_indices);
+    }
+    if (!weight.is_single()) {
+      /* All groups share the same bounds, so that the keys are comparable between groups too. */
+      Array<float3> positions(mask.size());
+      array_utils::gather(weight.typed<float3>(), mask, positions.as_mutable_span());
+      Array<uint64_t> keys(mask.size());
+      geometry::calc_spatial_sort_keys(positions, keys);
+      grouped_sort(offsets_to_sort.as_span(), keys.as_span(), gathered_indices);
+    }
+    parallel_transform<int>(gathered_indices, 2048, [&](const int pos) { return mask[pos]; });
+  }
+  else if (group_id.is_single()) {
     mask.to_indices<int>(gathered_indices);
     Array<float> weight_span(domain_size);
-    array_utils::copy(weight, mask, weight_span.as_mutable_span());
-    grouped_sort(Span({0, int(mask.size())}), weight_span, gathered_indices);
+    array_utils::copy(weight.typed<float>(), mask, weight_span.as_mutable_span());
+    grouped_sort(Span({0, int(mask.size())}), weight_span.as_span(), gathered_indices);
   }
   else {
     Array<int> gathered_group_id(mask.size());
@@ -163,8 +205,8 @@ static std::optional<Array<int>> sorted_indices(const fn::FieldContext &field_co
     find_points_by_group_index(gathered_group_id, offsets_to_sort, gathered_indices);
     if (!weight.is_single()) {
       Array<float> weight_span(mask.size());
-      array_utils::gather(weight, mask, weight_span.as_mutable_span());
-      grouped_sort(offsets_to_sort.as_span(), weight_span, gathered_indices);
+      array_utils::gather(weight.typed<float>(), mask, weight_span.as_mutable_span());
+      grouped_sort(offsets_to_sort.as_span(), weight_span.as_span(), gathered_indices);
     }
     parallel_transform<int>(gathered_indices, 2048, [&](const int pos) { return mask[pos]; });
   }
@@ -200,6 +242,7 @@ static void node_geo_exec(GeoNodeExecParams params)
   const Field<int> group_id_field = params.extract_input<Field<int>>("Group ID");
   const Field<float> weight_field = params.extract_input<Field<float>>("Sort Weight");
   const bke::AttrDomain domain = bke::AttrDomain(params.node().custom1);
+  const GeometryNodeSortElementsMode mode = GeometryNodeSortElementsMode(params.node().custom2);
 
   const NodeAttributeFilter attribute_filter = params.get_attribute_filter("Geometry");
 
@@ -214,7 +257,8 @@ static void node_geo_exec(GeoNodeExecParams params)
               instances->instances_num(),
               selection_field,
               group_id_field,
-              weight_field))
+              weight_field,
+              mode))
       {
         bke::Instances *result = geometry::reorder_instaces(
             *instances, *indices, attribute_filter);
@@ -240,7 +284,8 @@ static void node_geo_exec(GeoNodeExecParams params)
             src_component->attribute_domain_size(domain),
             selection_field,
             group_id_field,
-            weight_field);
+            weight_field,
+            mode);
         if (!indices.has_value()) {
           continue;
         }
@@ -291,6 +336,29 @@ static void node_rna(StructRNA *srna)
                     supported_items.data(),
                     NOD_inline_enum_accessors(custom1),
                     int(bke::AttrDomain::Point));
+
+  static const EnumPropertyItem mode_items[] = {
+      {GEO_NODE_SORT_ELEMENTS_WEIGHT,
+       "WEIGHT",
+       0,
+       "Weight",
+       "Sort the elements by the sort weight"},
+      {GEO_NODE_SORT_ELEMENTS_SPATIAL,
+       "SPATIAL",
+       0,
+       "Spatial",
+       "Sort the elements along a space-filling curve through their positions, so that elements "
+       "that are close to each other also have similar indices"},
+      {0, nullptr, 0, nullptr, nullptr},
+  };
+
+  RNA_def_node_enum(srna,
+                    "mode",
+                    "Mode",
+                    "How to determine the new order of the elements",
+                    mode_items,
+                    NOD_inline_enum_accessors(custom2),
+                    GEO_NODE_SORT_ELEMENTS_WEIGHT);
 }
 
 static void node_register()
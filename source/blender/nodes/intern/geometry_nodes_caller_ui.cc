@@ -913,6 +913,7 @@ static void draw_manage_panel(const bContext *C,
   {
     draw_named_attributes_panel(panel_layout, nmd);
   }
+  layout->prop(modifier_ptr, "use_node_result_cache", UI_ITEM_NONE, std::nullopt, ICON_NONE);
 }
 
 void draw_geometry_nodes_modifier_ui(const bContext &C, PointerRNA *modifier_ptr, uiLayout &layout)
@@ -22,6 +22,7 @@
 
 #include "NOD_geometry_exec.hh"
 #include "NOD_geometry_nodes_lazy_function.hh"
+#include "NOD_geometry_nodes_node_result_cache.hh"
 #include "NOD_multi_function.hh"
 #include "NOD_node_declaration.hh"
 
@@ -143,13 +144,16 @@ class LazyFunctionForGeometryNode : public LazyFunction {
    * does not have to execute.
    */
   Vector<bool> is_attribute_output_bsocket_;
+  /** True if the outputs of the node may be reused when its inputs did not change. */
+  bool supports_result_caching_;
 
  public:
   LazyFunctionForGeometryNode(const bNode &node,
                               GeometryNodesLazyFunctionGraphInfo &own_lf_graph_info)
       : node_(node),
         own_lf_graph_info_(own_lf_graph_info),
-        is_attribute_output_bsocket_(node.output_sockets().size(), false)
+        is_attribute_output_bsocket_(node.output_sockets().size(), false),
+        supports_result_caching_(node_supports_result_caching(node))
   {
     BLI_assert(node.typeinfo->geometry_node_execute != nullptr);
     debug_name_ = node.name;
@@ -250,15 +254,63 @@ class LazyFunctionForGeometryNode : public LazyFunction {
       return this->anonymous_attribute_name_for_output(*user_data, i);
     };
 
-    GeoNodeExecParams geo_params{
-        node_,
-        params,
-        context,
-        own_lf_graph_info_.mapping.lf_input_index_for_output_bsocket_usage,
-        own_lf_graph_info_.mapping.lf_input_index_for_reference_set_for_output,
-        get_anonymous_attribute_name};
+    /* Temporary allocators used during the node evaluation recycle their memory. */
+    LinearAllocatorArenaScope allocator_arena_scope;
 
-    node_.typeinfo->geometry_node_execute(geo_params);
+    const auto &local_user_data = *static_cast<GeoNodesLocalUserData *>(context.local_user_data);
+    geo_eval_log::GeoTreeLogger *tree_logger = local_user_data.try_get_tree_logger(*user_data);
+
+    auto execute_node = [&](lf::Params &node_params) {
+      std::optional<NodeGeometryOutputStatistics> output_statistics;
+      int64_t input_bytes = 0;
+      if (tree_logger && user_data->call_data->modifier_data &&
+          user_data->call_data->modifier_data->profile_memory)
+      {
+        /* Count the input geometries first, so that only memory that the node allocated for its
+         * outputs is attributed to it. */
+        output_statistics.emplace();
+        MemoryCounter memory{output_statistics->memory};
+        for (const int lf_index : inputs_.index_range()) {
+          if (*inputs_[lf_index].type != CPPType::get<GeometrySet>()) {
+            continue;
+          }
+          if (const auto *geometry = node_params.try_get_input_data_ptr<GeometrySet>(lf_index)) {
+            geometry->count_memory(memory);
+          }
+        }
+        input_bytes = output_statistics->memory.total_bytes;
+      }
+
+      GeoNodeExecParams geo_params{
+          node_,
+          node_params,
+          context,
+          own_lf_graph_info_.mapping.lf_input_index_for_output_bsocket_usage,
+          own_lf_graph_info_.mapping.lf_input_index_for_reference_set_for_output,
+          get_anonymous_attribute_name,
+          output_statistics ? &*output_statistics : nullptr};
+
+      node_.typeinfo->geometry_node_execute(geo_params);
+
+      if (output_statistics) {
+        tree_logger->node_geometry_statistics.append(
+            *tree_logger->allocator,
+            {node_.identifier,
+             output_statistics->elements_num,
+             output_statistics->memory.total_bytes - input_bytes});
+      }
+    };
+
+    if (supports_result_caching_) {
+      const GeoNodesModifierData *modifier_data = user_data->call_data->modifier_data;
+      if (modifier_data && modifier_data->node_result_cache) {
+        modifier_data->node_result_cache->execute_node(
+            node_, user_data->compute_context->hash(), params, tree_logger, execute_node);
+        return;
+      }
+    }
+
+    execute_node(params);
   }
 
   std::string input_name(const int index) const override
@@ -378,6 +430,7 @@ class LazyFunctionForRerouteNode : public LazyFunction {
   LazyFunctionForRerouteNode(const CPPType &type)
   {
     debug_name_ = "Reroute";
+    is_cheap_ = true;
     inputs_.append({"Input", type});
     outputs_.append({"Output", type});
   }
@@ -729,6 +782,48 @@ class LazyFunctionForMutedNode : public LazyFunction {
   }
 };
 
+/**
+ * Multi-function nodes whose cost is bounded when they are evaluated on single values or just
+ * build fields. Other multi-function nodes may do arbitrary amounts of work even for single
+ * values, e.g. when sampling a texture or looking up a color ramp.
+ */
+static bool is_cheap_multi_function_node(const bNode &node)
+{
+  if (!ELEM(node.type_legacy,
+            SH_NODE_VALUE,
+            SH_NODE_MATH,
+            SH_NODE_VECTOR_MATH,
+            SH_NODE_CLAMP,
+            SH_NODE_MAP_RANGE,
+            SH_NODE_MIX,
+            SH_NODE_SEPXYZ,
+            SH_NODE_COMBXYZ,
+            FN_NODE_BOOLEAN_MATH,
+            FN_NODE_COMPARE,
+            FN_NODE_INTEGER_MATH,
+            FN_NODE_SEPARATE_COLOR,
+            FN_NODE_COMBINE_COLOR,
+            FN_NODE_ROTATE_VECTOR))
+  {
+    return false;
+  }
+  /* Volume grid inputs are processed voxel by voxel, which is not bounded. */
+  const bNodeTree &tree = node.owner_tree();
+  const Span<nodes::StructureType> structure_types = tree.runtime->inferred_structure_types;
+  if (structure_types.size() != tree.all_sockets().size()) {
+    return false;
+  }
+  for (const bNodeSocket *socket : node.input_sockets()) {
+    if (!ELEM(structure_types[socket->index_in_tree()],
+              nodes::StructureType::Single,
+              nodes::StructureType::Field))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 /**
  * This lazy-function wraps nodes that are implemented as multi-function (mostly math nodes).
  */
@@ -745,6 +840,7 @@ class LazyFunctionForMultiFunctionNode : public LazyFunction {
   {
     BLI_assert(fn_item_.fn != nullptr);
     debug_name_ = node.name;
+    is_cheap_ = is_cheap_multi_function_node(node);
     lazy_function_interface_from_node(node, inputs_, outputs_, r_lf_index_by_bsocket);
   }
 
@@ -830,6 +926,7 @@ class LazyFunctionForImplicitInput : public LazyFunction {
       : init_fn_(std::move(init_fn))
   {
     debug_name_ = "Input";
+    is_cheap_ = true;
     outputs_.append({"Output", type});
   }
 
@@ -1361,6 +1458,7 @@ class LazyFunctionForSwitchSocketUsage : public lf::LazyFunction {
   LazyFunctionForSwitchSocketUsage()
   {
     debug_name_ = "Switch Socket Usage";
+    is_cheap_ = true;
     inputs_.append_as("Condition", CPPType::get<SocketValueVariant>());
     outputs_.append_as("False", CPPType::get<bool>());
     outputs_.append_as("True", CPPType::get<bool>());
@@ -1390,6 +1488,7 @@ class LazyFunctionForIndexSwitchSocketUsage : public lf::LazyFunction {
   LazyFunctionForIndexSwitchSocketUsage(const bNode &bnode)
   {
     debug_name_ = "Index Switch Socket Usage";
+    is_cheap_ = true;
     inputs_.append_as("Index", CPPType::get<SocketValueVariant>());
     for (const bNodeSocket *socket : bnode.input_sockets().drop_front(1)) {
       outputs_.append_as(socket->identifier, CPPType::get<bool>());
@@ -1421,6 +1520,7 @@ class LazyFunctionForExtractingReferenceSet : public lf::LazyFunction {
   LazyFunctionForExtractingReferenceSet()
   {
     debug_name_ = "Extract References";
+    is_cheap_ = true;
     inputs_.append_as("Use", CPPType::get<bool>());
     inputs_.append_as("Field", CPPType::get<SocketValueVariant>(), lf::ValueUsage::Maybe);
     outputs_.append_as("References", CPPType::get<GeometryNodesReferenceSet>());
@@ -1471,6 +1571,7 @@ class LazyFunctionForJoinReferenceSets : public lf::LazyFunction {
   LazyFunctionForJoinReferenceSets(const int amount) : amount_(amount)
   {
     debug_name_ = "Join Reference Sets";
+    is_cheap_ = true;
     for ([[maybe_unused]] const int i : IndexRange(amount)) {
       inputs_.append_as("Use", CPPType::get<bool>());
       inputs_.append_as(
@@ -2,12 +2,15 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <sstream>
+
 #include "DNA_windowmanager_types.h"
 #include "NOD_geometry_nodes_bundle.hh"
 #include "NOD_geometry_nodes_closure.hh"
 #include "NOD_geometry_nodes_log.hh"
 
 #include "BLI_listbase.h"
+#include "BLI_serialize.hh"
 #include "BLI_stack.hh"
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
@@ -19,6 +22,7 @@
 #include "BKE_geometry_nodes_gizmos_transforms.hh"
 #include "BKE_grease_pencil.hh"
 #include "BKE_lib_query.hh"
+#include "BKE_main.hh"
 #include "BKE_node_legacy_types.hh"
 #include "BKE_node_runtime.hh"
 #include "BKE_node_socket_value.hh"
@@ -489,6 +493,13 @@ void GeoTreeLog::ensure_execution_times()
       const std::chrono::nanoseconds duration = timings.end - timings.start;
       this->nodes.lookup_or_add_default_as(timings.node_id).execution_time += duration;
     }
+    for (const GeoTreeLogger::NodeGeometryStatistics &statistics :
+         tree_logger->node_geometry_statistics)
+    {
+      GeoNodeLog &node_log = this->nodes.lookup_or_add_default_as(statistics.node_id);
+      node_log.output_elements_num += statistics.elements_num;
+      node_log.allocated_bytes += statistics.allocated_bytes;
+    }
     this->execution_time += tree_logger->execution_time;
   }
   reduced_execution_times_ = true;
@@ -845,6 +856,151 @@ GeoTreeLog &GeoNodesLog::get_tree_log(const ComputeContextHash &compute_context_
   return reduced_tree_log;
 }
 
+void GeoNodesLog::write_profile_json(std::ostream &stream, const Main &bmain)
+{
+  using namespace io::serialize;
+
+  struct NodeProfile {
+    std::chrono::nanoseconds execution_time{0};
+    Map<int, std::chrono::nanoseconds> execution_time_by_thread;
+    int64_t elements_num = 0;
+    int64_t allocated_bytes = 0;
+  };
+  struct ContextProfile {
+    std::optional<uint32_t> tree_orig_session_uid;
+    Map<int32_t, NodeProfile> nodes;
+  };
+
+  /* Nodes that have their own compute context (e.g. group nodes and zones) include the time of
+   * the nodes inside of them. Those are skipped when computing how busy every thread was. */
+  Set<std::pair<ComputeContextHash, int32_t>> nodes_with_nested_context;
+  for (const LocalData &local_data : data_per_thread_) {
+    for (const destruct_ptr<GeoTreeLogger> &tree_logger :
+         local_data.tree_logger_by_context.values())
+    {
+      if (tree_logger->parent_hash && tree_logger->parent_node_id) {
+        nodes_with_nested_context.add({*tree_logger->parent_hash, *tree_logger->parent_node_id});
+      }
+    }
+  }
+
+  Map<ComputeContextHash, ContextProfile> profile_by_context;
+  Vector<std::chrono::nanoseconds> busy_time_by_thread;
+  std::optional<TimePoint> first_start;
+  std::optional<TimePoint> last_end;
+  int thread_index = 0;
+  for (const LocalData &local_data : data_per_thread_) {
+    std::chrono::nanoseconds busy_time{0};
+    for (const auto item : local_data.tree_logger_by_context.items()) {
+      const GeoTreeLogger &tree_logger = *item.value;
+      ContextProfile &context_profile = profile_by_context.lookup_or_add_default(item.key);
+      context_profile.tree_orig_session_uid = tree_logger.tree_orig_session_uid;
+      for (const GeoTreeLogger::NodeExecutionTime &timings : tree_logger.node_execution_times) {
+        const std::chrono::nanoseconds duration = timings.end - timings.start;
+        NodeProfile &node_profile = context_profile.nodes.lookup_or_add_default(timings.node_id);
+        node_profile.execution_time += duration;
+        node_profile.execution_time_by_thread.lookup_or_add(thread_index, {}) += duration;
+        if (!nodes_with_nested_context.contains({item.key, timings.node_id})) {
+          busy_time += duration;
+        }
+        first_start = first_start ? std::min(*first_start, timings.start) : timings.start;
+        last_end = last_end ? std::max(*last_end, timings.end) : timings.end;
+      }
+      for (const GeoTreeLogger::NodeGeometryStatistics &statistics :
+           tree_logger.node_geometry_statistics)
+      {
+        NodeProfile &node_profile = context_profile.nodes.lookup_or_add_default(
+            statistics.node_id);
+        node_profile.elements_num += statistics.elements_num;
+        node_profile.allocated_bytes += statistics.allocated_bytes;
+      }
+    }
+    busy_time_by_thread.append(busy_time);
+    thread_index++;
+  }
+
+  Map<uint32_t, const bNodeTree *> orig_tree_by_session_uid;
+  FOREACH_NODETREE_BEGIN (const_cast<Main *>(&bmain), tree, id) {
+    orig_tree_by_session_uid.add_new(tree->id.session_uid, tree);
+  }
+  FOREACH_NODETREE_END;
+
+  const auto to_seconds = [](const std::chrono::nanoseconds duration) {
+    return std::chrono::duration<double>(duration).count();
+  };
+
+  DictionaryValue root;
+  const std::chrono::nanoseconds wall_time = first_start ? *last_end - *first_start :
+                                                           std::chrono::nanoseconds(0);
+  root.append_double("wall_time", to_seconds(wall_time));
+
+  std::chrono::nanoseconds total_busy_time{0};
+  int active_threads_num = 0;
+  ArrayValue &threads = *root.append_array("threads");
+  for (const int i : busy_time_by_thread.index_range()) {
+    DictionaryValue &thread = *threads.append_dict();
+    thread.append_int("thread", i);
+    thread.append_double("busy_time", to_seconds(busy_time_by_thread[i]));
+    total_busy_time += busy_time_by_thread[i];
+    if (busy_time_by_thread[i].count() > 0) {
+      active_threads_num++;
+    }
+  }
+  /* Ratio between the time the threads spent in nodes and the time they were available. Time that
+   * nodes spend in nested parallel loops is not logged per thread, so this is only a lower bound
+   * for how well the evaluation used the threads. */
+  root.append_double("parallel_efficiency",
+                     wall_time.count() > 0 && active_threads_num > 0 ?
+                         double(total_busy_time.count()) /
+                             (double(wall_time.count()) * active_threads_num) :
+                         0.0);
+
+  ArrayValue &contexts = *root.append_array("contexts");
+  for (const auto context_item : profile_by_context.items()) {
+    const ContextProfile &context_profile = context_item.value;
+    const bNodeTree *tree = nullptr;
+    if (context_profile.tree_orig_session_uid) {
+      tree = orig_tree_by_session_uid.lookup_default(*context_profile.tree_orig_session_uid,
+                                                      nullptr);
+    }
+    DictionaryValue &context = *contexts.append_dict();
+    std::stringstream hash_str;
+    hash_str << context_item.key;
+    context.append_str("hash", hash_str.str());
+    if (tree) {
+      context.append_str("tree", tree->id.name + 2);
+    }
+    ArrayValue &nodes = *context.append_array("nodes");
+    for (const auto node_item : context_profile.nodes.items()) {
+      const NodeProfile &node_profile = node_item.value;
+      DictionaryValue &node = *nodes.append_dict();
+      node.append_int("id", node_item.key);
+      if (tree) {
+        if (const bNode *bnode = tree->node_by_id(node_item.key)) {
+          node.append_str("name", bnode->name);
+        }
+      }
+      const double execution_time = to_seconds(node_profile.execution_time);
+      node.append_double("execution_time", execution_time);
+      node.append_int("elements", node_profile.elements_num);
+      if (execution_time > 0.0) {
+        node.append_double("elements_per_second", node_profile.elements_num / execution_time);
+      }
+      node.append_int("allocated_bytes", node_profile.allocated_bytes);
+      ArrayValue &node_threads = *node.append_array("threads");
+      for (const auto thread_item : node_profile.execution_time_by_thread.items()) {
+        DictionaryValue &node_thread = *node_threads.append_dict();
+        node_thread.append_int("thread", thread_item.key);
+        node_thread.append_double("execution_time", to_seconds(thread_item.value));
+      }
+    }
+  }
+
+  JsonFormatter formatter;
+  formatter.indentation_len = 2;
+  formatter.serialize(stream, root);
+}
+
 static void find_tree_zone_hash_recursive(
     const bNodeTreeZone &zone,
     bke::ComputeContextCache &compute_context_cache,
@@ -0,0 +1,764 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include <atomic>
+#include <variant>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_array.hh"
+#include "BLI_implicit_sharing_ptr.hh"
+#include "BLI_listbase.h"
+#include "BLI_math_quaternion_types.hh"
+
+#include "BKE_curves.hh"
+#include "BKE_customdata.hh"
+#include "BKE_geometry_nodes_reference_set.hh"
+#include "BKE_geometry_set.hh"
+#include "BKE_mesh_types.hh"
+#include "BKE_node.hh"
+#include "BKE_node_legacy_types.hh"
+#include "BKE_node_runtime.hh"
+#include "BKE_node_socket_value.hh"
+
+#include "DNA_curves_types.h"
+#include "DNA_genfile.h"
+#include "DNA_mesh_types.h"
+#include "DNA_node_types.h"
+#include "DNA_object_types.h"
+#include "DNA_pointcloud_types.h"
+#include "DNA_sdna_types.h"
+
+#include "NOD_geometry_exec.hh"
+#include "NOD_geometry_nodes_log.hh"
+#include "NOD_geometry_nodes_node_result_cache.hh"
+
+namespace blender::nodes {
+
+using bke::GeometryComponent;
+using bke::GeometryNodesReferenceSet;
+using bke::GeometrySet;
+using bke::SocketValueVariant;
+using geo_eval_log::NamedAttributeUsage;
+using geo_eval_log::NodeWarning;
+
+/** True if the DNA struct or any struct nested in it has pointer members. */
+static bool dna_struct_has_pointers(const SDNA &sdna, const int struct_index)
+{
+  const SDNA_Struct &struct_info = *sdna.structs[struct_index];
+  for (const int i : IndexRange(struct_info.members_num)) {
+    const SDNA_StructMember &member = struct_info.members[i];
+    const char *member_name = sdna.members[member.member_index];
+    if (ELEM(member_name[0], '*', '(')) {
+      return true;
+    }
+    const int member_struct_index = DNA_struct_find_index_without_alias(
+        &sdna, sdna.types[member.type_index]);
+    if (member_struct_index != -1 && dna_struct_has_pointers(sdna, member_struct_index)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * The storage of the node is compared byte-wise in #NodePropertiesKey. That only works when it
+ * doesn't contain pointers, because the data they point to can change without changing the
+ * address.
+ */
+static bool node_storage_is_comparable(const bNode &node)
+{
+  if (node.storage == nullptr) {
+    return true;
+  }
+  const StringRefNull storage_name = node.typeinfo->storagename;
+  if (storage_name.is_empty()) {
+    return false;
+  }
+  const SDNA &sdna = *DNA_sdna_current_get();
+  const int struct_index = DNA_struct_find_index_without_alias(&sdna, storage_name.c_str());
+  if (struct_index == -1) {
+    return false;
+  }
+  return !dna_struct_has_pointers(sdna, struct_index);
+}
+
+bool node_supports_result_caching(const bNode &node)
+{
+  if (ELEM(node.type_legacy, GEO_NODE_DEFORM_CURVES_ON_SURFACE)) {
+    /* Reads the surface of the self object. */
+    return false;
+  }
+  if (!node_storage_is_comparable(node)) {
+    return false;
+  }
+  bool has_geometry_input = false;
+  for (const bNodeSocket *socket : node.input_sockets()) {
+    if (!socket->is_available()) {
+      continue;
+    }
+    switch (socket->type) {
+      case SOCK_GEOMETRY:
+        has_geometry_input = true;
+        break;
+      case SOCK_OBJECT:
+      case SOCK_COLLECTION:
+      case SOCK_IMAGE:
+      case SOCK_TEXTURE:
+        /* The node may depend on the current state of the referenced data-block. */
+        return false;
+      default:
+        break;
+    }
+  }
+  /* Nodes without geometry inputs are typically cheap or they access data outside of the node
+   * tree, like the scene time or the self object. */
+  return has_geometry_input;
+}
+
+/** Single values that can be compared and hashed cheaply. */
+static bool is_supported_single_value_type(const CPPType &type)
+{
+  return type.is_any<float,
+                     int,
+                     bool,
+                     float3,
+                     ColorGeometry4f,
+                     math::Quaternion,
+                     float4x4,
+                     std::string>();
+}
+
+/** A generic value that is owned by the cache. */
+class CachedValue : NonCopyable {
+ private:
+  const CPPType *type_ = nullptr;
+  void *buffer_ = nullptr;
+
+ public:
+  CachedValue(const CPPType &type, const void *value) : type_(&type)
+  {
+    buffer_ = MEM_mallocN_aligned(type.size, type.alignment, __func__);
+    type.copy_construct(value, buffer_);
+  }
+
+  CachedValue(CachedValue &&other) : type_(other.type_), buffer_(other.buffer_)
+  {
+    other.buffer_ = nullptr;
+  }
+
+  CachedValue &operator=(CachedValue &&other)
+  {
+    if (this != &other) {
+      std::destroy_at(this);
+      new (this) CachedValue(std::move(other));
+    }
+    return *this;
+  }
+
+  ~CachedValue()
+  {
+    if (buffer_ != nullptr) {
+      type_->destruct(buffer_);
+      MEM_freeN(buffer_);
+    }
+  }
+
+  GPointer get() const
+  {
+    return {type_, buffer_};
+  }
+};
+
+bool GeometryCacheKey::ComponentKey::matches(const ComponentKey &other) const
+{
+  if (type != other.type || component.get() != other.component.get() ||
+      component_version != other.component_version || domain_sizes != other.domain_sizes ||
+      vertex_group_names != other.vertex_group_names || materials != other.materials)
+  {
+    return false;
+  }
+  if (shared_data.size() != other.shared_data.size()) {
+    return false;
+  }
+  for (const int i : shared_data.index_range()) {
+    const SharedDataKey &a = shared_data[i];
+    const SharedDataKey &b = other.shared_data[i];
+    if (a.sharing_info.get() != b.sharing_info.get() || a.version != b.version || a.name != b.name)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Adds the keys of all data referenced by the component.
+ * \return False if some of the data isn't shared, so that it can't be identified.
+ */
+bool GeometryCacheKey::try_add_data_keys(const GeometryComponent &component, ComponentKey &r_key)
+{
+  const ImplicitSharingInfo *offsets_sharing_info = nullptr;
+  const CustomData *deform_vert_data = nullptr;
+  const ListBase *vertex_group_names = nullptr;
+  Span<Material *> materials;
+  switch (component.type()) {
+    case GeometryComponent::Type::Mesh: {
+      const Mesh *mesh = static_cast<const bke::MeshComponent &>(component).get();
+      if (mesh == nullptr) {
+        return true;
+      }
+      offsets_sharing_info = mesh->runtime->face_offsets_sharing_info;
+      if (mesh->faces_num > 0 && offsets_sharing_info == nullptr) {
+        return false;
+      }
+      deform_vert_data = &mesh->vert_data;
+      vertex_group_names = &mesh->vertex_group_names;
+      materials = Span<Material *>(mesh->mat, mesh->totcol);
+      break;
+    }
+    case GeometryComponent::Type::Curve: {
+      const Curves *curves_id = static_cast<const bke::CurveComponent &>(component).get();
+      if (curves_id == nullptr) {
+        return true;
+      }
+      const bke::CurvesGeometry &curves = curves_id->geometry.wrap();
+      offsets_sharing_info = curves.runtime->curve_offsets_sharing_info;
+      if (curves.curves_num() > 0 && offsets_sharing_info == nullptr) {
+        return false;
+      }
+      deform_vert_data = &curves.point_data;
+      vertex_group_names = &curves.vertex_group_names;
+      materials = Span<Material *>(curves_id->mat, curves_id->totcol);
+      break;
+    }
+    case GeometryComponent::Type::PointCloud: {
+      const PointCloud *pointcloud =
+          static_cast<const bke::PointCloudComponent &>(component).get();
+      if (pointcloud == nullptr) {
+        return true;
+      }
+      materials = Span<Material *>(pointcloud->mat, pointcloud->totcol);
+      break;
+    }
+    default:
+      return false;
+  }
+
+  auto add_shared_data = [&](const ImplicitSharingInfo &sharing_info, const StringRef name) {
+    sharing_info.add_weak_user();
+    r_key.shared_data.append({ImplicitSharingPtr<ImplicitSharingInfo, false>(&sharing_info),
+                              sharing_info.version(),
+                              name});
+  };
+
+  if (offsets_sharing_info) {
+    add_shared_data(*offsets_sharing_info, "");
+  }
+  if (deform_vert_data) {
+    /* Vertex groups are not stored as separate arrays, so they are identified by the deform
+     * vertices and the group names. */
+    const int layer_index = CustomData_get_layer_index(deform_vert_data, CD_MDEFORMVERT);
+    if (layer_index != -1) {
+      const ImplicitSharingInfo *sharing_info = deform_vert_data->layers[layer_index].sharing_info;
+      if (sharing_info == nullptr) {
+        return false;
+      }
+      add_shared_data(*sharing_info, "");
+    }
+    LISTBASE_FOREACH (const bDeformGroup *, group, vertex_group_names) {
+      r_key.vertex_group_names.append(group->name);
+    }
+  }
+  for (const Material *material : materials) {
+    r_key.materials.append(material);
+  }
+
+  const bke::AttributeAccessor attributes = *component.attributes();
+  for (const bke::AttrDomain domain : {bke::AttrDomain::Point,
+                                       bke::AttrDomain::Edge,
+                                       bke::AttrDomain::Face,
+                                       bke::AttrDomain::Corner,
+                                       bke::AttrDomain::Curve})
+  {
+    if (attributes.domain_supported(domain)) {
+      r_key.domain_sizes.append(attributes.domain_size(domain));
+    }
+  }
+  bool all_shared = true;
+  attributes.foreach_attribute([&](const bke::AttributeIter &iter) {
+    if (r_key.vertex_group_names.contains(iter.name)) {
+      return;
+    }
+    const bke::GAttributeReader attribute = iter.get();
+    if (attribute.sharing_info == nullptr) {
+      all_shared = false;
+      iter.stop();
+      return;
+    }
+    add_shared_data(*attribute.sharing_info, iter.name);
+  });
+  return all_shared;
+}
+
+GeometryCacheKey::ComponentKey GeometryCacheKey::create_component_key(
+    const GeometryComponent &component)
+{
+  ComponentKey key;
+  key.type = component.type();
+  if (!try_add_data_keys(component, key)) {
+    /* Fall back to the identity of the component, which only matches when the exact same
+     * component is passed in again, e.g. when it is the output of a cached node. */
+    key = {};
+    key.type = component.type();
+    component.add_weak_user();
+    key.component = ImplicitSharingPtr<GeometryComponent, false>(&component);
+    key.component_version = component.version();
+  }
+  return key;
+}
+
+GeometryCacheKey::GeometryCacheKey(const GeometrySet &geometry) : name_(geometry.name)
+{
+  for (const GeometryComponent *component : geometry.get_components()) {
+    components_.append(create_component_key(*component));
+  }
+}
+
+bool GeometryCacheKey::matches(const GeometrySet &geometry) const
+{
+  if (geometry.name != name_) {
+    return false;
+  }
+  const Vector<const GeometryComponent *> other_components = geometry.get_components();
+  if (other_components.size() != components_.size()) {
+    return false;
+  }
+  for (const int i : components_.index_range()) {
+    if (!components_[i].matches(create_component_key(*other_components[i]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/** Remembers an input value of a node, so that it can be compared to later inputs. */
+struct InputKey {
+  std::variant<std::monostate,
+               SocketValueVariant,
+               GeometryCacheKey,
+               GeometryNodesReferenceSet,
+               CachedValue>
+      value;
+
+  bool matches(const CPPType &type, const void *other_value) const
+  {
+    if (const SocketValueVariant *value_variant = std::get_if<SocketValueVariant>(&value)) {
+      const SocketValueVariant &other_variant = *static_cast<const SocketValueVariant *>(
+          other_value);
+      if (value_variant->is_single()) {
+        if (!other_variant.is_single()) {
+          return false;
+        }
+        const GPointer a = value_variant->get_single_ptr();
+        const GPointer b = other_variant.get_single_ptr();
+        return a.type() == b.type() && a.type()->is_equal_or_false(a.get(), b.get());
+      }
+      if (other_variant.is_single() || other_variant.is_volume_grid()) {
+        return false;
+      }
+      return value_variant->get<fn::GField>() == other_variant.get<fn::GField>();
+    }
+    if (const GeometryCacheKey *geometry_key = std::get_if<GeometryCacheKey>(&value)) {
+      return geometry_key->matches(*static_cast<const GeometrySet *>(other_value));
+    }
+    if (const GeometryNodesReferenceSet *reference_set = std::get_if<GeometryNodesReferenceSet>(
+            &value))
+    {
+      const GeometryNodesReferenceSet &other_set =
+          *static_cast<const GeometryNodesReferenceSet *>(other_value);
+      if (reference_set->names == other_set.names) {
+        return true;
+      }
+      if (!reference_set->names || !other_set.names) {
+        return false;
+      }
+      if (reference_set->names->size() != other_set.names->size()) {
+        return false;
+      }
+      for (const std::string &name : *reference_set->names) {
+        if (!other_set.names->contains(name)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    if (const CachedValue *cached_value = std::get_if<CachedValue>(&value)) {
+      return cached_value->get().type() == &type &&
+             type.is_equal_or_false(cached_value->get().get(), other_value);
+    }
+    return false;
+  }
+};
+
+/**
+ * Creates a key for the input value, or returns false if the value type is not supported.
+ */
+static bool try_create_input_key(const CPPType &type, const void *value, InputKey &r_key)
+{
+  if (type.is<SocketValueVariant>()) {
+    const SocketValueVariant &value_variant = *static_cast<const SocketValueVariant *>(value);
+    if (value_variant.is_single()) {
+      if (!is_supported_single_value_type(*value_variant.get_single_ptr().type())) {
+        return false;
+      }
+    }
+    else if (value_variant.is_volume_grid()) {
+      return false;
+    }
+    r_key.value.emplace<SocketValueVariant>(value_variant);
+    return true;
+  }
+  if (type.is<GeometrySet>()) {
+    r_key.value.emplace<GeometryCacheKey>(*static_cast<const GeometrySet *>(value));
+    return true;
+  }
+  if (type.is<GeometryNodesReferenceSet>()) {
+    r_key.value.emplace<GeometryNodesReferenceSet>(
+        *static_cast<const GeometryNodesReferenceSet *>(value));
+    return true;
+  }
+  if (type.is_any<bool, Material *>()) {
+    r_key.value.emplace<CachedValue>(type, value);
+    return true;
+  }
+  return false;
+}
+
+/**
+ * Geometry outputs may skip generic attributes depending on how they are linked, see
+ * #generic_attributes_are_unused. Those outputs are stored as bits, so that cached geometries that
+ * lack attributes are not reused when the links change.
+ */
+static uint64_t get_outputs_skipping_generic_attributes(const bNode &node)
+{
+  uint64_t outputs_mask = 0;
+  for (const bNodeSocket *output : node.output_sockets()) {
+    if (output->type == SOCK_GEOMETRY && output->index() < 64 &&
+        generic_attributes_are_unused(*output))
+    {
+      outputs_mask |= uint64_t(1) << output->index();
+    }
+  }
+  return outputs_mask;
+}
+
+/**
+ * Node properties that are not passed in as inputs but still affect the result of the node.
+ */
+struct NodePropertiesKey {
+  const bke::bNodeType *typeinfo;
+  int16_t custom1;
+  int16_t custom2;
+  float custom3;
+  float custom4;
+  uint64_t outputs_skipping_generic_attributes;
+  Array<char> storage;
+
+  NodePropertiesKey(const bNode &node)
+      : typeinfo(node.typeinfo),
+        custom1(node.custom1),
+        custom2(node.custom2),
+        custom3(node.custom3),
+        custom4(node.custom4),
+        outputs_skipping_generic_attributes(get_outputs_skipping_generic_attributes(node))
+  {
+    if (node.storage != nullptr) {
+      /* Only nodes without pointers in their storage are cached, see
+       * #node_storage_is_comparable. */
+      const char *storage_data = static_cast<const char *>(node.storage);
+      storage = Span<char>(storage_data, MEM_allocN_len(node.storage));
+    }
+  }
+
+  bool matches(const bNode &node) const
+  {
+    if (node.typeinfo != typeinfo || node.custom1 != custom1 || node.custom2 != custom2 ||
+        node.custom3 != custom3 || node.custom4 != custom4 ||
+        get_outputs_skipping_generic_attributes(node) != outputs_skipping_generic_attributes)
+    {
+      return false;
+    }
+    if (node.storage == nullptr) {
+      return storage.is_empty();
+    }
+    const Span<char> storage_data(static_cast<const char *>(node.storage),
+                                  MEM_allocN_len(node.storage));
+    return storage.as_span() == storage_data;
+  }
+};
+
+struct NodeResultCache::Entry {
+  NodePropertiesKey properties;
+  Array<InputKey> inputs;
+  /** Output values by lazy-function output index. */
+  Map<int, CachedValue> outputs;
+  /** The evaluation in which the entry was used last. */
+  mutable std::atomic<int64_t> last_used_evaluation;
+
+  /** Logged information that is replayed when the entry is used. */
+  bool logged = false;
+  Vector<NodeWarning> warnings;
+  Vector<std::pair<std::string, NamedAttributeUsage>> used_named_attributes;
+
+  Entry(const bNode &node, const int inputs_num, const int64_t evaluation)
+      : properties(node), inputs(inputs_num), last_used_evaluation(evaluation)
+  {
+  }
+
+  bool matches_inputs(const bNode &node, const lf::Params &params) const
+  {
+    if (!properties.matches(node)) {
+      return false;
+    }
+    const lf::LazyFunction &fn = params.fn_;
+    if (fn.inputs().size() != inputs.size()) {
+      return false;
+    }
+    for (const int i : inputs.index_range()) {
+      const void *value = params.try_get_input_data_ptr(i);
+      BLI_assert(value != nullptr);
+      if (!inputs[i].matches(*fn.inputs()[i].type, value)) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+namespace {
+
+/**
+ * Forwards all calls to the actual parameters of the node, but also remembers the output values
+ * that are set by the node.
+ */
+class RecordingParams : public lf::Params {
+ private:
+  lf::Params &base_params_;
+  NodeResultCache::Entry &entry_;
+  bool multi_threading_enabled_ = false;
+
+ public:
+  RecordingParams(lf::Params &base_params, NodeResultCache::Entry &entry)
+      : lf::Params(base_params.fn_, false), base_params_(base_params), entry_(entry)
+  {
+  }
+
+  void *try_get_input_data_ptr_impl(const int index) const override
+  {
+    return base_params_.try_get_input_data_ptr(index);
+  }
+
+  void *try_get_input_data_ptr_or_request_impl(const int index) override
+  {
+    return base_params_.try_get_input_data_ptr_or_request(index);
+  }
+
+  void *get_output_data_ptr_impl(const int index) override
+  {
+    return base_params_.get_output_data_ptr(index);
+  }
+
+  void output_set_impl(const int index) override
+  {
+    const CPPType &type = *fn_.outputs()[index].type;
+    entry_.outputs.add_overwrite(index,
+                                 CachedValue(type, base_params_.get_output_data_ptr(index)));
+    base_params_.output_set(index);
+  }
+
+  bool output_was_set_impl(const int index) const override
+  {
+    return base_params_.output_was_set(index);
+  }
+
+  lf::ValueUsage get_output_usage_impl(const int index) const override
+  {
+    return base_params_.get_output_usage(index);
+  }
+
+  void set_input_unused_impl(const int index) override
+  {
+    base_params_.set_input_unused(index);
+  }
+
+  bool try_enable_multi_threading_impl() override
+  {
+    if (multi_threading_enabled_) {
+      return true;
+    }
+    if (base_params_.try_enable_multi_threading()) {
+      multi_threading_enabled_ = true;
+      return true;
+    }
+    return false;
+  }
+};
+
+}  // namespace
+
+NodeResultCache::NodeResultCache() = default;
+NodeResultCache::~NodeResultCache() = default;
+
+static bool try_use_cached_outputs(const NodeResultCache::Entry &entry,
+                                   lf::Params &params,
+                                   geo_eval_log::GeoTreeLogger *tree_logger)
+{
+  if (tree_logger != nullptr && !entry.logged) {
+    /* Execute the node again to get the logged information. */
+    return false;
+  }
+  const lf::LazyFunction &fn = params.fn_;
+  for (const int i : fn.outputs().index_range()) {
+    if (params.get_output_usage(i) == lf::ValueUsage::Unused || params.output_was_set(i)) {
+      continue;
+    }
+    if (!entry.outputs.contains(i)) {
+      /* The output was not computed in the previous evaluation. */
+      return false;
+    }
+  }
+  for (const int i : fn.outputs().index_range()) {
+    if (params.get_output_usage(i) == lf::ValueUsage::Unused || params.output_was_set(i)) {
+      continue;
+    }
+    const GPointer value = entry.outputs.lookup(i).get();
+    value.type()->copy_construct(value.get(), params.get_output_data_ptr(i));
+    params.output_set(i);
+  }
+  return true;
+}
+
+static void replay_log(const bNode &node,
+                       const NodeResultCache::Entry &entry,
+                       geo_eval_log::GeoTreeLogger &tree_logger)
+{
+  for (const NodeWarning &warning : entry.warnings) {
+    tree_logger.node_warnings.append(
+        *tree_logger.allocator,
+        {node.identifier, {warning.type, tree_logger.allocator->copy_string(warning.message)}});
+  }
+  for (const auto &[attribute_name, usage] : entry.used_named_attributes) {
+    tree_logger.used_named_attributes.append(
+        *tree_logger.allocator,
+        {node.identifier, tree_logger.allocator->copy_string(attribute_name), usage});
+  }
+}
+
+static void record_log(const bNode &node,
+                       const geo_eval_log::GeoTreeLogger &tree_logger,
+                       NodeResultCache::Entry &entry)
+{
+  entry.logged = true;
+  for (const geo_eval_log::GeoTreeLogger::WarningWithNode &item : tree_logger.node_warnings) {
+    if (item.node_id == node.identifier) {
+      entry.warnings.append(item.warning);
+    }
+  }
+  for (const geo_eval_log::GeoTreeLogger::AttributeUsageWithNode &item :
+       tree_logger.used_named_attributes)
+  {
+    if (item.node_id == node.identifier) {
+      entry.used_named_attributes.append({item.attribute_name, item.usage});
+    }
+  }
+}
+
+void NodeResultCache::execute_node(const bNode &node,
+                                   const ComputeContextHash &context_hash,
+                                   lf::Params &params,
+                                   geo_eval_log::GeoTreeLogger *tree_logger,
+                                   const FunctionRef<void(lf::Params &params)> execute_fn)
+{
+  const NodeKey key{context_hash, node.identifier};
+  std::shared_ptr<const Entry> old_entry;
+  int64_t evaluation;
+  {
+    std::lock_guard lock{mutex_};
+    old_entry = entries_.lookup_default(key, nullptr);
+    evaluation = evaluation_counter_;
+  }
+  if (old_entry && old_entry->matches_inputs(node, params)) {
+    if (try_use_cached_outputs(*old_entry, params, tree_logger)) {
+      old_entry->last_used_evaluation = evaluation;
+      if (tree_logger != nullptr) {
+        replay_log(node, *old_entry, *tree_logger);
+      }
+      return;
+    }
+  }
+  /* Remove the old results before the node is executed. They are outdated, and as long as they
+   * are alive, data they share with the inputs of the node can't be modified in place. */
+  if (old_entry) {
+    std::lock_guard lock{mutex_};
+    entries_.remove(key);
+  }
+  old_entry.reset();
+
+  const lf::LazyFunction &fn = params.fn_;
+  std::shared_ptr<Entry> new_entry = std::make_shared<Entry>(node, fn.inputs().size(), evaluation);
+  bool supports_caching = true;
+  for (const int i : fn.inputs().index_range()) {
+    const void *value = params.try_get_input_data_ptr(i);
+    BLI_assert(value != nullptr);
+    if (!try_create_input_key(*fn.inputs()[i].type, value, new_entry->inputs[i])) {
+      supports_caching = false;
+      break;
+    }
+  }
+  if (!supports_caching) {
+    execute_fn(params);
+    return;
+  }
+
+  RecordingParams recording_params{params, *new_entry};
+  execute_fn(recording_params);
+  if (tree_logger != nullptr) {
+    record_log(node, *tree_logger, *new_entry);
+  }
+
+  std::lock_guard lock{mutex_};
+  entries_.add_overwrite(key, std::move(new_entry));
+}
+
+void NodeResultCache::begin_evaluation()
+{
+  std::lock_guard lock{mutex_};
+  evaluation_counter_++;
+}
+
+void NodeResultCache::end_evaluation()
+{
+  Vector<std::shared_ptr<const Entry>> removed_entries;
+  {
+    std::lock_guard lock{mutex_};
+    entries_.remove_if([&](const MutableMapItem<NodeKey, std::shared_ptr<const Entry>> item) {
+      if (item.value->last_used_evaluation == evaluation_counter_) {
+        return false;
+      }
+      removed_entries.append(std::move(item.value));
+      return true;
+    });
+  }
+  /* Free the outputs of the removed entries outside of the lock. */
+  removed_entries.clear();
+}
+
+void NodeResultCache::clear()
+{
+  std::lock_guard lock{mutex_};
+  entries_.clear();
+}
+
+}  // namespace blender::nodes
@@ -5,6 +5,7 @@
 #include "NOD_geometry_nodes_lazy_function.hh"
 
 #include "BKE_compute_contexts.hh"
+#include "BKE_node_legacy_types.hh"
 #include "BKE_node_runtime.hh"
 #include "BKE_node_socket_value.hh"
 
@@ -18,8 +19,11 @@
 
 #include "FN_lazy_function_graph_executor.hh"
 
+#include "GEO_join_geometries.hh"
+
 namespace blender::nodes {
 
+using bke::GeometrySet;
 using bke::SocketValueVariant;
 
 /**
@@ -91,11 +95,111 @@ class RepeatZoneSideEffectProvider : public lf::GraphExecutorSideEffectProvider
   }
 };
 
+/**
+ * Describes how a repeat item is used in a zone whose iterations don't depend on each other.
+ */
+enum class IndependentRepeatItem {
+  /** The item is passed from the zone input to the zone output unchanged. */
+  PassThrough,
+  /**
+   * The item is a geometry that is joined with new geometry in every iteration. The joined
+   * geometry is the first (or last) input of the Join Geometry node.
+   */
+  JoinAsFirst,
+  JoinAsLast,
+};
+
+/**
+ * Detects repeat zones that are used as generators, i.e. where every iteration only depends on
+ * the iteration index and on values that don't change in the loop. This is the case when every
+ * repeat item is either passed through unchanged, or is a geometry that is only used by a Join
+ * Geometry node whose result is the new value of the item. The iterations can then be evaluated
+ * independently and the results are joined at the end.
+ */
+static std::optional<Vector<IndependentRepeatItem>> find_independent_repeat_items(
+    const bke::bNodeTreeZone &zone, const int items_num)
+{
+  const bNode &input_bnode = *zone.input_node();
+  const bNode &output_bnode = *zone.output_node();
+  Vector<IndependentRepeatItem> items;
+  bool has_join_item = false;
+  for (const int i : IndexRange(items_num)) {
+    /* The first output of the input node is the iteration index. */
+    const bNodeSocket &state_bsocket = input_bnode.output_socket(i + 1);
+    const bNodeSocket &result_bsocket = output_bnode.input_socket(i);
+    const Span<const bNodeLink *> result_links = result_bsocket.directly_linked_links();
+    if (result_links.size() != 1 || !result_links[0]->is_used()) {
+      return std::nullopt;
+    }
+    const bNodeLink &result_link = *result_links[0];
+    if (result_link.fromsock == &state_bsocket) {
+      items.append(IndependentRepeatItem::PassThrough);
+      continue;
+    }
+    const bNode &join_bnode = *result_link.fromnode;
+    if (join_bnode.type_legacy != GEO_NODE_JOIN_GEOMETRY || join_bnode.is_muted()) {
+      return std::nullopt;
+    }
+    if (result_link.fromsock->directly_linked_links().size() != 1) {
+      return std::nullopt;
+    }
+    const Span<const bNodeLink *> state_links = state_bsocket.directly_linked_links();
+    if (state_links.size() != 1 || state_links[0]->tonode != &join_bnode ||
+        !state_links[0]->is_used())
+    {
+      return std::nullopt;
+    }
+    Vector<const bNodeLink *> join_links;
+    for (const bNodeLink *link : join_bnode.input_socket(0).directly_linked_links()) {
+      if (link->is_used() && !link->fromnode->is_dangling_reroute()) {
+        join_links.append(link);
+      }
+    }
+    if (join_links.first() == state_links[0]) {
+      items.append(IndependentRepeatItem::JoinAsFirst);
+    }
+    else if (join_links.last() == state_links[0]) {
+      items.append(IndependentRepeatItem::JoinAsLast);
+    }
+    else {
+      return std::nullopt;
+    }
+    has_join_item = true;
+  }
+  if (!has_join_item) {
+    return std::nullopt;
+  }
+  return items;
+}
+
+LazyFunctionForJoinIterationGeometries::LazyFunctionForJoinIterationGeometries(
+    const int inputs_num)
+{
+  debug_name_ = "Join Iterations";
+  for ([[maybe_unused]] const int i : IndexRange(inputs_num)) {
+    inputs_.append_as("Geometry", CPPType::get<GeometrySet>());
+  }
+  outputs_.append_as("Geometry", CPPType::get<GeometrySet>());
+}
+
+void LazyFunctionForJoinIterationGeometries::execute_impl(lf::Params &params,
+                                                          const lf::Context & /*context*/) const
+{
+  Array<GeometrySet> geometries(inputs_.size());
+  for (const int i : inputs_.index_range()) {
+    geometries[i] = params.extract_input<GeometrySet>(i);
+    bke::GeometryComponentEditData::remember_deformed_positions_if_necessary(geometries[i]);
+  }
+  /* The attributes that are used after the zone are not known here, so all are kept. */
+  params.set_output(0, geometry::join_geometries(geometries, {}));
+}
+
 struct RepeatEvalStorage {
   LinearAllocator<> allocator;
   VectorSet<lf::FunctionNode *> lf_body_nodes;
   lf::Graph graph;
   std::optional<LazyFunctionForLogicalOr> or_function;
+  std::optional<LazyFunctionForJoinIterationGeometries> join_function;
   std::optional<RepeatZoneSideEffectProvider> side_effect_provider;
   std::optional<RepeatBodyNodeExecuteWrapper> body_execute_wrapper;
   std::optional<lf::GraphExecutor> graph_executor;
@@ -113,6 +217,8 @@ class LazyFunctionForRepeatZone : public LazyFunction {
   const bNode &repeat_output_bnode_;
   const ZoneBuildInfo &zone_info_;
   const ZoneBodyFunction &body_fn_;
+  /** Set when the iterations of the zone don't depend on each other. */
+  std::optional<Vector<IndependentRepeatItem>> independent_items_;
 
  public:
   LazyFunctionForRepeatZone(const bNodeTree &btree,
@@ -130,6 +236,10 @@ class LazyFunctionForRepeatZone : public LazyFunction {
     initialize_zone_wrapper(zone, zone_info, body_fn, true, inputs_, outputs_);
     /* Iterations input is always used. */
     inputs_[zone_info.indices.inputs.main[0]].usage = lf::ValueUsage::Used;
+
+    const auto &node_storage = *static_cast<const NodeGeometryRepeatOutput *>(
+        repeat_output_bnode_.storage);
+    independent_items_ = find_independent_repeat_items(zone, node_storage.items_num);
   }
 
   void *init_storage(LinearAllocator<> &allocator) const override
@@ -290,28 +400,32 @@ class LazyFunctionForRepeatZone : public LazyFunction {
 
     static bool static_true = true;
 
-    /* Handle body nodes pair-wise. */
-    for (const int iter_i : lf_body_nodes.index_range().drop_back(1)) {
-      lf::FunctionNode &lf_node = *lf_body_nodes[iter_i];
-      lf::FunctionNode &lf_next_node = *lf_body_nodes[iter_i + 1];
-      for (const int i : IndexRange(num_repeat_items)) {
-        lf_graph.add_link(
-            lf_node.output(body_fn_.indices.outputs.main[i]),
-            lf_next_node.input(body_fn_.indices.inputs.main[i + body_inputs_offset]));
-        /* TODO: Add back-link after being able to check for cyclic dependencies. */
-        // lf_graph.add_link(lf_next_node.output(body_fn_.indices.outputs.input_usages[i]),
-        //                   lf_node.input(body_fn_.indices.inputs.output_usages[i]));
-        lf_node.input(body_fn_.indices.inputs.output_usages[i]).set_default_value(&static_true);
-      }
-    }
-
     /* Handle border link usage outputs. */
     for (const int i : IndexRange(num_border_links)) {
       lf_graph.add_link(lf_border_link_usage_or_nodes[i]->output(0),
                         *lf_outputs[zone_info_.indices.outputs.border_link_usages[i]]);
     }
 
-    if (iterations > 0) {
+    if (independent_items_ && iterations > 1) {
+      /* All iterations can be evaluated at the same time. */
+      this->link_independent_iterations(eval_storage, lf_inputs, lf_outputs);
+    }
+    else if (iterations > 0) {
+      /* Handle body nodes pair-wise. */
+      for (const int iter_i : lf_body_nodes.index_range().drop_back(1)) {
+        lf::FunctionNode &lf_node = *lf_body_nodes[iter_i];
+        lf::FunctionNode &lf_next_node = *lf_body_nodes[iter_i + 1];
+        for (const int i : IndexRange(num_repeat_items)) {
+          lf_graph.add_link(
+              lf_node.output(body_fn_.indices.outputs.main[i]),
+              lf_next_node.input(body_fn_.indices.inputs.main[i + body_inputs_offset]));
+          /* TODO: Add back-link after being able to check for cyclic dependencies. */
+          // lf_graph.add_link(lf_next_node.output(body_fn_.indices.outputs.input_usages[i]),
+          //                   lf_node.input(body_fn_.indices.inputs.output_usages[i]));
+          lf_node.input(body_fn_.indices.inputs.output_usages[i]).set_default_value(&static_true);
+        }
+      }
+
       {
         /* Link first body node to input/output nodes. */
         lf::FunctionNode &lf_first_body_node = *lf_body_nodes[0];
@@ -404,6 +518,60 @@ class LazyFunctionForRepeatZone : public LazyFunction {
     }
   }
 
+  /**
+   * Links the loop bodies so that they don't depend on each other. Geometries that are joined in
+   * every iteration start out empty in every body and are joined once at the end instead.
+   */
+  void link_independent_iterations(RepeatEvalStorage &eval_storage,
+                                   const Span<lf::GraphInputSocket *> lf_inputs,
+                                   const Span<lf::GraphOutputSocket *> lf_outputs) const
+  {
+    lf::Graph &lf_graph = eval_storage.graph;
+    const Span<lf::FunctionNode *> lf_body_nodes = eval_storage.lf_body_nodes;
+    const int iterations = lf_body_nodes.size();
+    static const GeometrySet static_empty_geometry;
+    static bool static_true = true;
+
+    eval_storage.join_function.emplace(iterations + 1);
+
+    for (const int i : independent_items_->index_range()) {
+      const IndependentRepeatItem item = (*independent_items_)[i];
+      lf::GraphInputSocket &lf_zone_input = *lf_inputs[zone_info_.indices.inputs.main[i + 1]];
+      lf::GraphOutputSocket &lf_zone_output = *lf_outputs[zone_info_.indices.outputs.main[i]];
+      /* The inputs are used whenever the zone is evaluated. */
+      lf_outputs[zone_info_.indices.outputs.input_usages[i + 1]]->set_default_value(&static_true);
+
+      for (lf::FunctionNode *lf_body_node : lf_body_nodes) {
+        lf_body_node->input(body_fn_.indices.inputs.output_usages[i])
+            .set_default_value(&static_true);
+      }
+
+      if (item == IndependentRepeatItem::PassThrough) {
+        /* Every iteration gets the same value. */
+        for (lf::FunctionNode *lf_body_node : lf_body_nodes) {
+          lf_graph.add_link(lf_zone_input,
+                            lf_body_node->input(body_fn_.indices.inputs.main[i + 1]));
+        }
+        lf_graph.add_link(lf_zone_input, lf_zone_output);
+        continue;
+      }
+
+      lf::FunctionNode &lf_join_node = lf_graph.add_function(*eval_storage.join_function);
+      const bool join_as_first = item == IndependentRepeatItem::JoinAsFirst;
+      for (const int iter_i : lf_body_nodes.index_range()) {
+        lf::FunctionNode &lf_body_node = *lf_body_nodes[iter_i];
+        lf_body_node.input(body_fn_.indices.inputs.main[i + 1])
+            .set_default_value(&static_empty_geometry);
+        /* Keep the order of the elements the same as with serial evaluation. */
+        const int join_input_i = join_as_first ? iter_i + 1 : iterations - 1 - iter_i;
+        lf_graph.add_link(lf_body_node.output(body_fn_.indices.outputs.main[i]),
+                          lf_join_node.input(join_input_i));
+      }
+      lf_graph.add_link(lf_zone_input, lf_join_node.input(join_as_first ? 0 : iterations));
+      lf_graph.add_link(lf_join_node.output(0), lf_zone_output);
+    }
+  }
+
   std::string input_name(const int i) const override
   {
     return zone_wrapper_input_name(zone_info_, zone_, inputs_, i);
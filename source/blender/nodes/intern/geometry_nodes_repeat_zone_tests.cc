@@ -0,0 +1,79 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+#include "testing/testing.h"
+
+#include "CLG_log.h"
+
+#include "BKE_attribute.hh"
+#include "BKE_geometry_set.hh"
+#include "BKE_idtype.hh"
+#include "BKE_mesh.hh"
+
+#include "DNA_mesh_types.h"
+
+#include "FN_lazy_function_execute.hh"
+
+#include "NOD_geometry_nodes_lazy_function.hh"
+
+namespace blender::nodes::tests {
+
+using bke::AttrDomain;
+using bke::GeometrySet;
+
+class RepeatZoneTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite()
+  {
+    CLG_init();
+    BKE_idtype_init();
+  }
+
+  static void TearDownTestSuite()
+  {
+    CLG_exit();
+  }
+};
+
+/** A mesh with a single vertex that has the given value in the named point attribute. */
+static GeometrySet single_vert_geometry(const StringRef name, const int value)
+{
+  Mesh *mesh = BKE_mesh_new_nomain(1, 0, 0, 0);
+  bke::MutableAttributeAccessor attributes = mesh->attributes_for_write();
+  attributes.add<int>(
+      name, AttrDomain::Point, bke::AttributeInitVArray(VArray<int>::from_single(value, 1)));
+  return GeometrySet::from_mesh(mesh);
+}
+
+TEST_F(RepeatZoneTest, JoinIterationGeometriesKeepsAttributes)
+{
+  const LazyFunctionForJoinIterationGeometries fn(3);
+  GeometrySet result;
+  lf::execute_lazy_function_eagerly(fn,
+                                    nullptr,
+                                    nullptr,
+                                    std::make_tuple(single_vert_geometry("index", 1),
+                                                    single_vert_geometry("index", 2),
+                                                    single_vert_geometry("other", 3)),
+                                    std::make_tuple(&result));
+
+  const Mesh *mesh = result.get_mesh();
+  ASSERT_NE(mesh, nullptr);
+  EXPECT_EQ(mesh->verts_num, 3);
+  const bke::AttributeAccessor attributes = mesh->attributes();
+
+  /* The attributes of all iterations are kept, in the order of the inputs. Geometries that don't
+   * have an attribute get the default value. */
+  const VArraySpan index = *attributes.lookup<int>("index", AttrDomain::Point);
+  EXPECT_EQ(index.size(), 3);
+  EXPECT_EQ(index[0], 1);
+  EXPECT_EQ(index[1], 2);
+  EXPECT_EQ(index[2], 0);
+  const VArraySpan other = *attributes.lookup<int>("other", AttrDomain::Point);
+  EXPECT_EQ(other.size(), 3);
+  EXPECT_EQ(other[0], 0);
+  EXPECT_EQ(other[1], 0);
+  EXPECT_EQ(other[2], 3);
+}
+
+}  // namespace blender::nodes::tests
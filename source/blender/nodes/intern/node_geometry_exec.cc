@@ -156,6 +156,24 @@ void GeoNodeExecParams::check_output_geometry_set(const GeometrySet &geometry_se
 #endif
 }
 
+void GeoNodeExecParams::count_output_geometry(const GeometrySet &geometry_set) const
+{
+  MemoryCounter memory{output_statistics_->memory};
+  geometry_set.count_memory(memory);
+  for (const bke::GeometryComponent *component : geometry_set.get_components()) {
+    const std::optional<bke::AttributeAccessor> attributes = component->attributes();
+    if (!attributes) {
+      continue;
+    }
+    const AttrDomain domain = component->type() == bke::GeometryComponent::Type::Instance ?
+                                  AttrDomain::Instance :
+                                  AttrDomain::Point;
+    if (attributes->domain_supported(domain)) {
+      output_statistics_->elements_num += attributes->domain_size(domain);
+    }
+  }
+}
+
 const bNodeSocket *GeoNodeExecParams::find_available_socket(const StringRef name) const
 {
   for (const bNodeSocket *socket : node_.input_sockets()) {
@@ -249,9 +267,27 @@ void GeoNodeExecParams::check_output_access(StringRef identifier, const CPPType
   }
 }
 
+static bool attribute_is_builtin_on_any_component_type(const StringRef name)
+{
+  for (const bke::GeometryComponent::Type type : {bke::GeometryComponent::Type::Mesh,
+                                                  bke::GeometryComponent::Type::PointCloud,
+                                                  bke::GeometryComponent::Type::Curve,
+                                                  bke::GeometryComponent::Type::Instance,
+                                                  bke::GeometryComponent::Type::GreasePencil})
+  {
+    if (bke::attribute_is_builtin_on_component_type(type, name)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 AttributeFilter::Result NodeAttributeFilter::filter(const StringRef attribute_name) const
 {
   if (!bke::attribute_name_is_anonymous(attribute_name)) {
+    if (skip_generic_attributes_ && !attribute_is_builtin_on_any_component_type(attribute_name)) {
+      return AttributeFilter::Result::AllowSkip;
+    }
     return AttributeFilter::Result::Process;
   }
   if (!set_.names) {
@@ -263,6 +299,35 @@ AttributeFilter::Result NodeAttributeFilter::filter(const StringRef attribute_na
   return AttributeFilter::Result::AllowSkip;
 }
 
+bool generic_attributes_are_unused(const bNodeSocket &geometry_output)
+{
+  BLI_assert(geometry_output.is_output());
+  if (!geometry_output.is_logically_linked()) {
+    /* Keep all attributes of geometries that are only computed to be inspected in the editor. */
+    return false;
+  }
+  for (const bNodeSocket *target_socket : geometry_output.logically_linked_sockets()) {
+    const bNode &target_node = target_socket->owner_node();
+    if (!ELEM(target_node.type_legacy,
+              GEO_NODE_BOUNDING_BOX,
+              GEO_NODE_CONVEX_HULL,
+              GEO_NODE_ATTRIBUTE_DOMAIN_SIZE))
+    {
+      return false;
+    }
+    /* These nodes only read positions (and radii for the bounding box) and element counts, but
+     * they propagate instance attributes to their output geometry. */
+    for (const bNodeSocket *output : target_node.output_sockets()) {
+      if (output->type == SOCK_GEOMETRY && output->is_logically_linked()) {
+        if (!generic_attributes_are_unused(*output)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
 std::optional<std::string> GeoNodeExecParams::ensure_absolute_path(const StringRefNull path) const
 {
   if (path.is_empty()) {
@@ -0,0 +1,220 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+#include "testing/testing.h"
+
+#include "CLG_log.h"
+
+#include "BKE_appdir.hh"
+#include "BKE_attribute.hh"
+#include "BKE_geometry_set.hh"
+#include "BKE_idtype.hh"
+#include "BKE_lib_id.hh"
+#include "BKE_mesh.hh"
+#include "BKE_node.hh"
+#include "BKE_node_legacy_types.hh"
+#include "BKE_node_tree_update.hh"
+
+#include "DNA_genfile.h"
+#include "DNA_mesh_types.h"
+#include "DNA_node_types.h"
+
+#include "FN_lazy_function_execute.hh"
+
+#include "NOD_geometry_nodes_node_result_cache.hh"
+
+#include "RNA_define.hh"
+
+namespace blender::nodes::tests {
+
+using bke::GeometrySet;
+
+class NodeResultCacheTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite()
+  {
+    CLG_init();
+    DNA_sdna_current_init();
+    BKE_idtype_init();
+    RNA_init();
+    bke::node_system_init();
+    BKE_appdir_init();
+  }
+
+  static void TearDownTestSuite()
+  {
+    bke::node_system_exit();
+    RNA_exit();
+    BKE_appdir_exit();
+    DNA_sdna_current_free();
+    CLG_exit();
+  }
+};
+
+/** Passes the geometry through, using the cache for the given node. */
+class CachedPassThroughFunction : public lf::LazyFunction {
+ private:
+  NodeResultCache &cache_;
+  const bNode &node_;
+
+ public:
+  mutable int executions_num = 0;
+
+  CachedPassThroughFunction(NodeResultCache &cache, const bNode &node) : cache_(cache), node_(node)
+  {
+    debug_name_ = "Cached Pass Through";
+    inputs_.append({"Geometry", CPPType::get<GeometrySet>()});
+    outputs_.append({"Geometry", CPPType::get<GeometrySet>()});
+  }
+
+  void execute_impl(lf::Params &params, const lf::Context & /*context*/) const override
+  {
+    cache_.execute_node(node_, ComputeContextHash{}, params, nullptr, [&](lf::Params &params) {
+      executions_num++;
+      params.set_output(0, params.get_input<GeometrySet>(0));
+    });
+  }
+};
+
+/** Same as the evaluated copy of an original mesh that is passed to a modifier. */
+static GeometrySet evaluated_geometry(const Mesh &mesh)
+{
+  return GeometrySet::from_mesh(BKE_mesh_copy_for_eval(mesh));
+}
+
+TEST_F(NodeResultCacheTest, GeometryKeyEvaluatedCopy)
+{
+  Mesh *mesh = BKE_mesh_new_nomain(4, 4, 1, 4);
+
+  const GeometryCacheKey key(evaluated_geometry(*mesh));
+  /* A new copy of the same data matches, even though the components are different. */
+  EXPECT_TRUE(key.matches(evaluated_geometry(*mesh)));
+
+  /* The positions are not shared with the evaluated copies anymore, so they are modified in
+   * place, which changes their version. */
+  mesh->vert_positions_for_write().first() = float3(1.0f);
+  EXPECT_FALSE(key.matches(evaluated_geometry(*mesh)));
+
+  mesh->attributes_for_write().add<int>(
+      "test", bke::AttrDomain::Point, bke::AttributeInitDefaultValue());
+  const GeometryCacheKey key_with_attribute(evaluated_geometry(*mesh));
+  EXPECT_TRUE(key_with_attribute.matches(evaluated_geometry(*mesh)));
+
+  /* Renaming an attribute keeps its data, but the geometry is still different. */
+  mesh->attributes_for_write().rename("test", "other_test");
+  EXPECT_FALSE(key_with_attribute.matches(evaluated_geometry(*mesh)));
+
+  BKE_id_free(nullptr, mesh);
+}
+
+TEST_F(NodeResultCacheTest, ReuseForEvaluatedCopy)
+{
+  bNodeTree *ntree = bke::node_tree_add_tree(nullptr, "Test", "GeometryNodeTree");
+  bNode *node = bke::node_add_static_node(nullptr, *ntree, GEO_NODE_SET_POSITION);
+  BKE_ntree_update_without_main(*ntree);
+
+  Mesh *mesh = BKE_mesh_new_nomain(4, 4, 1, 4);
+
+  NodeResultCache cache;
+  CachedPassThroughFunction fn(cache, *node);
+  for ([[maybe_unused]] const int i : IndexRange(3)) {
+    cache.begin_evaluation();
+    GeometrySet result;
+    lf::execute_lazy_function_eagerly(
+        fn, nullptr, nullptr, std::make_tuple(evaluated_geometry(*mesh)), std::make_tuple(&result));
+    cache.end_evaluation();
+    EXPECT_TRUE(result.has_mesh());
+  }
+  /* The node is only executed in the first evaluation. */
+  EXPECT_EQ(fn.executions_num, 1);
+
+  mesh->vert_positions_for_write().first() = float3(1.0f);
+  cache.begin_evaluation();
+  GeometrySet result;
+  lf::execute_lazy_function_eagerly(
+      fn, nullptr, nullptr, std::make_tuple(evaluated_geometry(*mesh)), std::make_tuple(&result));
+  cache.end_evaluation();
+  EXPECT_EQ(fn.executions_num, 2);
+
+  BKE_id_free(nullptr, mesh);
+  BKE_id_free(nullptr, ntree);
+}
+
+/** Evaluates the function once and returns the output geometry. */
+static GeometrySet evaluate_cached(NodeResultCache &cache,
+                                   const CachedPassThroughFunction &fn,
+                                   GeometrySet geometry)
+{
+  cache.begin_evaluation();
+  GeometrySet result;
+  lf::execute_lazy_function_eagerly(
+      fn, nullptr, nullptr, std::make_tuple(std::move(geometry)), std::make_tuple(&result));
+  cache.end_evaluation();
+  return result;
+}
+
+TEST_F(NodeResultCacheTest, SupportedNodes)
+{
+  bNodeTree *ntree = bke::node_tree_add_tree(nullptr, "Test", "GeometryNodeTree");
+  const bNode *set_position = bke::node_add_static_node(nullptr, *ntree, GEO_NODE_SET_POSITION);
+  const bNode *merge = bke::node_add_static_node(nullptr, *ntree, GEO_NODE_MERGE_BY_DISTANCE);
+  const bNode *capture = bke::node_add_static_node(nullptr, *ntree, GEO_NODE_CAPTURE_ATTRIBUTE);
+  BKE_ntree_update_without_main(*ntree);
+
+  /* No storage and storage without pointers. */
+  EXPECT_TRUE(node_supports_result_caching(*set_position));
+  EXPECT_TRUE(node_supports_result_caching(*merge));
+  /* The capture items are stored in an array that is referenced by a pointer. */
+  EXPECT_FALSE(node_supports_result_caching(*capture));
+
+  BKE_id_free(nullptr, ntree);
+}
+
+TEST_F(NodeResultCacheTest, NodePropertiesKey)
+{
+  bNodeTree *ntree = bke::node_tree_add_tree(nullptr, "Test", "GeometryNodeTree");
+  bNode *node = bke::node_add_static_node(nullptr, *ntree, GEO_NODE_MERGE_BY_DISTANCE);
+  BKE_ntree_update_without_main(*ntree);
+  auto &storage = *static_cast<NodeGeometryMergeByDistance *>(node->storage);
+
+  Mesh *mesh = BKE_mesh_new_nomain(4, 4, 1, 4);
+
+  NodeResultCache cache;
+  CachedPassThroughFunction fn(cache, *node);
+  evaluate_cached(cache, fn, evaluated_geometry(*mesh));
+  EXPECT_EQ(fn.executions_num, 1);
+
+  /* Properties that are set to the same values again match. */
+  storage.mode = GEO_NODE_MERGE_BY_DISTANCE_MODE_ALL;
+  node->custom1 = 0;
+  evaluate_cached(cache, fn, evaluated_geometry(*mesh));
+  EXPECT_EQ(fn.executions_num, 1);
+
+  /* Changing the storage invalidates the cached result. */
+  storage.mode = GEO_NODE_MERGE_BY_DISTANCE_MODE_CONNECTED;
+  evaluate_cached(cache, fn, evaluated_geometry(*mesh));
+  EXPECT_EQ(fn.executions_num, 2);
+  evaluate_cached(cache, fn, evaluated_geometry(*mesh));
+  EXPECT_EQ(fn.executions_num, 2);
+
+  /* Changing the storage back doesn't reuse the older result, because only the result of the last
+   * evaluation is kept. */
+  storage.mode = GEO_NODE_MERGE_BY_DISTANCE_MODE_ALL;
+  evaluate_cached(cache, fn, evaluated_geometry(*mesh));
+  EXPECT_EQ(fn.executions_num, 3);
+
+  /* Generic properties of the node are compared too. */
+  node->custom1 = 1;
+  evaluate_cached(cache, fn, evaluated_geometry(*mesh));
+  EXPECT_EQ(fn.executions_num, 4);
+  node->custom3 = 0.5f;
+  evaluate_cached(cache, fn, evaluated_geometry(*mesh));
+  EXPECT_EQ(fn.executions_num, 5);
+  evaluate_cached(cache, fn, evaluated_geometry(*mesh));
+  EXPECT_EQ(fn.executions_num, 5);
+
+  BKE_id_free(nullptr, mesh);
+  BKE_id_free(nullptr, ntree);
+}
+
+}  // namespace blender::nodes::tests
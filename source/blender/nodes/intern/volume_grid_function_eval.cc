@@ -141,7 +141,10 @@ static void parallel_grid_topology_tasks_internal_node(const InternalNodeT &node
     child_indices.append(child_mask_iter.pos());
   }
 
-  threading::parallel_for(child_indices.index_range(), 8, [&](const IndexRange range) {
+  /* Lower-level internal nodes contain many leaf nodes each, so they are processed with a smaller
+   * grain size. Otherwise, all children of a node often end up in a single task. */
+  const int64_t grain_size = std::is_same_v<ChildNodeT, LeafNodeT> ? 8 : 1;
+  threading::parallel_for(child_indices.index_range(), grain_size, [&](const IndexRange range) {
     /* Voxels collected from potentially multiple leaf nodes to be processed in one batch. This
      * inline buffer size is sufficient to avoid an allocation in all cases (a single standard leaf
      * has 512 voxels). */
@@ -192,14 +195,21 @@ static void parallel_grid_topology_tasks(const openvdb::MaskTree &mask_tree,
                                          const ProcessVoxelsFn process_voxels_fn,
                                          const ProcessTilesFn process_tiles_fn)
 {
-  /* Iterate over the root internal nodes. */
+  using RootChildNodeT = openvdb::MaskTree::RootNodeType::ChildNodeType;
+  /* Gather the root internal nodes first to process them in parallel. A grid that extends across
+   * the origin in all directions already has eight of them. */
+  Vector<const RootChildNodeT *> root_children;
   for (auto root_child_iter = mask_tree.cbeginRootChildren(); root_child_iter.test();
        ++root_child_iter)
   {
-    const auto &internal_node = *root_child_iter;
-    parallel_grid_topology_tasks_internal_node(
-        internal_node, process_leaf_fn, process_voxels_fn, process_tiles_fn);
+    root_children.append(&*root_child_iter);
   }
+  threading::parallel_for(root_children.index_range(), 1, [&](const IndexRange range) {
+    for (const RootChildNodeT *internal_node : root_children.as_span().slice(range)) {
+      parallel_grid_topology_tasks_internal_node(
+          *internal_node, process_leaf_fn, process_voxels_fn, process_tiles_fn);
+    }
+  });
 }
 
 /**
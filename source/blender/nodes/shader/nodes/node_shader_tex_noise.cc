@@ -239,6 +239,17 @@ class NoiseFunction : public mf::MultiFunction {
     return signature;
   }
 
+  /** Noise parameters of a single element, #detail and #roughness are clamped already. */
+  struct FractalParams {
+    float scale;
+    float detail;
+    float roughness;
+    float lacunarity;
+    float offset;
+    float gain;
+    float distortion;
+  };
+
   void call(const IndexMask &mask, mf::Params params, mf::Context /*context*/) const override
   {
     int param = ELEM(dimensions_, 2, 3, 4) + ELEM(dimensions_, 1, 4);
@@ -266,6 +277,42 @@ class NoiseFunction : public mf::MultiFunction {
     MutableSpan<ColorGeometry4f> r_color =
         params.uninitialized_single_output_if_required<ColorGeometry4f>(param++, "Color");
 
+    if (scale.is_single() && detail.is_single() && roughness.is_single() &&
+        lacunarity.is_single() && offset.is_single() && gain.is_single() &&
+        distortion.is_single())
+    {
+      /* Common case when only the position changes per element. Reading the parameters only once
+       * avoids many virtual function calls per element. */
+      const FractalParams single_params{scale.get_internal_single(),
+                                        math::clamp(detail.get_internal_single(), 0.0f, 15.0f),
+                                        math::max(roughness.get_internal_single(), 0.0f),
+                                        lacunarity.get_internal_single(),
+                                        offset.get_internal_single(),
+                                        gain.get_internal_single(),
+                                        distortion.get_internal_single()};
+      this->call_with_params(
+          mask, params, r_factor, r_color, [&](const int64_t /*i*/) { return single_params; });
+    }
+    else {
+      this->call_with_params(mask, params, r_factor, r_color, [&](const int64_t i) {
+        return FractalParams{scale[i],
+                             math::clamp(detail[i], 0.0f, 15.0f),
+                             math::max(roughness[i], 0.0f),
+                             lacunarity[i],
+                             offset[i],
+                             gain[i],
+                             distortion[i]};
+      });
+    }
+  }
+
+  template<typename GetParamsFn>
+  void call_with_params(const IndexMask &mask,
+                        mf::Params &params,
+                        MutableSpan<float> r_factor,
+                        MutableSpan<ColorGeometry4f> r_color,
+                        const GetParamsFn &get_params) const
+  {
     const bool compute_factor = !r_factor.is_empty();
     const bool compute_color = !r_color.is_empty();
 
@@ -274,29 +321,31 @@ class NoiseFunction : public mf::MultiFunction {
         const VArray<float> &w = params.readonly_single_input<float>(0, "W");
         if (compute_factor) {
           mask.foreach_index([&](const int64_t i) {
-            const float position = w[i] * scale[i];
+            const FractalParams p = get_params(i);
+            const float position = w[i] * p.scale;
             r_factor[i] = noise::perlin_fractal_distorted(position,
-                                                          math::clamp(detail[i], 0.0f, 15.0f),
-                                                          math::max(roughness[i], 0.0f),
-                                                          lacunarity[i],
-                                                          offset[i],
-                                                          gain[i],
-                                                          distortion[i],
+                                                          p.detail,
+                                                          p.roughness,
+                                                          p.lacunarity,
+                                                          p.offset,
+                                                          p.gain,
+                                                          p.distortion,
                                                           type_,
                                                           normalize_);
           });
         }
         if (compute_color) {
           mask.foreach_index([&](const int64_t i) {
-            const float position = w[i] * scale[i];
+            const FractalParams p = get_params(i);
+            const float position = w[i] * p.scale;
             const float3 c = noise::perlin_float3_fractal_distorted(
                 position,
-                math::clamp(detail[i], 0.0f, 15.0f),
-                math::max(roughness[i], 0.0f),
-                lacunarity[i],
-                offset[i],
-                gain[i],
-                distortion[i],
+                p.detail,
+                p.roughness,
+                p.lacunarity,
+                p.offset,
+                p.gain,
+                p.distortion,
                 type_,
                 normalize_);
             r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
@@ -308,29 +357,31 @@ class NoiseFunction : public mf::MultiFunction {
         const VArray<float3> &vector = params.readonly_single_input<float3>(0, "Vector");
         if (compute_factor) {
           mask.foreach_index([&](const int64_t i) {
-            const float2 position = float2(vector[i] * scale[i]);
+            const FractalParams p = get_params(i);
+            const float2 position = float2(vector[i] * p.scale);
             r_factor[i] = noise::perlin_fractal_distorted(position,
-                                                          math::clamp(detail[i], 0.0f, 15.0f),
-                                                          math::max(roughness[i], 0.0f),
-                                                          lacunarity[i],
-                                                          offset[i],
-                                                          gain[i],
-                                                          distortion[i],
+                                                          p.detail,
+                                                          p.roughness,
+                                                          p.lacunarity,
+                                                          p.offset,
+                                                          p.gain,
+                                                          p.distortion,
                                                           type_,
                                                           normalize_);
           });
         }
         if (compute_color) {
           mask.foreach_index([&](const int64_t i) {
-            const float2 position = float2(vector[i] * scale[i]);
+            const FractalParams p = get_params(i);
+            const float2 position = float2(vector[i] * p.scale);
             const float3 c = noise::perlin_float3_fractal_distorted(
                 position,
-                math::clamp(detail[i], 0.0f, 15.0f),
-                math::max(roughness[i], 0.0f),
-                lacunarity[i],
-                offset[i],
-                gain[i],
-                distortion[i],
+                p.detail,
+                p.roughness,
+                p.lacunarity,
+                p.offset,
+                p.gain,
+                p.distortion,
                 type_,
                 normalize_);
             r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
@@ -342,29 +393,31 @@ class NoiseFunction : public mf::MultiFunction {
         const VArray<float3> &vector = params.readonly_single_input<float3>(0, "Vector");
         if (compute_factor) {
           mask.foreach_index([&](const int64_t i) {
-            const float3 position = vector[i] * scale[i];
+            const FractalParams p = get_params(i);
+            const float3 position = vector[i] * p.scale;
             r_factor[i] = noise::perlin_fractal_distorted(position,
-                                                          math::clamp(detail[i], 0.0f, 15.0f),
-                                                          math::max(roughness[i], 0.0f),
-                                                          lacunarity[i],
-                                                          offset[i],
-                                                          gain[i],
-                                                          distortion[i],
+                                                          p.detail,
+                                                          p.roughness,
+                                                          p.lacunarity,
+                                                          p.offset,
+                                                          p.gain,
+                                                          p.distortion,
                                                           type_,
                                                           normalize_);
           });
         }
         if (compute_color) {
           mask.foreach_index([&](const int64_t i) {
-            const float3 position = vector[i] * scale[i];
+            const FractalParams p = get_params(i);
+            const float3 position = vector[i] * p.scale;
             const float3 c = noise::perlin_float3_fractal_distorted(
                 position,
-                math::clamp(detail[i], 0.0f, 15.0f),
-                math::max(roughness[i], 0.0f),
-                lacunarity[i],
-                offset[i],
-                gain[i],
-                distortion[i],
+                p.detail,
+                p.roughness,
+                p.lacunarity,
+                p.offset,
+                p.gain,
+                p.distortion,
                 type_,
                 normalize_);
             r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
@@ -377,35 +430,37 @@ class NoiseFunction : public mf::MultiFunction {
         const VArray<float> &w = params.readonly_single_input<float>(1, "W");
         if (compute_factor) {
           mask.foreach_index([&](const int64_t i) {
-            const float3 position_vector = vector[i] * scale[i];
-            const float position_w = w[i] * scale[i];
+            const FractalParams p = get_params(i);
+            const float3 position_vector = vector[i] * p.scale;
+            const float position_w = w[i] * p.scale;
             const float4 position{
                 position_vector[0], position_vector[1], position_vector[2], position_w};
             r_factor[i] = noise::perlin_fractal_distorted(position,
-                                                          math::clamp(detail[i], 0.0f, 15.0f),
-                                                          math::max(roughness[i], 0.0f),
-                                                          lacunarity[i],
-                                                          offset[i],
-                                                          gain[i],
-                                                          distortion[i],
+                                                          p.detail,
+                                                          p.roughness,
+                                                          p.lacunarity,
+                                                          p.offset,
+                                                          p.gain,
+                                                          p.distortion,
                                                           type_,
                                                           normalize_);
           });
         }
         if (compute_color) {
           mask.foreach_index([&](const int64_t i) {
-            const float3 position_vector = vector[i] * scale[i];
-            const float position_w = w[i] * scale[i];
+            const FractalParams p = get_params(i);
+            const float3 position_vector = vector[i] * p.scale;
+            const float position_w = w[i] * p.scale;
             const float4 position{
                 position_vector[0], position_vector[1], position_vector[2], position_w};
             const float3 c = noise::perlin_float3_fractal_distorted(
                 position,
-                math::clamp(detail[i], 0.0f, 15.0f),
-                math::max(roughness[i], 0.0f),
-                lacunarity[i],
-                offset[i],
-                gain[i],
-                distortion[i],
+                p.detail,
+                p.roughness,
+                p.lacunarity,
+                p.offset,
+                p.gain,
+                p.distortion,
                 type_,
                 normalize_);
             r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
@@ -632,6 +632,27 @@ static PyObject *bpy_app_help_text(PyObject * /*self*/, PyObject *args, PyObject
   return result;
 }
 
+PyDoc_STRVAR(
+    /* Wrap. */
+    bpy_app_memory_usage_by_category_doc,
+    ".. staticmethod:: memory_usage_by_category()\n"
+    "\n"
+    "   Return the memory currently allocated by each subsystem.\n"
+    "\n"
+    "   :return: Number of bytes in use, keyed by the category name.\n"
+    "   :rtype: dict[str, int]\n");
+static PyObject *bpy_app_memory_usage_by_category(PyObject * /*self*/)
+{
+  PyObject *result = PyDict_New();
+  for (int i = 0; i < MEM_CATEGORY_NUM; i++) {
+    const eMEMCategory category = eMEMCategory(i);
+    PyObject *value = PyLong_FromSize_t(MEM_get_memory_in_use_by_category(category));
+    PyDict_SetItemString(result, MEM_category_name(category), value);
+    Py_DECREF(value);
+  }
+  return result;
+}
+
 #ifdef __GNUC__
 #  ifdef __clang__
 #    pragma clang diagnostic push
@@ -651,6 +672,10 @@ static PyMethodDef bpy_app_methods[] = {
      (PyCFunction)bpy_app_help_text,
      METH_VARARGS | METH_KEYWORDS | METH_STATIC,
      bpy_app_help_text_doc},
+    {"memory_usage_by_category",
+     (PyCFunction)bpy_app_memory_usage_by_category,
+     METH_NOARGS | METH_STATIC,
+     bpy_app_memory_usage_by_category_doc},
     {nullptr, nullptr, 0, nullptr},
 };
 
@@ -8,6 +8,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <cstddef>
 #include <cstdlib>
@@ -34,6 +35,7 @@
 #include "BLI_string.h"
 #include "BLI_threads.h"
 #include "BLI_time.h"
+#include "BLI_timeit.hh"
 #include "BLI_timecode.h"
 #include "BLI_vector.hh"
 
@@ -54,6 +56,7 @@
 #include "BKE_main.hh"
 #include "BKE_mask.h"
 #include "BKE_modifier.hh"
+#include "BKE_node.hh"
 #include "BKE_node_legacy_types.hh"
 #include "BKE_node_runtime.hh"
 #include "BKE_pointcache.h"
@@ -65,6 +68,7 @@
 
 #include "COM_compositor.hh"
 #include "COM_context.hh"
+#include "COM_profiler.hh"
 #include "COM_render_context.hh"
 
 #include "DEG_depsgraph.hh"
@@ -1292,6 +1296,36 @@ static void render_compositor_stats(void *arg, const char *str)
   re->stats_draw(&i);
 }
 
+/* Log the evaluation time of every node of the compositor node tree that was measured by the
+ * given profiler, slowest first. Times of node groups include the times of their nodes. */
+static void render_compositor_log_node_times(const bNodeTree &node_tree,
+                                             blender::compositor::Profiler &profiler,
+                                             const char *view_name)
+{
+  const blender::Map<bNodeInstanceKey, blender::timeit::Nanoseconds> &node_times =
+      profiler.get_nodes_evaluation_times();
+
+  blender::Vector<std::pair<blender::timeit::Nanoseconds, const bNode *>> sorted_node_times;
+  for (const bNode *node : node_tree.all_nodes()) {
+    const bNodeInstanceKey instance_key = blender::bke::node_instance_key(
+        blender::bke::NODE_INSTANCE_KEY_BASE, &node_tree, node);
+    if (const blender::timeit::Nanoseconds *time = node_times.lookup_ptr(instance_key)) {
+      sorted_node_times.append({*time, node});
+    }
+  }
+  std::sort(sorted_node_times.begin(), sorted_node_times.end(), [](const auto &a, const auto &b) {
+    return a.first > b.first;
+  });
+
+  for (const auto &[time, node] : sorted_node_times) {
+    CLOG_DEBUG(&LOG,
+               "Compositor node \"%s\" (view \"%s\"): %.3f ms",
+               node->name,
+               view_name,
+               std::chrono::duration<double, std::milli>(time).count());
+  }
+}
+
 /* Render compositor nodes, along with any scenes required for them.
  * The result will be output into a compositing render layer in the render result. */
 static void do_render_compositor(Render *re)
@@ -1366,15 +1400,22 @@ static void do_render_compositor(Render *re)
 
         CLOG_STR_INFO(&LOG, "Executing compositor");
         blender::compositor::RenderContext compositor_render_context;
+        /* Measure the evaluation time of nodes when it will be logged, such that the cost of
+         * every node can be inspected for background renders. */
+        const bool use_profiler = CLOG_CHECK(&LOG, CLG_LEVEL_DEBUG);
         LISTBASE_FOREACH (RenderView *, rv, &re->result->views) {
+          blender::compositor::Profiler profiler;
           COM_execute(re,
                       &re->r,
                       re->pipeline_scene_eval,
                       ntree,
                       rv->name,
                       &compositor_render_context,
-                      nullptr,
+                      use_profiler ? &profiler : nullptr,
                       needed_outputs);
+          if (use_profiler) {
+            render_compositor_log_node_times(*ntree, profiler, rv->name);
+          }
         }
         compositor_render_context.save_file_outputs(re->pipeline_scene_eval);
 
@@ -1637,6 +1678,11 @@ static void do_render_full_pipeline(Render *re)
 
   re->stats_draw(&re->i);
 
+  if (G.debug & G_DEBUG_MEMORY) {
+    /* The evaluated scene and render result are still allocated at this point. */
+    MEM_print_memory_categories();
+  }
+
   /* save render result stamp if needed */
   if (re->result != nullptr) {
     /* sequence rendering should have taken care of that already */
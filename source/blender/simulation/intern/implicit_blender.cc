@@ -164,29 +164,21 @@ DO_INLINE void submul_lfvectorS(float (*to)[3], float (*fLongVector)[3], float s
 /* dot product for big vector */
 DO_INLINE float dot_lfvector(float (*fLongVectorA)[3], float (*fLongVectorB)[3], uint verts)
 {
-#  if 0
-  /* TODO: try enabling this and measuring performance. It was previously disabled
-   * due to non-deterministic behavior, but parallel_deterministic_reduce should
-   * give consistent results. */
+  /* The deterministic reduction splits the range the same way regardless of the number of
+   * threads, so the result doesn't change between runs. Below the grain size the sum is computed
+   * in a single pass, in the same order as a plain loop. */
   return blender::threading::parallel_deterministic_reduce(
-      blender::IndexRange(0, verts),
+      blender::IndexRange(verts),
       CLOTH_PARALLEL_LIMIT,
-      0.0,
-      [=](const blender::IndexRange &range, float value) {
+      0.0f,
+      [&](const blender::IndexRange range, const float value) {
         float temp = value;
-        for (const int i : range) {
+        for (const int64_t i : range) {
           temp += dot_v3v3(fLongVectorA[i], fLongVectorB[i]);
         }
         return temp;
       },
       std::plus<>());
-#  else
-  float temp = 0.0;
-  for (uint i = 0; i < verts; i++) {
-    temp += dot_v3v3(fLongVectorA[i], fLongVectorB[i]);
-  }
-  return temp;
-#  endif
 }
 /* `A = B + C` -> for big vector. */
 DO_INLINE void add_lfvector_lfvector(float (*to)[3],
@@ -204,11 +196,12 @@ DO_INLINE void add_lfvector_lfvector(float (*to)[3],
 DO_INLINE void add_lfvector_lfvectorS(
     float (*to)[3], float (*fLongVectorA)[3], float (*fLongVectorB)[3], float bS, uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(verts), CLOTH_PARALLEL_LIMIT, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
+        }
+      });
 }
 /* `A = B * float + C * float` -> for big vector */
 DO_INLINE void add_lfvectorS_lfvectorS(float (*to)[3],
@@ -460,6 +460,11 @@ bool WM_file_recover_last_session(bContext *C,
                                   const bool use_scripts_autoexec_check,
                                   ReportList *reports);
 void WM_file_tag_modified();
+/**
+ * Tag data as changed for auto-save, without marking the file as modified. Used for changes that
+ * don't go through an undo push, like edits from Python or handlers.
+ */
+void WM_file_tag_autosave_outdated(wmWindowManager *wm);
 
 /**
  * \note `scene` (and related `view_layer` and `v3d`) pointers may be NULL,
@@ -175,6 +175,7 @@ static CLG_LogRef LOG = {"blend"};
 void WM_file_tag_modified()
 {
   wmWindowManager *wm = static_cast<wmWindowManager *>(G_MAIN->wm.first);
+  wm->runtime->autosave_is_outdated = true;
   if (wm->file_saved) {
     wm->file_saved = 0;
     /* Notifier that data changed, for save-over warning or header. */
@@ -862,6 +863,8 @@ static void wm_file_read_post(bContext *C,
       else {
         BKE_undosys_stack_clear(wm->undo_stack);
       }
+      /* Undo steps are freed, so they can't be used to detect changes for auto-save anymore. */
+      wm->runtime->autosave_is_outdated = true;
       BKE_undosys_stack_init_from_main(wm->undo_stack, bmain);
       BKE_undosys_stack_init_from_context(wm->undo_stack, C);
     }
@@ -2307,12 +2310,43 @@ static void wm_autosave_location(char filepath[FILE_MAX])
   BLI_path_join(filepath, FILE_MAX, tempdir_base, filename);
 }
 
+void WM_file_tag_autosave_outdated(wmWindowManager *wm)
+{
+  wm->runtime->autosave_is_outdated = true;
+}
+
+/**
+ * Whether the data may have changed since the last auto-save. Changes are detected through undo
+ * pushes (tagging the file as modified), undo/redo (changing the active undo step), file reads and
+ * depsgraph updates (for changes without an undo push, see #WM_file_tag_autosave_outdated). When
+ * none of these happened, writing the auto-save again can be skipped.
+ */
+static bool wm_autosave_is_outdated(const wmWindowManager *wm)
+{
+  if (wm->runtime->autosave_is_outdated) {
+    return true;
+  }
+  /* Without an undo stack, the undo step can't be used to detect changes. */
+  if (wm->undo_stack == nullptr || wm->undo_stack->step_active == nullptr) {
+    return true;
+  }
+  return wm->undo_stack->step_active != wm->runtime->autosave_undo_step;
+}
+
 static bool wm_autosave_write_try(Main *bmain, wmWindowManager *wm)
 {
   char filepath[FILE_MAX];
 
   wm_autosave_location(filepath);
 
+  if (!wm_autosave_is_outdated(wm) && BLI_exists(filepath)) {
+    /* Nothing changed since the last auto-save, which is still there. */
+    wm_autosave_timer_end(wm);
+    wm_autosave_timer_begin(wm);
+    wm->autosave_scheduled = false;
+    return true;
+  }
+
   /* Technically, we could always just save here, but that would cause performance regressions
    * compared to when the #MemFile undo step was used for saving undo-steps. So for now just skip
    * auto-save when we are in a mode where auto-save wouldn't have worked previously anyway. This
@@ -2346,7 +2380,10 @@ void WM_autosave_write(wmWindowManager *wm, Main *bmain)
 
   /* Error reporting into console. */
   BlendFileWriteParams params{};
-  BLO_write_file(bmain, filepath, fileflags, &params, nullptr);
+  if (BLO_write_file(bmain, filepath, fileflags, &params, nullptr)) {
+    wm->runtime->autosave_is_outdated = false;
+    wm->runtime->autosave_undo_step = wm->undo_stack ? wm->undo_stack->step_active : nullptr;
+  }
 
   /* Restart auto-save timer. */
   wm_autosave_timer_end(wm);
@@ -455,6 +455,11 @@ void WM_exit_ex(bContext *C, const bool do_python_exit, const bool do_user_exit_
    * Saving #BLENDER_QUIT_FILE is also not likely to be desired either. */
   BLI_assert(G.background ? (do_user_exit_actions == false) : true);
 
+  if (G.debug & G_DEBUG_MEMORY) {
+    /* Print before any data is freed, to show what the session used. */
+    MEM_print_memory_categories();
+  }
+
   /* First wrap up running stuff, we assume only the active WM is running. */
   /* Modal handlers are on window level freed, others too? */
   /* NOTE: same code copied in `wm_files.cc`. */
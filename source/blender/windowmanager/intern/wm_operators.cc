@@ -3815,6 +3815,7 @@ static void WM_OT_redraw_timer(wmOperatorType *ot)
 static wmOperatorStatus memory_statistics_exec(bContext * /*C*/, wmOperator * /*op*/)
 {
   MEM_printmemlist_stats();
+  MEM_print_memory_categories();
   return OPERATOR_FINISHED;
 }
 
@@ -1439,10 +1439,12 @@ static int arg_handle_debug_mode_cycles(int /*argc*/, const char ** /*argv*/, vo
 
 static const char arg_handle_debug_mode_memory_set_doc[] =
     "\n\t"
-    "Enable fully guarded memory allocation and debugging.";
+    "Enable fully guarded memory allocation and debugging.\n"
+    "\tPrint the memory usage by category after rendering a frame and on exit.";
 static int arg_handle_debug_mode_memory_set(int /*argc*/, const char ** /*argv*/, void * /*data*/)
 {
   MEM_set_memory_debug();
+  G.debug |= G_DEBUG_MEMORY;
   return 0;
 }
 
@@ -5,7 +5,7 @@
 import api
 
 
-def _run(args):
+def _measure_evaluation_time():
     import bpy
     import time
 
@@ -42,6 +42,55 @@ def _run(args):
     return result
 
 
+def _run(args):
+    return _measure_evaluation_time()
+
+
+def _run_many_cheap_nodes(args):
+    import bpy
+
+    # Build a node tree with many math nodes that only process single values. Evaluating it is
+    # dominated by the overhead of scheduling the nodes.
+    tree = bpy.data.node_groups.new("Many Cheap Nodes", 'GeometryNodeTree')
+    tree.interface.new_socket("Geometry", in_out='INPUT', socket_type='NodeSocketGeometry')
+    tree.interface.new_socket("Geometry", in_out='OUTPUT', socket_type='NodeSocketGeometry')
+    group_input = tree.nodes.new('NodeGroupInput')
+    group_output = tree.nodes.new('NodeGroupOutput')
+
+    total = None
+    for chain_index in range(args['chains_num']):
+        value = tree.nodes.new('ShaderNodeValue')
+        value.outputs[0].default_value = chain_index
+        socket = value.outputs[0]
+        for _ in range(args['chain_length']):
+            math = tree.nodes.new('ShaderNodeMath')
+            math.operation = 'MULTIPLY_ADD'
+            tree.links.new(socket, math.inputs[0])
+            math.inputs[1].default_value = 0.5
+            math.inputs[2].default_value = 1.0
+            socket = math.outputs[0]
+        if total is None:
+            total = socket
+        else:
+            add = tree.nodes.new('ShaderNodeMath')
+            tree.links.new(total, add.inputs[0])
+            tree.links.new(socket, add.inputs[1])
+            total = add.outputs[0]
+
+    transform = tree.nodes.new('GeometryNodeTransform')
+    tree.links.new(group_input.outputs[0], transform.inputs['Geometry'])
+    tree.links.new(total, transform.inputs['Scale'])
+    tree.links.new(transform.outputs['Geometry'], group_output.inputs[0])
+
+    mesh = bpy.data.meshes.new("Mesh")
+    ob = bpy.data.objects.new("Object", mesh)
+    bpy.context.scene.collection.objects.link(ob)
+    modifier = ob.modifiers.new("Nodes", 'NODES')
+    modifier.node_group = tree
+
+    return _measure_evaluation_time()
+
+
 class GeometryNodesTest(api.Test):
     def __init__(self, filepath):
         self.filepath = filepath
@@ -60,6 +109,28 @@ class GeometryNodesTest(api.Test):
         return result
 
 
+class GeometryNodesManyCheapNodesTest(api.Test):
+    def __init__(self, chains_num, chain_length):
+        self.chains_num = chains_num
+        self.chain_length = chain_length
+
+    def name(self):
+        return f"many_cheap_nodes_{self.chains_num}x{self.chain_length}"
+
+    def category(self):
+        return "geometry_nodes"
+
+    def run(self, env, device_id):
+        args = {'chains_num': self.chains_num, 'chain_length': self.chain_length}
+
+        result, _ = env.run_in_blender(_run_many_cheap_nodes, args, ['--factory-startup'])
+
+        return result
+
+
 def generate(env):
     filepaths = env.find_blend_files('geometry_nodes/*')
-    return [GeometryNodesTest(filepath) for filepath in filepaths]
+    tests = [GeometryNodesTest(filepath) for filepath in filepaths]
+    # Wide and deep trees of nodes that are cheap to execute.
+    tests += [GeometryNodesManyCheapNodesTest(1000, 5), GeometryNodesManyCheapNodesTest(10, 500)]
+    return tests
@@ -0,0 +1,99 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+from .undo import SCENE_SIZES, SyntheticSceneTest, prepare_scene
+
+
+def _run_relations_rebuild(args: dict):
+    import bpy
+    import time
+
+    prepare_scene(args['objects_num'], args['grid_size'])
+    depsgraph = bpy.context.evaluated_depsgraph_get()
+
+    rebuilds_num = 10
+
+    start_time = time.time()
+    for _ in range(rebuilds_num):
+        depsgraph.debug_tag_update()
+        depsgraph.update()
+    elapsed_time = time.time() - start_time
+
+    return {'time': elapsed_time / rebuilds_num}
+
+
+def _run_override_resync(args: dict):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    prepare_scene(args['objects_num'], args['grid_size'])
+
+    # Put all objects into a collection that can be linked and overridden as one hierarchy.
+    scene = bpy.context.scene
+    collection = bpy.data.collections.new("Objects")
+    scene.collection.children.link(collection)
+    for ob in list(scene.collection.objects):
+        collection.objects.link(ob)
+        scene.collection.objects.unlink(ob)
+
+    with tempfile.TemporaryDirectory() as tempdir:
+        library_filepath = os.path.join(tempdir, "library.blend")
+        bpy.ops.wm.save_as_mainfile(filepath=library_filepath, copy=True)
+
+        bpy.ops.wm.read_homefile(use_empty=True, use_factory_startup=True)
+        scene = bpy.context.scene
+        view_layer = bpy.context.view_layer
+        with bpy.data.libraries.load(library_filepath, link=True) as (data_from, data_to):
+            data_to.collections = ["Objects"]
+        override_collection = data_to.collections[0].override_hierarchy_create(scene, view_layer)
+
+        resyncs_num = 5
+
+        start_time = time.time()
+        for _ in range(resyncs_num):
+            override_collection.override_library.resync(
+                scene, view_layer=view_layer, do_whole_hierarchy=True)
+        elapsed_time = time.time() - start_time
+
+    return {'time': elapsed_time / resyncs_num}
+
+
+def _run_export_import(args: dict):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    prepare_scene(args['objects_num'], args['grid_size'])
+
+    export_operator = getattr(bpy.ops.wm, args['file_format'] + "_export")
+    import_operator = getattr(bpy.ops.wm, args['file_format'] + "_import")
+
+    with tempfile.TemporaryDirectory() as tempdir:
+        filepath = os.path.join(tempdir, "test." + args['file_format'])
+
+        start_time = time.time()
+        export_operator(filepath=filepath)
+        export_time = time.time() - start_time
+
+        bpy.ops.wm.read_homefile(use_empty=True, use_factory_startup=True)
+
+        start_time = time.time()
+        import_operator(filepath=filepath)
+        import_time = time.time() - start_time
+
+    return {'time': export_time + import_time}
+
+
+def generate(env):
+    tests = []
+    for objects_num, grid_size in SCENE_SIZES:
+        tests.append(SyntheticSceneTest(_run_relations_rebuild, "relations_rebuild", objects_num, grid_size))
+        tests.append(SyntheticSceneTest(_run_override_resync, "override_resync", objects_num, grid_size))
+        for file_format in ('obj', 'ply'):
+            tests.append(SyntheticSceneTest(
+                _run_export_import, file_format + "_export_import", objects_num, grid_size, file_format=file_format))
+    return tests
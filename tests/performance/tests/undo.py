@@ -0,0 +1,139 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+# Scale both with the number of objects and with the amount of geometry per object.
+SCENE_SIZES = ((1, 1000), (100, 100), (1000, 10))
+
+
+def prepare_scene(objects_num: int, grid_size: int):
+    """
+    Create a synthetic scene with ``objects_num`` objects, each using its own grid mesh of
+    ``grid_size`` by ``grid_size`` vertices.
+    """
+    import bpy
+
+    bpy.ops.wm.read_homefile(use_empty=True, use_factory_startup=True)
+    scene = bpy.context.scene
+
+    bpy.ops.mesh.primitive_grid_add(x_subdivisions=grid_size, y_subdivisions=grid_size, size=2.0)
+    ob_base = bpy.context.object
+    for i in range(1, objects_num):
+        ob = ob_base.copy()
+        ob.data = ob_base.data.copy()
+        ob.location = ((i % 32) * 2.5, (i // 32) * 2.5, 0.0)
+        scene.collection.objects.link(ob)
+
+    bpy.context.view_layer.update()
+
+
+def _run_undo(args: dict):
+    import bpy
+    import time
+
+    prepare_scene(args['objects_num'], args['grid_size'])
+    scene = bpy.context.scene
+
+    # Create an undo stack explicitly. This isn't created by default in background mode.
+    bpy.ops.ed.undo_push()
+
+    steps_num = 10
+
+    start_time = time.time()
+    for i in range(steps_num):
+        scene.frame_current = i + 2
+        bpy.ops.ed.undo_push(message="Step")
+    push_time = (time.time() - start_time) / steps_num
+
+    start_time = time.time()
+    for _ in range(steps_num):
+        bpy.ops.ed.undo()
+    undo_time = (time.time() - start_time) / steps_num
+
+    start_time = time.time()
+    for _ in range(steps_num):
+        bpy.ops.ed.redo()
+    redo_time = (time.time() - start_time) / steps_num
+
+    return {'time': push_time + undo_time + redo_time}
+
+
+def _run_edit_mode_toggle(args: dict):
+    import bpy
+    import time
+
+    prepare_scene(args['objects_num'], args['grid_size'])
+
+    # Toggle all objects at once, so that the time scales with the number of objects.
+    for ob in bpy.context.scene.objects:
+        ob.select_set(True)
+
+    toggles_num = 10
+
+    start_time = time.time()
+    for _ in range(toggles_num):
+        bpy.ops.object.mode_set(mode='EDIT')
+        bpy.ops.object.mode_set(mode='OBJECT')
+    elapsed_time = time.time() - start_time
+
+    return {'time': elapsed_time / toggles_num}
+
+
+def _run_blend_save(args: dict):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    prepare_scene(args['objects_num'], args['grid_size'])
+
+    with tempfile.TemporaryDirectory() as tempdir:
+        filepath = os.path.join(tempdir, "test.blend")
+
+        # Save once so the first measured save does not include one-time initialization.
+        bpy.ops.wm.save_as_mainfile(filepath=filepath, copy=True)
+
+        saves_num = 5
+
+        start_time = time.time()
+        for _ in range(saves_num):
+            bpy.ops.wm.save_as_mainfile(filepath=filepath, copy=True)
+        elapsed_time = time.time() - start_time
+
+    return {'time': elapsed_time / saves_num}
+
+
+class SyntheticSceneTest(api.Test):
+    def __init__(self, function, category: str, objects_num: int, grid_size: int, **extra_args):
+        self.function = function
+        self.category_name = category
+        self.objects_num = objects_num
+        self.grid_size = grid_size
+        self.extra_args = extra_args
+
+    def name(self):
+        return "{}_objects_{}x{}_grid".format(self.objects_num, self.grid_size, self.grid_size)
+
+    def category(self):
+        return self.category_name
+
+    def run(self, env, _device_id):
+        args = {
+            'objects_num': self.objects_num,
+            'grid_size': self.grid_size,
+            **self.extra_args,
+        }
+        result, _ = env.run_in_blender(self.function, args)
+        return result
+
+
+def generate(env):
+    tests = []
+    for objects_num, grid_size in SCENE_SIZES:
+        tests.append(SyntheticSceneTest(_run_undo, "undo", objects_num, grid_size))
+        tests.append(SyntheticSceneTest(_run_edit_mode_toggle, "edit_mode_toggle", objects_num, grid_size))
+        tests.append(SyntheticSceneTest(_run_blend_save, "blend_save", objects_num, grid_size))
+    return tests